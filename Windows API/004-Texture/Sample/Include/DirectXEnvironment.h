@@ -512,17 +512,18 @@ namespace MyGame {
 		void Direct2DRneder() {
 			if (D2DDeviceContext.Get()) {
 				D2DDeviceContext->BeginDraw();
-				const String info = Info->ToString();
-				if (!info.IsNullOrEmpty()) {
-					LPCTSTR str = info.c_str();
+				// ˸mT|, uդ@; fpsString uΦۤvŶ, CVΰtmO
+				if (infoString.IsNullOrEmpty()) {
+					infoString = Info->ToString();
+				}
+				if (!infoString.IsNullOrEmpty()) {
 					D2D1_RECT_F layoutRect = { 0, 0, 300, 300 };
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(infoString.c_str(), (UINT32)infoString.Length(), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 
 				if (!(fpsString.IsNullOrEmpty())) {
-					LPCTSTR str = fpsString.c_str();
 					D2D1_RECT_F layoutRect = { 0, (FLOAT)SwapChainDesc.Height - 30, 300, (FLOAT)SwapChainDesc.Height };
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), FPSFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(fpsString.c_str(), (UINT32)fpsString.Length(), FPSFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 				D2DDeviceContext->EndDraw();
 			}
@@ -967,6 +968,7 @@ namespace MyGame {
 		LARGE_INTEGER time;
 		LARGE_INTEGER freq;
 		String fpsString;
+		String infoString;
 		Matrix world;
 		Matrix view;
 		Matrix projection;
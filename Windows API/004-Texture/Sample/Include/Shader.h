@@ -1,51 +1,21 @@
 #pragma once
 
+#include "MappedFile.h"
+
 class ShaderCode {
 
 public:
 
-	byte* Code;
-	size_t Length;
-
-	~ShaderCode() {
-		if (Code != nullptr) {
-			delete[] Code;
-			Code = nullptr;
-		}
-	}
+	const byte* Code = nullptr;
+	size_t Length = 0;
 
 	bool IsOK = false;
 
+	// ɮ׹O, t~ƻs@ heap
 	void LoadFromFile(String file) {
-		FILE* stream;
-		errno_t err = _tfopen_s(&stream, file, TEXT("rb"));
-		if (err == 0) {
-			
-			int result = fseek(stream, 0, SEEK_END);
-
-			if (result != 0) {
-				fclose(stream);
-				IsOK = false;
-				return;
-			}
-
-			size_t file_len = ftell(stream);
-			rewind(stream);
-			Length = file_len;
-			Code = new byte[file_len];
-			file_len = fread(Code, 1, file_len, stream);
-			if (Length != file_len) {
-				fclose(stream);
-				return;
-			}
-
-			fclose(stream);
-
-
-			IsOK = true;
-			return;
-		}
-		IsOK = false;
+		IsOK = mapping.Open(file);
+		Code = IsOK ? mapping.Data() : nullptr;
+		Length = IsOK ? mapping.Size() : 0;
 	}
 
 	operator LPCVOID() const {
@@ -57,7 +27,8 @@ public:
 	}
 
 private:
-	
+	DirectX::MappedFile mapping;
+
 	void OutputShaderErrorMessage(ID3D10Blob* message, HWND hWnd) {
 		size_t size = message->GetBufferSize();
 		const char* msg = (char*)(message->GetBufferPointer());
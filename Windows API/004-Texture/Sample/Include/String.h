@@ -3,78 +3,166 @@
 // https://en.wikipedia.org/wiki/C%2B%2B11#Rvalue_references_and_move_constructors
 // https://msdn.microsoft.com/zh-tw/library/dd293665.aspx
 
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
 #define BUFFER_MAX_CCH 0xFFFF
 
+// b Windows H~S TCHAR,  char N, ̿ Windows { (Ҧp Headless) ]ϥ
+#ifndef _WIN32
+typedef char TCHAR;
+typedef const char* LPCTSTR;
+typedef char* LPTSTR;
+#ifndef TEXT
+#define TEXT(quote) quote
+#endif
+#endif
+
 namespace {
 
+	struct StringTraits {
+		static int Compare(LPCTSTR a, LPCTSTR b) {
+#ifdef _WIN32
+			return _tcscmp(a, b);
+#else
+			return strcmp(a, b);
+#endif
+		}
+
+		// gi buffer (t 0 ̦h cch Ӧr), 񤣤UNI_
+		// ^ǧ㵲G (t 0), 榡~^ -1
+		static int VFormat(TCHAR* buffer, size_t cch, LPCTSTR format, va_list args) {
+#ifdef _WIN32
+			va_list copy;
+			va_copy(copy, args);
+			int n = cch ? _vsntprintf_s(buffer, cch, _TRUNCATE, format, args) : -1;
+			if (n < 0) n = _vsctprintf(format, copy);
+			va_end(copy);
+			return n;
+#else
+			return vsnprintf(buffer, cch, format, args);
+#endif
+		}
+	};
+
+	// ursb̭, r~tm; s Format ΫwɪuΤwŶ, ҥHCVsr|AtmO
 	class String
 	{
-		unique_ptr<TCHAR>	string;
+		static const size_t InlineCapacity = 31;
+
+		TCHAR*				string;		// V inline  heap
 		size_t				length;
+		size_t				capacity;	// t 0
+		TCHAR				inline_buffer[InlineCapacity + 1];
 
-		void object_copy(const String& other)
+		bool is_inline() const noexcept
 		{
-			string.reset(new TCHAR[other.length + 1]);
-			length = other.length;
-			StringCchCopy(string.get(), other.length + 1, other.string.get());
+			return string == inline_buffer;
+		}
+
+		void release() noexcept
+		{
+			if (!is_inline()) delete[] string;
+			string = inline_buffer;
+			capacity = InlineCapacity;
+		}
+
+		// Odܤ count ӦrŶ, keep  true ɫOd쥻e
+		void reserve(size_t count, bool keep)
+		{
+			if (count <= capacity) return;
+			size_t grow = capacity * 2;
+			size_t size = count > grow ? count : grow;
+			TCHAR* buf = new TCHAR[size + 1];
+			if (keep) memcpy(buf, string, (length + 1) * sizeof(TCHAR));
+			else buf[0] = TEXT('\0');
+			if (!is_inline()) delete[] string;
+			string = buf;
+			capacity = size;
+		}
+
+		void assign(LPCTSTR s, size_t count)
+		{
+			reserve(count, false);
+			memmove(string, s, count * sizeof(TCHAR));
+			length = count;
+			string[length] = TEXT('\0');
 		}
 
 		void object_move(String&& other) noexcept
 		{
-			string.reset(other.string.release());
+			release();
+			if (other.is_inline()) {
+				memcpy(inline_buffer, other.inline_buffer, (other.length + 1) * sizeof(TCHAR));
+			} else {
+				string = other.string;
+				capacity = other.capacity;
+				other.string = other.inline_buffer;
+				other.capacity = InlineCapacity;
+			}
 			length = other.length;
+			other.length = 0;
+			other.string[0] = TEXT('\0');
 		}
 
 	public:
 
-		~String() = default;
+		~String()
+		{
+			release();
+		}
 
-		String() = default;
+		String() noexcept
+			: string(inline_buffer), length(0), capacity(InlineCapacity)
+		{
+			inline_buffer[0] = TEXT('\0');
+		}
 
 		// copy constructor
 		String(const String& other)
+			: String()
 		{
-			//OutputDebug(TEXT("copy constructor %p %s\n"), this, other.c_str());
-			object_copy(other);
+			assign(other.string, other.length);
 		}
 
 		// move constructor
 		String(String&& other) noexcept
+			: String()
 		{
-			//OutputDebug(TEXT("move constructor %p %s %p\n"), this, other.c_str(), &other);
 			object_move(forward<String>(other));
 		}
 
 		// format constructor
 		template<typename... Arguments>
 		String(LPCTSTR format, const Arguments&... args)
+			: String()
 		{
 			Format(format, args...);
-			//OutputDebug(TEXT("format constructor %p %s\n"), this, string.get());
 		}
 
 		String(size_t length)
+			: String()
 		{
-			//OutputDebug(TEXT("custom constructor %p %u\n"), this, length);
-			string.reset(new TCHAR[length + 1]);
+			reserve(length, false);
 			this->length = length;
-			string.get()[length] = TEXT('\0');
+			string[length] = TEXT('\0');
 		}
 
 		String operator+ (const String& other) const
 		{
-			String ret(length + other.length);
-			if (length) StringCchCopy(ret.string.get(), length + 1, string.get());
-			if (other.length) StringCchCopy(ret.string.get() + length, other.length + 1, other.string.get());
+			String ret;
+			ret.reserve(length + other.length, false);
+			ret.assign(string, length);
+			ret.Append(other);
 			return ret;
 		}
 
 		String& operator=(const String& other)
 		{
-			//OutputDebug(TEXT("assignment operator %p=%p %s=%s\n"), this, &other, c_str(), other.c_str());
 			if (this != &other)
 			{
-				object_copy(other);
+				assign(other.string, other.length);
 			}
 			return (*this);
 		}
@@ -96,44 +184,46 @@ namespace {
 
 		void resize(size_t length)
 		{
-			TCHAR* buf = new TCHAR[length + 1];
-			size_t i;
-			for (i = 0; i < this->length && i < length; i++)
-			{
-				buf[i] = string.get()[i];
-			}
-			buf[i] = TEXT('\0');
-			this->length = i;
-			string.reset(buf);
+			reserve(length, true);
+			if (length < this->length) this->length = length;
+			string[this->length] = TEXT('\0');
 		}
 
 		void Append(const String& other)
 		{
-			String ret(length + other.length);
-			StringCchCopy(ret.string.get(), length + 1, string.get());
-			StringCchCopy(ret.string.get() + length, other.length + 1, other.string.get());
-			*this = ret;
+			Append(other.string, other.length);
 		}
 
-		bool operator<(const String& other)
+		void Append(LPCTSTR s, size_t count)
 		{
-			if (StrCmp(c_str(), other.c_str()) < 0) return true;
-			else return false;
+			// s iVۤve, Xjn۷h
+			bool self = s >= string && s <= string + length;
+			size_t offset = self ? (size_t)(s - string) : 0;
+			reserve(length + count, true);
+			if (self) s = string + offset;
+			memmove(string + length, s, count * sizeof(TCHAR));
+			length += count;
+			string[length] = TEXT('\0');
+		}
+
+		bool operator<(const String& other) const
+		{
+			return StringTraits::Compare(c_str(), other.c_str()) < 0;
 		}
 
 		operator LPCTSTR() const
 		{
-			return reinterpret_cast<LPCTSTR>(string.get());
+			return string;
 		}
 
 		operator LPTSTR()
 		{
-			return reinterpret_cast<LPTSTR>(string.get());
+			return string;
 		}
 
 		LPCTSTR c_str() const
 		{
-			return reinterpret_cast<LPCTSTR>(string.get());
+			return string;
 		}
 
 		size_t Length() const noexcept
@@ -141,44 +231,68 @@ namespace {
 			return length;
 		}
 
+		size_t Capacity() const noexcept
+		{
+			return capacity;
+		}
+
 		bool IsNullOrEmpty() const {
 			return length == 0;
 		}
 
+		// gi{Ŷ, 񤣤U~XjAg@; ѼƤVۤve
 		void Format(LPCTSTR format, ...)
 		{
-			size_t remainSize;
-			size_t formatSize;
-			TCHAR formatString[BUFFER_MAX_CCH];
-
 			va_list argptr;
 			va_start(argptr, format);
-			StringCchVPrintfEx(formatString, BUFFER_MAX_CCH, NULL,
-				&remainSize, STRSAFE_FILL_BEHIND_NULL,
-				format, argptr);
+			VFormat(format, argptr);
 			va_end(argptr);
+		}
 
-			formatSize = BUFFER_MAX_CCH - remainSize + 1;
-			string.reset(new TCHAR[formatSize]);
-			StringCchCopy(string.get(), formatSize, formatString);
-			StringCchLength(string.get(), formatSize, &length);
+		void VFormat(LPCTSTR format, va_list args)
+		{
+			va_list retry;
+			va_copy(retry, args);
+			int n = StringTraits::VFormat(string, capacity + 1, format, args);
+			if (n > (int)capacity) {
+				reserve((size_t)n, false);
+				n = StringTraits::VFormat(string, capacity + 1, format, retry);
+			}
+			va_end(retry);
+			length = n < 0 ? 0 : (size_t)n;
+			string[length] = TEXT('\0');
+		}
+
+		// 榡ƨIsݪwİ, tmO; 񤣤UNI_, ^ǼgJ
+		static size_t FormatTo(TCHAR* buffer, size_t cch, LPCTSTR format, ...)
+		{
+			if (cch == 0) return 0;
+			va_list argptr;
+			va_start(argptr, format);
+			int n = StringTraits::VFormat(buffer, cch, format, argptr);
+			va_end(argptr);
+			size_t written = n < 0 ? 0 : ((size_t)n < cch ? (size_t)n : cch - 1);
+			buffer[written] = TEXT('\0');
+			return written;
 		}
 
 		String Left(size_t count) const
 		{
-			String ret(count);
-			StringCchCopy(ret.string.get(), (count < length ? count : length) + 1, string.get());
+			String ret;
+			ret.assign(string, count < length ? count : length);
 			return ret;
 		}
 
+#ifdef _WIN32
 		int LoadString(UINT ID)
 		{
-			TCHAR buffer[BUFFER_MAX_CCH];
-			int len = ::LoadString(GetModuleHandle(NULL), ID, buffer, BUFFER_MAX_CCH);
-			string.reset(new TCHAR[len + 1]);
-			StringCchCopy(string.get(), len + 1, buffer);
+			// cch  0 ɦ^ǫV귽Ū, ݭnȦswİ
+			LPCTSTR resource = nullptr;
+			int len = ::LoadString(GetModuleHandle(NULL), ID, (LPTSTR)&resource, 0);
+			assign(resource ? resource : TEXT(""), len > 0 ? (size_t)len : 0);
 			return len;
 		}
+#endif
 
 	};
 
@@ -189,15 +303,13 @@ namespace {
 		TCHAR outString[BUFFER_MAX_CCH];
 		va_list argptr;
 		va_start(argptr, format);
-		StringCchVPrintf(outString, BUFFER_MAX_CCH, format, argptr);
+		StringTraits::VFormat(outString, BUFFER_MAX_CCH, format, argptr);
 		va_end(argptr);
+#ifdef _WIN32
 		OutputDebugString(outString);
+#else
+		fputs(outString, stderr);
+#endif
 #endif
-	}
-
-	void OutputDebug()
-	{
-		OutputDebugString(TEXT("Hello world!\n"));
 	}
 }
-
@@ -67,6 +67,11 @@ namespace DirectX
         void __cdecl Draw(_In_ IEffect* effect, _In_ ID3D11InputLayout* inputLayout, bool alpha = false, bool wireframe = false,
                           _In_opt_ std::function<void __cdecl()> setCustomState = nullptr) const;
 
+        // Draw many copies of the primitive in a single call. The caller binds per-instance data (IA slot 1 or
+        // a structured buffer) and supplies an effect or setCustomState shader that reads it.
+        void __cdecl DrawInstanced(_In_ IEffect* effect, _In_ ID3D11InputLayout* inputLayout, uint32_t instanceCount, bool alpha = false, bool wireframe = false,
+                                   uint32_t startInstanceLocation = 0, _In_opt_ std::function<void __cdecl()> setCustomState = nullptr) const;
+
        // Create input layout for drawing with a custom effect.
         void __cdecl CreateInputLayout(_In_ IEffect* effect, _Outptr_ ID3D11InputLayout** inputLayout) const;
 
@@ -0,0 +1,162 @@
+//--------------------------------------------------------------------------------------
+// File: MappedFile.h
+//
+// Read-only memory-mapped view of a whole file. The data is read in place by the OS
+// page cache instead of being copied into a heap buffer.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace DirectX
+{
+    class MappedFile
+    {
+    public:
+        MappedFile() throw() :
+            mData(nullptr),
+            mSize(0)
+        #ifdef _WIN32
+            , mFile(INVALID_HANDLE_VALUE),
+            mMapping(nullptr)
+        #endif
+        {
+        }
+
+        MappedFile(MappedFile const&) = delete;
+        MappedFile& operator= (MappedFile const&) = delete;
+
+        ~MappedFile()
+        {
+            Close();
+        }
+
+    #ifdef _WIN32
+        // On failure GetLastError() holds the reason.
+        bool Open(_In_z_ wchar_t const* fileName)
+        {
+            Close();
+
+        #if (_WIN32_WINNT >= _WIN32_WINNT_WIN8)
+            mFile = CreateFile2(fileName, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr);
+        #else
+            mFile = CreateFileW(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        #endif
+            if (mFile == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(mFile, &fileSize))
+                return Fail();
+
+            // Match BinaryReader::ReadEntireFile, which rejects files over 4GB.
+            if (fileSize.HighPart > 0)
+            {
+                SetLastError(ERROR_FILE_TOO_LARGE);
+                return Fail();
+            }
+
+            // Empty files cannot be mapped, but are still valid.
+            mSize = fileSize.LowPart;
+            if (mSize == 0)
+                return true;
+
+            mMapping = CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mMapping)
+                return Fail();
+
+            mData = static_cast<uint8_t const*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+            if (!mData)
+                return Fail();
+
+            return true;
+        }
+    #else
+        // On failure errno holds the reason.
+        bool Open(char const* fileName)
+        {
+            Close();
+
+            int fd = open(fileName, O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat info;
+            if (fstat(fd, &info) != 0)
+            {
+                close(fd);
+                return false;
+            }
+
+            // Empty files cannot be mapped, but are still valid.
+            mSize = static_cast<size_t>(info.st_size);
+            if (mSize > 0)
+            {
+                void* p = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    mSize = 0;
+                    close(fd);
+                    return false;
+                }
+                mData = static_cast<uint8_t const*>(p);
+            }
+
+            // The mapping stays valid after the descriptor is closed.
+            close(fd);
+            return true;
+        }
+    #endif
+
+        void Close() throw()
+        {
+        #ifdef _WIN32
+            if (mData)
+                UnmapViewOfFile(mData);
+            if (mMapping)
+                CloseHandle(mMapping);
+            if (mFile != INVALID_HANDLE_VALUE)
+                CloseHandle(mFile);
+            mMapping = nullptr;
+            mFile = INVALID_HANDLE_VALUE;
+        #else
+            if (mData)
+                munmap(const_cast<uint8_t*>(mData), mSize);
+        #endif
+            mData = nullptr;
+            mSize = 0;
+        }
+
+        uint8_t const* Data() const throw() { return mData; }
+        size_t Size() const throw() { return mSize; }
+
+    private:
+    #ifdef _WIN32
+        bool Fail() throw()
+        {
+            DWORD error = GetLastError();
+            Close();
+            SetLastError(error);
+            return false;
+        }
+    #endif
+
+        uint8_t const* mData;
+        size_t mSize;
+
+    #ifdef _WIN32
+        HANDLE mFile;
+        HANDLE mMapping;
+    #endif
+    };
+}
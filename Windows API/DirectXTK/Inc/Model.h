@@ -137,5 +137,8 @@ namespace DirectX
 
     private:
         std::set<IEffect*>  mEffectCache;
+
+        // Meshes that survived culling in the current Draw; kept so Draw does not allocate
+        mutable std::vector<ModelMesh const*> mVisible;
     };
 }
\ No newline at end of file
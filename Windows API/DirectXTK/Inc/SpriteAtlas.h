@@ -0,0 +1,61 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteAtlas.h
+//
+// Copies many small textures into one large texture at runtime. When a SpriteBatch
+// is given an atlas, sprites drawn with any texture in it are redirected to the
+// atlas, so a UI made of many small textures needs far fewer draws.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#if defined(_XBOX_ONE) && defined(_TITLE)
+#include <d3d11_x.h>
+#else
+#include <d3d11_1.h>
+#endif
+
+#include <memory>
+
+
+namespace DirectX
+{
+    class SpriteAtlas
+    {
+    public:
+        // padding texels around each entry repeat its edge, so filtering never picks up a neighbour.
+        SpriteAtlas(_In_ ID3D11DeviceContext* deviceContext, UINT width, UINT height, DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM, UINT padding = 1);
+        SpriteAtlas(SpriteAtlas&& moveFrom) throw();
+        SpriteAtlas& operator= (SpriteAtlas&& moveFrom) throw();
+
+        SpriteAtlas(SpriteAtlas const&) = delete;
+        SpriteAtlas& operator= (SpriteAtlas const&) = delete;
+
+        virtual ~SpriteAtlas();
+
+        // Copies a single-mip Texture2D view into the atlas. Returns false if the view exposes more
+        // than one mip (the atlas has no mip chain), the format differs from the atlas, or it does
+        // not fit even after Defragment; draws then use the texture as is.
+        // The atlas holds a reference to the texture until Remove.
+        bool __cdecl Add(_In_ ID3D11ShaderResourceView* texture);
+        void __cdecl Remove(_In_ ID3D11ShaderResourceView* texture);
+        bool __cdecl Contains(_In_ ID3D11ShaderResourceView* texture) const;
+
+        // Packs the remaining entries again to reclaim space freed by Remove. This copies into a
+        // new atlas texture; sprites already queued keep drawing from the old one.
+        bool __cdecl Defragment();
+
+        // Where texture lives in the atlas. atlasTexture is not AddRef'd. Returns false if it was never added.
+        bool __cdecl Find(_In_ ID3D11ShaderResourceView* texture, _Out_ ID3D11ShaderResourceView** atlasTexture, _Out_ RECT* rectangle) const;
+
+        ID3D11ShaderResourceView* __cdecl GetTexture() const;
+
+        // Fraction of the atlas covered by entries and their padding.
+        float __cdecl GetOccupancy() const;
+
+    private:
+        // Private implementation.
+        class Impl;
+
+        std::unique_ptr<Impl> pImpl;
+    };
+}
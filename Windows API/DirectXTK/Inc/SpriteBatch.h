@@ -0,0 +1,174 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteBatch.h
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248929
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#if defined(_XBOX_ONE) && defined(_TITLE)
+#include <d3d11_x.h>
+#else
+#include <d3d11_1.h>
+#endif
+
+#include <DirectXMath.h>
+#include <DirectXColors.h>
+#include <functional>
+#include <memory>
+
+
+namespace DirectX
+{
+    class SpriteAtlas;
+    class SpriteLayer;
+
+
+    enum SpriteSortMode
+    {
+        SpriteSortMode_Deferred,
+        SpriteSortMode_Immediate,
+        SpriteSortMode_Texture,
+        SpriteSortMode_BackToFront,
+        SpriteSortMode_FrontToBack,
+    };
+
+
+    enum SpriteEffects
+    {
+        SpriteEffects_None = 0,
+        SpriteEffects_FlipHorizontally = 1,
+        SpriteEffects_FlipVertically = 2,
+        SpriteEffects_FlipBoth = SpriteEffects_FlipHorizontally | SpriteEffects_FlipVertically,
+    };
+
+
+    enum SpriteDistanceField
+    {
+        SpriteDistanceField_None,
+        SpriteDistanceField_SingleChannel,      // Distance in alpha.
+        SpriteDistanceField_MultiChannel,       // Median of red, green and blue.
+    };
+
+
+    class SpriteBatch
+    {
+    public:
+        explicit SpriteBatch(_In_ ID3D11DeviceContext* deviceContext);
+        SpriteBatch(SpriteBatch&& moveFrom) throw();
+        SpriteBatch& operator= (SpriteBatch&& moveFrom) throw();
+
+        SpriteBatch(SpriteBatch const&) = delete;
+        SpriteBatch& operator= (SpriteBatch const&) = delete;
+
+        virtual ~SpriteBatch();
+
+        // Begin/End a batch of sprite drawing operations.
+        void XM_CALLCONV Begin(SpriteSortMode sortMode = SpriteSortMode_Deferred, _In_opt_ ID3D11BlendState* blendState = nullptr, _In_opt_ ID3D11SamplerState* samplerState = nullptr, _In_opt_ ID3D11DepthStencilState* depthStencilState = nullptr, _In_opt_ ID3D11RasterizerState* rasterizerState = nullptr,
+                               _In_opt_ std::function<void __cdecl()> setCustomShaders = nullptr, FXMMATRIX transformMatrix = MatrixIdentity);
+        void __cdecl End();
+
+        // Draw overloads specifying position, origin and scale as XMFLOAT2.
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, XMFLOAT2 const& position, FXMVECTOR color = Colors::White);
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, XMFLOAT2 const& position, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, XMFLOAT2 const& position, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, XMFLOAT2 const& scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        // Draw overloads specifying position, origin and scale via the first two components of an XMVECTOR.
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, FXMVECTOR position, FXMVECTOR color = Colors::White);
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, FXMVECTOR position, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color = Colors::White, float rotation = 0, FXMVECTOR origin = g_XMZero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, FXMVECTOR position, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        // Draw overloads specifying position as a RECT.
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, RECT const& destinationRectangle, FXMVECTOR color = Colors::White);
+        void XM_CALLCONV Draw(_In_ ID3D11ShaderResourceView* texture, RECT const& destinationRectangle, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        // Draw sprites that share a texture, position, color, rotation and scale but each have their own source
+        // rectangle and origin, such as the glyphs of a string. Queues them in one step instead of one Draw each.
+        void XM_CALLCONV DrawRun(_In_ ID3D11ShaderResourceView* texture, FXMVECTOR position, _In_reads_(count) RECT const* sourceRectangles, _In_reads_(count) XMFLOAT2 const* origins, size_t count, FXMVECTOR color = Colors::White, float rotation = 0, FXMVECTOR scale = g_XMOne, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        // Draw a retained layer. Sprites drawn earlier in this batch end up underneath it and sprites
+        // drawn afterwards on top of it. Only sprites changed since its last draw are uploaded again.
+        void __cdecl Draw(_In_ SpriteLayer& layer);
+
+        // Rotation mode to be applied to the sprite transformation
+        void __cdecl SetRotation(DXGI_MODE_ROTATION mode);
+        DXGI_MODE_ROTATION __cdecl GetRotation() const;
+
+        // Set viewport for sprite transformation
+        void __cdecl SetViewport(const D3D11_VIEWPORT& viewPort);
+
+        // Spread vertex generation of large batches across threads. dispatcher(jobCount, job) must call
+        // job(0) .. job(jobCount - 1) once each and return only when all of them have finished.
+        // Output is identical to generating on one thread. Pass nullptr to go back to serial.
+        void __cdecl SetVertexDispatcher(_In_opt_ std::function<void __cdecl(size_t jobCount, std::function<void __cdecl(size_t job)> const& job)> dispatcher, size_t maxJobs);
+
+        // Draw textures that have been added to the atlas from the atlas texture instead, so sprites
+        // using different small textures share a batch. The atlas must outlive its use here.
+        void __cdecl SetAtlas(_In_opt_ SpriteAtlas const* atlas);
+
+        // Draw textures as signed distance fields, such as those of distance field SpriteFonts, which stay
+        // sharp at any scale. pixelRange is the distance in texels between the values 0 and 1 of the field.
+        // Set it before Begin; custom shaders replace it. Requires Feature Level 10.0 or later.
+        void __cdecl SetDistanceField(SpriteDistanceField mode, float pixelRange = 4);
+
+    private:
+        // Private implementation.
+        class Impl;
+
+        std::unique_ptr<Impl> pImpl;
+
+        static const XMMATRIX MatrixIdentity;
+        static const XMFLOAT2 Float2Zero;
+
+        friend class SpriteLayer;
+    };
+
+
+    // Sprites whose vertices are kept in a vertex buffer of their own between frames, for UI that
+    // mostly stays put. Once more than about a tenth of the sprites change every frame, plain
+    // SpriteBatch::Draw is cheaper. Sprites are drawn in id order; layerDepth only matters for
+    // depth testing, and the SpriteBatch atlas is not applied.
+    class SpriteLayer
+    {
+    public:
+        explicit SpriteLayer(_In_ ID3D11Device* device);
+        SpriteLayer(SpriteLayer&& moveFrom) throw();
+        SpriteLayer& operator= (SpriteLayer&& moveFrom) throw();
+
+        SpriteLayer(SpriteLayer const&) = delete;
+        SpriteLayer& operator= (SpriteLayer const&) = delete;
+
+        virtual ~SpriteLayer();
+
+        // Parameters match SpriteBatch::Draw. Add returns an id for Set and Remove; ids of removed
+        // sprites are reused. The layer holds a reference to each texture until its sprite is removed.
+        size_t XM_CALLCONV Add(_In_ ID3D11ShaderResourceView* texture, XMFLOAT2 const& position, _In_opt_ RECT const* sourceRectangle = nullptr, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, XMFLOAT2 const& scale = Float2One, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+        size_t XM_CALLCONV Add(_In_ ID3D11ShaderResourceView* texture, RECT const& destinationRectangle, _In_opt_ RECT const* sourceRectangle = nullptr, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        void XM_CALLCONV Set(size_t id, _In_ ID3D11ShaderResourceView* texture, XMFLOAT2 const& position, _In_opt_ RECT const* sourceRectangle = nullptr, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, XMFLOAT2 const& scale = Float2One, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+        void XM_CALLCONV Set(size_t id, _In_ ID3D11ShaderResourceView* texture, RECT const& destinationRectangle, _In_opt_ RECT const* sourceRectangle = nullptr, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0);
+
+        // Cheaper edits for the common cases of moving or fading a sprite.
+        void XM_CALLCONV SetPosition(size_t id, XMFLOAT2 const& position);
+        void XM_CALLCONV SetColor(size_t id, FXMVECTOR color);
+
+        void __cdecl Remove(size_t id);
+        void __cdecl Clear();
+
+        size_t __cdecl GetCount() const;
+
+    private:
+        // Private implementation.
+        class Impl;
+
+        std::unique_ptr<Impl> pImpl;
+
+        static const XMFLOAT2 Float2Zero;
+        static const XMFLOAT2 Float2One;
+
+        friend class SpriteBatch;
+    };
+}
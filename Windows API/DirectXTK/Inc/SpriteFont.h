@@ -0,0 +1,145 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteFont.h
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248929
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "SpriteBatch.h"
+
+
+namespace DirectX
+{
+    class SpriteFont
+    {
+    public:
+        struct Glyph;
+
+        SpriteFont(_In_ ID3D11Device* device, _In_z_ wchar_t const* fileName, bool forceSRGB = false);
+        SpriteFont(_In_ ID3D11Device* device, _In_reads_bytes_(dataSize) uint8_t const* dataBlob, _In_ size_t dataSize, bool forceSRGB = false);
+        SpriteFont(_In_ ID3D11ShaderResourceView* texture, _In_reads_(glyphCount) Glyph const* glyphs, _In_ size_t glyphCount, _In_ float lineSpacing);
+
+        // Loads a TrueType font and rasterizes each glyph the first time it is drawn or measured, into an
+        // atlas that replaces the least recently used glyphs once it is full. Memory grows with the glyphs
+        // actually used rather than the whole character set. pixelSize is the height of the em square.
+        // atlasWidth and atlasHeight are the starting size; the atlas only grows taller, see NextFrame.
+        // Glyphs are uploaded with deviceContext, so only use the font on the thread that owns it.
+        SpriteFont(_In_ ID3D11DeviceContext* deviceContext, _In_z_ wchar_t const* trueTypeFileName, float pixelSize, UINT atlasWidth = 1024, UINT atlasHeight = 1024);
+        SpriteFont(_In_ ID3D11DeviceContext* deviceContext, _In_reads_bytes_(dataSize) uint8_t const* trueTypeData, size_t dataSize, float pixelSize, UINT atlasWidth = 1024, UINT atlasHeight = 1024);
+
+        // Loads a TrueType font and generates signed distance fields of its glyphs into one atlas, on as many
+        // threads as there are cores, so a single font draws sharp text at any scale. The em square is
+        // pixelSize texels tall and pixelRange is the field range in texels. characters is UTF-8, or nullptr
+        // for every character in the font. Draw it with SpriteBatch::SetDistanceField(GetDistanceField(),
+        // GetDistanceFieldRange()) set, which requires Feature Level 10.0 or later.
+        SpriteFont(_In_ ID3D11Device* device, _In_z_ wchar_t const* trueTypeFileName, SpriteDistanceField mode, float pixelSize = 32, float pixelRange = 4, _In_opt_z_ char const* characters = nullptr);
+        SpriteFont(_In_ ID3D11Device* device, _In_reads_bytes_(dataSize) uint8_t const* trueTypeData, size_t dataSize, SpriteDistanceField mode, float pixelSize = 32, float pixelRange = 4, _In_opt_z_ char const* characters = nullptr);
+
+        SpriteFont(SpriteFont&& moveFrom) throw();
+        SpriteFont& operator= (SpriteFont&& moveFrom) throw();
+
+        SpriteFont(SpriteFont const&) = delete;
+        SpriteFont& operator= (SpriteFont const&) = delete;
+
+        virtual ~SpriteFont();
+
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, XMFLOAT2 const& position, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, XMFLOAT2 const& scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, FXMVECTOR position, FXMVECTOR color = Colors::White, float rotation = 0, FXMVECTOR origin = g_XMZero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+
+        XMVECTOR XM_CALLCONV MeasureString(_In_z_ wchar_t const* text) const;
+
+        RECT __cdecl MeasureDrawBounds(_In_z_ wchar_t const* text, XMFLOAT2 const& position) const;
+        RECT XM_CALLCONV MeasureDrawBounds(_In_z_ wchar_t const* text, FXMVECTOR position) const;
+
+        // UTF-8 text, decoded as it is laid out. Malformed sequences draw as U+FFFD.
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, XMFLOAT2 const& position, FXMVECTOR color = Colors::White, float rotation = 0, XMFLOAT2 const& origin = Float2Zero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, XMFLOAT2 const& scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, FXMVECTOR position, FXMVECTOR color = Colors::White, float rotation = 0, FXMVECTOR origin = g_XMZero, float scale = 1, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+        void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects = SpriteEffects_None, float layerDepth = 0) const;
+
+        XMVECTOR XM_CALLCONV MeasureString(_In_z_ char const* text) const;
+
+        RECT __cdecl MeasureDrawBounds(_In_z_ char const* text, XMFLOAT2 const& position) const;
+        RECT XM_CALLCONV MeasureDrawBounds(_In_z_ char const* text, FXMVECTOR position) const;
+
+        // Spacing properties
+        float __cdecl GetLineSpacing() const;
+        void __cdecl SetLineSpacing(float spacing);
+
+        // Font properties
+        wchar_t __cdecl GetDefaultCharacter() const;
+        void __cdecl SetDefaultCharacter(wchar_t character);
+
+        bool __cdecl ContainsCharacter(wchar_t character) const;
+
+        // How the sprite sheet should be drawn: SpriteDistanceField_None except for distance field fonts.
+        SpriteDistanceField __cdecl GetDistanceField() const;
+        float __cdecl GetDistanceFieldRange() const;
+
+        // Layout cache: keeps the glyph layout, size and sprites of up to maxStrings recently drawn strings,
+        // so text that does not change skips layout, and MeasureString of it is a lookup. A string is cached
+        // the second time it is drawn; text that changes every frame is laid out directly and never evicts
+        // anything. 0, the default, turns it off. Size it to hold every string drawn again from one frame to
+        // the next; a cache that keeps evicting costs more than it saves. DrawString reuses buffers
+        // owned by the font, and the cache is updated by every call, so one font must not be drawn or
+        // measured from several threads at once.
+        struct LayoutCacheStatistics
+        {
+            size_t Hits;
+            size_t Misses;
+            size_t Evictions;
+            size_t Strings;
+        };
+
+        void __cdecl SetLayoutCacheSize(size_t maxStrings);
+        LayoutCacheStatistics __cdecl GetLayoutCacheStatistics() const;
+        void __cdecl ResetLayoutCacheStatistics();
+
+        // Glyph cache of fonts loaded from TrueType. Call NextFrame once a frame, after every SpriteBatch
+        // that drew this font has ended: glyphs used since the previous call are never replaced, because
+        // sprites queued with them may not have been drawn yet. If one frame needs more glyphs than the
+        // atlas holds, the atlas doubles in height, up to the largest texture D3D11 allows, which replaces
+        // the texture GetSpriteSheet returned; glyphs that still do not fit are drawn blank for that frame.
+        // Fonts from .spritefont files report only their glyph count.
+        struct GlyphCacheStatistics
+        {
+            size_t Hits;
+            size_t Misses;
+            size_t Evictions;
+            size_t Glyphs;
+        };
+
+        void __cdecl NextFrame();
+        GlyphCacheStatistics __cdecl GetGlyphCacheStatistics() const;
+        void __cdecl ResetGlyphCacheStatistics();
+
+        // Custom layout/rendering
+        Glyph const* __cdecl FindGlyph(wchar_t character) const;
+        void __cdecl GetSpriteSheet(ID3D11ShaderResourceView** texture) const;
+
+        // Describes a single character glyph.
+        struct Glyph
+        {
+            uint32_t Character;
+            RECT Subrect;
+            float XOffset;
+            float YOffset;
+            float XAdvance;
+        };
+
+
+    private:
+        // Private implementation.
+        class Impl;
+
+        std::unique_ptr<Impl> pImpl;
+
+        static const XMFLOAT2 Float2Zero;
+    };
+}
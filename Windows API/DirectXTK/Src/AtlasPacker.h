@@ -0,0 +1,331 @@
+//--------------------------------------------------------------------------------------
+// File: AtlasPacker.h
+//
+// CPU-side rectangle packing for SpriteAtlas. SkylinePacker places rectangles with
+// the skyline bottom-left heuristic. AtlasLayout adds ids, padding, removal and
+// defragmentation on top of it. Nothing here touches D3D, so the layout can be
+// tested and benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace DirectX
+{
+    // Keeps the top edge of the packed area as a list of horizontal segments. A new
+    // rectangle rests on the segments under it, at the position whose top is lowest.
+    class SkylinePacker
+    {
+    public:
+        SkylinePacker(int width, int height)
+        {
+            Reset(width, height);
+        }
+
+        void Reset(int width, int height)
+        {
+            mWidth = width;
+            mHeight = height;
+            mUsedArea = 0;
+            mSkyline.clear();
+            mSkyline.push_back(Segment{ 0, 0, width });
+        }
+
+        // Returns false if there is no room, leaving the packer unchanged.
+        bool Insert(int width, int height, int* x, int* y)
+        {
+            if (width <= 0 || height <= 0 || width > mWidth || height > mHeight)
+                return false;
+
+            size_t best = SIZE_MAX;
+            int bestTop = INT32_MAX;
+            int bestWidth = INT32_MAX;
+            int bestY = 0;
+
+            for (size_t i = 0; i < mSkyline.size(); i++)
+            {
+                int restY;
+
+                if (!Fit(i, width, height, &restY))
+                    continue;
+
+                // Lowest top edge first, then the narrowest segment to leave wide ones for wide rectangles.
+                int top = restY + height;
+
+                if (top < bestTop || (top == bestTop && mSkyline[i].width < bestWidth))
+                {
+                    best = i;
+                    bestTop = top;
+                    bestWidth = mSkyline[i].width;
+                    bestY = restY;
+                }
+            }
+
+            if (best == SIZE_MAX)
+                return false;
+
+            *x = mSkyline[best].x;
+            *y = bestY;
+
+            AddSegment(best, *x, bestY + height, width);
+
+            mUsedArea += static_cast<int64_t>(width) * height;
+
+            return true;
+        }
+
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+        int64_t UsedArea() const { return mUsedArea; }
+
+        // Highest top edge of anything placed so far.
+        int UsedHeight() const
+        {
+            int top = 0;
+
+            for (auto const& segment : mSkyline)
+            {
+                top = std::max(top, segment.y);
+            }
+
+            return top;
+        }
+
+    private:
+        struct Segment
+        {
+            int x;
+            int y;
+            int width;
+        };
+
+        // A rectangle starting at segment i rests on the highest segment it spans.
+        bool Fit(size_t i, int width, int height, int* restY) const
+        {
+            int x = mSkyline[i].x;
+
+            if (x + width > mWidth)
+                return false;
+
+            int y = 0;
+            int remaining = width;
+
+            for (size_t j = i; remaining > 0; j++)
+            {
+                y = std::max(y, mSkyline[j].y);
+
+                if (y + height > mHeight)
+                    return false;
+
+                remaining -= mSkyline[j].width;
+            }
+
+            *restY = y;
+            return true;
+        }
+
+        void AddSegment(size_t index, int x, int y, int width)
+        {
+            mSkyline.insert(mSkyline.begin() + index, Segment{ x, y, width });
+
+            // Trim or drop the segments now covered by the new one.
+            int right = x + width;
+
+            for (size_t i = index + 1; i < mSkyline.size(); )
+            {
+                Segment& segment = mSkyline[i];
+
+                if (segment.x >= right)
+                    break;
+
+                int overlap = right - segment.x;
+
+                if (overlap < segment.width)
+                {
+                    segment.x += overlap;
+                    segment.width -= overlap;
+                    break;
+                }
+
+                mSkyline.erase(mSkyline.begin() + i);
+            }
+
+            // Only the new segment can now be level with a neighbour.
+            if (index + 1 < mSkyline.size() && mSkyline[index + 1].y == y)
+            {
+                mSkyline[index].width += mSkyline[index + 1].width;
+                mSkyline.erase(mSkyline.begin() + index + 1);
+            }
+
+            if (index > 0 && mSkyline[index - 1].y == y)
+            {
+                mSkyline[index - 1].width += mSkyline[index].width;
+                mSkyline.erase(mSkyline.begin() + index);
+            }
+        }
+
+        int mWidth;
+        int mHeight;
+        int64_t mUsedArea;
+        std::vector<Segment> mSkyline;
+    };
+
+
+    // Entries are identified by small integer ids, which are reused after Remove.
+    // The skyline cannot give space back, so removed entries leave holes until
+    // Defragment packs the live entries again from scratch.
+    class AtlasLayout
+    {
+    public:
+        struct Entry
+        {
+            int x;          // Inside the padding.
+            int y;
+            int width;
+            int height;
+            bool live;
+        };
+
+        // An entry that Defragment moved from (fromX, fromY) to its current position.
+        struct Move
+        {
+            int id;
+            int fromX;
+            int fromY;
+        };
+
+        AtlasLayout(int width, int height, int padding) :
+            mPacker(width, height),
+            mPadding(padding),
+            mLiveArea(0)
+        {
+        }
+
+        // Returns the new entry id, or -1 if it does not fit.
+        int Insert(int width, int height)
+        {
+            int x, y;
+
+            if (!mPacker.Insert(width + mPadding * 2, height + mPadding * 2, &x, &y))
+                return -1;
+
+            int id;
+
+            if (mFreeIds.empty())
+            {
+                id = static_cast<int>(mEntries.size());
+                mEntries.push_back(Entry());
+            }
+            else
+            {
+                id = mFreeIds.back();
+                mFreeIds.pop_back();
+            }
+
+            mEntries[id] = Entry{ x + mPadding, y + mPadding, width, height, true };
+            mLiveArea += PaddedArea(mEntries[id]);
+
+            return id;
+        }
+
+        void Remove(int id)
+        {
+            if (id < 0 || id >= static_cast<int>(mEntries.size()) || !mEntries[id].live)
+                return;
+
+            mLiveArea -= PaddedArea(mEntries[id]);
+            mEntries[id].live = false;
+            mFreeIds.push_back(id);
+        }
+
+        // Packs every live entry again, tallest first, which fits much tighter than arrival
+        // order. Ids stay the same. Returns false and leaves the layout unchanged if the
+        // entries no longer fit; otherwise appends every entry that changed position to moves.
+        bool Defragment(std::vector<Move>* moves)
+        {
+            std::vector<int> order;
+
+            for (int id = 0; id < static_cast<int>(mEntries.size()); id++)
+            {
+                if (mEntries[id].live)
+                    order.push_back(id);
+            }
+
+            std::stable_sort(order.begin(), order.end(), [this](int a, int b)
+            {
+                Entry const& ea = mEntries[a];
+                Entry const& eb = mEntries[b];
+
+                return (ea.height != eb.height) ? (ea.height > eb.height) : (ea.width > eb.width);
+            });
+
+            SkylinePacker packer(mPacker.Width(), mPacker.Height());
+            std::vector<Entry> placed(mEntries);
+
+            for (int id : order)
+            {
+                Entry& entry = placed[id];
+                int x, y;
+
+                if (!packer.Insert(entry.width + mPadding * 2, entry.height + mPadding * 2, &x, &y))
+                    return false;
+
+                entry.x = x + mPadding;
+                entry.y = y + mPadding;
+            }
+
+            if (moves)
+            {
+                for (int id : order)
+                {
+                    if (placed[id].x != mEntries[id].x || placed[id].y != mEntries[id].y)
+                    {
+                        moves->push_back(Move{ id, mEntries[id].x, mEntries[id].y });
+                    }
+                }
+            }
+
+            mPacker = packer;
+            mEntries.swap(placed);
+
+            return true;
+        }
+
+        Entry const& operator[](int id) const { return mEntries[id]; }
+        size_t Size() const { return mEntries.size(); }
+
+        int Width() const { return mPacker.Width(); }
+        int Height() const { return mPacker.Height(); }
+        int Padding() const { return mPadding; }
+        int UsedHeight() const { return mPacker.UsedHeight(); }
+
+        // Fraction of the atlas covered by live entries, including their padding.
+        float Occupancy() const
+        {
+            return static_cast<float>(static_cast<double>(mLiveArea) / (static_cast<double>(mPacker.Width()) * mPacker.Height()));
+        }
+
+        // Padded area freed by Remove that only Defragment can reuse.
+        int64_t ReclaimableArea() const
+        {
+            return mPacker.UsedArea() - mLiveArea;
+        }
+
+    private:
+        int64_t PaddedArea(Entry const& entry) const
+        {
+            return static_cast<int64_t>(entry.width + mPadding * 2) * (entry.height + mPadding * 2);
+        }
+
+        SkylinePacker mPacker;
+        int mPadding;
+        int64_t mLiveArea;
+        std::vector<Entry> mEntries;
+        std::vector<int> mFreeIds;
+    };
+}
@@ -20,17 +20,15 @@ BinaryReader::BinaryReader(_In_z_ wchar_t const* fileName) :
     mPos(nullptr),
     mEnd(nullptr)
 {
-    size_t dataSize;
-
-    HRESULT hr = ReadEntireFile(fileName, mOwnedData, &dataSize);
+    HRESULT hr = MapEntireFile(fileName, mMappedData);
     if (FAILED(hr))
     {
         DebugTrace("BinaryReader failed (%08X) to load '%ls'\n", hr, fileName);
         throw std::exception("BinaryReader");
     }
 
-    mPos = mOwnedData.get();
-    mEnd = mOwnedData.get() + dataSize;
+    mPos = mMappedData.Data();
+    mEnd = mMappedData.Data() + mMappedData.Size();
 }
 
 
@@ -87,3 +85,13 @@ HRESULT BinaryReader::ReadEntireFile(_In_z_ wchar_t const* fileName, _Inout_ std
 
     return S_OK;
 }
+
+
+// Maps the file into memory, the data stays valid until the MappedFile is closed.
+HRESULT BinaryReader::MapEntireFile(_In_z_ wchar_t const* fileName, _Inout_ MappedFile& file)
+{
+    if (!file.Open(fileName))
+        return HRESULT_FROM_WIN32(GetLastError());
+
+    return S_OK;
+}
@@ -15,6 +15,7 @@
 #include <stdexcept>
 #include <type_traits>
 
+#include "MappedFile.h"
 #include "PlatformHelpers.h"
 
 
@@ -61,12 +62,15 @@ namespace DirectX
         // Lower level helper reads directly from the filesystem into memory.
         static HRESULT ReadEntireFile(_In_z_ wchar_t const* fileName, _Inout_ std::unique_ptr<uint8_t[]>& data, _Out_ size_t* dataSize);
 
+        // Lower level helper maps the file into memory without copying it.
+        static HRESULT MapEntireFile(_In_z_ wchar_t const* fileName, _Inout_ MappedFile& file);
+
 
     private:
         // The data currently being read.
         uint8_t const* mPos;
         uint8_t const* mEnd;
 
-        std::unique_ptr<uint8_t[]> mOwnedData;
+        MappedFile mMappedData;
     };
 }
@@ -461,9 +461,8 @@ void DGSLEffectFactory::Impl::CreatePixelShader(const wchar_t* name, ID3D11Pixel
             }
         }
 
-        size_t dataSize = 0;
-        std::unique_ptr<uint8_t[]> data;
-        HRESULT hr = BinaryReader::ReadEntireFile(fullName, data, &dataSize);
+        MappedFile data;
+        HRESULT hr = BinaryReader::MapEntireFile(fullName, data);
         if (FAILED(hr))
         {
             DebugTrace("CreatePixelShader failed (%08X) to load shader file '%ls'\n", hr, fullName);
@@ -471,7 +470,7 @@ void DGSLEffectFactory::Impl::CreatePixelShader(const wchar_t* name, ID3D11Pixel
         }
 
         ThrowIfFailed(
-            mDevice->CreatePixelShader(data.get(), dataSize, nullptr, pixelShader));
+            mDevice->CreatePixelShader(data.Data(), data.Size(), nullptr, pixelShader));
 
         _Analysis_assume_(*pixelShader != 0);
 
@@ -0,0 +1,1062 @@
+//--------------------------------------------------------------------------------------
+// File: DistanceFieldGenerator.h
+//
+// Signed distance fields of glyph outlines, so that one atlas draws sharp text at any
+// scale. A single channel field holds the distance to the outline. A multi-channel field
+// holds in red, green and blue the distances to edges of three colors, whose median
+// keeps corners sharp when magnified, and the true distance in alpha. Distances from
+// -range/2 to +range/2 pixels, positive inside, map to texel values 0-255, so the outline
+// lies at 127.5. Inside and outside follow the nonzero rule, but distances are measured
+// to every edge, so contours that overlap (rare outside variable fonts) can leave faint
+// marks where edges cross the filled area. DistanceFieldAtlas generates the fields of a
+// whole character set into one atlas on several threads. Nothing here touches D3D, so it
+// can be tested and benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AtlasPacker.h"
+#include "GlyphRasterizer.h"
+#include "TrueTypeFont.h"
+
+
+namespace DirectX
+{
+    class DistanceFieldGenerator
+    {
+    public:
+        typedef GlyphRasterizer::Bounds Bounds;
+
+        // Pixel rectangle of the field: the outline bounds from GlyphRasterizer::Measure with
+        // half the range added on every side. Empty for outlines without contours.
+        static Bounds Measure(GlyphOutline const& outline, float scale, float range)
+        {
+            Bounds bounds = GlyphRasterizer::Measure(outline, scale);
+
+            if (!bounds.width)
+                return bounds;
+
+            int margin = static_cast<int>(std::ceil(range * 0.5f));
+
+            return Bounds{ bounds.left - margin, bounds.top + margin, bounds.width + margin * 2, bounds.height + margin * 2 };
+        }
+
+        // Writes the field of the outline drawn at scale pixels per font unit into texels, y down,
+        // with the given row pitch in bytes. Single channel fields take one byte per texel,
+        // multi-channel fields four: red, green, blue and the true distance in alpha.
+        void Generate(GlyphOutline const& outline, float scale, Bounds const& bounds, float range, bool multiChannel, uint8_t* texels, size_t pitch)
+        {
+            mWidth = bounds.width;
+            mHeight = bounds.height;
+
+            if (mWidth <= 0 || mHeight <= 0)
+                return;
+
+            BuildEdges(outline, scale, bounds, multiChannel);
+            FindInside();
+
+            double const half = range * 0.5;
+            double const infinity = std::numeric_limits<double>::infinity();
+            size_t const count = static_cast<size_t>(mWidth) * mHeight;
+
+            mTrueDistance.assign(count, infinity);
+
+            if (multiChannel)
+            {
+                mNearest.assign(count * 3, Nearest{ infinity, 0, 0, 0, -1 });
+            }
+
+            // Edge by edge, visiting only the texels within half the range of each: further out
+            // every channel saturates anyway, so most of the field never needs a distance.
+            for (size_t k = 0; k < mEdges.size(); k++)
+            {
+                Edge const& edge = mEdges[k];
+
+                double xMin = std::min(std::min(edge.p0.x, edge.p1.x), edge.p2.x) - half;
+                double xMax = std::max(std::max(edge.p0.x, edge.p1.x), edge.p2.x) + half;
+                double yMin = std::min(std::min(edge.p0.y, edge.p1.y), edge.p2.y) - half;
+                double yMax = std::max(std::max(edge.p0.y, edge.p1.y), edge.p2.y) + half;
+
+                int x0 = std::max(static_cast<int>(std::ceil(xMin - 0.5)), 0);
+                int x1 = std::min(static_cast<int>(std::floor(xMax - 0.5)), mWidth - 1);
+                int y0 = std::max(static_cast<int>(std::ceil(yMin - 0.5)), 0);
+                int y1 = std::min(static_cast<int>(std::floor(yMax - 0.5)), mHeight - 1);
+
+                for (int y = y0; y <= y1; y++)
+                {
+                    for (int x = x0; x <= x1; x++)
+                    {
+                        Vector p = { x + 0.5, y + 0.5 };
+                        size_t i = static_cast<size_t>(y) * mWidth + x;
+
+                        double param;
+                        Distance d = SignedDistance(edge, p, &param);
+                        double a = std::fabs(d.distance);
+
+                        mTrueDistance[i] = std::min(mTrueDistance[i], a);
+
+                        if (!multiChannel)
+                            continue;
+
+                        for (int channel = 0; channel < 3; channel++)
+                        {
+                            Nearest& nearest = mNearest[i * 3 + channel];
+
+                            // Ties go to the edge that meets the texel more squarely, which is
+                            // the one whose side the texel is on where two edges share a corner.
+                            if ((edge.color & (1 << channel)) && (a < nearest.distance || (a == nearest.distance && d.dot < nearest.dot)))
+                            {
+                                nearest = Nearest{ a, d.dot, d.distance, param, static_cast<int>(k) };
+                            }
+                        }
+                    }
+                }
+            }
+
+            mField.resize(count * 4);
+
+            for (int y = 0; y < mHeight; y++)
+            {
+                for (int x = 0; x < mWidth; x++)
+                {
+                    size_t i = static_cast<size_t>(y) * mWidth + x;
+                    double sign = mInside[i] ? 1 : -1;
+                    float* field = &mField[i * 4];
+
+                    field[3] = Normalize(sign * std::min(mTrueDistance[i], half), range);
+
+                    if (!multiChannel)
+                        continue;
+
+                    Vector p = { x + 0.5, y + 0.5 };
+
+                    for (int channel = 0; channel < 3; channel++)
+                    {
+                        Nearest const& nearest = mNearest[i * 3 + channel];
+
+                        if (nearest.edge < 0)
+                        {
+                            field[channel] = field[3];
+                            continue;
+                        }
+
+                        // Past the ends of its edge, a channel measures the distance to the edge
+                        // extended along its end tangent. That is what keeps corners sharp.
+                        Distance d = { nearest.signedDistance, nearest.dot };
+
+                        ToPseudoDistance(mEdges[nearest.edge], p, nearest.param, &d);
+
+                        field[channel] = Normalize(mOrientation * d.distance, range);
+                    }
+                }
+            }
+
+            if (multiChannel)
+            {
+                CorrectErrors(range);
+            }
+
+            for (int y = 0; y < mHeight; y++)
+            {
+                uint8_t* row = texels + y * pitch;
+
+                for (int x = 0; x < mWidth; x++)
+                {
+                    float const* field = &mField[(static_cast<size_t>(y) * mWidth + x) * 4];
+
+                    if (multiChannel)
+                    {
+                        for (int c = 0; c < 4; c++)
+                        {
+                            row[x * 4 + c] = ToByte(field[c]);
+                        }
+                    }
+                    else
+                    {
+                        row[x] = ToByte(field[3]);
+                    }
+                }
+            }
+        }
+
+    private:
+        enum Color
+        {
+            Black = 0,
+            Red = 1,
+            Green = 2,
+            Blue = 4,
+            Yellow = Red | Green,
+            Magenta = Red | Blue,
+            Cyan = Green | Blue,
+            White = Red | Green | Blue,
+        };
+
+        struct Vector
+        {
+            double x;
+            double y;
+        };
+
+        // An outline segment in pixels, y down. A line runs from p0 to p2.
+        struct Edge
+        {
+            Vector p0;
+            Vector p1;
+            Vector p2;
+            bool curve;
+            int color;
+        };
+
+        // Signed by the side of the edge the point is on, positive to the left of its direction.
+        // dot breaks ties between edges meeting at a corner.
+        struct Distance
+        {
+            double distance;
+            double dot;
+        };
+
+        struct Nearest
+        {
+            double distance;
+            double dot;
+            double signedDistance;
+            double param;
+            int edge;
+        };
+
+        struct Crossing
+        {
+            int row;
+            double x;
+            int direction;
+
+            bool operator< (Crossing const& other) const
+            {
+                return row < other.row || (row == other.row && x < other.x);
+            }
+        };
+
+        static Vector Add(Vector a, Vector b) { return Vector{ a.x + b.x, a.y + b.y }; }
+        static Vector Subtract(Vector a, Vector b) { return Vector{ a.x - b.x, a.y - b.y }; }
+        static Vector Multiply(Vector a, double s) { return Vector{ a.x * s, a.y * s }; }
+        static double Dot(Vector a, Vector b) { return a.x * b.x + a.y * b.y; }
+        static double Cross(Vector a, Vector b) { return a.x * b.y - a.y * b.x; }
+        static double Length(Vector a) { return std::sqrt(Dot(a, a)); }
+        static double NonZeroSign(double value) { return (value > 0) ? 1 : -1; }
+
+        static Vector Normalize(Vector a)
+        {
+            double length = Length(a);
+
+            return (length > 0) ? Multiply(a, 1 / length) : Vector{ 0, 1 };
+        }
+
+        static float Normalize(double distance, float range)
+        {
+            return static_cast<float>(distance / range + 0.5);
+        }
+
+        static uint8_t ToByte(float value)
+        {
+            return static_cast<uint8_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+
+        static Vector Point(Edge const& edge, double t)
+        {
+            if (!edge.curve)
+                return Add(edge.p0, Multiply(Subtract(edge.p2, edge.p0), t));
+
+            double u = 1 - t;
+
+            return Vector{ u * u * edge.p0.x + 2 * u * t * edge.p1.x + t * t * edge.p2.x,
+                           u * u * edge.p0.y + 2 * u * t * edge.p1.y + t * t * edge.p2.y };
+        }
+
+        static Vector Direction(Edge const& edge, double t)
+        {
+            if (!edge.curve)
+                return Subtract(edge.p2, edge.p0);
+
+            Vector d = Add(Multiply(Subtract(edge.p1, edge.p0), 1 - t), Multiply(Subtract(edge.p2, edge.p1), t));
+
+            // A control point on an end point leaves no tangent there; the chord stands in.
+            if (d.x == 0 && d.y == 0)
+                return Subtract(edge.p2, edge.p0);
+
+            return d;
+        }
+
+        // Distance from p to the nearest point of the edge. param is where that point is along the
+        // edge, below 0 or above 1 when it is an end point and p lies beyond it.
+        static Distance SignedDistance(Edge const& edge, Vector p, double* param)
+        {
+            if (!edge.curve)
+            {
+                Vector aq = Subtract(p, edge.p0);
+                Vector ab = Subtract(edge.p2, edge.p0);
+
+                *param = Dot(aq, ab) / Dot(ab, ab);
+
+                Vector eq = Subtract((*param > 0.5) ? edge.p2 : edge.p0, p);
+                double endDistance = Length(eq);
+
+                if (*param > 0 && *param < 1)
+                {
+                    double orthogonal = Cross(ab, aq) / Length(ab);
+
+                    if (std::fabs(orthogonal) < endDistance)
+                        return Distance{ orthogonal, 0 };
+                }
+
+                return Distance{ NonZeroSign(Cross(ab, aq)) * endDistance, std::fabs(Dot(Normalize(ab), Normalize(eq))) };
+            }
+
+            // Nearest points are where p - B(t) is perpendicular to B'(t), a cubic in t.
+            Vector qa = Subtract(edge.p0, p);
+            Vector ab = Subtract(edge.p1, edge.p0);
+            Vector br = Subtract(Subtract(edge.p2, edge.p1), ab);
+
+            double t[3];
+            int solutions = SolveCubic(t, Dot(br, br), 3 * Dot(ab, br), 2 * Dot(ab, ab) + Dot(qa, br), Dot(qa, ab));
+
+            Vector direction = Direction(edge, 0);
+            double minDistance = NonZeroSign(Cross(direction, Subtract(p, edge.p0))) * Length(qa);
+
+            *param = -Dot(qa, direction) / Dot(direction, direction);
+
+            {
+                direction = Direction(edge, 1);
+
+                Vector bq = Subtract(p, edge.p2);
+                double distance = Length(bq);
+
+                if (distance < std::fabs(minDistance))
+                {
+                    minDistance = NonZeroSign(Cross(direction, bq)) * distance;
+                    *param = 1 + Dot(bq, direction) / Dot(direction, direction);
+                }
+            }
+
+            for (int i = 0; i < solutions; i++)
+            {
+                if (t[i] > 0 && t[i] < 1)
+                {
+                    Vector qe = Add(Add(qa, Multiply(ab, 2 * t[i])), Multiply(br, t[i] * t[i]));
+                    double distance = Length(qe);
+
+                    if (distance <= std::fabs(minDistance))
+                    {
+                        minDistance = NonZeroSign(Cross(Add(ab, Multiply(br, t[i])), Multiply(qe, -1))) * distance;
+                        *param = t[i];
+                    }
+                }
+            }
+
+            if (*param >= 0 && *param <= 1)
+                return Distance{ minDistance, 0 };
+
+            if (*param < 0.5)
+                return Distance{ minDistance, std::fabs(Dot(Normalize(Direction(edge, 0)), Normalize(qa))) };
+
+            return Distance{ minDistance, std::fabs(Dot(Normalize(Direction(edge, 1)), Normalize(Subtract(edge.p2, p)))) };
+        }
+
+        static void ToPseudoDistance(Edge const& edge, Vector p, double param, Distance* distance)
+        {
+            if (param < 0)
+            {
+                Vector direction = Normalize(Direction(edge, 0));
+                Vector aq = Subtract(p, edge.p0);
+
+                if (Dot(aq, direction) < 0)
+                {
+                    double pseudoDistance = Cross(direction, aq);
+
+                    if (std::fabs(pseudoDistance) <= std::fabs(distance->distance))
+                    {
+                        distance->distance = pseudoDistance;
+                        distance->dot = 0;
+                    }
+                }
+            }
+            else if (param > 1)
+            {
+                Vector direction = Normalize(Direction(edge, 1));
+                Vector bq = Subtract(p, edge.p2);
+
+                if (Dot(bq, direction) > 0)
+                {
+                    double pseudoDistance = Cross(direction, bq);
+
+                    if (std::fabs(pseudoDistance) <= std::fabs(distance->distance))
+                    {
+                        distance->distance = pseudoDistance;
+                        distance->dot = 0;
+                    }
+                }
+            }
+        }
+
+        static int SolveQuadratic(double x[2], double a, double b, double c)
+        {
+            if (a == 0 || std::fabs(b) > 1e12 * std::fabs(a))
+            {
+                if (b == 0)
+                    return 0;
+
+                x[0] = -c / b;
+                return 1;
+            }
+
+            double discriminant = b * b - 4 * a * c;
+
+            if (discriminant > 0)
+            {
+                discriminant = std::sqrt(discriminant);
+                x[0] = (-b + discriminant) / (2 * a);
+                x[1] = (-b - discriminant) / (2 * a);
+                return 2;
+            }
+
+            if (discriminant == 0)
+            {
+                x[0] = -b / (2 * a);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        static int SolveCubic(double x[3], double a, double b, double c, double d)
+        {
+            // Nearly straight curves make a tiny; past this ratio the rounding error of dividing by
+            // it is worse than dropping the cubic term.
+            if (a == 0 || std::fabs(b / a) >= 1e6)
+                return SolveQuadratic(x, b, c, d);
+
+            b /= a;
+            c /= a;
+            d /= a;
+
+            double b2 = b * b;
+            double q = (b2 - 3 * c) / 9;
+            double r = (b * (2 * b2 - 9 * c) + 27 * d) / 54;
+            double r2 = r * r;
+            double q3 = q * q * q;
+
+            b /= 3;
+
+            if (r2 < q3)
+            {
+                double t = std::min(std::max(r / std::sqrt(q3), -1.0), 1.0);
+                double const pi = 3.14159265358979323846;
+
+                t = std::acos(t);
+                q = -2 * std::sqrt(q);
+
+                x[0] = q * std::cos(t / 3) - b;
+                x[1] = q * std::cos((t + 2 * pi) / 3) - b;
+                x[2] = q * std::cos((t - 2 * pi) / 3) - b;
+                return 3;
+            }
+
+            double u = ((r < 0) ? 1 : -1) * std::cbrt(std::fabs(r) + std::sqrt(r2 - q3));
+            double v = (u == 0) ? 0 : q / u;
+
+            x[0] = (u + v) - b;
+
+            if (u == v || std::fabs(u - v) < 1e-12 * std::fabs(u + v))
+            {
+                x[1] = -0.5 * (u + v) - b;
+                return 2;
+            }
+
+            return 1;
+        }
+
+        // Converts the outline to pixels and, for multi-channel fields, colors its edges so that
+        // the two edges meeting at every corner share at most one channel.
+        void BuildEdges(GlyphOutline const& outline, float scale, Bounds const& bounds, bool multiChannel)
+        {
+            mEdges.clear();
+
+            double dx = -bounds.left;
+            double dy = bounds.top;
+
+            auto toPixels = [&](GlyphOutline::Point const& p)
+            {
+                return Vector{ p.x * scale + dx, dy - p.y * scale };
+            };
+
+            double area = 0;
+            size_t first = 0;
+
+            for (size_t end : outline.contourEnds)
+            {
+                mContour.clear();
+
+                for (size_t s = first; s < end && s < outline.segments.size(); s++)
+                {
+                    auto const& segment = outline.segments[s];
+
+                    Edge edge = { toPixels(segment.p0), toPixels(segment.control), toPixels(segment.p1), segment.curve, White };
+
+                    if (!edge.curve)
+                    {
+                        edge.p1 = Multiply(Add(edge.p0, edge.p2), 0.5);
+                    }
+
+                    if (edge.p0.x == edge.p2.x && edge.p0.y == edge.p2.y && (!edge.curve || (edge.p1.x == edge.p0.x && edge.p1.y == edge.p0.y)))
+                        continue;
+
+                    // The control polygon has the sign of the area under the curve.
+                    area += Cross(edge.p0, edge.p1) + Cross(edge.p1, edge.p2);
+
+                    mContour.push_back(edge);
+                }
+
+                first = end;
+
+                if (mContour.empty())
+                    continue;
+
+                if (multiChannel)
+                {
+                    ColorContour();
+                }
+
+                mEdges.insert(mEdges.end(), mContour.begin(), mContour.end());
+            }
+
+            // Distances are positive to the left of each edge; flip them if the fill is on the right.
+            mOrientation = (area >= 0) ? 1 : -1;
+        }
+
+        // Splits the contour into runs between corners, alternating colors. A contour without
+        // corners is white, all channels alike; one with a single corner, such as a teardrop,
+        // gets three colors so that the corner still lies between two different ones.
+        void ColorContour()
+        {
+            double const crossThreshold = std::sin(3.0);
+
+            mCorners.clear();
+
+            for (size_t i = 0; i < mContour.size(); i++)
+            {
+                Vector a = Normalize(Direction(mContour[(i + mContour.size() - 1) % mContour.size()], 1));
+                Vector b = Normalize(Direction(mContour[i], 0));
+
+                if (Dot(a, b) <= 0 || std::fabs(Cross(a, b)) > crossThreshold)
+                {
+                    mCorners.push_back(i);
+                }
+            }
+
+            if (mCorners.empty())
+                return;
+
+            if (mCorners.size() == 1)
+            {
+                if (mContour.size() < 3)
+                {
+                    SplitInThirds();
+
+                    mCorners[0] *= 3;
+                }
+
+                int const colors[3] = { Cyan, White, Magenta };
+                size_t m = mContour.size();
+
+                for (size_t i = 0; i < m; i++)
+                {
+                    int third = static_cast<int>(3 + 2.875 * i / (m - 1) - 1.4375 + 0.5) - 3;
+
+                    mContour[(mCorners[0] + i) % m].color = colors[1 + third];
+                }
+
+                return;
+            }
+
+            size_t m = mContour.size();
+            size_t spline = 0;
+            size_t start = mCorners[0];
+            int color = Cyan;
+            int const initialColor = color;
+
+            for (size_t i = 0; i < m; i++)
+            {
+                size_t index = (start + i) % m;
+
+                if (spline + 1 < mCorners.size() && mCorners[spline + 1] == index)
+                {
+                    spline++;
+
+                    // The last run also meets the first one, so it avoids sharing two channels with it.
+                    color = SwitchColor(color, (spline == mCorners.size() - 1) ? initialColor : Black);
+                }
+
+                mContour[index].color = color;
+            }
+        }
+
+        static int SwitchColor(int color, int banned)
+        {
+            int combined = color & banned;
+
+            if (combined == Red || combined == Green || combined == Blue)
+                return combined ^ White;
+
+            int shifted = color << 1;
+
+            return (shifted | (shifted >> 3)) & White;
+        }
+
+        void SplitInThirds()
+        {
+            mSplit.clear();
+
+            for (auto const& edge : mContour)
+            {
+                for (int i = 0; i < 3; i++)
+                {
+                    double a = i / 3.0;
+                    double b = (i + 1) / 3.0;
+
+                    Edge part = edge;
+
+                    part.p0 = Point(edge, a);
+                    part.p2 = Point(edge, b);
+                    part.p1 = edge.curve ? Add(part.p0, Multiply(Direction(edge, a), b - a)) : Multiply(Add(part.p0, part.p2), 0.5);
+
+                    mSplit.push_back(part);
+                }
+            }
+
+            mContour.swap(mSplit);
+        }
+
+        // Nonzero winding at every texel center, from where the edges cross each row of centers.
+        // Curves are split where they turn vertically, so every piece crosses a row at most once
+        // and a crossing at the end of one piece is not counted again at the start of the next.
+        void FindInside()
+        {
+            mCrossings.clear();
+
+            for (auto const& edge : mEdges)
+            {
+                if (!edge.curve)
+                {
+                    AddCrossings(edge, 0, 1);
+                    continue;
+                }
+
+                double denominator = edge.p0.y - 2 * edge.p1.y + edge.p2.y;
+                double turn = (denominator != 0) ? (edge.p0.y - edge.p1.y) / denominator : -1;
+
+                if (turn > 0 && turn < 1)
+                {
+                    AddCrossings(edge, 0, turn);
+                    AddCrossings(edge, turn, 1);
+                }
+                else
+                {
+                    AddCrossings(edge, 0, 1);
+                }
+            }
+
+            std::sort(mCrossings.begin(), mCrossings.end());
+
+            mInside.assign(static_cast<size_t>(mWidth) * mHeight, 0);
+
+            size_t c = 0;
+
+            for (int y = 0; y < mHeight; y++)
+            {
+                int winding = 0;
+
+                while (c < mCrossings.size() && mCrossings[c].row < y)
+                    c++;
+
+                for (int x = 0; x < mWidth; x++)
+                {
+                    while (c < mCrossings.size() && mCrossings[c].row == y && mCrossings[c].x <= x + 0.5)
+                    {
+                        winding += mCrossings[c++].direction;
+                    }
+
+                    mInside[static_cast<size_t>(y) * mWidth + x] = (winding != 0);
+                }
+            }
+        }
+
+        // Adds where the piece of edge from t0 to t1, which only goes up or down, crosses the row
+        // centers in [its lower y, its upper y).
+        void AddCrossings(Edge const& edge, double t0, double t1)
+        {
+            Vector a = Point(edge, t0);
+            Vector b = Point(edge, t1);
+
+            if (a.y == b.y)
+                return;
+
+            int direction = (b.y > a.y) ? 1 : -1;
+
+            if (direction < 0)
+            {
+                std::swap(a, b);
+                std::swap(t0, t1);
+            }
+
+            int rowStart = std::max(static_cast<int>(std::ceil(a.y - 0.5)), 0);
+            int rowEnd = std::min(static_cast<int>(std::ceil(b.y - 0.5)), mHeight);
+
+            for (int row = rowStart; row < rowEnd; row++)
+            {
+                double center = row + 0.5;
+                double x;
+
+                if (!edge.curve)
+                {
+                    x = a.x + (b.x - a.x) * (center - a.y) / (b.y - a.y);
+                }
+                else
+                {
+                    // y grows from t0 to t1, so bisection homes in on the one crossing.
+                    double low = t0;
+                    double high = t1;
+
+                    for (int i = 0; i < 40; i++)
+                    {
+                        double middle = 0.5 * (low + high);
+
+                        if (Point(edge, middle).y < center)
+                            low = middle;
+                        else
+                            high = middle;
+                    }
+
+                    x = Point(edge, 0.5 * (low + high)).x;
+                }
+
+                mCrossings.push_back(Crossing{ row, x, direction });
+            }
+        }
+
+        static float Median(float a, float b, float c)
+        {
+            return std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+
+        // Two kinds of texels would draw wrongly: those whose channels disagree with the true
+        // inside or outside, where contours overlap, and those whose channels change so much
+        // towards a neighbour that filtering between them makes a false edge. Both drop to a
+        // single value there.
+        void CorrectErrors(float range)
+        {
+            size_t const count = static_cast<size_t>(mWidth) * mHeight;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                float* field = &mField[i * 4];
+
+                if ((Median(field[0], field[1], field[2]) > 0.5f) != (mInside[i] != 0))
+                {
+                    field[0] = field[1] = field[2] = field[3];
+                }
+            }
+
+            float const threshold = 1.001f / range;
+
+            mClashes.clear();
+
+            for (int y = 0; y < mHeight; y++)
+            {
+                for (int x = 0; x < mWidth; x++)
+                {
+                    size_t i = static_cast<size_t>(y) * mWidth + x;
+                    float const* field = &mField[i * 4];
+
+                    if ((x > 0 && Clashes(field, field - 4, threshold)) ||
+                        (x < mWidth - 1 && Clashes(field, field + 4, threshold)) ||
+                        (y > 0 && Clashes(field, field - mWidth * 4, threshold)) ||
+                        (y < mHeight - 1 && Clashes(field, field + mWidth * 4, threshold)))
+                    {
+                        mClashes.push_back(i);
+                    }
+                }
+            }
+
+            for (size_t i : mClashes)
+            {
+                float* field = &mField[i * 4];
+
+                field[0] = field[1] = field[2] = Median(field[0], field[1], field[2]);
+            }
+        }
+
+        // Whether texel a, rather than its neighbour b, should be flattened: two channels change
+        // by more than the threshold in opposite ways, and a is the one further from the edge.
+        static bool Clashes(float const* a, float const* b, float threshold)
+        {
+            float a0 = a[0], a1 = a[1], a2 = a[2];
+            float b0 = b[0], b1 = b[1], b2 = b[2];
+
+            // Order the channels by how much they change, most first.
+            if (std::fabs(b0 - a0) < std::fabs(b1 - a1))
+            {
+                std::swap(a0, a1);
+                std::swap(b0, b1);
+            }
+
+            if (std::fabs(b1 - a1) < std::fabs(b2 - a2))
+            {
+                std::swap(a1, a2);
+                std::swap(b1, b2);
+
+                if (std::fabs(b0 - a0) < std::fabs(b1 - a1))
+                {
+                    std::swap(a0, a1);
+                    std::swap(b0, b1);
+                }
+            }
+
+            return std::fabs(b1 - a1) >= threshold &&
+                   !(b0 == b1 && b0 == b2) &&
+                   std::fabs(a2 - 0.5f) >= std::fabs(b2 - 0.5f);
+        }
+
+        int mWidth;
+        int mHeight;
+        double mOrientation;
+
+        std::vector<Edge> mEdges;
+        std::vector<Edge> mContour;
+        std::vector<Edge> mSplit;
+        std::vector<size_t> mCorners;
+        std::vector<Crossing> mCrossings;
+        std::vector<uint8_t> mInside;
+        std::vector<double> mTrueDistance;
+        std::vector<Nearest> mNearest;
+        std::vector<float> mField;
+        std::vector<size_t> mClashes;
+    };
+
+
+    // The distance fields of a character set, packed into one atlas.
+    class DistanceFieldAtlas
+    {
+    public:
+        static const int Padding = 1;
+
+        struct Glyph
+        {
+            uint32_t character;
+            int x;              // Field rectangle in the atlas; empty for glyphs without an outline.
+            int y;
+            int width;
+            int height;
+            int left;           // Field rectangle relative to the pen on the baseline, top measured up.
+            int top;
+            float advance;      // Pen advance in pixels.
+        };
+
+        DistanceFieldAtlas() :
+            mWidth(0),
+            mHeight(0),
+            mBytesPerTexel(1)
+        {
+        }
+
+        // Generates the field of every character the font has, in the order given, with the em
+        // square pixelSize texels tall. Characters that share a glyph share its field, and fields
+        // are generated threadCount at a time. Returns false if the atlas would need to be wider
+        // or taller than maxSize.
+        bool Build(TrueTypeFont const& font, uint32_t const* characters, size_t characterCount, float pixelSize, float range, bool multiChannel, unsigned threadCount, int maxSize)
+        {
+            mGlyphs.clear();
+            mTexels.clear();
+            mWidth = 0;
+            mHeight = 0;
+            mBytesPerTexel = multiChannel ? 4 : 1;
+
+            float const scale = pixelSize / font.UnitsPerEm();
+
+            struct Field
+            {
+                uint32_t glyph;
+                DistanceFieldGenerator::Bounds bounds;
+                int x;
+                int y;
+            };
+
+            std::vector<Field> fields;
+            std::vector<size_t> fieldOfGlyph;
+            std::unordered_map<uint32_t, size_t> fieldIndex;
+            GlyphOutline outline;
+
+            for (size_t i = 0; i < characterCount; i++)
+            {
+                uint32_t glyph = font.FindGlyph(characters[i]);
+
+                if (!glyph)
+                    continue;
+
+                auto found = fieldIndex.find(glyph);
+
+                if (found == fieldIndex.end())
+                {
+                    font.GetOutline(glyph, &outline);
+
+                    found = fieldIndex.emplace(glyph, fields.size()).first;
+                    fields.push_back(Field{ glyph, DistanceFieldGenerator::Measure(outline, scale, range), 0, 0 });
+                }
+
+                fieldOfGlyph.push_back(found->second);
+                mGlyphs.push_back(Glyph{ characters[i], 0, 0, 0, 0, 0, 0, font.AdvanceWidth(glyph) * scale });
+            }
+
+            // Tallest first packs much tighter than character order.
+            std::vector<size_t> order;
+            int64_t area = 0;
+
+            for (size_t i = 0; i < fields.size(); i++)
+            {
+                auto const& bounds = fields[i].bounds;
+
+                if (bounds.width > 0)
+                {
+                    order.push_back(i);
+                    area += static_cast<int64_t>(bounds.width + Padding * 2) * (bounds.height + Padding * 2);
+                }
+            }
+
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+            {
+                return fields[a].bounds.height > fields[b].bounds.height;
+            });
+
+            // The narrowest power of two width that the fields fit at no taller than maxSize, and
+            // only as tall as they need.
+            int width = 1;
+
+            while (static_cast<int64_t>(width) * width < area)
+                width *= 2;
+
+            SkylinePacker packer(width, maxSize);
+
+            for (;;)
+            {
+                if (width > maxSize)
+                    return false;
+
+                packer.Reset(width, maxSize);
+
+                bool fits = true;
+
+                for (size_t i : order)
+                {
+                    auto& field = fields[i];
+
+                    if (!packer.Insert(field.bounds.width + Padding * 2, field.bounds.height + Padding * 2, &field.x, &field.y))
+                    {
+                        fits = false;
+                        break;
+                    }
+
+                    field.x += Padding;
+                    field.y += Padding;
+                }
+
+                if (fits)
+                    break;
+
+                width *= 2;
+            }
+
+            mWidth = width;
+            mHeight = std::max(packer.UsedHeight(), 1);
+            mTexels.assign(static_cast<size_t>(mWidth) * mHeight * mBytesPerTexel, 0);
+
+            // Fields are disjoint rectangles of the atlas, so threads write them without locking.
+            std::atomic<size_t> next(0);
+            size_t const pitch = static_cast<size_t>(mWidth) * mBytesPerTexel;
+
+            auto work = [&]()
+            {
+                DistanceFieldGenerator generator;
+                GlyphOutline glyphOutline;
+
+                for (size_t i = next++; i < fields.size(); i = next++)
+                {
+                    auto const& field = fields[i];
+
+                    if (field.bounds.width <= 0)
+                        continue;
+
+                    font.GetOutline(field.glyph, &glyphOutline);
+
+                    generator.Generate(glyphOutline, scale, field.bounds, range, multiChannel, &mTexels[field.y * pitch + field.x * mBytesPerTexel], pitch);
+                }
+            };
+
+            size_t threads = std::min<size_t>(std::max(threadCount, 1u), std::max<size_t>(fields.size(), 1));
+            std::vector<std::thread> workers;
+
+            for (size_t i = 1; i < threads; i++)
+            {
+                workers.emplace_back(work);
+            }
+
+            work();
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            for (size_t i = 0; i < mGlyphs.size(); i++)
+            {
+                auto const& field = fields[fieldOfGlyph[i]];
+                auto& glyph = mGlyphs[i];
+
+                if (field.bounds.width > 0)
+                {
+                    glyph.x = field.x;
+                    glyph.y = field.y;
+                    glyph.width = field.bounds.width;
+                    glyph.height = field.bounds.height;
+                    glyph.left = field.bounds.left;
+                    glyph.top = field.bounds.top;
+                }
+            }
+
+            return true;
+        }
+
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+        size_t BytesPerTexel() const { return mBytesPerTexel; }
+
+        std::vector<uint8_t> const& Texels() const { return mTexels; }
+        std::vector<Glyph> const& Glyphs() const { return mGlyphs; }
+
+    private:
+        int mWidth;
+        int mHeight;
+        size_t mBytesPerTexel;
+
+        std::vector<uint8_t> mTexels;
+        std::vector<Glyph> mGlyphs;
+    };
+}
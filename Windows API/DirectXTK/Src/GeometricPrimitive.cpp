@@ -84,6 +84,8 @@ public:
 
     void Draw(_In_ IEffect* effect, _In_ ID3D11InputLayout* inputLayout, bool alpha, bool wireframe, std::function<void()>& setCustomState) const;
 
+    void DrawInstanced(_In_ IEffect* effect, _In_ ID3D11InputLayout* inputLayout, uint32_t instanceCount, bool alpha, bool wireframe, uint32_t startInstanceLocation, std::function<void()>& setCustomState) const;
+
     void CreateInputLayout(_In_ IEffect* effect, _Outptr_ ID3D11InputLayout** inputLayout) const;
 
 private:
@@ -92,6 +94,8 @@ private:
 
     UINT mIndexCount;
 
+    void PrepareForDraw(_In_ IEffect* effect, _In_ ID3D11InputLayout* inputLayout, bool alpha, bool wireframe, std::function<void()>& setCustomState) const;
+
     // Only one of these helpers is allocated per D3D device context, even if there are multiple GeometricPrimitive instances.
     class SharedResources
     {
@@ -239,9 +243,9 @@ void XM_CALLCONV GeometricPrimitive::Impl::Draw(
 }
 
 
-// Draw the primitive using a custom effect.
+// Sets all state shared by Draw and DrawInstanced.
 _Use_decl_annotations_
-void GeometricPrimitive::Impl::Draw(
+void GeometricPrimitive::Impl::PrepareForDraw(
     IEffect* effect,
     ID3D11InputLayout* inputLayout,
     bool alpha,
@@ -278,10 +282,41 @@ void GeometricPrimitive::Impl::Draw(
         setCustomState();
     }
 
-    // Draw the primitive.
     deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+
+// Draw the primitive using a custom effect.
+_Use_decl_annotations_
+void GeometricPrimitive::Impl::Draw(
+    IEffect* effect,
+    ID3D11InputLayout* inputLayout,
+    bool alpha,
+    bool wireframe,
+    std::function<void()>& setCustomState) const
+{
+    PrepareForDraw(effect, inputLayout, alpha, wireframe, setCustomState);
+
+    // Draw the primitive.
+    mResources->deviceContext->DrawIndexed(mIndexCount, 0, 0);
+}
 
-    deviceContext->DrawIndexed(mIndexCount, 0, 0);
+
+// Draw instanceCount copies of the primitive using a custom effect.
+_Use_decl_annotations_
+void GeometricPrimitive::Impl::DrawInstanced(
+    IEffect* effect,
+    ID3D11InputLayout* inputLayout,
+    uint32_t instanceCount,
+    bool alpha,
+    bool wireframe,
+    uint32_t startInstanceLocation,
+    std::function<void()>& setCustomState) const
+{
+    PrepareForDraw(effect, inputLayout, alpha, wireframe, setCustomState);
+
+    // Draw the primitive.
+    mResources->deviceContext->DrawIndexedInstanced(mIndexCount, instanceCount, 0, 0, startInstanceLocation);
 }
 
 
@@ -347,6 +382,20 @@ void GeometricPrimitive::Draw(
 }
 
 
+_Use_decl_annotations_
+void GeometricPrimitive::DrawInstanced(
+    IEffect* effect,
+    ID3D11InputLayout* inputLayout,
+    uint32_t instanceCount,
+    bool alpha,
+    bool wireframe,
+    uint32_t startInstanceLocation,
+    std::function<void()> setCustomState) const
+{
+    pImpl->DrawInstanced(effect, inputLayout, instanceCount, alpha, wireframe, startInstanceLocation, setCustomState);
+}
+
+
 _Use_decl_annotations_
 void GeometricPrimitive::CreateInputLayout(IEffect* effect, ID3D11InputLayout** inputLayout) const
 {
@@ -0,0 +1,407 @@
+//--------------------------------------------------------------------------------------
+// File: GlyphAtlasCache.h
+//
+// Decides where glyphs rasterized on demand go in an atlas, and which to replace once
+// it is full. The atlas is stacked with shelves, each opened as tall as the glyph that
+// needed it; a shelf keeps a list of free spans, so the space of a replaced glyph can
+// be reused right away, and shelves left empty merge back into free height. Replacement
+// is least recently used first, but never a glyph used since the last NextFrame: sprites
+// queued with it may not have been drawn yet. When even that is not enough, the owner
+// can Grow the atlas taller. Nothing here touches D3D, so it can be tested and
+// benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace DirectX
+{
+    class GlyphAtlasCache
+    {
+    public:
+        struct Entry
+        {
+            uint32_t key;
+            int x;          // Inside the padding.
+            int y;
+            int width;
+            int height;
+            uint64_t lastUsed;
+            bool live;
+        };
+
+        struct Statistics
+        {
+            size_t Hits;
+            size_t Misses;
+            size_t Evictions;
+            size_t Glyphs;
+        };
+
+        GlyphAtlasCache(int width, int height, int padding) :
+            mWidth(width),
+            mHeight(height),
+            mTop(0),
+            mPadding(padding),
+            mClock(0),
+            mFrameStart(1),
+            mHits(0),
+            mMisses(0),
+            mEvictions(0),
+            mLiveCount(0)
+        {
+        }
+
+        // Returns the entry id of key and marks it used, or -1 after counting a miss.
+        int Find(uint32_t key)
+        {
+            auto it = mKeys.find(key);
+
+            if (it == mKeys.end())
+            {
+                mMisses++;
+                return -1;
+            }
+
+            mHits++;
+            Touch(it->second);
+
+            return it->second;
+        }
+
+        // Places a width by height glyph for key, which Find just missed, replacing least recently
+        // used glyphs as needed. Returns -1 if it cannot fit without replacing a glyph used this
+        // frame; Grow the atlas and try again. Glyphs with no area take no space and are never replaced.
+        int Insert(uint32_t key, int width, int height)
+        {
+            int x = 0;
+            int y = 0;
+
+            if (width > 0 && height > 0)
+            {
+                int paddedWidth = width + mPadding * 2;
+                int paddedHeight = height + mPadding * 2;
+
+                if (paddedWidth > mWidth || paddedHeight > mHeight)
+                    return -1;
+
+                while (!Allocate(paddedWidth, paddedHeight, &x, &y))
+                {
+                    if (!EvictOne())
+                        return -1;
+                }
+
+                x += mPadding;
+                y += mPadding;
+            }
+            else
+            {
+                width = 0;
+                height = 0;
+            }
+
+            int id;
+
+            if (mFreeIds.empty())
+            {
+                id = static_cast<int>(mEntries.size());
+                mEntries.push_back(Entry());
+            }
+            else
+            {
+                id = mFreeIds.back();
+                mFreeIds.pop_back();
+            }
+
+            mEntries[id] = Entry{ key, x, y, width, height, ++mClock, true };
+            mKeys[key] = id;
+            mLiveCount++;
+
+            return id;
+        }
+
+        void Touch(int id)
+        {
+            mEntries[id].lastUsed = ++mClock;
+        }
+
+        // Glyphs used before this call may be replaced again.
+        void NextFrame()
+        {
+            mFrameStart = mClock + 1;
+        }
+
+        // Adds free height below the glyphs already placed, which keep their positions.
+        void Grow(int height)
+        {
+            mHeight = std::max(mHeight, height);
+        }
+
+        void Clear()
+        {
+            mEntries.clear();
+            mFreeIds.clear();
+            mKeys.clear();
+            mShelves.clear();
+            mTop = 0;
+            mLiveCount = 0;
+        }
+
+        Entry const& operator[](int id) const { return mEntries[id]; }
+
+        // Number of entry ids handed out so far, live or not.
+        size_t Size() const { return mEntries.size(); }
+
+        int Width() const { return mWidth; }
+        int Height() const { return mHeight; }
+        int Padding() const { return mPadding; }
+
+        // Height taken by shelves; the rest of the atlas has never been written since it was last empty.
+        int UsedHeight() const { return mTop; }
+        size_t ShelfCount() const { return mShelves.size(); }
+
+        Statistics GetStatistics() const
+        {
+            return Statistics{ mHits, mMisses, mEvictions, mLiveCount };
+        }
+
+        void ResetStatistics()
+        {
+            mHits = 0;
+            mMisses = 0;
+            mEvictions = 0;
+        }
+
+    private:
+        struct Span
+        {
+            int x;
+            int width;
+        };
+
+        struct Shelf
+        {
+            int y;
+            int height;
+            std::vector<Span> spans;    // Free, sorted by x.
+
+            bool Empty(int width) const { return spans.size() == 1 && spans[0].width == width; }
+        };
+
+        // A shelf may hold glyphs up to a quarter shorter than itself before a new one is opened.
+        static bool CloseFit(int shelfHeight, int height)
+        {
+            return shelfHeight >= height && shelfHeight - height <= height / 4;
+        }
+
+        // Best fit: the shelf closest to the glyph height, then the narrowest free span the glyph
+        // fits in, so wide gaps stay for wide glyphs. Opens a new shelf while there is free height,
+        // and only then settles for a shelf much taller than the glyph.
+        bool Allocate(int width, int height, int* x, int* y)
+        {
+            size_t shelf = FindSpan(width, height, true);
+
+            if (shelf == SIZE_MAX && mTop + height <= mHeight)
+            {
+                mShelves.push_back(Shelf{ mTop, height, std::vector<Span>(1, Span{ 0, mWidth }) });
+                mTop += height;
+                shelf = mShelves.size() - 1;
+            }
+
+            if (shelf == SIZE_MAX)
+            {
+                shelf = FindSpan(width, height, false);
+
+                if (shelf == SIZE_MAX)
+                    return false;
+            }
+
+            // An empty shelf gives the glyph only its height; the rest becomes another empty shelf.
+            if (mShelves[shelf].Empty(mWidth) && mShelves[shelf].height > height)
+            {
+                Shelf rest{ mShelves[shelf].y + height, mShelves[shelf].height - height, std::vector<Span>(1, Span{ 0, mWidth }) };
+
+                mShelves[shelf].height = height;
+                mShelves.insert(mShelves.begin() + shelf + 1, std::move(rest));
+            }
+
+            auto& spans = mShelves[shelf].spans;
+            size_t best = 0;
+
+            for (size_t s = 1; s < spans.size(); s++)
+            {
+                if (spans[s].width >= width && (spans[best].width < width || spans[s].width < spans[best].width))
+                    best = s;
+            }
+
+            Span& span = spans[best];
+
+            *x = span.x;
+            *y = mShelves[shelf].y;
+
+            span.x += width;
+            span.width -= width;
+
+            if (!span.width)
+                spans.erase(spans.begin() + best);
+
+            return true;
+        }
+
+        // The shelf with the least height to spare that has a free span at least width wide, or
+        // SIZE_MAX. Empty shelves count as a close fit, since Allocate cuts them down to size.
+        size_t FindSpan(int width, int height, bool closeFit) const
+        {
+            size_t best = SIZE_MAX;
+            int bestSpare = INT32_MAX;
+
+            for (size_t i = 0; i < mShelves.size(); i++)
+            {
+                auto const& shelf = mShelves[i];
+                bool empty = shelf.Empty(mWidth);
+                int spare = empty ? 0 : shelf.height - height;
+
+                if (shelf.height < height || spare >= bestSpare)
+                    continue;
+
+                if (closeFit && !empty && !CloseFit(shelf.height, height))
+                    continue;
+
+                for (auto const& span : shelf.spans)
+                {
+                    if (span.width >= width)
+                    {
+                        best = i;
+                        bestSpare = spare;
+                        break;
+                    }
+                }
+
+                if (!bestSpare)
+                    break;
+            }
+
+            return best;
+        }
+
+        // Gives a span back to its shelf, merging it with free neighbours. A shelf left empty merges
+        // with empty shelves next to it, and is given back to the free height if it is the last one.
+        void Free(int x, int y, int width)
+        {
+            auto shelf = std::upper_bound(mShelves.begin(), mShelves.end(), y, [](int value, Shelf const& s)
+            {
+                return value < s.y;
+            }) - 1;
+
+            auto& spans = shelf->spans;
+
+            auto it = std::lower_bound(spans.begin(), spans.end(), x, [](Span const& span, int value)
+            {
+                return span.x < value;
+            });
+
+            it = spans.insert(it, Span{ x, width });
+
+            auto next = it + 1;
+
+            if (next != spans.end() && it->x + it->width == next->x)
+            {
+                it->width += next->width;
+                spans.erase(next);
+            }
+
+            if (it != spans.begin())
+            {
+                auto previous = it - 1;
+
+                if (previous->x + previous->width == it->x)
+                {
+                    previous->width += it->width;
+                    spans.erase(it);
+                }
+            }
+
+            if (!shelf->Empty(mWidth))
+                return;
+
+            if (shelf + 1 != mShelves.end() && (shelf + 1)->Empty(mWidth))
+            {
+                shelf->height += (shelf + 1)->height;
+                mShelves.erase(shelf + 1);
+            }
+
+            if (shelf != mShelves.begin() && (shelf - 1)->Empty(mWidth))
+            {
+                (shelf - 1)->height += shelf->height;
+                shelf = mShelves.erase(shelf) - 1;
+            }
+
+            if (shelf + 1 == mShelves.end())
+            {
+                mTop = shelf->y;
+                mShelves.pop_back();
+            }
+        }
+
+        // Replaces the least recently used glyph that takes space and was not used this frame.
+        bool EvictOne()
+        {
+            int victim = -1;
+            uint64_t oldest = mFrameStart;
+
+            for (size_t id = 0; id < mEntries.size(); id++)
+            {
+                Entry const& entry = mEntries[id];
+
+                if (entry.live && entry.width && entry.lastUsed < oldest)
+                {
+                    victim = static_cast<int>(id);
+                    oldest = entry.lastUsed;
+                }
+            }
+
+            if (victim < 0)
+                return false;
+
+            Entry& entry = mEntries[victim];
+
+            Free(entry.x - mPadding, entry.y - mPadding, entry.width + mPadding * 2);
+
+            mKeys.erase(entry.key);
+            entry.live = false;
+            mFreeIds.push_back(victim);
+            mLiveCount--;
+            mEvictions++;
+
+            return true;
+        }
+
+        int mWidth;
+        int mHeight;
+        int mTop;
+        int mPadding;
+
+        // Every use gets the next clock value; entries used at or after mFrameStart are pinned.
+        uint64_t mClock;
+        uint64_t mFrameStart;
+
+        size_t mHits;
+        size_t mMisses;
+        size_t mEvictions;
+        size_t mLiveCount;
+
+        std::vector<Entry> mEntries;
+        std::vector<int> mFreeIds;
+        std::unordered_map<uint32_t, int> mKeys;
+
+        // Sorted by y, one on top of the next from 0 to mTop.
+        std::vector<Shelf> mShelves;
+    };
+}
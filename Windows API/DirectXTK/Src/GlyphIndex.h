@@ -0,0 +1,281 @@
+//--------------------------------------------------------------------------------------
+// File: GlyphIndex.h
+//
+// Constant-time codepoint to glyph index lookup for SpriteFont, built when the font
+// loads. Codepoints in well-populated 256-character pages (ASCII, Latin, kana, the
+// common CJK ideographs) are found by direct indexing; the rest go in a minimal
+// perfect hash. Nothing here touches D3D, so it can be benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace DirectX
+{
+    class GlyphIndex
+    {
+    public:
+        static const uint32_t NotFound = UINT32_MAX;
+
+        // A page gets a direct table once it holds this many glyphs; pages with fewer are hashed.
+        static const size_t MinDenseGlyphs = 16;
+
+        static const uint32_t MaxCodepoint = 0x10FFFF;
+        static const uint32_t PageBits = 8;
+        static const uint32_t PageSize = 1u << PageBits;
+
+        GlyphIndex() :
+            mSeedMask(0),
+            mSlotMask(0)
+        {
+        }
+
+        // codepoints[i] is the character of glyph i. For repeated codepoints the first glyph wins.
+        void Build(uint32_t const* codepoints, size_t count)
+        {
+            mPages.clear();
+            mTable.clear();
+            mSeeds.clear();
+            mKeys.clear();
+            mValues.clear();
+            mSeedMask = 0;
+            mSlotMask = 0;
+
+            // Count glyphs per page. Dense entries are 16 bits, so huge fonts are hashed throughout.
+            std::vector<uint32_t> pageCounts;
+
+            if (count < NoEntry)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (codepoints[i] > MaxCodepoint)
+                        continue;
+
+                    uint32_t page = codepoints[i] >> PageBits;
+
+                    if (page >= pageCounts.size())
+                        pageCounts.resize(page + 1);
+
+                    pageCounts[page]++;
+                }
+            }
+
+            size_t lastDense = 0;
+
+            for (size_t page = 0; page < pageCounts.size(); page++)
+            {
+                if (pageCounts[page] >= MinDenseGlyphs)
+                    lastDense = page + 1;
+            }
+
+            mPages.assign(lastDense, static_cast<uint32_t>(NoPage));
+
+            for (size_t page = 0; page < lastDense; page++)
+            {
+                if (pageCounts[page] >= MinDenseGlyphs)
+                {
+                    mPages[page] = static_cast<uint32_t>(mTable.size());
+                    mTable.resize(mTable.size() + PageSize, static_cast<uint16_t>(NoEntry));
+                }
+            }
+
+            std::vector<uint32_t> sparseKeys;
+            std::vector<uint32_t> sparseValues;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                uint32_t character = codepoints[i];
+                uint32_t page = character >> PageBits;
+
+                if (page < mPages.size() && mPages[page] != NoPage)
+                {
+                    uint16_t& entry = mTable[mPages[page] + (character & (PageSize - 1))];
+
+                    if (entry == NoEntry)
+                        entry = static_cast<uint16_t>(i);
+                }
+                else
+                {
+                    sparseKeys.push_back(character);
+                    sparseValues.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            BuildHash(sparseKeys, sparseValues);
+        }
+
+        uint32_t Find(uint32_t character) const
+        {
+            uint32_t page = character >> PageBits;
+
+            if (page < mPages.size() && mPages[page] != NoPage)
+            {
+                uint16_t entry = mTable[mPages[page] + (character & (PageSize - 1))];
+
+                return (entry != NoEntry) ? entry : NotFound;
+            }
+
+            if (mKeys.empty())
+                return NotFound;
+
+            uint32_t slot = Hash(character, mSeeds[Hash(character, 0) & mSeedMask]) & mSlotMask;
+
+            return (mKeys[slot] == character) ? mValues[slot] : NotFound;
+        }
+
+        // Bytes used by the lookup structures.
+        size_t MemorySize() const
+        {
+            return mPages.size() * sizeof(uint32_t) + mTable.size() * sizeof(uint16_t) + mSeeds.size() * sizeof(uint32_t) +
+                   mKeys.size() * sizeof(uint32_t) + mValues.size() * sizeof(uint32_t);
+        }
+
+    private:
+        static const uint32_t NoPage = UINT32_MAX;
+        static const uint16_t NoEntry = UINT16_MAX;
+        static const uint32_t EmptyKey = UINT32_MAX;
+
+        static uint32_t Hash(uint32_t key, uint32_t seed)
+        {
+            uint32_t x = (key ^ seed) * 0x9E3779B1u;
+
+            x ^= x >> 15;
+            x *= 0x85EBCA77u;
+            x ^= x >> 13;
+
+            return x;
+        }
+
+        // Hash and displace: keys are spread over buckets by one hash, then each bucket, largest
+        // first, searches for a seed that sends all of its keys to free slots. A lookup is then
+        // two hashes and one comparison, whatever the key.
+        void BuildHash(std::vector<uint32_t> const& keys, std::vector<uint32_t> const& values)
+        {
+            if (keys.empty())
+                return;
+
+            size_t slotCount = 1;
+
+            while (slotCount < keys.size())
+                slotCount *= 2;
+
+            size_t bucketCount = 1;
+
+            while (bucketCount * 4 < keys.size())
+                bucketCount *= 2;
+
+            while (!TryBuildHash(keys, values, bucketCount, slotCount))
+            {
+                slotCount *= 2;
+            }
+        }
+
+        bool TryBuildHash(std::vector<uint32_t> const& keys, std::vector<uint32_t> const& values, size_t bucketCount, size_t slotCount)
+        {
+            static const uint32_t MaxSeed = 1u << 16;
+
+            std::vector<std::vector<size_t>> buckets(bucketCount);
+
+            for (size_t i = 0; i < keys.size(); i++)
+            {
+                buckets[Hash(keys[i], 0) & (bucketCount - 1)].push_back(i);
+            }
+
+            std::vector<size_t> order(bucketCount);
+
+            for (size_t i = 0; i < bucketCount; i++)
+                order[i] = i;
+
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+            {
+                return buckets[a].size() > buckets[b].size();
+            });
+
+            mSeeds.assign(bucketCount, 0);
+            mKeys.assign(slotCount, static_cast<uint32_t>(EmptyKey));
+            mValues.assign(slotCount, static_cast<uint32_t>(NotFound));
+            mSeedMask = static_cast<uint32_t>(bucketCount - 1);
+            mSlotMask = static_cast<uint32_t>(slotCount - 1);
+
+            std::vector<size_t> slots;
+
+            for (size_t b : order)
+            {
+                std::vector<size_t> const& bucket = buckets[b];
+
+                if (bucket.empty())
+                    break;
+
+                uint32_t seed = 1;
+
+                for (; seed < MaxSeed; seed++)
+                {
+                    slots.clear();
+
+                    for (size_t i : bucket)
+                    {
+                        size_t slot = Hash(keys[i], seed) & mSlotMask;
+
+                        // A repeated codepoint needs no slot of its own; the first glyph keeps it.
+                        bool repeated = false;
+
+                        for (size_t j : bucket)
+                        {
+                            if (j == i)
+                                break;
+
+                            if (keys[j] == keys[i])
+                                repeated = true;
+                        }
+
+                        if (repeated)
+                        {
+                            slots.push_back(SIZE_MAX);
+                            continue;
+                        }
+
+                        if (mKeys[slot] != EmptyKey || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                            break;
+
+                        slots.push_back(slot);
+                    }
+
+                    if (slots.size() == bucket.size())
+                        break;
+                }
+
+                if (seed == MaxSeed)
+                    return false;
+
+                mSeeds[b] = seed;
+
+                for (size_t k = 0; k < bucket.size(); k++)
+                {
+                    if (slots[k] != SIZE_MAX)
+                    {
+                        mKeys[slots[k]] = keys[bucket[k]];
+                        mValues[slots[k]] = values[bucket[k]];
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // Dense pages: mPages[codepoint >> PageBits] is the offset of that page in mTable.
+        std::vector<uint32_t> mPages;
+        std::vector<uint16_t> mTable;
+
+        // Sparse codepoints.
+        std::vector<uint32_t> mSeeds;
+        std::vector<uint32_t> mKeys;
+        std::vector<uint32_t> mValues;
+        uint32_t mSeedMask;
+        uint32_t mSlotMask;
+    };
+}
@@ -231,6 +231,44 @@ void XM_CALLCONV ModelMesh::Draw(
 // Model
 //--------------------------------------------------------------------------------------
 
+namespace
+{
+    // Skinned meshes are deformed by the bone transforms, so the bind-pose bounds
+    // stored in the file do not describe where they end up on screen.
+    bool IsSkinned(const ModelMesh* mesh)
+    {
+        for (auto it = mesh->meshParts.cbegin(); it != mesh->meshParts.cend(); ++it)
+        {
+            if (dynamic_cast<IEffectSkinning*>((*it)->effect.get()))
+                return true;
+        }
+
+        return false;
+    }
+
+    // Clip planes extracted from world * view * projection are in model space, so the
+    // mesh bounds can be tested without transforming them (works for any scale or projection).
+    // DirectXCollision expects normalized planes facing out of the volume.
+    bool XM_CALLCONV IsVisible(const ModelMesh* mesh, FXMMATRIX worldViewProjection)
+    {
+        XMMATRIX m = XMMatrixTranspose(worldViewProjection);
+
+        XMVECTOR left   = XMPlaneNormalize(XMVectorNegate(XMVectorAdd(m.r[3], m.r[0])));
+        XMVECTOR right  = XMPlaneNormalize(XMVectorSubtract(m.r[0], m.r[3]));
+        XMVECTOR bottom = XMPlaneNormalize(XMVectorNegate(XMVectorAdd(m.r[3], m.r[1])));
+        XMVECTOR top    = XMPlaneNormalize(XMVectorSubtract(m.r[1], m.r[3]));
+        XMVECTOR nearp  = XMPlaneNormalize(XMVectorNegate(m.r[2]));
+        XMVECTOR farp   = XMPlaneNormalize(XMVectorSubtract(m.r[2], m.r[3]));
+
+        // The sphere is the cheaper test, the box is the tighter one
+        if (mesh->boundingSphere.ContainedBy(left, right, bottom, top, nearp, farp) == DISJOINT)
+            return false;
+
+        return mesh->boundingBox.ContainedBy(left, right, bottom, top, nearp, farp) != DISJOINT;
+    }
+}
+
+
 Model::~Model()
 {
 }
@@ -247,22 +285,35 @@ void XM_CALLCONV Model::Draw(
 {
     assert(deviceContext != 0);
 
-    // Draw opaque parts
+    // Cull meshes outside the view frustum once, before recording either pass
+    XMMATRIX worldViewProjection = XMMatrixMultiply(XMMatrixMultiply(world, view), projection);
+
+    auto& visible = mVisible;
+    visible.clear();
+
     for (auto it = meshes.cbegin(); it != meshes.cend(); ++it)
     {
         auto mesh = it->get();
         assert(mesh != 0);
 
+        if (IsSkinned(mesh) || IsVisible(mesh, worldViewProjection))
+            visible.push_back(mesh);
+    }
+
+    // Draw opaque parts
+    for (auto it = visible.cbegin(); it != visible.cend(); ++it)
+    {
+        auto mesh = *it;
+
         mesh->PrepareForRendering(deviceContext, states, false, wireframe);
 
         mesh->Draw(deviceContext, world, view, projection, false, setCustomState);
     }
 
     // Draw alpha parts
-    for (auto it = meshes.cbegin(); it != meshes.cend(); ++it)
+    for (auto it = visible.cbegin(); it != visible.cend(); ++it)
     {
-        auto mesh = it->get();
-        assert(mesh != 0);
+        auto mesh = *it;
 
         mesh->PrepareForRendering(deviceContext, states, true, wireframe);
 
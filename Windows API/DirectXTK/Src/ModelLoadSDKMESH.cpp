@@ -613,16 +613,15 @@ std::unique_ptr<Model> DirectX::Model::CreateFromSDKMESH(ID3D11Device* d3dDevice
 _Use_decl_annotations_
 std::unique_ptr<Model> DirectX::Model::CreateFromSDKMESH(ID3D11Device* d3dDevice, const wchar_t* szFileName, IEffectFactory& fxFactory, bool ccw, bool pmalpha)
 {
-    size_t dataSize = 0;
-    std::unique_ptr<uint8_t[]> data;
-    HRESULT hr = BinaryReader::ReadEntireFile(szFileName, data, &dataSize);
+    MappedFile data;
+    HRESULT hr = BinaryReader::MapEntireFile(szFileName, data);
     if (FAILED(hr))
     {
         DebugTrace("CreateFromSDKMESH failed (%08X) loading '%ls'\n", hr, szFileName);
         throw std::exception("CreateFromSDKMESH");
     }
 
-    auto model = CreateFromSDKMESH(d3dDevice, data.get(), dataSize, fxFactory, ccw, pmalpha);
+    auto model = CreateFromSDKMESH(d3dDevice, data.Data(), data.Size(), fxFactory, ccw, pmalpha);
 
     model->name = szFileName;
 
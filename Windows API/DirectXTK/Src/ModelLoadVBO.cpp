@@ -168,16 +168,15 @@ _Use_decl_annotations_
 std::unique_ptr<Model> DirectX::Model::CreateFromVBO(ID3D11Device* d3dDevice, const wchar_t* szFileName,
                                                      std::shared_ptr<IEffect> ieffect, bool ccw, bool pmalpha)
 {
-    size_t dataSize = 0;
-    std::unique_ptr<uint8_t[]> data;
-    HRESULT hr = BinaryReader::ReadEntireFile(szFileName, data, &dataSize);
+    MappedFile data;
+    HRESULT hr = BinaryReader::MapEntireFile(szFileName, data);
     if (FAILED(hr))
     {
         DebugTrace("CreateFromVBO failed (%08X) loading '%ls'\n", hr, szFileName);
         throw std::exception("CreateFromVBO");
     }
 
-    auto model = CreateFromVBO(d3dDevice, data.get(), dataSize, ieffect, ccw, pmalpha);
+    auto model = CreateFromVBO(d3dDevice, data.Data(), data.Size(), ieffect, ccw, pmalpha);
 
     model->name = szFileName;
 
@@ -0,0 +1,139 @@
+//--------------------------------------------------------------------------------------
+// File: RadixSort.h
+//
+// Stable LSD radix sort of (key, index) pairs. Used by SpriteBatch to order queued
+// sprites by texture or depth without dereferencing SpriteInfo pointers per compare.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+
+namespace DirectX
+{
+    // Maps a float to an unsigned key whose integer order matches the float order.
+    // -0 and +0 compare equal as floats, so they map to the same key.
+    inline uint32_t FloatToSortKey(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        if (bits == 0x80000000u)
+            bits = 0;
+
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+
+    class RadixSorter
+    {
+    public:
+        // Sorts the indices 0..count-1 by keys[index], keeping submission order for equal keys.
+        // The returned array stays valid until the next call.
+        uint32_t const* Sort(uint64_t const* keys, size_t count)
+        {
+            if (mIndices[0].size() < count)
+            {
+                for (int i = 0; i < 2; i++)
+                {
+                    mKeys[i].resize(count);
+                    mIndices[i].resize(count);
+                }
+            }
+
+            uint64_t* srcKeys = mKeys[0].data();
+            uint32_t* srcIndices = mIndices[0].data();
+
+            for (size_t i = 0; i < count; i++)
+            {
+                srcKeys[i] = keys[i];
+                srcIndices[i] = static_cast<uint32_t>(i);
+            }
+
+            // Clearing and scanning eight histograms costs more than sorting a short list directly.
+            if (count < SmallSortThreshold)
+            {
+                InsertionSort(srcKeys, srcIndices, count);
+                return srcIndices;
+            }
+
+            // One pass builds the histograms for every byte.
+            memset(mCounts, 0, sizeof(mCounts));
+
+            for (size_t i = 0; i < count; i++)
+            {
+                uint64_t key = srcKeys[i];
+
+                for (int b = 0; b < 8; b++)
+                {
+                    mCounts[b][(key >> (b * 8)) & 0xFF]++;
+                }
+            }
+
+            uint64_t* dstKeys = mKeys[1].data();
+            uint32_t* dstIndices = mIndices[1].data();
+
+            for (int b = 0; b < 8; b++)
+            {
+                size_t* counts = mCounts[b];
+                int shift = b * 8;
+
+                // Every key has the same value in this byte, so this pass would not move anything.
+                if (counts[(srcKeys[0] >> shift) & 0xFF] == count)
+                    continue;
+
+                size_t offset = 0;
+                for (int d = 0; d < 256; d++)
+                {
+                    size_t c = counts[d];
+                    counts[d] = offset;
+                    offset += c;
+                }
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    uint64_t key = srcKeys[i];
+                    size_t slot = counts[(key >> shift) & 0xFF]++;
+                    dstKeys[slot] = key;
+                    dstIndices[slot] = srcIndices[i];
+                }
+
+                std::swap(srcKeys, dstKeys);
+                std::swap(srcIndices, dstIndices);
+            }
+
+            return srcIndices;
+        }
+
+    private:
+        static const size_t SmallSortThreshold = 64;
+
+        static void InsertionSort(uint64_t* keys, uint32_t* indices, size_t count)
+        {
+            for (size_t i = 1; i < count; i++)
+            {
+                uint64_t key = keys[i];
+                uint32_t index = indices[i];
+                size_t j = i;
+
+                for (; j > 0 && keys[j - 1] > key; j--)
+                {
+                    keys[j] = keys[j - 1];
+                    indices[j] = indices[j - 1];
+                }
+
+                keys[j] = key;
+                indices[j] = index;
+            }
+        }
+
+        std::vector<uint64_t> mKeys[2];
+        std::vector<uint32_t> mIndices[2];
+        size_t mCounts[8][256];
+    };
+}
@@ -0,0 +1,323 @@
+//--------------------------------------------------------------------------------------
+// File: RetainedSprites.h
+//
+// CPU side of SpriteLayer: keeps sprites and their generated vertices between frames,
+// tracks which sprites were edited, and regenerates only those. Vertices are uploaded
+// in coalesced ranges and drawn as runs of sprites that share a texture. Nothing here
+// touches D3D, so it can be tested and benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "SpriteVertexGenerator.h"
+
+
+namespace DirectX
+{
+    // Sprite must have the members SpriteVertexGenerator reads plus a texture handle.
+    template<typename Sprite, typename Vertex, typename Texture>
+    class RetainedSprites
+    {
+    public:
+        static const size_t VerticesPerSprite = 4;
+
+        // Edited sprites this close together are uploaded as one range; resending a few clean
+        // sprites costs less than another upload call.
+        static const size_t MergeGap = 8;
+
+        // Edited sprites generated per SpriteVertexGenerator call.
+        static const size_t BlockSize = 256;
+
+        // Consecutive sprites drawn with one texture. Removed sprites inside a run are left as
+        // degenerate quads rather than splitting it.
+        struct Run
+        {
+            Texture texture;
+            size_t first;
+            size_t count;
+        };
+
+        RetainedSprites() :
+            mLiveCount(0),
+            mRunsDirty(false)
+        {
+        }
+
+        size_t Add(Sprite const& sprite)
+        {
+            size_t id;
+
+            if (mFreeIds.empty())
+            {
+                id = mSprites.size();
+                mSprites.push_back(sprite);
+                mLive.push_back(true);
+                mDirty.push_back(false);
+                mRunTextures.push_back(Texture());
+                mVertices.resize(mSprites.size() * VerticesPerSprite);
+            }
+            else
+            {
+                id = mFreeIds.back();
+                mFreeIds.pop_back();
+                mSprites[id] = sprite;
+                mLive[id] = true;
+            }
+
+            mLiveCount++;
+            mRunsDirty = true;
+            MarkDirty(id);
+
+            return id;
+        }
+
+        // Returns the sprite for editing and schedules its vertices to be regenerated.
+        Sprite& Edit(size_t id)
+        {
+            MarkDirty(id);
+
+            return mSprites[id];
+        }
+
+        void Remove(size_t id)
+        {
+            if (id >= mSprites.size() || !mLive[id])
+                return;
+
+            mLive[id] = false;
+            mLiveCount--;
+            mFreeIds.push_back(id);
+            mRunsDirty = true;
+            MarkDirty(id);
+        }
+
+        void Clear()
+        {
+            mSprites.clear();
+            mLive.clear();
+            mDirty.clear();
+            mRunTextures.clear();
+            mVertices.clear();
+            mFreeIds.clear();
+            mDirtyIds.clear();
+            mRuns.clear();
+            mLiveCount = 0;
+            mRunsDirty = false;
+        }
+
+        bool IsLive(size_t id) const { return id < mSprites.size() && mLive[id]; }
+        Sprite const& operator[](size_t id) const { return mSprites[id]; }
+
+        // Live sprites, and slots including removed ones.
+        size_t Count() const { return mLiveCount; }
+        size_t Size() const { return mSprites.size(); }
+
+        Vertex const* Vertices() const { return mVertices.data(); }
+
+        // Regenerates the vertices of every edited sprite, then calls upload(first, end) for each
+        // coalesced range of sprites whose vertices changed. getTextureSize(texture, float size[2])
+        // supplies texture dimensions for sprites whose source region is in texels.
+        template<typename GetTextureSize, typename Upload>
+        void Update(GetTextureSize const& getTextureSize, Upload const& upload)
+        {
+            if (mDirtyIds.empty())
+                return;
+
+            // With many edits, scanning the flags is cheaper than sorting the list.
+            if (mDirtyIds.size() > mSprites.size() / 16)
+            {
+                mDirtyIds.clear();
+
+                for (size_t id = 0; id < mSprites.size(); id++)
+                {
+                    if (mDirty[id])
+                        mDirtyIds.push_back(static_cast<uint32_t>(id));
+                }
+            }
+            else
+            {
+                std::sort(mDirtyIds.begin(), mDirtyIds.end());
+            }
+
+            // Edited sprites are rarely adjacent, so gather those sharing a texture into blocks, generate
+            // each block into scratch space, then copy every sprite's vertices to its own slot.
+            Texture sizeTexture = Texture();
+            bool haveSize = false;
+            float textureSize[2] = {};
+            float inverseTextureSize[2] = {};
+
+            mSpritePointers.clear();
+
+            for (size_t i = 0; i < mDirtyIds.size(); i++)
+            {
+                size_t id = mDirtyIds[i];
+
+                if (!mLive[id])
+                {
+                    memset(&mVertices[id * VerticesPerSprite], 0, sizeof(Vertex) * VerticesPerSprite);
+                    SetRunTexture(id, Texture());
+                    continue;
+                }
+
+                Texture texture = mSprites[id].texture;
+
+                if (!mSpritePointers.empty() && (texture != sizeTexture || mSpritePointers.size() == BlockSize))
+                {
+                    GenerateBlock(i, textureSize, inverseTextureSize);
+                }
+
+                if (!haveSize || texture != sizeTexture)
+                {
+                    getTextureSize(texture, textureSize);
+                    inverseTextureSize[0] = 1.0f / textureSize[0];
+                    inverseTextureSize[1] = 1.0f / textureSize[1];
+                    sizeTexture = texture;
+                    haveSize = true;
+                }
+
+                mSpritePointers.push_back(&mSprites[id]);
+                SetRunTexture(id, texture);
+            }
+
+            if (!mSpritePointers.empty())
+            {
+                GenerateBlock(mDirtyIds.size(), textureSize, inverseTextureSize);
+            }
+
+            // Coalesce the edited sprites into upload ranges.
+            size_t rangeFirst = mDirtyIds[0];
+            size_t rangeEnd = rangeFirst + 1;
+
+            for (size_t i = 1; i < mDirtyIds.size(); i++)
+            {
+                size_t id = mDirtyIds[i];
+
+                if (id - rangeEnd > MergeGap)
+                {
+                    upload(rangeFirst, rangeEnd);
+                    rangeFirst = id;
+                }
+
+                rangeEnd = id + 1;
+            }
+
+            upload(rangeFirst, rangeEnd);
+
+            for (size_t id : mDirtyIds)
+            {
+                mDirty[id] = false;
+            }
+
+            mDirtyIds.clear();
+        }
+
+        // Draw runs in sprite order. Only valid after Update.
+        std::vector<Run> const& Runs()
+        {
+            if (mRunsDirty)
+            {
+                BuildRuns();
+                mRunsDirty = false;
+            }
+
+            return mRuns;
+        }
+
+    private:
+        void MarkDirty(size_t id)
+        {
+            if (!mDirty[id])
+            {
+                mDirty[id] = true;
+                mDirtyIds.push_back(static_cast<uint32_t>(id));
+            }
+        }
+
+        // Generates the gathered sprites, which are the live ones among the edited ids before end.
+        void GenerateBlock(size_t end, float const textureSize[2], float const inverseTextureSize[2])
+        {
+            size_t count = mSpritePointers.size();
+
+            mScratch.resize(BlockSize * VerticesPerSprite);
+
+            SpriteVertexGenerator::Generate(mSpritePointers.data(), count, mScratch.data(), textureSize, inverseTextureSize);
+
+            Vertex const* source = mScratch.data() + count * VerticesPerSprite;
+
+            for (size_t i = end; count > 0; )
+            {
+                size_t id = mDirtyIds[--i];
+
+                if (!mLive[id])
+                    continue;
+
+                source -= VerticesPerSprite;
+                memcpy(&mVertices[id * VerticesPerSprite], source, sizeof(Vertex) * VerticesPerSprite);
+                count--;
+            }
+
+            mSpritePointers.clear();
+        }
+
+        void SetRunTexture(size_t id, Texture texture)
+        {
+            if (mRunTextures[id] != texture)
+            {
+                mRunTextures[id] = texture;
+                mRunsDirty = true;
+            }
+        }
+
+        void BuildRuns()
+        {
+            mRuns.clear();
+
+            size_t lastLive = 0;
+
+            for (size_t id = 0; id < mSprites.size(); id++)
+            {
+                if (!mLive[id])
+                    continue;
+
+                Texture texture = mRunTextures[id];
+
+                if (mRuns.empty() || mRuns.back().texture != texture)
+                {
+                    // Removed sprites between two runs are not drawn at all.
+                    if (!mRuns.empty())
+                    {
+                        mRuns.back().count = lastLive + 1 - mRuns.back().first;
+                    }
+
+                    mRuns.push_back(Run{ texture, id, 0 });
+                }
+
+                lastLive = id;
+            }
+
+            if (!mRuns.empty())
+            {
+                mRuns.back().count = lastLive + 1 - mRuns.back().first;
+            }
+        }
+
+        std::vector<Sprite> mSprites;
+        std::vector<bool> mLive;
+        std::vector<bool> mDirty;
+        std::vector<Texture> mRunTextures;
+        std::vector<Vertex> mVertices;
+        std::vector<Vertex> mScratch;
+        std::vector<size_t> mFreeIds;
+        std::vector<uint32_t> mDirtyIds;
+        std::vector<Sprite const*> mSpritePointers;
+        std::vector<Run> mRuns;
+        size_t mLiveCount;
+        bool mRunsDirty;
+    };
+}
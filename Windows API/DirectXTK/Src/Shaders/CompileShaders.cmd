@@ -185,6 +185,8 @@ call :CompileShaderSM4%1 DebugEffect ps PSRGBBiTangents
 
 call :CompileShader%1 SpriteEffect vs SpriteVertexShader
 call :CompileShader%1 SpriteEffect ps SpritePixelShader
+call :CompileShaderSM4%1 SpriteEffect ps SpriteDistanceFieldPixelShader
+call :CompileShaderSM4%1 SpriteEffect ps SpriteMultiChannelDistanceFieldPixelShader
 
 call :CompileShader%1 DGSLEffect vs main
 call :CompileShader%1 DGSLEffect vs mainVc
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248929
+// http://create.msdn.com/en-US/education/catalog/sample/stock_effects
+
+
+Texture2D<float4> Texture : register(t0);
+sampler TextureSampler : register(s0);
+
+
+cbuffer Parameters : register(b0)
+{
+    row_major float4x4 MatrixTransform;
+};
+
+
+void SpriteVertexShader(inout float4 color    : COLOR0,
+                        inout float2 texCoord : TEXCOORD0,
+                        inout float4 position : SV_Position)
+{
+    position = mul(position, MatrixTransform);
+}
+
+
+float4 SpritePixelShader(float4 color    : COLOR0,
+                         float2 texCoord : TEXCOORD0) : SV_Target0
+{
+    return Texture.Sample(TextureSampler, texCoord) * color;
+}
+
+
+// Distance field textures: 0.5 is the outline and DistanceFieldRange is how far apart, as a
+// fraction of the texture size, the values 0 and 1 lie. Scaling the field by the number of
+// screen pixels that span makes the edge one pixel wide at any magnification.
+cbuffer DistanceFieldParameters : register(b1)
+{
+    float2 DistanceFieldRange;
+};
+
+
+float DistanceFieldOpacity(float distance, float2 texCoord)
+{
+    float screenRange = max(0.5 * dot(DistanceFieldRange, 1 / fwidth(texCoord)), 1);
+
+    return saturate(screenRange * (distance - 0.5) + 0.5);
+}
+
+
+float4 SpriteDistanceFieldPixelShader(float4 color    : COLOR0,
+                                      float2 texCoord : TEXCOORD0) : SV_Target0
+{
+    float distance = Texture.Sample(TextureSampler, texCoord).a;
+
+    return DistanceFieldOpacity(distance, texCoord) * color;
+}
+
+
+// The median of three channels keeps corners sharp that a single distance would round off.
+float4 SpriteMultiChannelDistanceFieldPixelShader(float4 color    : COLOR0,
+                                                  float2 texCoord : TEXCOORD0) : SV_Target0
+{
+    float3 s = Texture.Sample(TextureSampler, texCoord).rgb;
+    float distance = max(min(s.r, s.g), min(max(s.r, s.g), s.b));
+
+    return DistanceFieldOpacity(distance, texCoord) * color;
+}
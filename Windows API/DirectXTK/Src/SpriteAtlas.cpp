@@ -0,0 +1,365 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteAtlas.cpp
+//
+// Runtime texture atlas used by SpriteBatch to merge draws of small textures.
+//--------------------------------------------------------------------------------------
+
+#include "pch.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "SpriteAtlas.h"
+#include "DirectXHelpers.h"
+#include "PlatformHelpers.h"
+#include "AtlasPacker.h"
+
+using namespace DirectX;
+using Microsoft::WRL::ComPtr;
+
+
+namespace
+{
+    // Block-compressed textures can only be copied in whole 4x4 blocks, which the packer does not align to.
+    bool IsBlockCompressed(DXGI_FORMAT format)
+    {
+        return (format >= DXGI_FORMAT_BC1_TYPELESS && format <= DXGI_FORMAT_BC5_SNORM) ||
+               (format >= DXGI_FORMAT_BC6H_TYPELESS && format <= DXGI_FORMAT_BC7_UNORM_SRGB);
+    }
+}
+
+
+// Internal SpriteAtlas implementation class.
+class SpriteAtlas::Impl
+{
+public:
+    Impl(_In_ ID3D11DeviceContext* deviceContext, UINT width, UINT height, DXGI_FORMAT format, UINT padding);
+
+    bool Add(_In_ ID3D11ShaderResourceView* texture);
+    void Remove(_In_ ID3D11ShaderResourceView* texture);
+    bool Defragment();
+    bool Find(_In_ ID3D11ShaderResourceView* texture, _Out_ ID3D11ShaderResourceView** atlasTexture, _Out_ RECT* rectangle) const;
+
+
+    // A texture copied into the atlas.
+    struct Item
+    {
+        ComPtr<ID3D11ShaderResourceView> texture;
+        int id;
+    };
+
+    ComPtr<ID3D11Device> mDevice;
+    ComPtr<ID3D11DeviceContext> mDeviceContext;
+    ComPtr<ID3D11Texture2D> mTexture;
+    ComPtr<ID3D11ShaderResourceView> mTextureView;
+    DXGI_FORMAT mFormat;
+    AtlasLayout mLayout;
+    std::unordered_map<ID3D11ShaderResourceView*, Item> mItems;
+
+private:
+    void CreateTexture(_Out_ ID3D11Texture2D** texture, _Out_ ID3D11ShaderResourceView** textureView);
+    void CopyEntry(_In_ ID3D11Resource* source, UINT subresource, AtlasLayout::Entry const& entry);
+    void CopyTexels(_In_ ID3D11Resource* source, UINT subresource, UINT left, UINT top, UINT right, UINT bottom, int x, int y);
+};
+
+
+SpriteAtlas::Impl::Impl(_In_ ID3D11DeviceContext* deviceContext, UINT width, UINT height, DXGI_FORMAT format, UINT padding)
+  : mDeviceContext(deviceContext),
+    mFormat(format),
+    mLayout(static_cast<int>(width), static_cast<int>(height), static_cast<int>(padding))
+{
+    if (IsBlockCompressed(format))
+    {
+        throw std::exception("SpriteAtlas does not support block-compressed formats");
+    }
+
+    deviceContext->GetDevice(&mDevice);
+
+    CreateTexture(mTexture.GetAddressOf(), mTextureView.GetAddressOf());
+}
+
+
+// Creates an empty atlas texture of the layout's size.
+void SpriteAtlas::Impl::CreateTexture(ID3D11Texture2D** texture, ID3D11ShaderResourceView** textureView)
+{
+    D3D11_TEXTURE2D_DESC desc = {};
+
+    desc.Width = static_cast<UINT>(mLayout.Width());
+    desc.Height = static_cast<UINT>(mLayout.Height());
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+    desc.Format = mFormat;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    ThrowIfFailed(
+        mDevice->CreateTexture2D(&desc, nullptr, texture)
+    );
+
+    SetDebugObjectName(*texture, "DirectXTK:SpriteAtlas");
+
+    ThrowIfFailed(
+        mDevice->CreateShaderResourceView(*texture, nullptr, textureView)
+    );
+
+    SetDebugObjectName(*textureView, "DirectXTK:SpriteAtlas");
+}
+
+
+_Use_decl_annotations_
+bool SpriteAtlas::Impl::Add(ID3D11ShaderResourceView* texture)
+{
+    if (mItems.find(texture) != mItems.end())
+        return true;
+
+    // Only single-sampled 2D textures in the atlas format can be copied.
+    D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc;
+
+    texture->GetDesc(&viewDesc);
+
+    if (viewDesc.ViewDimension != D3D11_SRV_DIMENSION_TEXTURE2D)
+        return false;
+
+    ComPtr<ID3D11Resource> resource;
+    ComPtr<ID3D11Texture2D> texture2D;
+
+    texture->GetResource(&resource);
+
+    if (FAILED(resource.As(&texture2D)))
+        return false;
+
+    D3D11_TEXTURE2D_DESC desc;
+
+    texture2D->GetDesc(&desc);
+
+    if (desc.Format != mFormat || desc.SampleDesc.Count != 1)
+        return false;
+
+    // The atlas has a single mip, so a view with a mip chain would lose its smaller mips and
+    // minified sprites would alias. Those keep drawing from their own texture.
+    UINT mip = viewDesc.Texture2D.MostDetailedMip;
+    UINT viewMips = (viewDesc.Texture2D.MipLevels == UINT(-1)) ? desc.MipLevels - mip : viewDesc.Texture2D.MipLevels;
+
+    if (viewMips != 1)
+        return false;
+
+    int width = static_cast<int>(std::max<UINT>(desc.Width >> mip, 1));
+    int height = static_cast<int>(std::max<UINT>(desc.Height >> mip, 1));
+
+    int id = mLayout.Insert(width, height);
+
+    if (id < 0 && mLayout.ReclaimableArea() > 0 && Defragment())
+    {
+        id = mLayout.Insert(width, height);
+    }
+
+    if (id < 0)
+        return false;
+
+    CopyEntry(resource.Get(), D3D11CalcSubresource(mip, 0, desc.MipLevels), mLayout[id]);
+
+    mItems[texture] = Item{ texture, id };
+
+    return true;
+}
+
+
+_Use_decl_annotations_
+void SpriteAtlas::Impl::Remove(ID3D11ShaderResourceView* texture)
+{
+    auto it = mItems.find(texture);
+
+    if (it == mItems.end())
+        return;
+
+    mLayout.Remove(it->second.id);
+    mItems.erase(it);
+}
+
+
+// Packs the live entries again into a new texture. The old texture stays alive for as long
+// as queued sprites reference it, and their source rectangles still point into it.
+bool SpriteAtlas::Impl::Defragment()
+{
+    std::vector<AtlasLayout::Move> moves;
+
+    if (!mLayout.Defragment(&moves))
+        return false;
+
+    ComPtr<ID3D11Texture2D> texture;
+    ComPtr<ID3D11ShaderResourceView> textureView;
+
+    CreateTexture(texture.GetAddressOf(), textureView.GetAddressOf());
+
+    // Entries that did not move are copied from where they already are.
+    std::vector<const AtlasLayout::Move*> moveOf(mLayout.Size(), nullptr);
+
+    for (auto const& move : moves)
+    {
+        moveOf[move.id] = &move;
+    }
+
+    int padding = mLayout.Padding();
+
+    for (auto const& item : mItems)
+    {
+        AtlasLayout::Entry const& entry = mLayout[item.second.id];
+        const AtlasLayout::Move* move = moveOf[item.second.id];
+
+        int fromX = move ? move->fromX : entry.x;
+        int fromY = move ? move->fromY : entry.y;
+
+        D3D11_BOX box;
+
+        box.left = static_cast<UINT>(fromX - padding);
+        box.top = static_cast<UINT>(fromY - padding);
+        box.front = 0;
+        box.right = static_cast<UINT>(fromX + entry.width + padding);
+        box.bottom = static_cast<UINT>(fromY + entry.height + padding);
+        box.back = 1;
+
+        mDeviceContext->CopySubresourceRegion(texture.Get(), 0, static_cast<UINT>(entry.x - padding), static_cast<UINT>(entry.y - padding), 0, mTexture.Get(), 0, &box);
+    }
+
+    mTexture = texture;
+    mTextureView = textureView;
+
+    return true;
+}
+
+
+_Use_decl_annotations_
+bool SpriteAtlas::Impl::Find(ID3D11ShaderResourceView* texture, ID3D11ShaderResourceView** atlasTexture, RECT* rectangle) const
+{
+    auto it = mItems.find(texture);
+
+    if (it == mItems.end())
+    {
+        *atlasTexture = nullptr;
+        *rectangle = RECT{};
+        return false;
+    }
+
+    AtlasLayout::Entry const& entry = mLayout[it->second.id];
+
+    *atlasTexture = mTextureView.Get();
+    *rectangle = RECT{ entry.x, entry.y, entry.x + entry.width, entry.y + entry.height };
+
+    return true;
+}
+
+
+// Copies the source texels into the entry and repeats its edges across the padding.
+_Use_decl_annotations_
+void SpriteAtlas::Impl::CopyEntry(ID3D11Resource* source, UINT subresource, AtlasLayout::Entry const& entry)
+{
+    UINT w = static_cast<UINT>(entry.width);
+    UINT h = static_cast<UINT>(entry.height);
+    int x = entry.x;
+    int y = entry.y;
+
+    CopyTexels(source, subresource, 0, 0, w, h, x, y);
+
+    for (int i = 1; i <= mLayout.Padding(); i++)
+    {
+        // Edges.
+        CopyTexels(source, subresource, 0, 0, 1, h, x - i, y);
+        CopyTexels(source, subresource, w - 1, 0, w, h, x + entry.width - 1 + i, y);
+        CopyTexels(source, subresource, 0, 0, w, 1, x, y - i);
+        CopyTexels(source, subresource, 0, h - 1, w, h, x, y + entry.height - 1 + i);
+
+        // Corners.
+        for (int j = 1; j <= mLayout.Padding(); j++)
+        {
+            CopyTexels(source, subresource, 0, 0, 1, 1, x - i, y - j);
+            CopyTexels(source, subresource, w - 1, 0, w, 1, x + entry.width - 1 + i, y - j);
+            CopyTexels(source, subresource, 0, h - 1, 1, h, x - i, y + entry.height - 1 + j);
+            CopyTexels(source, subresource, w - 1, h - 1, w, h, x + entry.width - 1 + i, y + entry.height - 1 + j);
+        }
+    }
+}
+
+
+_Use_decl_annotations_
+void SpriteAtlas::Impl::CopyTexels(ID3D11Resource* source, UINT subresource, UINT left, UINT top, UINT right, UINT bottom, int x, int y)
+{
+    D3D11_BOX box = { left, top, 0, right, bottom, 1 };
+
+    mDeviceContext->CopySubresourceRegion(mTexture.Get(), 0, static_cast<UINT>(x), static_cast<UINT>(y), 0, source, subresource, &box);
+}
+
+
+// Public constructor.
+_Use_decl_annotations_
+SpriteAtlas::SpriteAtlas(ID3D11DeviceContext* deviceContext, UINT width, UINT height, DXGI_FORMAT format, UINT padding)
+  : pImpl(std::make_unique<Impl>(deviceContext, width, height, format, padding))
+{
+}
+
+
+// Move constructor.
+SpriteAtlas::SpriteAtlas(SpriteAtlas&& moveFrom) throw()
+  : pImpl(std::move(moveFrom.pImpl))
+{
+}
+
+
+// Move assignment.
+SpriteAtlas& SpriteAtlas::operator= (SpriteAtlas&& moveFrom) throw()
+{
+    pImpl = std::move(moveFrom.pImpl);
+    return *this;
+}
+
+
+// Public destructor.
+SpriteAtlas::~SpriteAtlas()
+{
+}
+
+
+_Use_decl_annotations_
+bool SpriteAtlas::Add(ID3D11ShaderResourceView* texture)
+{
+    return pImpl->Add(texture);
+}
+
+
+_Use_decl_annotations_
+void SpriteAtlas::Remove(ID3D11ShaderResourceView* texture)
+{
+    pImpl->Remove(texture);
+}
+
+
+_Use_decl_annotations_
+bool SpriteAtlas::Contains(ID3D11ShaderResourceView* texture) const
+{
+    return pImpl->mItems.find(texture) != pImpl->mItems.end();
+}
+
+
+bool SpriteAtlas::Defragment()
+{
+    return pImpl->Defragment();
+}
+
+
+_Use_decl_annotations_
+bool SpriteAtlas::Find(ID3D11ShaderResourceView* texture, ID3D11ShaderResourceView** atlasTexture, RECT* rectangle) const
+{
+    return pImpl->Find(texture, atlasTexture, rectangle);
+}
+
+
+ID3D11ShaderResourceView* SpriteAtlas::GetTexture() const
+{
+    return pImpl->mTextureView.Get();
+}
+
+
+float SpriteAtlas::GetOccupancy() const
+{
+    return pImpl->mLayout.Occupancy();
+}
@@ -10,11 +10,15 @@
 #include "pch.h"
 
 #include "SpriteBatch.h"
+#include "SpriteAtlas.h"
 #include "ConstantBuffer.h"
 #include "CommonStates.h"
 #include "VertexTypes.h"
 #include "SharedResourcePool.h"
 #include "AlignedNew.h"
+#include "RadixSort.h"
+#include "SpriteVertexGenerator.h"
+#include "RetainedSprites.h"
 
 using namespace DirectX;
 using Microsoft::WRL::ComPtr;
@@ -25,9 +29,13 @@ namespace
     #if defined(_XBOX_ONE) && defined(_TITLE)
     #include "Shaders/Compiled/XboxOneSpriteEffect_SpriteVertexShader.inc"
     #include "Shaders/Compiled/XboxOneSpriteEffect_SpritePixelShader.inc"
+    #include "Shaders/Compiled/XboxOneSpriteEffect_SpriteDistanceFieldPixelShader.inc"
+    #include "Shaders/Compiled/XboxOneSpriteEffect_SpriteMultiChannelDistanceFieldPixelShader.inc"
     #else
     #include "Shaders/Compiled/SpriteEffect_SpriteVertexShader.inc"
     #include "Shaders/Compiled/SpriteEffect_SpritePixelShader.inc"
+    #include "Shaders/Compiled/SpriteEffect_SpriteDistanceFieldPixelShader.inc"
+    #include "Shaders/Compiled/SpriteEffect_SpriteMultiChannelDistanceFieldPixelShader.inc"
     #endif
 
 
@@ -79,6 +87,20 @@ public:
         FXMVECTOR originRotationDepth,
         int flags);
 
+    void XM_CALLCONV DrawRun(_In_ ID3D11ShaderResourceView* texture,
+        FXMVECTOR destination,
+        _In_reads_(count) RECT const* sourceRectangles,
+        _In_reads_(count) XMFLOAT2 const* origins,
+        size_t count,
+        FXMVECTOR color,
+        float rotation,
+        float layerDepth,
+        int flags);
+
+    void DrawLayer(SpriteLayer::Impl& layer);
+
+    void SetDistanceField(SpriteDistanceField mode, float pixelRange);
+
 
     // Info about a single sprite that is waiting to be drawn.
     __declspec(align(16)) struct SpriteInfo : public AlignedNew<SpriteInfo>
@@ -96,6 +118,10 @@ public:
         static const int DestSizeInPixels = 8;
 
         static_assert((SpriteEffects_FlipBoth & (SourceInTexels | DestSizeInPixels)) == 0, "Flag bits must not overlap");
+        static_assert(SourceInTexels == SpriteVertexGenerator::SourceInTexels &&
+                      DestSizeInPixels == SpriteVertexGenerator::DestSizeInPixels &&
+                      SpriteEffects_FlipHorizontally == SpriteVertexGenerator::FlipHorizontally &&
+                      SpriteEffects_FlipVertically == SpriteVertexGenerator::FlipVertically, "If you change these values, SpriteVertexGenerator must be updated to match");
     };
 
     DXGI_MODE_ROTATION mRotation;
@@ -103,7 +129,29 @@ public:
     bool mSetViewport;
     D3D11_VIEWPORT mViewPort;
 
+    std::function<void(size_t, std::function<void(size_t)> const&)> mVertexDispatcher;
+    size_t mVertexJobs;
+
+    SpriteAtlas const* mAtlas;
+
+    SpriteDistanceField mDistanceField;
+    float mDistanceFieldRange;
+
+
+    // Helpers shared with SpriteLayer.
+    static void XM_CALLCONV StoreSprite(_Out_ SpriteInfo* sprite,
+        _In_ ID3D11ShaderResourceView* texture,
+        FXMVECTOR destination,
+        _In_opt_ RECT const* sourceRectangle,
+        FXMVECTOR color,
+        FXMVECTOR originRotationDepth,
+        int flags);
+
+    static XMVECTOR GetTextureSize(_In_ ID3D11ShaderResourceView* texture);
+
 private:
+    static bool MapToAtlas(RECT const& entry, _In_opt_ RECT const* sourceRectangle, _Out_ RECT* atlasRectangle);
+
     // Implementation helper methods.
     void GrowSpriteQueue();
     void PrepareForRendering();
@@ -113,12 +161,9 @@ private:
 
     void RenderBatch(_In_ ID3D11ShaderResourceView* texture, _In_reads_(count) SpriteInfo const* const* sprites, size_t count);
 
-    static void XM_CALLCONV RenderSprite(_In_ SpriteInfo const* sprite,
-        _Out_writes_(VerticesPerSprite) VertexPositionColorTexture* vertices,
-        FXMVECTOR textureSize,
-        FXMVECTOR inverseTextureSize);
+    bool DrawsDistanceField() const;
+    void XM_CALLCONV SetDistanceFieldRange(FXMVECTOR textureSize);
 
-    static XMVECTOR GetTextureSize(_In_ ID3D11ShaderResourceView* texture);
     XMMATRIX GetViewportTransform(_In_ ID3D11DeviceContext* deviceContext, DXGI_MODE_ROTATION rotation );
 
 
@@ -144,6 +189,12 @@ private:
     std::vector<SpriteInfo const*> mSortedSprites;
 
 
+    // Sort keys are packed into integers and radix sorted together with their queue index,
+    // so sorting never has to chase the SpriteInfo pointers.
+    std::vector<uint64_t> mSortKeys;
+    RadixSorter mSorter;
+
+
     // If each SpriteInfo instance held a refcount on its texture, could end up with
     // many redundant AddRef/Release calls on the same object, so instead we use
     // this separate list to hold just a single refcount each time we change texture.
@@ -169,6 +220,7 @@ private:
 
         ComPtr<ID3D11VertexShader> vertexShader;
         ComPtr<ID3D11PixelShader> pixelShader;
+        ComPtr<ID3D11PixelShader> distanceFieldPixelShaders[2];
         ComPtr<ID3D11InputLayout> inputLayout;
         ComPtr<ID3D11Buffer> indexBuffer;
 
@@ -196,6 +248,7 @@ private:
         ComPtr<ID3D11Buffer> vertexBuffer;
 
         ConstantBuffer<XMMATRIX> constantBuffer;
+        ConstantBuffer<XMFLOAT4> distanceFieldConstantBuffer;
 
         size_t vertexBufferPosition;
 
@@ -261,6 +314,27 @@ void SpriteBatch::Impl::DeviceResources::CreateShaders(_In_ ID3D11Device* device
     SetDebugObjectName(vertexShader.Get(), "DirectXTK:SpriteBatch");
     SetDebugObjectName(pixelShader.Get(),  "DirectXTK:SpriteBatch");
     SetDebugObjectName(inputLayout.Get(),  "DirectXTK:SpriteBatch");
+
+    // The distance field shaders take screen space derivatives, which Feature Level 9.x lacks.
+    if (device->GetFeatureLevel() >= D3D_FEATURE_LEVEL_10_0)
+    {
+        ThrowIfFailed(
+            device->CreatePixelShader(SpriteEffect_SpriteDistanceFieldPixelShader,
+                                      sizeof(SpriteEffect_SpriteDistanceFieldPixelShader),
+                                      nullptr,
+                                      &distanceFieldPixelShaders[0])
+        );
+
+        ThrowIfFailed(
+            device->CreatePixelShader(SpriteEffect_SpriteMultiChannelDistanceFieldPixelShader,
+                                      sizeof(SpriteEffect_SpriteMultiChannelDistanceFieldPixelShader),
+                                      nullptr,
+                                      &distanceFieldPixelShaders[1])
+        );
+
+        SetDebugObjectName(distanceFieldPixelShaders[0].Get(), "DirectXTK:SpriteBatch");
+        SetDebugObjectName(distanceFieldPixelShaders[1].Get(), "DirectXTK:SpriteBatch");
+    }
 }
 
 
@@ -314,6 +388,7 @@ std::vector<short> SpriteBatch::Impl::DeviceResources::CreateIndexValues()
 // Per-context constructor.
 SpriteBatch::Impl::ContextResources::ContextResources(_In_ ID3D11DeviceContext* context)
   :constantBuffer(GetDevice(context).Get()),
+    distanceFieldConstantBuffer(GetDevice(context).Get()),
     vertexBufferPosition(0),
     inImmediateMode(false)
 {
@@ -370,6 +445,10 @@ SpriteBatch::Impl::Impl(_In_ ID3D11DeviceContext* deviceContext)
   : mRotation(DXGI_MODE_ROTATION_IDENTITY),
     mSetViewport(false),
     mViewPort{},
+    mVertexJobs(1),
+    mAtlas(nullptr),
+    mDistanceField(SpriteDistanceField_None),
+    mDistanceFieldRange(4),
     mSpriteQueueCount(0),
     mSpriteQueueArraySize(0),
     mInBeginEndPair(false),
@@ -461,6 +540,16 @@ void XM_CALLCONV SpriteBatch::Impl::Draw(ID3D11ShaderResourceView* texture,
     if (!mInBeginEndPair)
         throw std::exception("Begin must be called before Draw");
 
+    RECT atlasEntry;
+    RECT atlasRectangle;
+    ID3D11ShaderResourceView* atlasTexture;
+
+    if (mAtlas && mAtlas->Find(texture, &atlasTexture, &atlasEntry) && MapToAtlas(atlasEntry, sourceRectangle, &atlasRectangle))
+    {
+        texture = atlasTexture;
+        sourceRectangle = &atlasRectangle;
+    }
+
     // Get a pointer to the output sprite.
     if (mSpriteQueueCount >= mSpriteQueueArraySize)
     {
@@ -469,6 +558,156 @@ void XM_CALLCONV SpriteBatch::Impl::Draw(ID3D11ShaderResourceView* texture,
 
     SpriteInfo* sprite = &mSpriteQueue[mSpriteQueueCount];
 
+    StoreSprite(sprite, texture, destination, sourceRectangle, color, originRotationDepth, flags);
+
+    if (mSortMode == SpriteSortMode_Immediate)
+    {
+        // If we are in immediate mode, draw this sprite straight away.
+        RenderBatch(texture, &sprite, 1);
+    }
+    else
+    {
+        // Queue this sprite for later sorting and batched rendering.
+        mSpriteQueueCount++;
+
+        // Make sure we hold a refcount on this texture until the sprite has been drawn. Only checking the
+        // back of the vector means we will add duplicate references if the caller switches back and forth
+        // between multiple repeated textures, but calling AddRef more times than strictly necessary hurts
+        // nothing, and is faster than scanning the whole list or using a map to detect all duplicates.
+        if (mSpriteTextureReferences.empty() || texture != mSpriteTextureReferences.back().Get())
+        {
+            mSpriteTextureReferences.emplace_back(texture);
+        }
+    }
+}
+
+
+// Adds sprites that differ only in source rectangle and origin to the queue in one step.
+_Use_decl_annotations_
+void XM_CALLCONV SpriteBatch::Impl::DrawRun(ID3D11ShaderResourceView* texture,
+    FXMVECTOR destination,
+    RECT const* sourceRectangles,
+    XMFLOAT2 const* origins,
+    size_t count,
+    FXMVECTOR color,
+    float rotation,
+    float layerDepth,
+    int flags)
+{
+    if (!texture)
+        throw std::exception("Texture cannot be null");
+
+    if (!mInBeginEndPair)
+        throw std::exception("Begin must be called before Draw");
+
+    if (!count)
+        return;
+
+    // Look the texture up once for the whole run.
+    RECT atlasEntry;
+    RECT atlasRectangle;
+    ID3D11ShaderResourceView* atlasTexture = nullptr;
+
+    if (mAtlas && !mAtlas->Find(texture, &atlasTexture, &atlasEntry))
+    {
+        atlasTexture = nullptr;
+    }
+
+    // In immediate mode the run is drawn straight from the start of the queue, which is otherwise unused.
+    while (mSpriteQueueCount + count > mSpriteQueueArraySize)
+    {
+        GrowSpriteQueue();
+    }
+
+    SpriteInfo* sprites = &mSpriteQueue[mSpriteQueueCount];
+    XMVECTOR rotationDepth = XMVectorSet(0, 0, rotation, layerDepth);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        ID3D11ShaderResourceView* spriteTexture = texture;
+        RECT const* sourceRectangle = &sourceRectangles[i];
+
+        if (atlasTexture && MapToAtlas(atlasEntry, sourceRectangle, &atlasRectangle))
+        {
+            spriteTexture = atlasTexture;
+            sourceRectangle = &atlasRectangle;
+        }
+
+        XMVECTOR originRotationDepth = XMVectorPermute<0, 1, 6, 7>(XMLoadFloat2(&origins[i]), rotationDepth);
+
+        StoreSprite(&sprites[i], spriteTexture, destination, sourceRectangle, color, originRotationDepth, flags);
+    }
+
+    if (mSortMode == SpriteSortMode_Immediate)
+    {
+        // The run sits at the start of the queue, where these pointers already point when present.
+        for (size_t i = mSortedSprites.size(); i < count; i++)
+        {
+            mSortedSprites.push_back(&mSpriteQueue[i]);
+        }
+
+        // Sprites that fell outside the atlas entry still use the original texture.
+        size_t start = 0;
+
+        for (size_t i = 1; i <= count; i++)
+        {
+            if (i == count || sprites[i].texture != sprites[start].texture)
+            {
+                RenderBatch(sprites[start].texture, &mSortedSprites[start], i - start);
+                start = i;
+            }
+        }
+    }
+    else
+    {
+        mSpriteQueueCount += count;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (mSpriteTextureReferences.empty() || sprites[i].texture != mSpriteTextureReferences.back().Get())
+            {
+                mSpriteTextureReferences.emplace_back(sprites[i].texture);
+            }
+        }
+    }
+}
+
+
+// Translates a source region into the texture's entry in the atlas, so that sprites using different
+// small textures end up next to each other in one batch. Source regions reaching outside the texture
+// would sample the atlas neighbours instead of wrapping or clamping, so those keep the original.
+_Use_decl_annotations_
+bool SpriteBatch::Impl::MapToAtlas(RECT const& entry, RECT const* sourceRectangle, RECT* atlasRectangle)
+{
+    if (!sourceRectangle)
+    {
+        *atlasRectangle = entry;
+        return true;
+    }
+
+    LONG width = entry.right - entry.left;
+    LONG height = entry.bottom - entry.top;
+
+    if (sourceRectangle->left < 0 || sourceRectangle->top < 0 || sourceRectangle->right > width || sourceRectangle->bottom > height)
+        return false;
+
+    *atlasRectangle = RECT{ entry.left + sourceRectangle->left, entry.top + sourceRectangle->top,
+                            entry.left + sourceRectangle->right, entry.top + sourceRectangle->bottom };
+
+    return true;
+}
+
+
+// Converts Draw parameters into the form the vertex generator reads.
+_Use_decl_annotations_
+void XM_CALLCONV SpriteBatch::Impl::StoreSprite(SpriteInfo* sprite,
+    ID3D11ShaderResourceView* texture,
+    FXMVECTOR destination,
+    RECT const* sourceRectangle,
+    FXMVECTOR color,
+    FXMVECTOR originRotationDepth,
+    int flags)
+{
     XMVECTOR dest = destination;
 
     if (sourceRectangle)
@@ -501,26 +740,6 @@ void XM_CALLCONV SpriteBatch::Impl::Draw(ID3D11ShaderResourceView* texture,
 
     sprite->texture = texture;
     sprite->flags = flags;
-
-    if (mSortMode == SpriteSortMode_Immediate)
-    {
-        // If we are in immediate mode, draw this sprite straight away.
-        RenderBatch(texture, &sprite, 1);
-    }
-    else
-    {
-        // Queue this sprite for later sorting and batched rendering.
-        mSpriteQueueCount++;
-
-        // Make sure we hold a refcount on this texture until the sprite has been drawn. Only checking the
-        // back of the vector means we will add duplicate references if the caller switches back and forth
-        // between multiple repeated textures, but calling AddRef more times than strictly necessary hurts
-        // nothing, and is faster than scanning the whole list or using a map to detect all duplicates.
-        if (mSpriteTextureReferences.empty() || texture != mSpriteTextureReferences.back().Get())
-        {
-            mSpriteTextureReferences.emplace_back(texture);
-        }
-    }
 }
 
 
@@ -568,7 +787,12 @@ void SpriteBatch::Impl::PrepareForRendering()
     deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     deviceContext->IASetInputLayout(mDeviceResources->inputLayout.Get());
     deviceContext->VSSetShader(mDeviceResources->vertexShader.Get(), nullptr, 0);
-    deviceContext->PSSetShader(mDeviceResources->pixelShader.Get(), nullptr, 0);
+
+    auto pixelShader = (mDistanceField == SpriteDistanceField_None)
+        ? mDeviceResources->pixelShader.Get()
+        : mDeviceResources->distanceFieldPixelShaders[mDistanceField - SpriteDistanceField_SingleChannel].Get();
+
+    deviceContext->PSSetShader(pixelShader, nullptr, 0);
 
     // Set the vertex and index buffer.
 #if !defined(_XBOX_ONE) || !defined(_TITLE)
@@ -597,6 +821,14 @@ void SpriteBatch::Impl::PrepareForRendering()
     ID3D11Buffer* constantBuffer = mContextResources->constantBuffer.GetBuffer();
 
     deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
+
+    // The distance field range depends on the texture, so RenderBatch fills this in.
+    if (mDistanceField != SpriteDistanceField_None)
+    {
+        ID3D11Buffer* distanceFieldConstantBuffer = mContextResources->distanceFieldConstantBuffer.GetBuffer();
+
+        deviceContext->PSSetConstantBuffers(1, 1, &distanceFieldConstantBuffer);
+    }
 #endif
 
     // If this is a deferred D3D context, reset position so the first Map call will use D3D11_MAP_WRITE_DISCARD.
@@ -670,34 +902,53 @@ void SpriteBatch::Impl::SortSprites()
         GrowSortedSprites();
     }
 
+    if (mSortMode != SpriteSortMode_Texture &&
+        mSortMode != SpriteSortMode_BackToFront &&
+        mSortMode != SpriteSortMode_FrontToBack)
+    {
+        return;
+    }
+
+    if (mSortKeys.size() < mSpriteQueueCount)
+    {
+        mSortKeys.resize(mSpriteQueueCount);
+    }
+
+    uint64_t* keys = mSortKeys.data();
+
     switch (mSortMode)
     {
         case SpriteSortMode_Texture:
             // Sort by texture.
-            std::sort(mSortedSprites.begin(), mSortedSprites.begin() + mSpriteQueueCount, [](SpriteInfo const* x, SpriteInfo const* y) -> bool
+            for (size_t i = 0; i < mSpriteQueueCount; i++)
             {
-                return x->texture < y->texture;
-            });
+                keys[i] = reinterpret_cast<uintptr_t>(mSpriteQueue[i].texture);
+            }
             break;
 
         case SpriteSortMode_BackToFront:
-            // Sort back to front.
-            std::sort(mSortedSprites.begin(), mSortedSprites.begin() + mSpriteQueueCount, [](SpriteInfo const* x, SpriteInfo const* y) -> bool
+            // Sort back to front, so larger depths get smaller keys.
+            for (size_t i = 0; i < mSpriteQueueCount; i++)
             {
-                return x->originRotationDepth.w > y->originRotationDepth.w;
-            });
+                keys[i] = ~FloatToSortKey(mSpriteQueue[i].originRotationDepth.w);
+            }
             break;
 
-        case SpriteSortMode_FrontToBack:
+        default:
             // Sort front to back.
-            std::sort(mSortedSprites.begin(), mSortedSprites.begin() + mSpriteQueueCount, [](SpriteInfo const* x, SpriteInfo const* y) -> bool
+            for (size_t i = 0; i < mSpriteQueueCount; i++)
             {
-                return x->originRotationDepth.w < y->originRotationDepth.w;
-            });
+                keys[i] = FloatToSortKey(mSpriteQueue[i].originRotationDepth.w);
+            }
             break;
+    }
 
-        default:
-            break;
+    // The sort is stable: sprites with equal keys keep the order they were drawn in.
+    uint32_t const* order = mSorter.Sort(keys, mSpriteQueueCount);
+
+    for (size_t i = 0; i < mSpriteQueueCount; i++)
+    {
+        mSortedSprites[i] = &mSpriteQueue[order[i]];
     }
 }
 
@@ -725,8 +976,18 @@ void SpriteBatch::Impl::RenderBatch(ID3D11ShaderResourceView* texture, SpriteInf
     // Draw using the specified texture.
     deviceContext->PSSetShaderResources(0, 1, &texture);
 
-    XMVECTOR textureSize = GetTextureSize(texture);
-    XMVECTOR inverseTextureSize = XMVectorReciprocal(textureSize);
+    XMVECTOR textureSizeV = GetTextureSize(texture);
+
+    XMFLOAT2 textureSize;
+    XMFLOAT2 inverseTextureSize;
+
+    XMStoreFloat2(&textureSize, textureSizeV);
+    XMStoreFloat2(&inverseTextureSize, XMVectorReciprocal(textureSizeV));
+
+    if (DrawsDistanceField())
+    {
+        SetDistanceFieldRange(textureSizeV);
+    }
             
     while (count > 0)
     {
@@ -769,14 +1030,18 @@ void SpriteBatch::Impl::RenderBatch(ID3D11ShaderResourceView* texture, SpriteInf
         auto vertices = static_cast<VertexPositionColorTexture*>(mappedBuffer.pData) + mContextResources->vertexBufferPosition * VerticesPerSprite;
 #endif
 
-        // Generate sprite vertex data.
-        for (size_t i = 0; i < batchSize; i++)
-        {
-            assert(i < count);
-            _Analysis_assume_(i < count);
-            RenderSprite(sprites[i], vertices, textureSize, inverseTextureSize);
+        // Generate sprite vertex data, several sprites per SIMD iteration. Worker threads fill
+        // disjoint slices of the mapped region and have all finished by the time this returns.
+        assert(batchSize <= count);
+        _Analysis_assume_(batchSize <= count);
 
-            vertices += VerticesPerSprite;
+        if (mVertexDispatcher && mVertexJobs > 1)
+        {
+            SpriteVertexGenerator::GenerateParallel(sprites, batchSize, vertices, &textureSize.x, &inverseTextureSize.x, mVertexDispatcher, mVertexJobs);
+        }
+        else
+        {
+            SpriteVertexGenerator::Generate(sprites, batchSize, vertices, &textureSize.x, &inverseTextureSize.x);
         }
 
 #if defined(_XBOX_ONE) && defined(_TITLE)
@@ -802,118 +1067,49 @@ void SpriteBatch::Impl::RenderBatch(ID3D11ShaderResourceView* texture, SpriteInf
 }
 
 
-// Generates vertex data for drawing a single sprite.
-_Use_decl_annotations_
-void XM_CALLCONV SpriteBatch::Impl::RenderSprite(SpriteInfo const* sprite,
-    VertexPositionColorTexture* vertices,
-    FXMVECTOR textureSize,
-    FXMVECTOR inverseTextureSize)
+// Selects the distance field pixel shader for the following batches.
+void SpriteBatch::Impl::SetDistanceField(SpriteDistanceField mode, float pixelRange)
 {
-    // Load sprite parameters into SIMD registers.
-    XMVECTOR source = XMLoadFloat4A(&sprite->source);
-    XMVECTOR destination = XMLoadFloat4A(&sprite->destination);
-    XMVECTOR color = XMLoadFloat4A(&sprite->color);
-    XMVECTOR originRotationDepth = XMLoadFloat4A(&sprite->originRotationDepth);
-
-    float rotation = sprite->originRotationDepth.z;
-    int flags = sprite->flags;
+    if (mode < SpriteDistanceField_None || mode > SpriteDistanceField_MultiChannel)
+        throw std::out_of_range("SpriteDistanceField");
 
-    // Extract the source and destination sizes into separate vectors.
-    XMVECTOR sourceSize = XMVectorSwizzle<2, 3, 2, 3>(source);
-    XMVECTOR destinationSize = XMVectorSwizzle<2, 3, 2, 3>(destination);
+    if (!(pixelRange > 0))
+        throw std::invalid_argument("pixelRange must be positive");
 
-    // Scale the origin offset by source size, taking care to avoid overflow if the source region is zero.
-    XMVECTOR isZeroMask = XMVectorEqual(sourceSize, XMVectorZero());
-    XMVECTOR nonZeroSourceSize = XMVectorSelect(sourceSize, g_XMEpsilon, isZeroMask);
+    if (mode != SpriteDistanceField_None && !mDeviceResources->distanceFieldPixelShaders[0])
+        throw std::exception("SpriteBatch distance fields require Feature Level 10.0 or later");
 
-    XMVECTOR origin = XMVectorDivide(originRotationDepth, nonZeroSourceSize);
-
-    // Convert the source region from texels to mod-1 texture coordinate format.
-    if (flags & SpriteInfo::SourceInTexels)
-    {
-        source *= inverseTextureSize;
-        sourceSize *= inverseTextureSize;
-    }
-    else
-    {
-        origin *= inverseTextureSize;
-    }
-
-    // If the destination size is relative to the source region, convert it to pixels.
-    if (!(flags & SpriteInfo::DestSizeInPixels))
-    {
-        destinationSize *= textureSize;
-    }
-
-    // Compute a 2x2 rotation matrix.
-    XMVECTOR rotationMatrix1;
-    XMVECTOR rotationMatrix2;
-
-    if (rotation != 0)
-    {
-        float sin, cos;
-
-        XMScalarSinCos(&sin, &cos, rotation);
-
-        XMVECTOR sinV = XMLoadFloat(&sin);
-        XMVECTOR cosV = XMLoadFloat(&cos);
-
-        rotationMatrix1 = XMVectorMergeXY(cosV, sinV);
-        rotationMatrix2 = XMVectorMergeXY(-sinV, cosV);
-    }
-    else
-    {
-        rotationMatrix1 = g_XMIdentityR0;
-        rotationMatrix2 = g_XMIdentityR1;
-    }
-    
-    // The four corner vertices are computed by transforming these unit-square positions.
-    static XMVECTORF32 cornerOffsets[VerticesPerSprite] =
-    {
-        { { { 0, 0, 0, 0 } } },
-        { { { 1, 0, 0, 0 } } },
-        { { { 0, 1, 0, 0 } } },
-        { { { 1, 1, 0, 0 } } },
-    };
+    mDistanceField = mode;
+    mDistanceFieldRange = pixelRange;
+}
 
-    // Tricksy alert! Texture coordinates are computed from the same cornerOffsets
-    // table as vertex positions, but if the sprite is mirrored, this table
-    // must be indexed in a different order. This is done as follows:
-    //
-    //    position = cornerOffsets[i]
-    //    texcoord = cornerOffsets[i ^ SpriteEffects]
 
-    static_assert(SpriteEffects_FlipHorizontally == 1 &&
-                  SpriteEffects_FlipVertically == 2, "If you change these enum values, the mirroring implementation must be updated to match");
+// Whether the distance field pixel shader is the one drawing, rather than ours or a custom one.
+bool SpriteBatch::Impl::DrawsDistanceField() const
+{
+    return mDistanceField != SpriteDistanceField_None && !mSetCustomShaders;
+}
 
-    int mirrorBits = flags & 3;
 
-    // Generate the four output vertices.
-    for (int i = 0; i < VerticesPerSprite; i++)
-    {
-        // Calculate position.
-        XMVECTOR cornerOffset = (cornerOffsets[i] - origin) * destinationSize;
-        
-        // Apply 2x2 rotation matrix.
-        XMVECTOR position1 = XMVectorMultiplyAdd(XMVectorSplatX(cornerOffset), rotationMatrix1, destination);
-        XMVECTOR position2 = XMVectorMultiplyAdd(XMVectorSplatY(cornerOffset), rotationMatrix2, position1);
+// Tells the distance field pixel shader how much of the texture the field range spans.
+void XM_CALLCONV SpriteBatch::Impl::SetDistanceFieldRange(FXMVECTOR textureSize)
+{
+    auto deviceContext = mContextResources->deviceContext.Get();
 
-        // Set z = depth.
-        XMVECTOR position = XMVectorPermute<0, 1, 7, 6>(position2, originRotationDepth);
+    XMFLOAT2 size;
 
-        // Write position as a Float4, even though VertexPositionColor::position is an XMFLOAT3.
-        // This is faster, and harmless as we are just clobbering the first element of the
-        // following color field, which will immediately be overwritten with its correct value.
-        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&vertices[i].position), position);
+    XMStoreFloat2(&size, textureSize);
 
-        // Write the color.
-        XMStoreFloat4(&vertices[i].color, color);
+    XMFLOAT4 range(mDistanceFieldRange / size.x, mDistanceFieldRange / size.y, 0, 0);
 
-        // Compute and write the texture coordinate.
-        XMVECTOR textureCoordinate = XMVectorMultiplyAdd(cornerOffsets[i ^ mirrorBits], sourceSize, source);
+#if defined(_XBOX_ONE) && defined(_TITLE)
+    void* grfxMemory;
+    mContextResources->distanceFieldConstantBuffer.SetData(deviceContext, range, &grfxMemory);
 
-        XMStoreFloat2(&vertices[i].textureCoordinate, textureCoordinate);
-    }
+    deviceContext->PSSetPlacementConstantBuffer(1, mContextResources->distanceFieldConstantBuffer.GetBuffer(), grfxMemory);
+#else
+    mContextResources->distanceFieldConstantBuffer.SetData(deviceContext, range);
+#endif
 }
 
 
@@ -1177,6 +1373,24 @@ void XM_CALLCONV SpriteBatch::Draw(ID3D11ShaderResourceView* texture,
 }
 
 
+_Use_decl_annotations_
+void XM_CALLCONV SpriteBatch::DrawRun(ID3D11ShaderResourceView* texture,
+    FXMVECTOR position,
+    RECT const* sourceRectangles,
+    XMFLOAT2 const* origins,
+    size_t count,
+    FXMVECTOR color,
+    float rotation,
+    FXMVECTOR scale,
+    SpriteEffects effects,
+    float layerDepth)
+{
+    XMVECTOR destination = XMVectorPermute<0, 1, 4, 5>(position, scale); // x, y, scale.x, scale.y
+
+    pImpl->DrawRun(texture, destination, sourceRectangles, origins, count, color, rotation, layerDepth, effects);
+}
+
+
 void SpriteBatch::SetRotation(DXGI_MODE_ROTATION mode)
 {
     pImpl->mRotation = mode;
@@ -1194,3 +1408,409 @@ void SpriteBatch::SetViewport(const D3D11_VIEWPORT& viewPort)
     pImpl->mSetViewport = true;
     pImpl->mViewPort = viewPort;
 }
+
+
+void SpriteBatch::SetVertexDispatcher(std::function<void __cdecl(size_t jobCount, std::function<void __cdecl(size_t job)> const& job)> dispatcher, size_t maxJobs)
+{
+    pImpl->mVertexDispatcher = dispatcher;
+    pImpl->mVertexJobs = dispatcher ? std::max<size_t>(maxJobs, 1) : 1;
+}
+
+
+void SpriteBatch::SetAtlas(SpriteAtlas const* atlas)
+{
+    pImpl->mAtlas = atlas;
+}
+
+
+void SpriteBatch::SetDistanceField(SpriteDistanceField mode, float pixelRange)
+{
+    pImpl->SetDistanceField(mode, pixelRange);
+}
+
+
+_Use_decl_annotations_
+void SpriteBatch::Draw(SpriteLayer& layer)
+{
+    pImpl->DrawLayer(*layer.pImpl);
+}
+
+
+// Internal SpriteLayer implementation class.
+class SpriteLayer::Impl
+{
+public:
+    typedef SpriteBatch::Impl::SpriteInfo SpriteInfo;
+
+    Impl(_In_ ID3D11Device* device);
+
+    size_t XM_CALLCONV Add(_In_ ID3D11ShaderResourceView* texture, FXMVECTOR destination, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color, FXMVECTOR originRotationDepth, int flags);
+    void XM_CALLCONV Set(size_t id, _In_ ID3D11ShaderResourceView* texture, FXMVECTOR destination, _In_opt_ RECT const* sourceRectangle, FXMVECTOR color, FXMVECTOR originRotationDepth, int flags);
+    SpriteInfo& Edit(size_t id);
+    void Remove(size_t id);
+    void Clear();
+
+    // Regenerates edited sprites and uploads their vertices.
+    void Update(_In_ ID3D11DeviceContext* deviceContext);
+
+
+    ComPtr<ID3D11Device> mDevice;
+    ComPtr<ID3D11Buffer> mVertexBuffer;
+    size_t mVertexBufferCapacity;
+
+    RetainedSprites<SpriteInfo, VertexPositionColorTexture, ID3D11ShaderResourceView*> mSprites;
+
+    // One reference per sprite, since sprites outlive any single frame.
+    std::vector<ComPtr<ID3D11ShaderResourceView>> mTextureReferences;
+
+private:
+    void CreateVertexBuffer(size_t capacity);
+    void UploadVertices(_In_ ID3D11DeviceContext* deviceContext, size_t first, size_t end);
+
+    static const size_t InitialCapacity = 256;
+    static const size_t VerticesPerSprite = 4;
+};
+
+
+// Constants.
+const XMFLOAT2 SpriteLayer::Float2Zero(0, 0);
+const XMFLOAT2 SpriteLayer::Float2One(1, 1);
+
+
+SpriteLayer::Impl::Impl(_In_ ID3D11Device* device)
+  : mDevice(device),
+    mVertexBufferCapacity(0)
+{
+}
+
+
+_Use_decl_annotations_
+size_t XM_CALLCONV SpriteLayer::Impl::Add(ID3D11ShaderResourceView* texture, FXMVECTOR destination, RECT const* sourceRectangle, FXMVECTOR color, FXMVECTOR originRotationDepth, int flags)
+{
+    if (!texture)
+        throw std::exception("Texture cannot be null");
+
+    SpriteInfo sprite;
+
+    SpriteBatch::Impl::StoreSprite(&sprite, texture, destination, sourceRectangle, color, originRotationDepth, flags);
+
+    size_t id = mSprites.Add(sprite);
+
+    if (mTextureReferences.size() < mSprites.Size())
+    {
+        mTextureReferences.resize(mSprites.Size());
+    }
+
+    mTextureReferences[id] = texture;
+
+    return id;
+}
+
+
+_Use_decl_annotations_
+void XM_CALLCONV SpriteLayer::Impl::Set(size_t id, ID3D11ShaderResourceView* texture, FXMVECTOR destination, RECT const* sourceRectangle, FXMVECTOR color, FXMVECTOR originRotationDepth, int flags)
+{
+    if (!texture)
+        throw std::exception("Texture cannot be null");
+
+    SpriteBatch::Impl::StoreSprite(&Edit(id), texture, destination, sourceRectangle, color, originRotationDepth, flags);
+
+    mTextureReferences[id] = texture;
+}
+
+
+SpriteLayer::Impl::SpriteInfo& SpriteLayer::Impl::Edit(size_t id)
+{
+    if (!mSprites.IsLive(id))
+        throw std::exception("Invalid SpriteLayer sprite id");
+
+    return mSprites.Edit(id);
+}
+
+
+void SpriteLayer::Impl::Remove(size_t id)
+{
+    if (!mSprites.IsLive(id))
+        return;
+
+    mSprites.Remove(id);
+    mTextureReferences[id].Reset();
+}
+
+
+void SpriteLayer::Impl::Clear()
+{
+    mSprites.Clear();
+    mTextureReferences.clear();
+}
+
+
+_Use_decl_annotations_
+void SpriteLayer::Impl::Update(ID3D11DeviceContext* deviceContext)
+{
+    auto getTextureSize = [](ID3D11ShaderResourceView* texture, float size[2])
+    {
+        XMFLOAT2 textureSize;
+
+        XMStoreFloat2(&textureSize, SpriteBatch::Impl::GetTextureSize(texture));
+
+        size[0] = textureSize.x;
+        size[1] = textureSize.y;
+    };
+
+    if (mSprites.Size() > mVertexBufferCapacity)
+    {
+        // A new buffer starts out empty, so it gets every sprite rather than just the edited ones.
+        CreateVertexBuffer(std::max(mSprites.Size(), std::max(InitialCapacity, mVertexBufferCapacity * 2)));
+
+        mSprites.Update(getTextureSize, [](size_t, size_t) {});
+
+        UploadVertices(deviceContext, 0, mSprites.Size());
+    }
+    else
+    {
+        mSprites.Update(getTextureSize, [&](size_t first, size_t end)
+        {
+            UploadVertices(deviceContext, first, end);
+        });
+    }
+}
+
+
+void SpriteLayer::Impl::CreateVertexBuffer(size_t capacity)
+{
+    D3D11_BUFFER_DESC vertexBufferDesc = {};
+
+    vertexBufferDesc.ByteWidth = static_cast<UINT>(sizeof(VertexPositionColorTexture) * capacity * VerticesPerSprite);
+    vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+
+    mVertexBuffer.Reset();
+
+    ThrowIfFailed(
+        mDevice->CreateBuffer(&vertexBufferDesc, nullptr, &mVertexBuffer)
+    );
+
+    SetDebugObjectName(mVertexBuffer.Get(), "DirectXTK:SpriteLayer");
+
+    mVertexBufferCapacity = capacity;
+}
+
+
+_Use_decl_annotations_
+void SpriteLayer::Impl::UploadVertices(ID3D11DeviceContext* deviceContext, size_t first, size_t end)
+{
+    if (end <= first)
+        return;
+
+    D3D11_BOX box = {};
+
+    box.left = static_cast<UINT>(sizeof(VertexPositionColorTexture) * first * VerticesPerSprite);
+    box.right = static_cast<UINT>(sizeof(VertexPositionColorTexture) * end * VerticesPerSprite);
+    box.bottom = 1;
+    box.back = 1;
+
+    deviceContext->UpdateSubresource(mVertexBuffer.Get(), 0, &box, mSprites.Vertices() + first * VerticesPerSprite, 0, 0);
+}
+
+
+// Draws a retained layer between the sprites queued before and after it.
+void SpriteBatch::Impl::DrawLayer(SpriteLayer::Impl& layer)
+{
+    if (!mInBeginEndPair)
+        throw std::exception("Begin must be called before Draw");
+
+    if (mSortMode != SpriteSortMode_Immediate)
+    {
+        if (mContextResources->inImmediateMode)
+            throw std::exception("Cannot draw a layer while another SpriteBatch is using SpriteSortMode_Immediate");
+
+        // Draw what is queued so far, so it ends up underneath the layer.
+        PrepareForRendering();
+        FlushBatch();
+    }
+
+    auto deviceContext = mContextResources->deviceContext.Get();
+
+    layer.Update(deviceContext);
+
+    auto const& runs = layer.mSprites.Runs();
+
+    if (runs.empty())
+        return;
+
+    ID3D11Buffer* vertexBuffer = layer.mVertexBuffer.Get();
+    UINT vertexStride = sizeof(VertexPositionColorTexture);
+    UINT vertexOffset = 0;
+
+    deviceContext->IASetVertexBuffers(0, 1, &vertexBuffer, &vertexStride, &vertexOffset);
+
+    // The shared index buffer covers MaxBatchSize sprites, so long runs are split, with the base
+    // vertex pointing at each piece.
+    for (auto const& run : runs)
+    {
+        ID3D11ShaderResourceView* texture = run.texture;
+
+        deviceContext->PSSetShaderResources(0, 1, &texture);
+
+        if (DrawsDistanceField())
+        {
+            SetDistanceFieldRange(GetTextureSize(texture));
+        }
+
+        for (size_t first = run.first, remaining = run.count; remaining > 0; )
+        {
+            size_t batchSize = std::min(remaining, MaxBatchSize);
+
+            deviceContext->DrawIndexed((UINT)batchSize * IndicesPerSprite, 0, (INT)(first * VerticesPerSprite));
+
+            first += batchSize;
+            remaining -= batchSize;
+        }
+    }
+
+    // Immediate mode sprites drawn after the layer go through our own vertex buffer again.
+#if !defined(_XBOX_ONE) || !defined(_TITLE)
+    vertexBuffer = mContextResources->vertexBuffer.Get();
+
+    deviceContext->IASetVertexBuffers(0, 1, &vertexBuffer, &vertexStride, &vertexOffset);
+#endif
+}
+
+
+// Public constructor.
+_Use_decl_annotations_
+SpriteLayer::SpriteLayer(ID3D11Device* device)
+  : pImpl(std::make_unique<Impl>(device))
+{
+}
+
+
+// Move constructor.
+SpriteLayer::SpriteLayer(SpriteLayer&& moveFrom) throw()
+  : pImpl(std::move(moveFrom.pImpl))
+{
+}
+
+
+// Move assignment.
+SpriteLayer& SpriteLayer::operator= (SpriteLayer&& moveFrom) throw()
+{
+    pImpl = std::move(moveFrom.pImpl);
+    return *this;
+}
+
+
+// Public destructor.
+SpriteLayer::~SpriteLayer()
+{
+}
+
+
+_Use_decl_annotations_
+size_t XM_CALLCONV SpriteLayer::Add(ID3D11ShaderResourceView* texture,
+    XMFLOAT2 const& position,
+    RECT const* sourceRectangle,
+    FXMVECTOR color,
+    float rotation,
+    XMFLOAT2 const& origin,
+    XMFLOAT2 const& scale,
+    SpriteEffects effects,
+    float layerDepth)
+{
+    XMVECTOR destination = XMVectorPermute<0, 1, 4, 5>(XMLoadFloat2(&position), XMLoadFloat2(&scale)); // x, y, scale.x, scale.y
+
+    XMVECTOR originRotationDepth = XMVectorSet(origin.x, origin.y, rotation, layerDepth);
+
+    return pImpl->Add(texture, destination, sourceRectangle, color, originRotationDepth, effects);
+}
+
+
+_Use_decl_annotations_
+size_t XM_CALLCONV SpriteLayer::Add(ID3D11ShaderResourceView* texture,
+    RECT const& destinationRectangle,
+    RECT const* sourceRectangle,
+    FXMVECTOR color,
+    float rotation,
+    XMFLOAT2 const& origin,
+    SpriteEffects effects,
+    float layerDepth)
+{
+    XMVECTOR destination = LoadRect(&destinationRectangle); // x, y, w, h
+
+    XMVECTOR originRotationDepth = XMVectorSet(origin.x, origin.y, rotation, layerDepth);
+
+    return pImpl->Add(texture, destination, sourceRectangle, color, originRotationDepth, effects | Impl::SpriteInfo::DestSizeInPixels);
+}
+
+
+_Use_decl_annotations_
+void XM_CALLCONV SpriteLayer::Set(size_t id,
+    ID3D11ShaderResourceView* texture,
+    XMFLOAT2 const& position,
+    RECT const* sourceRectangle,
+    FXMVECTOR color,
+    float rotation,
+    XMFLOAT2 const& origin,
+    XMFLOAT2 const& scale,
+    SpriteEffects effects,
+    float layerDepth)
+{
+    XMVECTOR destination = XMVectorPermute<0, 1, 4, 5>(XMLoadFloat2(&position), XMLoadFloat2(&scale)); // x, y, scale.x, scale.y
+
+    XMVECTOR originRotationDepth = XMVectorSet(origin.x, origin.y, rotation, layerDepth);
+
+    pImpl->Set(id, texture, destination, sourceRectangle, color, originRotationDepth, effects);
+}
+
+
+_Use_decl_annotations_
+void XM_CALLCONV SpriteLayer::Set(size_t id,
+    ID3D11ShaderResourceView* texture,
+    RECT const& destinationRectangle,
+    RECT const* sourceRectangle,
+    FXMVECTOR color,
+    float rotation,
+    XMFLOAT2 const& origin,
+    SpriteEffects effects,
+    float layerDepth)
+{
+    XMVECTOR destination = LoadRect(&destinationRectangle); // x, y, w, h
+
+    XMVECTOR originRotationDepth = XMVectorSet(origin.x, origin.y, rotation, layerDepth);
+
+    pImpl->Set(id, texture, destination, sourceRectangle, color, originRotationDepth, effects | Impl::SpriteInfo::DestSizeInPixels);
+}
+
+
+void XM_CALLCONV SpriteLayer::SetPosition(size_t id, XMFLOAT2 const& position)
+{
+    auto& sprite = pImpl->Edit(id);
+
+    sprite.destination.x = position.x;
+    sprite.destination.y = position.y;
+}
+
+
+void XM_CALLCONV SpriteLayer::SetColor(size_t id, FXMVECTOR color)
+{
+    XMStoreFloat4A(&pImpl->Edit(id).color, color);
+}
+
+
+void SpriteLayer::Remove(size_t id)
+{
+    pImpl->Remove(id);
+}
+
+
+void SpriteLayer::Clear()
+{
+    pImpl->Clear();
+}
+
+
+size_t SpriteLayer::GetCount() const
+{
+    return pImpl->mSprites.Count();
+}
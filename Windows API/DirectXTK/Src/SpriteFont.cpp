@@ -0,0 +1,1356 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteFont.cpp
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+//
+// http://go.microsoft.com/fwlink/?LinkId=248929
+//--------------------------------------------------------------------------------------
+
+#include "pch.h"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SpriteFont.h"
+#include "DirectXHelpers.h"
+#include "BinaryReader.h"
+#include "LoaderHelpers.h"
+#include "GlyphIndex.h"
+#include "TextLayoutCache.h"
+#include "Utf8.h"
+#include "TrueTypeFont.h"
+#include "GlyphRasterizer.h"
+#include "GlyphAtlasCache.h"
+#include "DistanceFieldGenerator.h"
+
+using namespace DirectX;
+using Microsoft::WRL::ComPtr;
+
+
+// Internal SpriteFont implementation class.
+class SpriteFont::Impl
+{
+public:
+    Impl(_In_ ID3D11Device* device, _In_ BinaryReader* reader, bool forceSRGB);
+    Impl(_In_ ID3D11ShaderResourceView* texture, _In_reads_(glyphCount) Glyph const* glyphs, _In_ size_t glyphCount, _In_ float lineSpacing);
+    Impl(_In_ ID3D11DeviceContext* deviceContext, _In_reads_bytes_(dataSize) uint8_t const* trueTypeData, size_t dataSize, float pixelSize, UINT atlasWidth, UINT atlasHeight);
+    Impl(_In_ ID3D11Device* device, _In_reads_bytes_(dataSize) uint8_t const* trueTypeData, size_t dataSize, SpriteDistanceField mode, float pixelSize, float pixelRange, _In_opt_z_ char const* characters);
+
+    Glyph const* FindGlyph(uint32_t character);
+
+    void SetDefaultCharacter(wchar_t character);
+
+    void BuildGlyphIndex();
+
+    template<typename Char, typename TAction>
+    void ForEachGlyph(_In_z_ Char const* text, TAction action);
+
+    template<typename Char, typename TAction>
+    void ForEachCachedGlyph(_In_z_ Char const* text, TAction action);
+
+    template<typename Char>
+    void XM_CALLCONV DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ Char const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects, float layerDepth);
+
+    template<typename Char>
+    XMVECTOR MeasureString(_In_z_ Char const* text);
+
+    template<typename Char>
+    RECT MeasureDrawBounds(_In_z_ Char const* text, XMFLOAT2 const& position);
+
+    void ClearLayoutCaches();
+
+
+    // A glyph placed by ForEachGlyph, as kept in the layout cache.
+    struct PlacedGlyph
+    {
+        Glyph const* glyph;
+        float x;
+        float y;
+        float advance;
+    };
+
+    // A string as kept in the layout cache: its glyphs and size, and the sprites DrawString last
+    // queued for it, relative to the origin argument, which only depend on the mirroring.
+    struct Layout
+    {
+        Layout() :
+            size(0, 0),
+            mirroring(-1)
+        {
+        }
+
+        void clear()
+        {
+            glyphs.clear();
+            size = XMFLOAT2(0, 0);
+            mirroring = -1;
+            rectangles.clear();
+            origins.clear();
+        }
+
+        std::vector<PlacedGlyph> glyphs;
+        XMFLOAT2 size;
+
+        // SpriteEffects the sprites were placed for, or -1 before the string is first drawn.
+        int mirroring;
+        std::vector<RECT> rectangles;
+        std::vector<XMFLOAT2> origins;
+    };
+
+    TextLayoutCache<wchar_t, Layout>& LayoutCache(wchar_t const*) { return layoutCache; }
+    TextLayoutCache<char, Layout>& LayoutCache(char const*) { return utf8LayoutCache; }
+
+    template<typename Char>
+    Layout* FindLayout(_In_z_ Char const* text, bool insert);
+
+    template<typename Char>
+    XMVECTOR LayoutSize(_In_z_ Char const* text);
+
+    // Bottom right corner of a placed glyph, as MeasureString counts it.
+    XMVECTOR GlyphExtent(Glyph const* glyph, float x, float y) const
+    {
+        float w = (float)(glyph->Subrect.right - glyph->Subrect.left);
+        float h = (float)(glyph->Subrect.bottom - glyph->Subrect.top) + glyph->YOffset;
+
+        h = std::max(h, lineSpacing);
+
+        return XMVectorSet(x + w, y + h, 0, 0);
+    }
+
+
+    // Glyphs rasterized from a TrueType font as they are first used.
+    struct DynamicGlyphs
+    {
+        DynamicGlyphs(int atlasWidth, int atlasHeight, int maxGlyphHeight) :
+            atlas(atlasWidth, atlasHeight, Padding),
+            maxGlyphHeight(maxGlyphHeight),
+            scale(0),
+            baseline(0),
+            defaultCharacter(0),
+            evictionsSeen(0)
+        {
+        }
+
+        // Blank texels around each glyph, so filtering never picks up a neighbour.
+        static const int Padding = 1;
+
+        // The record of a glyph, found again from a Glyph pointer held in a cached layout.
+        struct Slot
+        {
+            Glyph glyph;
+            int id;
+        };
+
+        ComPtr<ID3D11DeviceContext> deviceContext;
+        ComPtr<ID3D11Texture2D> texture;
+        std::vector<uint8_t> fontData;
+        TrueTypeFont font;
+        GlyphAtlasCache atlas;
+        int maxGlyphHeight;
+        float scale;
+        float baseline;
+        wchar_t defaultCharacter;
+        size_t evictionsSeen;
+
+        // Indexed by atlas entry id. A deque, so glyph pointers stay put as it grows.
+        std::deque<Slot> slots;
+
+        // Blank stand-ins, with id -1, for glyphs that did not fit even in the largest atlas. Kept
+        // until NextFrame; layouts holding them are stale, so they are never drawn from the cache.
+        std::deque<Slot> overflow;
+
+        GlyphOutline outline;
+        GlyphRasterizer rasterizer;
+        std::vector<uint8_t> coverage;
+        std::vector<uint32_t> texels;
+    };
+
+    Glyph const* FindDynamicGlyph(uint32_t character);
+    int AddDynamicGlyph(uint32_t character, uint32_t glyphIndex);
+    bool GrowDynamicAtlas();
+
+    void TouchGlyph(Glyph const* glyph)
+    {
+        int id = reinterpret_cast<DynamicGlyphs::Slot const*>(glyph)->id;
+
+        if (id >= 0)
+        {
+            dynamicGlyphs->atlas.Touch(id);
+        }
+    }
+
+
+    // Fields.
+    ComPtr<ID3D11ShaderResourceView> texture;
+    std::vector<Glyph> glyphs;
+    GlyphIndex glyphIndex;
+    Glyph const* defaultGlyph;
+    float lineSpacing;
+
+    SpriteDistanceField distanceField;
+    float distanceFieldRange;
+
+    TextLayoutCache<wchar_t, Layout> layoutCache;
+    TextLayoutCache<char, Layout> utf8LayoutCache;
+
+    std::unique_ptr<DynamicGlyphs> dynamicGlyphs;
+
+    // Set when a glyph was replaced, so cached layouts may point at glyphs that have moved.
+    bool layoutsStale;
+
+    // Scratch space DrawString passes to SpriteBatch::DrawRun.
+    std::vector<RECT> runRectangles;
+    std::vector<XMFLOAT2> runOrigins;
+};
+
+
+// Constants.
+const XMFLOAT2 SpriteFont::Float2Zero(0, 0);
+
+static const char spriteFontMagic[] = "DXTKfont";
+
+
+// Comparison operator lets std::is_sorted validate user specified glyph data.
+namespace DirectX
+{
+    static inline bool operator< (SpriteFont::Glyph const& left, SpriteFont::Glyph const& right)
+    {
+        return left.Character < right.Character;
+    }
+}
+
+
+// Reads a SpriteFont from the binary format created by the MakeSpriteFont utility.
+SpriteFont::Impl::Impl(_In_ ID3D11Device* device, _In_ BinaryReader* reader, bool forceSRGB) :
+    defaultGlyph(nullptr),
+    distanceField(SpriteDistanceField_None),
+    distanceFieldRange(0),
+    layoutsStale(false)
+{
+    // Validate the header.
+    for (char const* magic = spriteFontMagic; *magic; magic++)
+    {
+        if (reader->Read<uint8_t>() != *magic)
+        {
+            DebugTrace("SpriteFont provided with an invalid .spritefont file\n");
+            throw std::exception("Not a MakeSpriteFont output binary");
+        }
+    }
+
+    // Read the glyph data.
+    auto glyphCount = reader->Read<uint32_t>();
+    auto glyphData = reader->ReadArray<Glyph>(glyphCount);
+
+    glyphs.assign(glyphData, glyphData + glyphCount);
+
+    BuildGlyphIndex();
+
+    // Read font properties.
+    lineSpacing = reader->Read<float>();
+
+    SetDefaultCharacter((wchar_t)reader->Read<uint32_t>());
+
+    // Read the texture data.
+    auto textureWidth = reader->Read<uint32_t>();
+    auto textureHeight = reader->Read<uint32_t>();
+    auto textureFormat = reader->Read<DXGI_FORMAT>();
+    auto textureStride = reader->Read<uint32_t>();
+    auto textureRows = reader->Read<uint32_t>();
+    auto textureData = reader->ReadArray<uint8_t>(textureStride * textureRows);
+
+    if (forceSRGB)
+    {
+        textureFormat = LoaderHelpers::MakeSRGB(textureFormat);
+    }
+
+    // Create the D3D texture.
+    CD3D11_TEXTURE2D_DESC textureDesc(textureFormat, textureWidth, textureHeight, 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_IMMUTABLE);
+    CD3D11_SHADER_RESOURCE_VIEW_DESC viewDesc(D3D11_SRV_DIMENSION_TEXTURE2D, textureFormat);
+    D3D11_SUBRESOURCE_DATA initData = { textureData, textureStride };
+    ComPtr<ID3D11Texture2D> texture2D;
+
+    ThrowIfFailed(
+        device->CreateTexture2D(&textureDesc, &initData, &texture2D)
+    );
+
+    ThrowIfFailed(
+        device->CreateShaderResourceView(texture2D.Get(), &viewDesc, &texture)
+    );
+
+    SetDebugObjectName(texture.Get(), "DirectXTK:SpriteFont");
+    SetDebugObjectName(texture2D.Get(), "DirectXTK:SpriteFont");
+}
+
+
+// Constructs a SpriteFont from arbitrary user specified glyph data.
+_Use_decl_annotations_
+SpriteFont::Impl::Impl(ID3D11ShaderResourceView* texture, Glyph const* glyphs, size_t glyphCount, float lineSpacing)
+    : texture(texture),
+    glyphs(glyphs, glyphs + glyphCount),
+    defaultGlyph(nullptr),
+    lineSpacing(lineSpacing),
+    distanceField(SpriteDistanceField_None),
+    distanceFieldRange(0),
+    layoutsStale(false)
+{
+    if (!std::is_sorted(glyphs, glyphs + glyphCount))
+    {
+        throw std::exception("Glyphs must be in ascending codepoint order");
+    }
+
+    BuildGlyphIndex();
+}
+
+
+// Loads a TrueType font whose glyphs are rasterized into an atlas the first time they are used.
+_Use_decl_annotations_
+SpriteFont::Impl::Impl(ID3D11DeviceContext* deviceContext, uint8_t const* trueTypeData, size_t dataSize, float pixelSize, UINT atlasWidth, UINT atlasHeight) :
+    defaultGlyph(nullptr),
+    lineSpacing(0),
+    distanceField(SpriteDistanceField_None),
+    distanceFieldRange(0),
+    layoutsStale(false)
+{
+    if (pixelSize <= 0 || !atlasWidth || !atlasHeight || atlasWidth > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION || atlasHeight > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION)
+    {
+        throw std::exception("Invalid SpriteFont size");
+    }
+
+    std::vector<uint8_t> fontData(trueTypeData, trueTypeData + dataSize);
+    TrueTypeFont font;
+
+    if (!font.Load(fontData.data(), fontData.size()))
+    {
+        DebugTrace("SpriteFont provided with a font that is not TrueType with glyf outlines\n");
+        throw std::exception("Not a TrueType font");
+    }
+
+    // No glyph is taller than the font bounding box.
+    float scale = pixelSize / font.UnitsPerEm();
+    int maxGlyphHeight = static_cast<int>(std::ceil(font.YMax() * scale) - std::floor(font.YMin() * scale));
+
+    dynamicGlyphs = std::make_unique<DynamicGlyphs>(static_cast<int>(atlasWidth), static_cast<int>(atlasHeight), maxGlyphHeight);
+
+    auto& dynamic = *dynamicGlyphs;
+
+    dynamic.deviceContext = deviceContext;
+    dynamic.fontData.swap(fontData);
+    dynamic.font.Load(dynamic.fontData.data(), dynamic.fontData.size());
+    dynamic.scale = scale;
+    dynamic.baseline = std::round(font.Ascender() * scale);
+
+    lineSpacing = std::round((font.Ascender() - font.Descender() + font.LineGap()) * scale);
+
+    // Premultiplied white, like MakeSpriteFont output, so the default SpriteBatch shader draws it as is.
+    ComPtr<ID3D11Device> device;
+
+    deviceContext->GetDevice(&device);
+
+    CD3D11_TEXTURE2D_DESC textureDesc(DXGI_FORMAT_R8G8B8A8_UNORM, atlasWidth, atlasHeight, 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_DEFAULT);
+
+    ThrowIfFailed(
+        device->CreateTexture2D(&textureDesc, nullptr, &dynamic.texture)
+    );
+
+    ThrowIfFailed(
+        device->CreateShaderResourceView(dynamic.texture.Get(), nullptr, &texture)
+    );
+
+    SetDebugObjectName(texture.Get(), "DirectXTK:SpriteFont");
+    SetDebugObjectName(dynamic.texture.Get(), "DirectXTK:SpriteFont");
+}
+
+
+// Loads a TrueType font and generates the distance fields of its glyphs into one atlas.
+_Use_decl_annotations_
+SpriteFont::Impl::Impl(ID3D11Device* device, uint8_t const* trueTypeData, size_t dataSize, SpriteDistanceField mode, float pixelSize, float pixelRange, char const* characters) :
+    defaultGlyph(nullptr),
+    lineSpacing(0),
+    distanceField(mode),
+    distanceFieldRange(pixelRange),
+    layoutsStale(false)
+{
+    if (mode != SpriteDistanceField_SingleChannel && mode != SpriteDistanceField_MultiChannel)
+    {
+        throw std::out_of_range("SpriteDistanceField");
+    }
+
+    if (!(pixelSize > 0) || !(pixelRange > 0))
+    {
+        throw std::exception("Invalid SpriteFont size");
+    }
+
+    TrueTypeFont font;
+
+    if (!font.Load(trueTypeData, dataSize))
+    {
+        DebugTrace("SpriteFont provided with a font that is not TrueType with glyf outlines\n");
+        throw std::exception("Not a TrueType font");
+    }
+
+    // Glyphs must end up in ascending codepoint order, as in .spritefont files.
+    std::vector<uint32_t> codepoints;
+
+    if (characters)
+    {
+        while (*characters)
+        {
+            codepoints.push_back(Utf8::Decode(characters));
+        }
+
+        std::sort(codepoints.begin(), codepoints.end());
+        codepoints.erase(std::unique(codepoints.begin(), codepoints.end()), codepoints.end());
+    }
+    else
+    {
+        font.GetCharacters(&codepoints);
+    }
+
+    DistanceFieldAtlas atlas;
+
+    if (!atlas.Build(font, codepoints.data(), codepoints.size(), pixelSize, pixelRange, mode == SpriteDistanceField_MultiChannel,
+                     std::thread::hardware_concurrency(), D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION))
+    {
+        DebugTrace("SpriteFont distance fields of %zu characters at %g pixels do not fit in one texture\n", codepoints.size(), pixelSize);
+        throw std::exception("SpriteFont too large");
+    }
+
+    if (atlas.Glyphs().empty())
+    {
+        throw std::exception("None of the characters are in the font");
+    }
+
+    float scale = pixelSize / font.UnitsPerEm();
+    float baseline = std::round(font.Ascender() * scale);
+
+    lineSpacing = std::round((font.Ascender() - font.Descender() + font.LineGap()) * scale);
+
+    glyphs.reserve(atlas.Glyphs().size());
+
+    for (auto const& field : atlas.Glyphs())
+    {
+        Glyph glyph;
+
+        glyph.Character = field.character;
+        glyph.Subrect = { field.x, field.y, field.x + field.width, field.y + field.height };
+        glyph.XOffset = static_cast<float>(field.width ? field.left : 0);
+        glyph.YOffset = field.height ? baseline - field.top : 0;
+        glyph.XAdvance = field.advance - glyph.XOffset - field.width;
+
+        glyphs.push_back(glyph);
+    }
+
+    BuildGlyphIndex();
+
+    // Single channel fields only need the alpha the distance field shader reads.
+    DXGI_FORMAT textureFormat = (mode == SpriteDistanceField_MultiChannel) ? DXGI_FORMAT_R8G8B8A8_UNORM : DXGI_FORMAT_A8_UNORM;
+
+    CD3D11_TEXTURE2D_DESC textureDesc(textureFormat, static_cast<UINT>(atlas.Width()), static_cast<UINT>(atlas.Height()), 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_IMMUTABLE);
+    D3D11_SUBRESOURCE_DATA initData = { atlas.Texels().data(), static_cast<UINT>(atlas.Width() * atlas.BytesPerTexel()) };
+    ComPtr<ID3D11Texture2D> texture2D;
+
+    ThrowIfFailed(
+        device->CreateTexture2D(&textureDesc, &initData, &texture2D)
+    );
+
+    ThrowIfFailed(
+        device->CreateShaderResourceView(texture2D.Get(), nullptr, &texture)
+    );
+
+    SetDebugObjectName(texture.Get(), "DirectXTK:SpriteFont");
+    SetDebugObjectName(texture2D.Get(), "DirectXTK:SpriteFont");
+}
+
+
+// Looks up the requested glyph, falling back to the default character if it is not in the font.
+SpriteFont::Glyph const* SpriteFont::Impl::FindGlyph(uint32_t character)
+{
+    if (dynamicGlyphs)
+    {
+        return FindDynamicGlyph(character);
+    }
+
+    uint32_t index = glyphIndex.Find(character);
+
+    if (index != GlyphIndex::NotFound)
+    {
+        return &glyphs[index];
+    }
+
+    if (defaultGlyph)
+    {
+        return defaultGlyph;
+    }
+
+    DebugTrace("SpriteFont encountered a character not in the font (%u, %C), and no default glyph was provided\n", character, static_cast<wchar_t>(character));
+    throw std::exception("Character not in font");
+}
+
+
+// Dynamic fonts: returns the glyph from the atlas, rasterizing it first if needed. Characters
+// the font lacks use the default character, or the font's own missing glyph if there is none.
+// A glyph that does not fit even once the atlas is as large as a texture can be is drawn blank.
+SpriteFont::Glyph const* SpriteFont::Impl::FindDynamicGlyph(uint32_t character)
+{
+    auto& dynamic = *dynamicGlyphs;
+
+    uint32_t glyphIndex = dynamic.font.FindGlyph(character);
+
+    if (!glyphIndex && dynamic.defaultCharacter)
+    {
+        glyphIndex = dynamic.font.FindGlyph(static_cast<uint32_t>(dynamic.defaultCharacter));
+    }
+
+    // The atlas is keyed by glyph index, so characters sharing a glyph share its texels.
+    int id = dynamic.atlas.Find(glyphIndex);
+
+    if (id < 0)
+    {
+        id = AddDynamicGlyph(character, glyphIndex);
+
+        if (id < 0)
+        {
+            DebugTrace("SpriteFont glyph atlas has no room for character (%u, %C) that is not already in use this frame\n", character, static_cast<wchar_t>(character));
+
+            dynamic.overflow.emplace_back();
+
+            auto& slot = dynamic.overflow.back();
+
+            slot.id = -1;
+            slot.glyph.Character = character;
+            slot.glyph.Subrect = { 0, 0, 0, 0 };
+            slot.glyph.XOffset = 0;
+            slot.glyph.YOffset = 0;
+            slot.glyph.XAdvance = dynamic.font.AdvanceWidth(glyphIndex) * dynamic.scale;
+
+            layoutsStale = true;
+
+            return &slot.glyph;
+        }
+    }
+
+    return &dynamic.slots[id].glyph;
+}
+
+
+// Rasterizes a glyph into the atlas, growing the atlas if it is full. Returns its atlas entry
+// id, or -1 if it does not fit.
+int SpriteFont::Impl::AddDynamicGlyph(uint32_t character, uint32_t glyphIndex)
+{
+    auto& dynamic = *dynamicGlyphs;
+    auto& atlas = dynamic.atlas;
+    int const padding = DynamicGlyphs::Padding;
+
+    dynamic.font.GetOutline(glyphIndex, &dynamic.outline);
+
+    auto bounds = GlyphRasterizer::Measure(dynamic.outline, dynamic.scale);
+
+    // Only a damaged font has glyphs outside its bounding box; crop them to it.
+    bounds.width = std::min(bounds.width, atlas.Width() - padding * 2);
+    bounds.height = std::min(bounds.height, dynamic.maxGlyphHeight);
+
+    int id = atlas.Insert(glyphIndex, bounds.width, bounds.height);
+
+    while (id < 0 && GrowDynamicAtlas())
+    {
+        id = atlas.Insert(glyphIndex, bounds.width, bounds.height);
+    }
+
+    if (id < 0)
+        return -1;
+
+    auto const& entry = atlas[id];
+
+    if (static_cast<size_t>(id) >= dynamic.slots.size())
+    {
+        dynamic.slots.resize(id + 1);
+    }
+
+    auto& slot = dynamic.slots[id];
+
+    slot.id = id;
+    slot.glyph.Character = character;
+    slot.glyph.Subrect = { entry.x, entry.y, entry.x + entry.width, entry.y + entry.height };
+    slot.glyph.XOffset = static_cast<float>(entry.width ? bounds.left : 0);
+    slot.glyph.YOffset = entry.height ? dynamic.baseline - bounds.top : 0;
+    slot.glyph.XAdvance = dynamic.font.AdvanceWidth(glyphIndex) * dynamic.scale - slot.glyph.XOffset - entry.width;
+
+    if (entry.width)
+    {
+        // Rasterize, then upload with the padding around it, which clears whatever was there before.
+        size_t width = static_cast<size_t>(entry.width);
+        size_t paddedWidth = width + padding * 2;
+        size_t paddedHeight = static_cast<size_t>(entry.height) + padding * 2;
+
+        dynamic.coverage.resize(width * entry.height);
+        dynamic.rasterizer.Rasterize(dynamic.outline, dynamic.scale, bounds, dynamic.coverage.data(), width);
+
+        dynamic.texels.assign(paddedWidth * paddedHeight, 0);
+
+        for (int y = 0; y < entry.height; y++)
+        {
+            uint8_t const* source = &dynamic.coverage[y * width];
+            uint32_t* dest = &dynamic.texels[(y + padding) * paddedWidth + padding];
+
+            for (size_t x = 0; x < width; x++)
+            {
+                dest[x] = source[x] * 0x01010101u;
+            }
+        }
+
+        D3D11_BOX box =
+        {
+            static_cast<UINT>(entry.x - padding),
+            static_cast<UINT>(entry.y - padding),
+            0,
+            static_cast<UINT>(entry.x - padding) + static_cast<UINT>(paddedWidth),
+            static_cast<UINT>(entry.y - padding) + static_cast<UINT>(paddedHeight),
+            1
+        };
+
+        dynamic.deviceContext->UpdateSubresource(dynamic.texture.Get(), 0, &box, dynamic.texels.data(), static_cast<UINT>(paddedWidth * sizeof(uint32_t)), 0);
+    }
+
+    // Replaced glyphs may be in cached layouts. The layout being built right now only holds
+    // glyphs used this frame, which are never replaced, so it is safe to finish it first.
+    size_t evictions = atlas.GetStatistics().Evictions;
+
+    if (evictions != dynamic.evictionsSeen)
+    {
+        dynamic.evictionsSeen = evictions;
+        layoutsStale = true;
+    }
+
+    return id;
+}
+
+
+// Doubles the height of the dynamic atlas texture, copying the glyphs already in it. Glyph
+// subrects stay valid, and sprites queued with the old texture keep it alive until they are
+// drawn. Returns false once the texture is as tall as D3D11 allows.
+bool SpriteFont::Impl::GrowDynamicAtlas()
+{
+    auto& dynamic = *dynamicGlyphs;
+    auto& atlas = dynamic.atlas;
+
+    UINT width = static_cast<UINT>(atlas.Width());
+    UINT height = static_cast<UINT>(atlas.Height());
+
+    if (height >= D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION)
+        return false;
+
+    UINT newHeight = std::min<UINT>(height * 2, D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION);
+
+    ComPtr<ID3D11Device> device;
+
+    dynamic.deviceContext->GetDevice(&device);
+
+    CD3D11_TEXTURE2D_DESC textureDesc(DXGI_FORMAT_R8G8B8A8_UNORM, width, newHeight, 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_DEFAULT);
+    ComPtr<ID3D11Texture2D> newTexture;
+    ComPtr<ID3D11ShaderResourceView> newView;
+
+    ThrowIfFailed(
+        device->CreateTexture2D(&textureDesc, nullptr, &newTexture)
+    );
+
+    ThrowIfFailed(
+        device->CreateShaderResourceView(newTexture.Get(), nullptr, &newView)
+    );
+
+    SetDebugObjectName(newView.Get(), "DirectXTK:SpriteFont");
+    SetDebugObjectName(newTexture.Get(), "DirectXTK:SpriteFont");
+
+    // Only the shelves were ever written.
+    if (atlas.UsedHeight())
+    {
+        D3D11_BOX box = { 0, 0, 0, width, static_cast<UINT>(atlas.UsedHeight()), 1 };
+
+        dynamic.deviceContext->CopySubresourceRegion(newTexture.Get(), 0, 0, 0, 0, dynamic.texture.Get(), 0, &box);
+    }
+
+    dynamic.texture = newTexture;
+    texture = newView;
+
+    atlas.Grow(static_cast<int>(newHeight));
+
+    return true;
+}
+
+
+// Indexes the glyphs by codepoint, so FindGlyph takes the same time for every character.
+void SpriteFont::Impl::BuildGlyphIndex()
+{
+    std::vector<uint32_t> codepoints(glyphs.size());
+
+    for (size_t i = 0; i < glyphs.size(); i++)
+    {
+        codepoints[i] = glyphs[i].Character;
+    }
+
+    glyphIndex.Build(codepoints.data(), codepoints.size());
+}
+
+
+// Sets the missing-character fallback glyph.
+void SpriteFont::Impl::SetDefaultCharacter(wchar_t character)
+{
+    defaultGlyph = nullptr;
+
+    // Cached layouts may have used the old fallback glyph.
+    ClearLayoutCaches();
+
+    if (dynamicGlyphs)
+    {
+        dynamicGlyphs->defaultCharacter = character;
+        return;
+    }
+
+    if (character)
+    {
+        defaultGlyph = FindGlyph(character);
+    }
+}
+
+
+void SpriteFont::Impl::ClearLayoutCaches()
+{
+    layoutCache.Clear();
+    utf8LayoutCache.Clear();
+    layoutsStale = false;
+}
+
+
+namespace
+{
+    // Returns the character at text and moves past it.
+    inline uint32_t NextCharacter(_Inout_ wchar_t const*& text)
+    {
+        return static_cast<uint32_t>(*text++);
+    }
+
+    inline uint32_t NextCharacter(_Inout_ char const*& text)
+    {
+        return Utf8::Decode(text);
+    }
+}
+
+
+// The core glyph layout algorithm, shared between DrawString and MeasureString.
+template<typename Char, typename TAction>
+void SpriteFont::Impl::ForEachGlyph(_In_z_ Char const* text, TAction action)
+{
+    float x = 0;
+    float y = 0;
+
+    while (*text)
+    {
+        uint32_t character = NextCharacter(text);
+
+        switch (character)
+        {
+            case '\r':
+                // Skip carriage returns.
+                continue;
+
+            case '\n':
+                // New line.
+                x = 0;
+                y += lineSpacing;
+                break;
+
+            default:
+                // Output this character.
+                auto glyph = FindGlyph(character);
+
+                x += glyph->XOffset;
+
+                if (x < 0)
+                    x = 0;
+
+                float advance = glyph->Subrect.right - glyph->Subrect.left + glyph->XAdvance;
+
+                if (!iswspace(static_cast<wint_t>(character))
+                    || ((glyph->Subrect.right - glyph->Subrect.left) > 1)
+                    || ((glyph->Subrect.bottom - glyph->Subrect.top) > 1))
+                {
+                    action(glyph, x, y, advance);
+                }
+
+                x += advance;
+                break;
+        }
+    }
+}
+
+
+// Returns the cached layout of text, or nullptr if the cache is off or does not hold it. With
+// insert, a miss lays the string out into the cache, if the cache admits it.
+template<typename Char>
+SpriteFont::Impl::Layout* SpriteFont::Impl::FindLayout(_In_z_ Char const* text, bool insert)
+{
+    auto& cache = LayoutCache(text);
+
+    if (!cache.Capacity())
+        return nullptr;
+
+    if (layoutsStale)
+    {
+        ClearLayoutCaches();
+    }
+
+    size_t length = std::char_traits<Char>::length(text);
+    Layout* layout = cache.Find(text, length);
+
+    if (layout)
+    {
+        // Dynamic glyphs drawn from a cached layout count as used, so they stay in the atlas this frame.
+        if (dynamicGlyphs)
+        {
+            for (auto const& placed : layout->glyphs)
+            {
+                TouchGlyph(placed.glyph);
+            }
+        }
+    }
+    else if (insert)
+    {
+        layout = cache.Insert(text, length);
+
+        if (layout)
+        {
+            XMVECTOR size = XMVectorZero();
+
+            ForEachGlyph(text, [&](Glyph const* glyph, float x, float y, float advance)
+            {
+                layout->glyphs.push_back(PlacedGlyph{ glyph, x, y, advance });
+
+                size = XMVectorMax(size, GlyphExtent(glyph, x, y));
+            });
+
+            XMStoreFloat2(&layout->size, size);
+        }
+    }
+
+    return layout;
+}
+
+
+// Same as ForEachGlyph, but replays the layout from the cache when it holds the string.
+template<typename Char, typename TAction>
+void SpriteFont::Impl::ForEachCachedGlyph(_In_z_ Char const* text, TAction action)
+{
+    Layout* layout = FindLayout(text, false);
+
+    if (!layout)
+    {
+        ForEachGlyph(text, action);
+        return;
+    }
+
+    for (auto const& placed : layout->glyphs)
+    {
+        action(placed.glyph, placed.x, placed.y, placed.advance);
+    }
+}
+
+
+// Lays out the string and queues it as one run of sprites.
+template<typename Char>
+void XM_CALLCONV SpriteFont::Impl::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ Char const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects, float layerDepth)
+{
+    static_assert(SpriteEffects_FlipHorizontally == 1 &&
+                  SpriteEffects_FlipVertically == 2, "If you change these enum values, the following tables must be updated to match");
+
+    // Lookup table indicates which way to move along each axis per SpriteEffects enum value.
+    static XMVECTORF32 axisDirectionTable[4] =
+    {
+        { { { -1, -1, 0, 0 } } },
+        { { {  1, -1, 0, 0 } } },
+        { { { -1,  1, 0, 0 } } },
+        { { {  1,  1, 0, 0 } } },
+    };
+
+    // Lookup table indicates which axes are mirrored for each SpriteEffects enum value.
+    static XMVECTORF32 axisIsMirroredTable[4] =
+    {
+        { { { 0, 0, 0, 0 } } },
+        { { { 1, 0, 0, 0 } } },
+        { { { 0, 1, 0, 0 } } },
+        { { { 1, 1, 0, 0 } } },
+    };
+
+    int mirroring = effects & 3;
+
+    // Queue the whole string as one run of sprites. A cached string keeps the sprites it was last
+    // drawn with, so it is only placed again when its mirroring changes.
+    Layout* layout = FindLayout(text, true);
+
+    auto& rectangles = layout ? layout->rectangles : runRectangles;
+    auto& origins = layout ? layout->origins : runOrigins;
+
+    if (!layout || layout->mirroring != mirroring)
+    {
+        XMVECTOR baseOffset = XMVectorZero();
+
+        // If the text is mirrored, offset the start position accordingly.
+        if (effects)
+        {
+            XMVECTOR size = layout ? XMLoadFloat2(&layout->size) : LayoutSize(text);
+
+            baseOffset = -size * axisIsMirroredTable[mirroring];
+        }
+
+        rectangles.clear();
+        origins.clear();
+
+        auto placeGlyph = [&](Glyph const* glyph, float x, float y, float advance)
+        {
+            UNREFERENCED_PARAMETER(advance);
+
+            XMVECTOR offset = XMVectorMultiplyAdd(XMVectorSet(x, y + glyph->YOffset, 0, 0), axisDirectionTable[mirroring], baseOffset);
+
+            if (effects)
+            {
+                // For mirrored characters, specify bottom and/or right instead of top left.
+                XMVECTOR glyphRect = XMConvertVectorIntToFloat(XMLoadInt4(reinterpret_cast<uint32_t const*>(&glyph->Subrect)), 0);
+
+                // xy = glyph width/height.
+                glyphRect = XMVectorSwizzle<2, 3, 0, 1>(glyphRect) - glyphRect;
+
+                offset = XMVectorMultiplyAdd(glyphRect, axisIsMirroredTable[mirroring], offset);
+            }
+
+            XMFLOAT2 glyphOrigin;
+
+            XMStoreFloat2(&glyphOrigin, offset);
+
+            rectangles.push_back(glyph->Subrect);
+            origins.push_back(glyphOrigin);
+        };
+
+        if (layout)
+        {
+            for (auto const& placed : layout->glyphs)
+            {
+                placeGlyph(placed.glyph, placed.x, placed.y, placed.advance);
+            }
+
+            layout->mirroring = mirroring;
+        }
+        else
+        {
+            ForEachGlyph(text, placeGlyph);
+        }
+    }
+
+    XMFLOAT2 const* runOrigin = origins.data();
+
+    // The sprites are placed relative to a zero origin; any other origin moves them all.
+    if (!XMVector2Equal(origin, XMVectorZero()))
+    {
+        XMFLOAT2 offset;
+
+        XMStoreFloat2(&offset, origin);
+
+        runOrigins.resize(origins.size());
+
+        for (size_t i = 0; i < origins.size(); i++)
+        {
+            runOrigins[i] = XMFLOAT2(origins[i].x + offset.x, origins[i].y + offset.y);
+        }
+
+        runOrigin = runOrigins.data();
+    }
+
+    spriteBatch->DrawRun(texture.Get(), position, rectangles.data(), runOrigin, rectangles.size(), color, rotation, scale, effects, layerDepth);
+}
+
+
+template<typename Char>
+XMVECTOR SpriteFont::Impl::MeasureString(_In_z_ Char const* text)
+{
+    Layout* layout = FindLayout(text, false);
+
+    if (layout)
+    {
+        return XMLoadFloat2(&layout->size);
+    }
+
+    return LayoutSize(text);
+}
+
+
+// MeasureString without the layout cache.
+template<typename Char>
+XMVECTOR SpriteFont::Impl::LayoutSize(_In_z_ Char const* text)
+{
+    XMVECTOR result = XMVectorZero();
+
+    ForEachGlyph(text, [&](Glyph const* glyph, float x, float y, float advance)
+    {
+        UNREFERENCED_PARAMETER(advance);
+
+        result = XMVectorMax(result, GlyphExtent(glyph, x, y));
+    });
+
+    return result;
+}
+
+
+template<typename Char>
+RECT SpriteFont::Impl::MeasureDrawBounds(_In_z_ Char const* text, XMFLOAT2 const& position)
+{
+    RECT result = { LONG_MAX, LONG_MAX, 0, 0 };
+
+    ForEachCachedGlyph(text, [&](Glyph const* glyph, float x, float y, float advance)
+    {
+        float w = (float)(glyph->Subrect.right - glyph->Subrect.left);
+        float h = (float)(glyph->Subrect.bottom - glyph->Subrect.top);
+
+        float minX = position.x + x;
+        float minY = position.y + y + glyph->YOffset;
+
+        float maxX = std::max(minX + advance, minX + w);
+        float maxY = minY + h;
+
+        if (minX < result.left)
+            result.left = long(minX);
+
+        if (minY < result.top)
+            result.top = long(minY);
+
+        if (result.right < maxX)
+            result.right = long(maxX);
+
+        if (result.bottom < maxY)
+            result.bottom = long(maxY);
+    });
+
+    if (result.left == LONG_MAX)
+    {
+        result.left = 0;
+        result.top = 0;
+    }
+
+    return result;
+}
+
+
+// Construct from a binary file created by the MakeSpriteFont utility.
+SpriteFont::SpriteFont(_In_ ID3D11Device* device, _In_z_ wchar_t const* fileName, bool forceSRGB)
+{
+    BinaryReader reader(fileName);
+
+    pImpl = std::make_unique<Impl>(device, &reader, forceSRGB);
+}
+
+
+// Construct from a binary blob created by the MakeSpriteFont utility and already loaded into memory.
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11Device* device, uint8_t const* dataBlob, size_t dataSize, bool forceSRGB)
+{
+    BinaryReader reader(dataBlob, dataSize);
+
+    pImpl = std::make_unique<Impl>(device, &reader, forceSRGB);
+}
+
+
+// Construct from arbitrary user specified glyph data (for those not using the MakeSpriteFont utility).
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11ShaderResourceView* texture, Glyph const* glyphs, size_t glyphCount, float lineSpacing)
+    : pImpl(std::make_unique<Impl>(texture, glyphs, glyphCount, lineSpacing))
+{
+}
+
+
+// Construct from a TrueType font file, rasterizing glyphs as they are first used.
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11DeviceContext* deviceContext, wchar_t const* trueTypeFileName, float pixelSize, UINT atlasWidth, UINT atlasHeight)
+{
+    std::unique_ptr<uint8_t[]> data;
+    size_t dataSize;
+
+    HRESULT hr = BinaryReader::ReadEntireFile(trueTypeFileName, data, &dataSize);
+    if (FAILED(hr))
+    {
+        DebugTrace("SpriteFont failed (%08X) to load '%ls'\n", hr, trueTypeFileName);
+        throw std::exception("SpriteFont");
+    }
+
+    pImpl = std::make_unique<Impl>(deviceContext, data.get(), dataSize, pixelSize, atlasWidth, atlasHeight);
+}
+
+
+// Construct from a TrueType font already loaded into memory. The data is copied.
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11DeviceContext* deviceContext, uint8_t const* trueTypeData, size_t dataSize, float pixelSize, UINT atlasWidth, UINT atlasHeight)
+    : pImpl(std::make_unique<Impl>(deviceContext, trueTypeData, dataSize, pixelSize, atlasWidth, atlasHeight))
+{
+}
+
+
+// Construct from a TrueType font file, generating the distance fields of its glyphs.
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11Device* device, wchar_t const* trueTypeFileName, SpriteDistanceField mode, float pixelSize, float pixelRange, char const* characters)
+{
+    std::unique_ptr<uint8_t[]> data;
+    size_t dataSize;
+
+    HRESULT hr = BinaryReader::ReadEntireFile(trueTypeFileName, data, &dataSize);
+    if (FAILED(hr))
+    {
+        DebugTrace("SpriteFont failed (%08X) to load '%ls'\n", hr, trueTypeFileName);
+        throw std::exception("SpriteFont");
+    }
+
+    pImpl = std::make_unique<Impl>(device, data.get(), dataSize, mode, pixelSize, pixelRange, characters);
+}
+
+
+// Construct from a TrueType font already loaded into memory, generating the distance fields of its glyphs.
+_Use_decl_annotations_
+SpriteFont::SpriteFont(ID3D11Device* device, uint8_t const* trueTypeData, size_t dataSize, SpriteDistanceField mode, float pixelSize, float pixelRange, char const* characters)
+    : pImpl(std::make_unique<Impl>(device, trueTypeData, dataSize, mode, pixelSize, pixelRange, characters))
+{
+}
+
+
+// Move constructor.
+SpriteFont::SpriteFont(SpriteFont&& moveFrom) throw()
+    : pImpl(std::move(moveFrom.pImpl))
+{
+}
+
+
+// Move assignment.
+SpriteFont& SpriteFont::operator= (SpriteFont&& moveFrom) throw()
+{
+    pImpl = std::move(moveFrom.pImpl);
+    return *this;
+}
+
+
+// Public destructor.
+SpriteFont::~SpriteFont()
+{
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, float scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, XMLoadFloat2(&position), color, rotation, XMLoadFloat2(&origin), XMVectorReplicate(scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, XMFLOAT2 const& scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, XMLoadFloat2(&position), color, rotation, XMLoadFloat2(&origin), XMLoadFloat2(&scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, float scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, position, color, rotation, origin, XMVectorReplicate(scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ wchar_t const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects, float layerDepth) const
+{
+    pImpl->DrawString(spriteBatch, text, position, color, rotation, origin, scale, effects, layerDepth);
+}
+
+
+XMVECTOR XM_CALLCONV SpriteFont::MeasureString(_In_z_ wchar_t const* text) const
+{
+    return pImpl->MeasureString(text);
+}
+
+
+RECT SpriteFont::MeasureDrawBounds(_In_z_ wchar_t const* text, XMFLOAT2 const& position) const
+{
+    return pImpl->MeasureDrawBounds(text, position);
+}
+
+
+RECT XM_CALLCONV SpriteFont::MeasureDrawBounds(_In_z_ wchar_t const* text, FXMVECTOR position) const
+{
+    XMFLOAT2 pos;
+    XMStoreFloat2(&pos, position);
+
+    return MeasureDrawBounds(text, pos);
+}
+
+
+// UTF-8 text
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, float scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, XMLoadFloat2(&position), color, rotation, XMLoadFloat2(&origin), XMVectorReplicate(scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, XMFLOAT2 const& position, FXMVECTOR color, float rotation, XMFLOAT2 const& origin, XMFLOAT2 const& scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, XMLoadFloat2(&position), color, rotation, XMLoadFloat2(&origin), XMLoadFloat2(&scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, float scale, SpriteEffects effects, float layerDepth) const
+{
+    DrawString(spriteBatch, text, position, color, rotation, origin, XMVectorReplicate(scale), effects, layerDepth);
+}
+
+
+void XM_CALLCONV SpriteFont::DrawString(_In_ SpriteBatch* spriteBatch, _In_z_ char const* text, FXMVECTOR position, FXMVECTOR color, float rotation, FXMVECTOR origin, GXMVECTOR scale, SpriteEffects effects, float layerDepth) const
+{
+    pImpl->DrawString(spriteBatch, text, position, color, rotation, origin, scale, effects, layerDepth);
+}
+
+
+XMVECTOR XM_CALLCONV SpriteFont::MeasureString(_In_z_ char const* text) const
+{
+    return pImpl->MeasureString(text);
+}
+
+
+RECT SpriteFont::MeasureDrawBounds(_In_z_ char const* text, XMFLOAT2 const& position) const
+{
+    return pImpl->MeasureDrawBounds(text, position);
+}
+
+
+RECT XM_CALLCONV SpriteFont::MeasureDrawBounds(_In_z_ char const* text, FXMVECTOR position) const
+{
+    XMFLOAT2 pos;
+    XMStoreFloat2(&pos, position);
+
+    return MeasureDrawBounds(text, pos);
+}
+
+
+// Spacing properties
+float SpriteFont::GetLineSpacing() const
+{
+    return pImpl->lineSpacing;
+}
+
+
+void SpriteFont::SetLineSpacing(float spacing)
+{
+    pImpl->lineSpacing = spacing;
+    pImpl->ClearLayoutCaches();
+}
+
+
+// Font properties
+wchar_t SpriteFont::GetDefaultCharacter() const
+{
+    if (pImpl->dynamicGlyphs)
+        return pImpl->dynamicGlyphs->defaultCharacter;
+
+    return pImpl->defaultGlyph ? (wchar_t)pImpl->defaultGlyph->Character : 0;
+}
+
+
+void SpriteFont::SetDefaultCharacter(wchar_t character)
+{
+    pImpl->SetDefaultCharacter(character);
+}
+
+
+bool SpriteFont::ContainsCharacter(wchar_t character) const
+{
+    if (pImpl->dynamicGlyphs)
+        return pImpl->dynamicGlyphs->font.FindGlyph(static_cast<uint32_t>(character)) != 0;
+
+    return pImpl->glyphIndex.Find(static_cast<uint32_t>(character)) != GlyphIndex::NotFound;
+}
+
+
+SpriteDistanceField SpriteFont::GetDistanceField() const
+{
+    return pImpl->distanceField;
+}
+
+
+float SpriteFont::GetDistanceFieldRange() const
+{
+    return pImpl->distanceFieldRange;
+}
+
+
+// Custom layout/rendering
+SpriteFont::Glyph const* SpriteFont::FindGlyph(wchar_t character) const
+{
+    return pImpl->FindGlyph(static_cast<uint32_t>(character));
+}
+
+
+// Layout cache
+void SpriteFont::SetLayoutCacheSize(size_t maxStrings)
+{
+    pImpl->layoutCache.SetCapacity(maxStrings);
+    pImpl->utf8LayoutCache.SetCapacity(maxStrings);
+}
+
+
+SpriteFont::LayoutCacheStatistics SpriteFont::GetLayoutCacheStatistics() const
+{
+    auto wide = pImpl->layoutCache.GetStatistics();
+    auto utf8 = pImpl->utf8LayoutCache.GetStatistics();
+
+    return LayoutCacheStatistics{ wide.Hits + utf8.Hits, wide.Misses + utf8.Misses, wide.Evictions + utf8.Evictions, wide.Strings + utf8.Strings };
+}
+
+
+void SpriteFont::ResetLayoutCacheStatistics()
+{
+    pImpl->layoutCache.ResetStatistics();
+    pImpl->utf8LayoutCache.ResetStatistics();
+}
+
+
+// Glyph cache
+void SpriteFont::NextFrame()
+{
+    if (pImpl->dynamicGlyphs)
+    {
+        pImpl->dynamicGlyphs->atlas.NextFrame();
+        pImpl->dynamicGlyphs->overflow.clear();
+    }
+}
+
+
+SpriteFont::GlyphCacheStatistics SpriteFont::GetGlyphCacheStatistics() const
+{
+    if (!pImpl->dynamicGlyphs)
+    {
+        return GlyphCacheStatistics{ 0, 0, 0, pImpl->glyphs.size() };
+    }
+
+    auto statistics = pImpl->dynamicGlyphs->atlas.GetStatistics();
+
+    return GlyphCacheStatistics{ statistics.Hits, statistics.Misses, statistics.Evictions, statistics.Glyphs };
+}
+
+
+void SpriteFont::ResetGlyphCacheStatistics()
+{
+    if (pImpl->dynamicGlyphs)
+    {
+        pImpl->dynamicGlyphs->atlas.ResetStatistics();
+        pImpl->dynamicGlyphs->evictionsSeen = 0;
+    }
+}
+
+
+void SpriteFont::GetSpriteSheet(ID3D11ShaderResourceView** texture) const
+{
+    if (!texture)
+        return;
+
+    ThrowIfFailed(pImpl->texture.CopyTo(texture));
+}
@@ -0,0 +1,438 @@
+//--------------------------------------------------------------------------------------
+// File: SpriteVertexGenerator.h
+//
+// Generates the four VertexPositionColorTexture corners of many sprites at once.
+// SpriteBatch uses it to fill the mapped vertex buffer. It has no D3D dependency, so
+// it can also write into any caller buffer for tests and benchmarks.
+//
+// Sprites are processed 8 at a time with AVX, 4 at a time with SSE2, and one at a
+// time otherwise. All widths run the same arithmetic in the same order as the old
+// per-sprite XMVECTOR path, so every width produces bit-identical vertices. Large
+// batches can also be split into ranges and generated on several threads.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <immintrin.h>
+#define SPRITE_VERTEX_SSE2
+#if defined(__AVX__)
+#define SPRITE_VERTEX_AVX
+#endif
+#endif
+
+
+namespace DirectX
+{
+    namespace SpriteVertexGenerator
+    {
+        // Must match SpriteEffects and SpriteBatch::Impl::SpriteInfo.
+        const int FlipHorizontally = 1;
+        const int FlipVertically = 2;
+        const int SourceInTexels = 4;
+        const int DestSizeInPixels = 8;
+
+        // Same as g_XMEpsilon, used instead of a zero source size.
+        const float Epsilon = 1.192092896e-7f;
+
+
+        // Arithmetic for one lane at a time. Masks are plain bools.
+        struct ScalarLanes
+        {
+            static const int Width = 1;
+            typedef float Vector;
+            typedef bool Mask;
+
+            static Vector Replicate(float f) { return f; }
+            static Vector Add(Vector a, Vector b) { return a + b; }
+            static Vector Subtract(Vector a, Vector b) { return a - b; }
+            static Vector Multiply(Vector a, Vector b) { return a * b; }
+            static Vector Divide(Vector a, Vector b) { return a / b; }
+            static Vector Negate(Vector a) { return -a; }
+            static Vector Truncate(Vector a) { return static_cast<float>(static_cast<int>(a)); }
+            static Mask Equal(Vector a, Vector b) { return a == b; }
+            static Mask Greater(Vector a, Vector b) { return a > b; }
+            static Mask GreaterOrEqual(Vector a, Vector b) { return a >= b; }
+            static Mask Less(Vector a, Vector b) { return a < b; }
+            static Mask FlagSet(int const* flags, int bit) { return (*flags & bit) != 0; }
+            static Vector Select(Mask m, Vector ifTrue, Vector ifFalse) { return m ? ifTrue : ifFalse; }
+            static void Store(float* out, Vector a) { *out = a; }
+
+            // rows[l] points at the four floats of lane l.
+            static void Load4(float const* const* rows, Vector& a, Vector& b, Vector& c, Vector& d)
+            {
+                a = rows[0][0];
+                b = rows[0][1];
+                c = rows[0][2];
+                d = rows[0][3];
+            }
+
+            // Writes (a, b, c, d) of lane l to out + l * stride.
+            static void Store4(float* out, size_t, Vector a, Vector b, Vector c, Vector d)
+            {
+                out[0] = a;
+                out[1] = b;
+                out[2] = c;
+                out[3] = d;
+            }
+        };
+
+    #if defined(SPRITE_VERTEX_SSE2)
+        struct SSELanes
+        {
+            static const int Width = 4;
+            typedef __m128 Vector;
+            typedef __m128 Mask;
+
+            static Vector Replicate(float f) { return _mm_set1_ps(f); }
+            static Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+            static Vector Subtract(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+            static Vector Multiply(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+            static Vector Divide(Vector a, Vector b) { return _mm_div_ps(a, b); }
+            static Vector Negate(Vector a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+            static Vector Truncate(Vector a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+            static Mask Equal(Vector a, Vector b) { return _mm_cmpeq_ps(a, b); }
+            static Mask Greater(Vector a, Vector b) { return _mm_cmpgt_ps(a, b); }
+            static Mask GreaterOrEqual(Vector a, Vector b) { return _mm_cmpge_ps(a, b); }
+            static Mask Less(Vector a, Vector b) { return _mm_cmplt_ps(a, b); }
+            static Vector Select(Mask m, Vector ifTrue, Vector ifFalse) { return _mm_or_ps(_mm_and_ps(m, ifTrue), _mm_andnot_ps(m, ifFalse)); }
+            static void Store(float* out, Vector a) { _mm_storeu_ps(out, a); }
+
+            static Mask FlagSet(int const* flags, int bit)
+            {
+                __m128i b = _mm_set1_epi32(bit);
+                __m128i f = _mm_loadu_si128(reinterpret_cast<__m128i const*>(flags));
+
+                return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(f, b), b));
+            }
+
+            static void Load4(float const* const* rows, Vector& a, Vector& b, Vector& c, Vector& d)
+            {
+                a = _mm_loadu_ps(rows[0]);
+                b = _mm_loadu_ps(rows[1]);
+                c = _mm_loadu_ps(rows[2]);
+                d = _mm_loadu_ps(rows[3]);
+
+                _MM_TRANSPOSE4_PS(a, b, c, d);
+            }
+
+            static void Store4(float* out, size_t stride, Vector a, Vector b, Vector c, Vector d)
+            {
+                _MM_TRANSPOSE4_PS(a, b, c, d);
+
+                _mm_storeu_ps(out, a);
+                _mm_storeu_ps(out + stride, b);
+                _mm_storeu_ps(out + stride * 2, c);
+                _mm_storeu_ps(out + stride * 3, d);
+            }
+        };
+    #endif
+
+    #if defined(SPRITE_VERTEX_AVX)
+        // Lanes 0-3 live in the low 128 bits and lanes 4-7 in the high 128 bits, so each
+        // transpose is two independent 4x4 transposes.
+        struct AVXLanes
+        {
+            static const int Width = 8;
+            typedef __m256 Vector;
+            typedef __m256 Mask;
+
+            static Vector Replicate(float f) { return _mm256_set1_ps(f); }
+            static Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+            static Vector Subtract(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+            static Vector Multiply(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+            static Vector Divide(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+            static Vector Negate(Vector a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+            static Vector Truncate(Vector a) { return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(a)); }
+            static Mask Equal(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+            static Mask Greater(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static Mask GreaterOrEqual(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+            static Mask Less(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static Vector Select(Mask m, Vector ifTrue, Vector ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, m); }
+            static void Store(float* out, Vector a) { _mm256_storeu_ps(out, a); }
+
+            // A 256-bit integer AND needs AVX2, so test each half with SSE2.
+            static Mask FlagSet(int const* flags, int bit)
+            {
+                return _mm256_insertf128_ps(_mm256_castps128_ps256(SSELanes::FlagSet(flags, bit)), SSELanes::FlagSet(flags + 4, bit), 1);
+            }
+
+            static void Load4(float const* const* rows, Vector& a, Vector& b, Vector& c, Vector& d)
+            {
+                a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rows[0])), _mm_loadu_ps(rows[4]), 1);
+                b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rows[1])), _mm_loadu_ps(rows[5]), 1);
+                c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rows[2])), _mm_loadu_ps(rows[6]), 1);
+                d = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rows[3])), _mm_loadu_ps(rows[7]), 1);
+
+                Transpose(a, b, c, d);
+            }
+
+            static void Store4(float* out, size_t stride, Vector a, Vector b, Vector c, Vector d)
+            {
+                Transpose(a, b, c, d);
+
+                _mm_storeu_ps(out, _mm256_castps256_ps128(a));
+                _mm_storeu_ps(out + stride, _mm256_castps256_ps128(b));
+                _mm_storeu_ps(out + stride * 2, _mm256_castps256_ps128(c));
+                _mm_storeu_ps(out + stride * 3, _mm256_castps256_ps128(d));
+                _mm_storeu_ps(out + stride * 4, _mm256_extractf128_ps(a, 1));
+                _mm_storeu_ps(out + stride * 5, _mm256_extractf128_ps(b, 1));
+                _mm_storeu_ps(out + stride * 6, _mm256_extractf128_ps(c, 1));
+                _mm_storeu_ps(out + stride * 7, _mm256_extractf128_ps(d, 1));
+            }
+
+            static void Transpose(Vector& a, Vector& b, Vector& c, Vector& d)
+            {
+                __m256 t0 = _mm256_unpacklo_ps(a, b);
+                __m256 t1 = _mm256_unpacklo_ps(c, d);
+                __m256 t2 = _mm256_unpackhi_ps(a, b);
+                __m256 t3 = _mm256_unpackhi_ps(c, d);
+
+                a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+                b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+                c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+        };
+    #endif
+
+
+        // XMScalarSinCos evaluated across lanes: the same range reduction and the same
+        // 11-degree sine and 10-degree cosine minimax polynomials, with branches turned into selects.
+        template<typename Lanes>
+        void SinCos(typename Lanes::Vector value, typename Lanes::Vector& sinOut, typename Lanes::Vector& cosOut)
+        {
+            typedef typename Lanes::Vector Vector;
+
+            const float twoPi = 6.283185307f;
+            const float oneDivTwoPi = 0.159154943f;
+            const float pi = 3.141592654f;
+            const float piDiv2 = 1.570796327f;
+
+            Vector zero = Lanes::Replicate(0);
+            Vector half = Lanes::Replicate(0.5f);
+
+            // Map value to y in [-pi,pi], x = 2*pi*quotient + remainder.
+            Vector quotient = Lanes::Multiply(Lanes::Replicate(oneDivTwoPi), value);
+            quotient = Lanes::Select(Lanes::GreaterOrEqual(value, zero),
+                Lanes::Truncate(Lanes::Add(quotient, half)),
+                Lanes::Truncate(Lanes::Subtract(quotient, half)));
+
+            Vector y = Lanes::Subtract(value, Lanes::Multiply(Lanes::Replicate(twoPi), quotient));
+
+            // Map y to [-pi/2,pi/2] with sin(y) = sin(value).
+            auto above = Lanes::Greater(y, Lanes::Replicate(piDiv2));
+            auto below = Lanes::Less(y, Lanes::Replicate(-piDiv2));
+
+            Vector minusOne = Lanes::Replicate(-1.0f);
+            Vector sign = Lanes::Select(above, minusOne, Lanes::Select(below, minusOne, Lanes::Replicate(1.0f)));
+
+            y = Lanes::Select(above, Lanes::Subtract(Lanes::Replicate(pi), y),
+                Lanes::Select(below, Lanes::Subtract(Lanes::Replicate(-pi), y), y));
+
+            Vector y2 = Lanes::Multiply(y, y);
+
+            // p * y2 + c; subtracting a constant rounds the same as adding its negation.
+            auto step = [&](Vector p, float c) { return Lanes::Add(Lanes::Multiply(p, y2), Lanes::Replicate(c)); };
+
+            Vector s = step(step(step(step(step(Lanes::Replicate(-2.3889859e-08f), 2.7525562e-06f), -0.00019840874f), 0.0083333310f), -0.16666667f), 1.0f);
+            sinOut = Lanes::Multiply(s, y);
+
+            Vector c = step(step(step(step(step(Lanes::Replicate(-2.6051615e-07f), 2.4760495e-05f), -0.0013888378f), 0.041666638f), -0.5f), 1.0f);
+            cosOut = Lanes::Multiply(sign, c);
+        }
+
+
+        // Generates Lanes::Width sprites. Sprite fields are transposed into one vector per
+        // component, the corner math runs across lanes, and each vertex is transposed back and
+        // written front to back so the (possibly write-combined) destination fills sequentially.
+        template<typename Lanes, typename Sprite, typename Vertex>
+        void GenerateBlock(Sprite const* const* sprites, Vertex* vertices, float const textureSize[2], float const inverseTextureSize[2])
+        {
+            typedef typename Lanes::Vector Vector;
+            const int W = Lanes::Width;
+
+            // Vertices are written as raw floats: position, color, then texture coordinate.
+            static_assert(sizeof(Vertex) == sizeof(float) * 9, "Vertex must be a packed float3 position, float4 color and float2 texcoord");
+
+            float const* sourceRows[W];
+            float const* destinationRows[W];
+            float const* colorRows[W];
+            float const* originRows[W];
+            int flags[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                Sprite const* sprite = sprites[l];
+
+                sourceRows[l] = &sprite->source.x;
+                destinationRows[l] = &sprite->destination.x;
+                colorRows[l] = &sprite->color.x;
+                originRows[l] = &sprite->originRotationDepth.x;
+                flags[l] = sprite->flags;
+            }
+
+            Vector sourceX, sourceY, sourceW, sourceH;
+            Vector destinationX, destinationY, destinationW, destinationH;
+            Vector colorR, colorG, colorB, colorA;
+            Vector originX, originY, rotation, depth;
+
+            Lanes::Load4(sourceRows, sourceX, sourceY, sourceW, sourceH);
+            Lanes::Load4(destinationRows, destinationX, destinationY, destinationW, destinationH);
+            Lanes::Load4(colorRows, colorR, colorG, colorB, colorA);
+            Lanes::Load4(originRows, originX, originY, rotation, depth);
+
+            Vector zero = Lanes::Replicate(0);
+            Vector one = Lanes::Replicate(1);
+
+            // Scale the origin offset by source size, taking care to avoid overflow if the source region is zero.
+            Vector epsilon = Lanes::Replicate(Epsilon);
+
+            originX = Lanes::Divide(originX, Lanes::Select(Lanes::Equal(sourceW, zero), epsilon, sourceW));
+            originY = Lanes::Divide(originY, Lanes::Select(Lanes::Equal(sourceH, zero), epsilon, sourceH));
+
+            // Convert the source region from texels to mod-1 texture coordinate format.
+            Vector inverseW = Lanes::Replicate(inverseTextureSize[0]);
+            Vector inverseH = Lanes::Replicate(inverseTextureSize[1]);
+            auto inTexels = Lanes::FlagSet(flags, SourceInTexels);
+
+            sourceX = Lanes::Select(inTexels, Lanes::Multiply(sourceX, inverseW), sourceX);
+            sourceY = Lanes::Select(inTexels, Lanes::Multiply(sourceY, inverseH), sourceY);
+            sourceW = Lanes::Select(inTexels, Lanes::Multiply(sourceW, inverseW), sourceW);
+            sourceH = Lanes::Select(inTexels, Lanes::Multiply(sourceH, inverseH), sourceH);
+            originX = Lanes::Select(inTexels, originX, Lanes::Multiply(originX, inverseW));
+            originY = Lanes::Select(inTexels, originY, Lanes::Multiply(originY, inverseH));
+
+            // If the destination size is relative to the source region, convert it to pixels.
+            auto inPixels = Lanes::FlagSet(flags, DestSizeInPixels);
+
+            destinationW = Lanes::Select(inPixels, destinationW, Lanes::Multiply(destinationW, Lanes::Replicate(textureSize[0])));
+            destinationH = Lanes::Select(inPixels, destinationH, Lanes::Multiply(destinationH, Lanes::Replicate(textureSize[1])));
+
+            // Compute a 2x2 rotation matrix; unrotated sprites keep the exact identity.
+            Vector sin, cos;
+
+            SinCos<Lanes>(rotation, sin, cos);
+
+            auto unrotated = Lanes::Equal(rotation, zero);
+            Vector rotation1X = Lanes::Select(unrotated, one, cos);
+            Vector rotation1Y = Lanes::Select(unrotated, zero, sin);
+            Vector rotation2X = Lanes::Select(unrotated, zero, Lanes::Negate(sin));
+            Vector rotation2Y = Lanes::Select(unrotated, one, cos);
+
+            Vector mirrorX = Lanes::Select(Lanes::FlagSet(flags, FlipHorizontally), one, zero);
+            Vector mirrorY = Lanes::Select(Lanes::FlagSet(flags, FlipVertically), one, zero);
+
+            // Each vertex is written as (x, y, z, r), (g, b, a, u) and v.
+            const size_t vertexFloats = 9;
+            const size_t spriteFloats = vertexFloats * 4;
+
+            float* out = reinterpret_cast<float*>(vertices);
+
+            alignas(32) float texcoordV[4][W];
+
+            // Corner i sits at unit-square position (i & 1, i >> 1). Texture coordinates use the
+            // same table indexed by i ^ SpriteEffects, which mirrors the sprite.
+            for (int i = 0; i < 4; i++)
+            {
+                Vector cornerX = (i & 1) ? one : zero;
+                Vector cornerY = (i >> 1) ? one : zero;
+
+                // Calculate position and apply the 2x2 rotation matrix.
+                Vector offsetX = Lanes::Multiply(Lanes::Subtract(cornerX, originX), destinationW);
+                Vector offsetY = Lanes::Multiply(Lanes::Subtract(cornerY, originY), destinationH);
+
+                Vector position1X = Lanes::Add(Lanes::Multiply(offsetX, rotation1X), destinationX);
+                Vector position1Y = Lanes::Add(Lanes::Multiply(offsetX, rotation1Y), destinationY);
+
+                Vector positionX = Lanes::Add(Lanes::Multiply(offsetY, rotation2X), position1X);
+                Vector positionY = Lanes::Add(Lanes::Multiply(offsetY, rotation2Y), position1Y);
+
+                // Compute the texture coordinate.
+                Vector textureX = (i & 1) ? Lanes::Subtract(one, mirrorX) : mirrorX;
+                Vector textureY = (i >> 1) ? Lanes::Subtract(one, mirrorY) : mirrorY;
+
+                Vector u = Lanes::Add(Lanes::Multiply(textureX, sourceW), sourceX);
+                Vector v = Lanes::Add(Lanes::Multiply(textureY, sourceH), sourceY);
+
+                Lanes::Store4(out + i * vertexFloats, spriteFloats, positionX, positionY, depth, colorR);
+                Lanes::Store4(out + i * vertexFloats + 4, spriteFloats, colorG, colorB, colorA, u);
+                Lanes::Store(texcoordV[i], v);
+            }
+
+            for (int l = 0; l < W; l++)
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    out[l * spriteFloats + i * vertexFloats + 8] = texcoordV[i][l];
+                }
+            }
+        }
+
+
+        // Writes count * 4 vertices. textureSize and inverseTextureSize are shared by the whole
+        // batch, matching one SpriteBatch draw call.
+        template<typename Sprite, typename Vertex>
+        void Generate(Sprite const* const* sprites, size_t count, Vertex* vertices, float const textureSize[2], float const inverseTextureSize[2])
+        {
+            size_t i = 0;
+
+        #if defined(SPRITE_VERTEX_AVX)
+            for (; i + AVXLanes::Width <= count; i += AVXLanes::Width)
+            {
+                GenerateBlock<AVXLanes>(sprites + i, vertices + i * 4, textureSize, inverseTextureSize);
+            }
+        #endif
+
+        #if defined(SPRITE_VERTEX_SSE2)
+            for (; i + SSELanes::Width <= count; i += SSELanes::Width)
+            {
+                GenerateBlock<SSELanes>(sprites + i, vertices + i * 4, textureSize, inverseTextureSize);
+            }
+        #endif
+
+            for (; i < count; i++)
+            {
+                GenerateBlock<ScalarLanes>(sprites + i, vertices + i * 4, textureSize, inverseTextureSize);
+            }
+        }
+
+
+        // Below this many sprites per job, waking another thread costs more than it saves.
+        const size_t MinSpritesPerJob = 256;
+
+        // Splits the batch into at most maxJobs contiguous ranges and generates them through
+        // dispatch(jobCount, job), which must run job(0) .. job(jobCount - 1) once each and
+        // return when all have finished. Ranges only depend on count and maxJobs, and no
+        // sprite's vertices depend on its neighbours, so the output matches Generate exactly.
+        template<typename Sprite, typename Vertex, typename Dispatch>
+        void GenerateParallel(Sprite const* const* sprites, size_t count, Vertex* vertices, float const textureSize[2], float const inverseTextureSize[2], Dispatch const& dispatch, size_t maxJobs)
+        {
+            size_t jobCount = std::min(maxJobs, count / MinSpritesPerJob);
+
+            if (jobCount <= 1)
+            {
+                Generate(sprites, count, vertices, textureSize, inverseTextureSize);
+                return;
+            }
+
+            // Round ranges up to whole 8-sprite blocks so only the last one has a scalar tail.
+            size_t spritesPerJob = ((count + jobCount - 1) / jobCount + 7) & ~size_t(7);
+
+            jobCount = (count + spritesPerJob - 1) / spritesPerJob;
+
+            dispatch(jobCount, [=](size_t job)
+            {
+                size_t begin = job * spritesPerJob;
+                size_t end = std::min(count, begin + spritesPerJob);
+
+                Generate(sprites + begin, end - begin, vertices + begin * 4, textureSize, inverseTextureSize);
+            });
+        }
+    }
+}
@@ -0,0 +1,275 @@
+//--------------------------------------------------------------------------------------
+// File: TextLayoutCache.h
+//
+// Least recently used cache of laid out strings for SpriteFont. Labels and menus are
+// drawn with the same text every frame, so after the second frame their glyph
+// positions come straight from here. A string is only admitted once it has been seen
+// before, and once the cache is full only if it is drawn more often than the string it
+// would replace, so text that changes every frame, or more strings than fit, do not
+// pay for an insert and an eviction on every draw.
+// Nothing here touches D3D, so it can be tested and benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace DirectX
+{
+    template<typename Char, typename Layout>
+    class TextLayoutCache
+    {
+    public:
+        struct Statistics
+        {
+            size_t Hits;
+            size_t Misses;
+            size_t Evictions;
+            size_t Strings;
+        };
+
+        TextLayoutCache() :
+            mCapacity(0),
+            mHits(0),
+            mMisses(0),
+            mEvictions(0),
+            mSamples(0),
+            mMissHash(0),
+            mMissCollides(false)
+        {
+        }
+
+        // Maximum number of strings kept. 0 turns the cache off and empties it.
+        void SetCapacity(size_t capacity)
+        {
+            mCapacity = capacity;
+            mIndex.reserve(capacity);
+
+            // 16 counters per string, at least 4096, so strings rarely share both counters.
+            size_t counters = capacity ? 4096 : 0;
+
+            while (counters && counters < capacity * 16)
+            {
+                counters *= 2;
+            }
+
+            mFrequency.assign(counters, 0);
+            mSamples = 0;
+
+            while (mEntries.size() > mCapacity)
+            {
+                Evict();
+            }
+        }
+
+        size_t Capacity() const { return mCapacity; }
+
+        // Returns the cached layout of text, or nullptr after counting a miss.
+        Layout* Find(Char const* text, size_t length)
+        {
+            uint64_t hash = Hash(text, length);
+            auto it = mIndex.find(hash);
+
+            if (it == mIndex.end() || it->second->text.compare(0, std::basic_string<Char>::npos, text, length) != 0)
+            {
+                mMisses++;
+                mMissHash = hash;
+                mMissCollides = (it != mIndex.end());
+                return nullptr;
+            }
+
+            // Move to the front of the recently used list.
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            mHits++;
+
+            Count(hash);
+
+            return &it->second->layout;
+        }
+
+        // Adds an empty layout for text, which Find just missed, evicting the least recently used
+        // string if the cache is full. The caller fills it in. nullptr means the string was not
+        // admitted, which is always the case the first time; the caller lays it out without the cache.
+        // Layout needs a clear() method: an evicted entry is reused in place, so a working set
+        // larger than the cache does not pay for a fresh string and layout allocation on every miss.
+        Layout* Insert(Char const* text, size_t length)
+        {
+            uint64_t hash = mMissHash;
+
+            Count(hash);
+
+            if (!Admit(hash))
+                return nullptr;
+
+            if (mMissCollides)
+            {
+                // A different string with the same 64-bit hash; the newer one takes its place.
+                mEntries.splice(mEntries.begin(), mEntries, mIndex[hash]);
+            }
+            else if (!mEntries.empty() && mEntries.size() >= mCapacity)
+            {
+                mIndex.erase(mEntries.back().hash);
+                mEntries.splice(mEntries.begin(), mEntries, std::prev(mEntries.end()));
+                mEvictions++;
+
+                mIndex[hash] = mEntries.begin();
+            }
+            else
+            {
+                mEntries.emplace_front();
+
+                mIndex[hash] = mEntries.begin();
+            }
+
+            Entry& entry = mEntries.front();
+
+            entry.text.assign(text, length);
+            entry.hash = hash;
+            entry.layout.clear();
+
+            return &entry.layout;
+        }
+
+        // Strings seen once stay remembered: their hashes do not depend on the layouts.
+        void Clear()
+        {
+            mEntries.clear();
+            mIndex.clear();
+        }
+
+        Statistics GetStatistics() const
+        {
+            return Statistics{ mHits, mMisses, mEvictions, mEntries.size() };
+        }
+
+        void ResetStatistics()
+        {
+            mHits = 0;
+            mMisses = 0;
+            mEvictions = 0;
+        }
+
+    private:
+        struct Entry
+        {
+            std::basic_string<Char> text;
+            uint64_t hash;
+            Layout layout;
+        };
+
+        // Eight bytes of text per multiply, so a label costs a handful of them rather than one per
+        // character, then mixed so every bit of the result depends on every character.
+        static uint64_t Hash(Char const* text, size_t length)
+        {
+            auto bytes = reinterpret_cast<uint8_t const*>(text);
+            size_t size = length * sizeof(Char);
+            uint64_t hash = 14695981039346656037ull ^ size;
+
+            for (; size >= 8; bytes += 8, size -= 8)
+            {
+                uint64_t chunk;
+
+                memcpy(&chunk, bytes, 8);
+                hash = (hash ^ chunk) * 0x9e3779b97f4a7c15ull;
+                hash ^= hash >> 32;
+            }
+
+            if (size)
+            {
+                uint64_t chunk = 0;
+
+                memcpy(&chunk, bytes, size);
+                hash = (hash ^ chunk) * 0x9e3779b97f4a7c15ull;
+            }
+
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdull;
+            hash ^= hash >> 33;
+
+            return hash;
+        }
+
+        // Frequency sketch: two 8-bit counters per string, the smaller one is its estimate. Every
+        // counter is halved after eight counts per string the cache holds, so strings no longer
+        // drawn fade out. Hits and inserts are counted; a string only measured is not.
+        void Count(uint64_t hash)
+        {
+            if (mFrequency.empty())
+                return;
+
+            for (size_t counter : { FirstCounter(hash), SecondCounter(hash) })
+            {
+                if (mFrequency[counter] < UINT8_MAX)
+                    mFrequency[counter]++;
+            }
+
+            if (++mSamples >= mCapacity * 8)
+            {
+                for (auto& frequency : mFrequency)
+                {
+                    frequency /= 2;
+                }
+
+                mSamples /= 2;
+            }
+        }
+
+        uint8_t Frequency(uint64_t hash) const
+        {
+            return std::min(mFrequency[FirstCounter(hash)], mFrequency[SecondCounter(hash)]);
+        }
+
+        size_t FirstCounter(uint64_t hash) const { return static_cast<size_t>(hash) & (mFrequency.size() - 1); }
+        size_t SecondCounter(uint64_t hash) const { return static_cast<size_t>(hash >> 32) & (mFrequency.size() - 1); }
+
+        // Seen before, and when the cache is full, more often than the least recently used string.
+        bool Admit(uint64_t hash) const
+        {
+            if (mFrequency.empty())
+                return false;
+
+            uint8_t frequency = Frequency(hash);
+
+            if (frequency < 2)
+                return false;
+
+            return mEntries.size() < mCapacity || mMissCollides || frequency > Frequency(mEntries.back().hash);
+        }
+
+        void Evict()
+        {
+            if (mEntries.empty())
+                return;
+
+            mIndex.erase(mEntries.back().hash);
+            mEntries.pop_back();
+            mEvictions++;
+        }
+
+        size_t mCapacity;
+        size_t mHits;
+        size_t mMisses;
+        size_t mEvictions;
+        size_t mSamples;
+
+        // The string Find last missed, which Insert is called with: its hash, and whether a
+        // different string with the same hash is cached.
+        uint64_t mMissHash;
+        bool mMissCollides;
+
+        // Most recently used first.
+        std::list<Entry> mEntries;
+        std::unordered_map<uint64_t, typename std::list<Entry>::iterator> mIndex;
+
+        std::vector<uint8_t> mFrequency;
+    };
+}
@@ -0,0 +1,785 @@
+//--------------------------------------------------------------------------------------
+// File: TrueTypeFont.h
+//
+// Minimal reader for TrueType (glyf outline) fonts, enough for SpriteFont to rasterize
+// glyphs on demand: character map, horizontal metrics and glyph outlines, including
+// composite glyphs. Hinting, kerning and CFF outlines are not supported. Every read is
+// bounds checked, so a damaged file fails to load or yields empty glyphs rather than
+// reading outside the data. Nothing here touches D3D, so it can be tested without a
+// device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace DirectX
+{
+    // A glyph outline in font units, y up. Each contour is a closed run of segments;
+    // a line segment has its control point halfway between its ends.
+    struct GlyphOutline
+    {
+        struct Point
+        {
+            float x;
+            float y;
+        };
+
+        struct Segment
+        {
+            Point p0;
+            Point control;
+            Point p1;
+            bool curve;
+        };
+
+        std::vector<Segment> segments;
+        std::vector<size_t> contourEnds;    // One past the last segment of each contour.
+
+        float xMin;
+        float yMin;
+        float xMax;
+        float yMax;
+
+        void Clear()
+        {
+            segments.clear();
+            contourEnds.clear();
+            xMin = yMin = xMax = yMax = 0;
+        }
+
+        bool Empty() const { return segments.empty(); }
+    };
+
+
+    class TrueTypeFont
+    {
+    public:
+        TrueTypeFont() :
+            mData(nullptr),
+            mSize(0),
+            mGlyphCount(0),
+            mUnitsPerEm(0),
+            mLongLoca(false),
+            mAscender(0),
+            mDescender(0),
+            mLineGap(0),
+            mHMetricCount(0),
+            mHmtx(0),
+            mLoca(0),
+            mGlyf(0),
+            mGlyfSize(0),
+            mCmap(0),
+            mCmapFormat(0),
+            mCmapGroupCount(0),
+            mXMin(0),
+            mYMin(0),
+            mXMax(0),
+            mYMax(0)
+        {
+        }
+
+        // The data is not copied and must outlive the font. Returns false if it is not a
+        // TrueType font with glyf outlines.
+        bool Load(uint8_t const* data, size_t size)
+        {
+            *this = TrueTypeFont();
+
+            mData = data;
+            mSize = size;
+
+            uint32_t version = U32(0);
+
+            if (version != 0x00010000 && version != 0x74727565)    // 1.0 or 'true'
+                return false;
+
+            uint32_t head = 0, hhea = 0, maxp = 0, cmap = 0;
+            uint32_t headSize = 0, hheaSize = 0, maxpSize = 0, cmapSize = 0, locaSize = 0, hmtxSize = 0;
+            uint16_t tableCount = U16(4);
+
+            for (uint32_t i = 0; i < tableCount; i++)
+            {
+                size_t record = 12 + i * 16;
+                uint32_t tag = U32(record);
+                uint32_t offset = U32(record + 8);
+                uint32_t length = U32(record + 12);
+
+                if (offset > mSize || length > mSize - offset)
+                    return false;
+
+                if (tag == Tag('h', 'e', 'a', 'd')) { head = offset; headSize = length; }
+                else if (tag == Tag('h', 'h', 'e', 'a')) { hhea = offset; hheaSize = length; }
+                else if (tag == Tag('m', 'a', 'x', 'p')) { maxp = offset; maxpSize = length; }
+                else if (tag == Tag('c', 'm', 'a', 'p')) { cmap = offset; cmapSize = length; }
+                else if (tag == Tag('h', 'm', 't', 'x')) { mHmtx = offset; hmtxSize = length; }
+                else if (tag == Tag('l', 'o', 'c', 'a')) { mLoca = offset; locaSize = length; }
+                else if (tag == Tag('g', 'l', 'y', 'f')) { mGlyf = offset; mGlyfSize = length; }
+            }
+
+            if (headSize < 54 || hheaSize < 36 || maxpSize < 6 || !cmapSize || !locaSize || !mGlyfSize || !hmtxSize)
+                return false;
+
+            mUnitsPerEm = U16(head + 18);
+            mXMin = S16(head + 36);
+            mYMin = S16(head + 38);
+            mXMax = S16(head + 40);
+            mYMax = S16(head + 42);
+            mLongLoca = S16(head + 50) != 0;
+
+            mAscender = S16(hhea + 4);
+            mDescender = S16(hhea + 6);
+            mLineGap = S16(hhea + 8);
+            mHMetricCount = U16(hhea + 34);
+
+            mGlyphCount = U16(maxp + 4);
+
+            if (!mUnitsPerEm || !mGlyphCount || !mHMetricCount || hmtxSize < mHMetricCount * 4u)
+                return false;
+
+            if (locaSize < (mGlyphCount + 1u) * (mLongLoca ? 4u : 2u))
+                return false;
+
+            return SelectCmap(cmap, cmapSize);
+        }
+
+        uint32_t GlyphCount() const { return mGlyphCount; }
+
+        // Font-wide metrics in font units.
+        int UnitsPerEm() const { return mUnitsPerEm; }
+        int Ascender() const { return mAscender; }
+        int Descender() const { return mDescender; }
+        int LineGap() const { return mLineGap; }
+
+        // Bounding box of every glyph in the font.
+        int XMin() const { return mXMin; }
+        int YMin() const { return mYMin; }
+        int XMax() const { return mXMax; }
+        int YMax() const { return mYMax; }
+
+        // Glyph index for a Unicode codepoint. 0, the .notdef glyph, means the font does not have it.
+        uint32_t FindGlyph(uint32_t codepoint) const
+        {
+            if (mCmapFormat == 12)
+            {
+                uint32_t low = 0;
+                uint32_t high = mCmapGroupCount;
+
+                while (low < high)
+                {
+                    uint32_t middle = (low + high) / 2;
+                    size_t group = mCmap + 16 + middle * 12;
+
+                    if (codepoint < U32(group))
+                    {
+                        high = middle;
+                    }
+                    else if (codepoint > U32(group + 4))
+                    {
+                        low = middle + 1;
+                    }
+                    else
+                    {
+                        uint32_t glyph = U32(group + 8) + (codepoint - U32(group));
+
+                        return (glyph < mGlyphCount) ? glyph : 0;
+                    }
+                }
+
+                return 0;
+            }
+
+            if (mCmapFormat == 4 && codepoint <= 0xFFFF)
+            {
+                uint32_t segmentCount = U16(mCmap + 6) / 2;
+                size_t endCodes = mCmap + 14;
+                size_t startCodes = endCodes + segmentCount * 2 + 2;
+                size_t idDeltas = startCodes + segmentCount * 2;
+                size_t idRangeOffsets = idDeltas + segmentCount * 2;
+
+                // First segment whose end code is at or above the codepoint.
+                uint32_t low = 0;
+                uint32_t high = segmentCount;
+
+                while (low < high)
+                {
+                    uint32_t middle = (low + high) / 2;
+
+                    if (U16(endCodes + middle * 2) < codepoint)
+                        low = middle + 1;
+                    else
+                        high = middle;
+                }
+
+                if (low == segmentCount)
+                    return 0;
+
+                uint32_t start = U16(startCodes + low * 2);
+
+                if (codepoint < start)
+                    return 0;
+
+                uint16_t delta = U16(idDeltas + low * 2);
+                uint16_t rangeOffset = U16(idRangeOffsets + low * 2);
+                uint32_t glyph;
+
+                if (!rangeOffset)
+                {
+                    glyph = static_cast<uint16_t>(codepoint + delta);
+                }
+                else
+                {
+                    glyph = U16(idRangeOffsets + low * 2 + rangeOffset + (codepoint - start) * 2);
+
+                    if (glyph)
+                        glyph = static_cast<uint16_t>(glyph + delta);
+                }
+
+                return (glyph < mGlyphCount) ? glyph : 0;
+            }
+
+            return 0;
+        }
+
+        // Lists every codepoint the character map gives a glyph, in ascending order.
+        void GetCharacters(std::vector<uint32_t>* characters) const
+        {
+            characters->clear();
+
+            if (mCmapFormat == 12)
+            {
+                for (uint32_t i = 0; i < mCmapGroupCount; i++)
+                {
+                    size_t group = mCmap + 16 + i * 12;
+                    uint32_t first = U32(group);
+                    uint32_t last = std::min<uint32_t>(U32(group + 4), 0x10FFFF);
+
+                    for (uint32_t c = first; c <= last; c++)
+                    {
+                        if ((characters->empty() || c > characters->back()) && FindGlyph(c))
+                            characters->push_back(c);
+                    }
+                }
+            }
+            else if (mCmapFormat == 4)
+            {
+                uint32_t segmentCount = U16(mCmap + 6) / 2;
+                size_t endCodes = mCmap + 14;
+                size_t startCodes = endCodes + segmentCount * 2 + 2;
+
+                for (uint32_t i = 0; i < segmentCount; i++)
+                {
+                    uint32_t first = U16(startCodes + i * 2);
+                    uint32_t last = U16(endCodes + i * 2);
+
+                    for (uint32_t c = first; c <= last; c++)
+                    {
+                        if ((characters->empty() || c > characters->back()) && FindGlyph(c))
+                            characters->push_back(c);
+                    }
+                }
+            }
+        }
+
+        // Horizontal advance in font units.
+        int AdvanceWidth(uint32_t glyph) const
+        {
+            if (glyph >= mGlyphCount)
+                return 0;
+
+            uint32_t metric = std::min<uint32_t>(glyph, mHMetricCount - 1);
+
+            return U16(mHmtx + metric * 4);
+        }
+
+        // Appends nothing and returns an empty outline for glyphs without contours, such as space.
+        void GetOutline(uint32_t glyph, GlyphOutline* outline) const
+        {
+            outline->Clear();
+
+            int components = 0;
+
+            AppendGlyph(glyph, Transform{ 1, 0, 0, 1, 0, 0 }, 0, &components, outline);
+
+            if (outline->Empty())
+                return;
+
+            auto const& first = outline->segments.front().p0;
+
+            outline->xMin = outline->xMax = first.x;
+            outline->yMin = outline->yMax = first.y;
+
+            for (auto const& segment : outline->segments)
+            {
+                // A quadratic stays inside the hull of its three points.
+                GlyphOutline::Point const points[] = { segment.p0, segment.control, segment.p1 };
+
+                for (auto const& p : points)
+                {
+                    outline->xMin = std::min(outline->xMin, p.x);
+                    outline->yMin = std::min(outline->yMin, p.y);
+                    outline->xMax = std::max(outline->xMax, p.x);
+                    outline->yMax = std::max(outline->yMax, p.y);
+                }
+            }
+        }
+
+    private:
+        static const int MaxCompositeDepth = 8;
+
+        // Components may share glyphs, so depth alone still allows an exponential number of them.
+        static const int MaxCompositeComponents = 1024;
+
+        struct Transform
+        {
+            float xx, xy, yx, yy, dx, dy;
+
+            GlyphOutline::Point Apply(float x, float y) const
+            {
+                return GlyphOutline::Point{ x * xx + y * yx + dx, x * xy + y * yy + dy };
+            }
+        };
+
+        static uint32_t Tag(char a, char b, char c, char d)
+        {
+            return (static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(c) << 8) | static_cast<uint32_t>(d);
+        }
+
+        // Big-endian reads. Anything past the end of the data reads as zero.
+        uint8_t U8(size_t offset) const
+        {
+            return (offset < mSize) ? mData[offset] : 0;
+        }
+
+        uint16_t U16(size_t offset) const
+        {
+            return static_cast<uint16_t>((U8(offset) << 8) | U8(offset + 1));
+        }
+
+        int16_t S16(size_t offset) const
+        {
+            return static_cast<int16_t>(U16(offset));
+        }
+
+        uint32_t U32(size_t offset) const
+        {
+            return (static_cast<uint32_t>(U16(offset)) << 16) | U16(offset + 2);
+        }
+
+        // Prefers a full Unicode (format 12) table, then a Basic Multilingual Plane (format 4) one.
+        bool SelectCmap(uint32_t cmap, uint32_t cmapSize)
+        {
+            uint16_t tableCount = U16(cmap + 2);
+            uint32_t best = 0;
+            int bestFormat = 0;
+
+            for (uint32_t i = 0; i < tableCount; i++)
+            {
+                size_t record = cmap + 4 + i * 8;
+                uint16_t platform = U16(record);
+                uint16_t encoding = U16(record + 2);
+                uint32_t offset = U32(record + 4);
+
+                bool unicode = (platform == 0) || (platform == 3 && (encoding == 1 || encoding == 10));
+
+                if (!unicode || offset >= cmapSize)
+                    continue;
+
+                int format = U16(cmap + offset);
+
+                if ((format == 12 && bestFormat != 12) || (format == 4 && !bestFormat))
+                {
+                    best = cmap + offset;
+                    bestFormat = format;
+                }
+            }
+
+            mCmap = best;
+            mCmapFormat = bestFormat;
+
+            // A format 12 subtable gives its own length; count only the groups that fit in it and in the cmap table.
+            if (bestFormat == 12)
+            {
+                uint32_t length = std::min<uint32_t>(U32(best + 4), cmap + cmapSize - best);
+
+                mCmapGroupCount = (length >= 16) ? std::min<uint32_t>(U32(best + 12), (length - 16) / 12) : 0;
+            }
+
+            return bestFormat != 0;
+        }
+
+        // Byte range of a glyph in the glyf table; empty for glyphs without an outline.
+        bool GlyphRange(uint32_t glyph, size_t* start, size_t* end) const
+        {
+            if (glyph >= mGlyphCount)
+                return false;
+
+            uint32_t first, last;
+
+            if (mLongLoca)
+            {
+                first = U32(mLoca + glyph * 4);
+                last = U32(mLoca + glyph * 4 + 4);
+            }
+            else
+            {
+                first = U16(mLoca + glyph * 2) * 2u;
+                last = U16(mLoca + glyph * 2 + 2) * 2u;
+            }
+
+            if (first >= last || last > mGlyfSize || last - first < 10)
+                return false;
+
+            *start = mGlyf + first;
+            *end = mGlyf + last;
+
+            return true;
+        }
+
+        void AppendGlyph(uint32_t glyph, Transform const& transform, int depth, int* components, GlyphOutline* outline) const
+        {
+            size_t start, end;
+
+            if (!GlyphRange(glyph, &start, &end))
+                return;
+
+            int16_t contourCount = S16(start);
+
+            if (contourCount >= 0)
+            {
+                AppendSimpleGlyph(start, end, contourCount, transform, outline);
+            }
+            else if (depth < MaxCompositeDepth)
+            {
+                AppendCompositeGlyph(start, end, transform, depth, components, outline);
+            }
+        }
+
+        void AppendSimpleGlyph(size_t start, size_t end, int contourCount, Transform const& transform, GlyphOutline* outline) const
+        {
+            enum
+            {
+                OnCurve = 0x01,
+                XShort = 0x02,
+                YShort = 0x04,
+                Repeat = 0x08,
+                XSameOrPositive = 0x10,
+                YSameOrPositive = 0x20,
+            };
+
+            size_t p = start + 10;
+
+            if (!contourCount)
+                return;
+
+            std::vector<uint16_t> contourEnds(contourCount);
+
+            for (int i = 0; i < contourCount; i++)
+            {
+                contourEnds[i] = U16(p + i * 2);
+
+                if (i > 0 && contourEnds[i] < contourEnds[i - 1])
+                    return;
+            }
+
+            p += contourCount * 2;
+
+            size_t pointCount = contourEnds.back() + 1u;
+
+            p += 2 + U16(p);    // Skip the hinting instructions.
+
+            // Each point takes at least one flag byte, so a count this large cannot be valid.
+            if (p >= end || pointCount > end - p)
+                return;
+
+            std::vector<uint8_t> flags(pointCount);
+
+            for (size_t i = 0; i < pointCount; )
+            {
+                if (p >= end)
+                    return;
+
+                uint8_t flag = U8(p++);
+                size_t count = 1;
+
+                if (flag & Repeat)
+                {
+                    if (p >= end)
+                        return;
+
+                    count += U8(p++);
+                }
+
+                for (; count > 0 && i < pointCount; count--)
+                {
+                    flags[i++] = flag;
+                }
+            }
+
+            std::vector<GlyphOutline::Point> points(pointCount);
+            int value = 0;
+
+            for (size_t i = 0; i < pointCount; i++)
+            {
+                if (flags[i] & XShort)
+                {
+                    value += (flags[i] & XSameOrPositive) ? U8(p) : -U8(p);
+                    p += 1;
+                }
+                else if (!(flags[i] & XSameOrPositive))
+                {
+                    value += S16(p);
+                    p += 2;
+                }
+
+                points[i].x = static_cast<float>(value);
+            }
+
+            value = 0;
+
+            for (size_t i = 0; i < pointCount; i++)
+            {
+                if (flags[i] & YShort)
+                {
+                    value += (flags[i] & YSameOrPositive) ? U8(p) : -U8(p);
+                    p += 1;
+                }
+                else if (!(flags[i] & YSameOrPositive))
+                {
+                    value += S16(p);
+                    p += 2;
+                }
+
+                points[i].y = static_cast<float>(value);
+            }
+
+            if (p > end)
+                return;
+
+            for (auto& point : points)
+            {
+                point = transform.Apply(point.x, point.y);
+            }
+
+            // A reflecting transform reverses the winding; undo it so the fill stays the same.
+            bool reverse = transform.xx * transform.yy - transform.xy * transform.yx < 0;
+
+            size_t first = 0;
+
+            for (int c = 0; c < contourCount; c++)
+            {
+                size_t last = contourEnds[c];
+
+                AppendContour(&points[first], &flags[first], last - first + 1, reverse, outline);
+
+                first = last + 1;
+            }
+        }
+
+        // Turns on/off-curve points into segments. Two off-curve points in a row imply an
+        // on-curve point halfway between them.
+        static void AppendContour(GlyphOutline::Point const* points, uint8_t const* flags, size_t count, bool reverse, GlyphOutline* outline)
+        {
+            if (count < 2)
+                return;
+
+            auto midpoint = [](GlyphOutline::Point a, GlyphOutline::Point b)
+            {
+                return GlyphOutline::Point{ (a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f };
+            };
+
+            auto point = [&](size_t i) { return points[reverse ? count - 1 - i : i]; };
+            auto onCurve = [&](size_t i) { return (flags[reverse ? count - 1 - i : i] & 1) != 0; };
+
+            // Start on an on-curve point, or between two off-curve ones.
+            size_t startIndex = 0;
+            GlyphOutline::Point start;
+
+            while (startIndex < count && !onCurve(startIndex))
+                startIndex++;
+
+            if (startIndex < count)
+            {
+                start = point(startIndex);
+            }
+            else
+            {
+                startIndex = 0;
+                start = midpoint(point(0), point(1));
+            }
+
+            size_t first = outline->segments.size();
+            GlyphOutline::Point current = start;
+            GlyphOutline::Point control = {};
+            bool haveControl = false;
+
+            for (size_t n = 1; n <= count; n++)
+            {
+                size_t i = (startIndex + n) % count;
+                GlyphOutline::Point next = point(i);
+
+                if (onCurve(i))
+                {
+                    if (haveControl)
+                        outline->segments.push_back(GlyphOutline::Segment{ current, control, next, true });
+                    else
+                        outline->segments.push_back(GlyphOutline::Segment{ current, midpoint(current, next), next, false });
+
+                    current = next;
+                    haveControl = false;
+                }
+                else if (haveControl)
+                {
+                    GlyphOutline::Point middle = midpoint(control, next);
+
+                    outline->segments.push_back(GlyphOutline::Segment{ current, control, middle, true });
+
+                    current = middle;
+                    control = next;
+                }
+                else
+                {
+                    control = next;
+                    haveControl = true;
+                }
+            }
+
+            // Close the contour back to where it started.
+            if (haveControl)
+            {
+                outline->segments.push_back(GlyphOutline::Segment{ current, control, start, true });
+            }
+            else if (current.x != start.x || current.y != start.y)
+            {
+                outline->segments.push_back(GlyphOutline::Segment{ current, midpoint(current, start), start, false });
+            }
+
+            if (outline->segments.size() > first)
+                outline->contourEnds.push_back(outline->segments.size());
+        }
+
+        void AppendCompositeGlyph(size_t start, size_t end, Transform const& transform, int depth, int* components, GlyphOutline* outline) const
+        {
+            enum
+            {
+                ArgsAreWords = 0x0001,
+                ArgsAreXYValues = 0x0002,
+                HaveScale = 0x0008,
+                MoreComponents = 0x0020,
+                HaveXYScale = 0x0040,
+                HaveTwoByTwo = 0x0080,
+            };
+
+            size_t p = start + 10;
+            uint16_t flags;
+
+            do
+            {
+                if (p + 4 > end || ++*components > MaxCompositeComponents)
+                    return;
+
+                flags = U16(p);
+                uint16_t component = U16(p + 2);
+                p += 4;
+
+                float dx = 0;
+                float dy = 0;
+
+                if (flags & ArgsAreWords)
+                {
+                    if (flags & ArgsAreXYValues)
+                    {
+                        dx = S16(p);
+                        dy = S16(p + 2);
+                    }
+
+                    p += 4;
+                }
+                else
+                {
+                    if (flags & ArgsAreXYValues)
+                    {
+                        dx = static_cast<int8_t>(U8(p));
+                        dy = static_cast<int8_t>(U8(p + 1));
+                    }
+
+                    p += 2;
+                }
+
+                // Components placed by matching points rather than offsets are drawn unmoved.
+                Transform local = { 1, 0, 0, 1, dx, dy };
+
+                if (flags & HaveScale)
+                {
+                    local.xx = local.yy = F2Dot14(p);
+                    p += 2;
+                }
+                else if (flags & HaveXYScale)
+                {
+                    local.xx = F2Dot14(p);
+                    local.yy = F2Dot14(p + 2);
+                    p += 4;
+                }
+                else if (flags & HaveTwoByTwo)
+                {
+                    local.xx = F2Dot14(p);
+                    local.xy = F2Dot14(p + 2);
+                    local.yx = F2Dot14(p + 4);
+                    local.yy = F2Dot14(p + 6);
+                    p += 8;
+                }
+
+                if (p > end)
+                    return;
+
+                // Apply the component transform first, then the parent's.
+                Transform combined;
+
+                combined.xx = local.xx * transform.xx + local.xy * transform.yx;
+                combined.xy = local.xx * transform.xy + local.xy * transform.yy;
+                combined.yx = local.yx * transform.xx + local.yy * transform.yx;
+                combined.yy = local.yx * transform.xy + local.yy * transform.yy;
+
+                GlyphOutline::Point offset = transform.Apply(local.dx, local.dy);
+
+                combined.dx = offset.x;
+                combined.dy = offset.y;
+
+                AppendGlyph(component, combined, depth + 1, components, outline);
+            }
+            while (flags & MoreComponents);
+        }
+
+        float F2Dot14(size_t offset) const
+        {
+            return static_cast<float>(S16(offset)) / 16384.0f;
+        }
+
+        uint8_t const* mData;
+        size_t mSize;
+
+        uint32_t mGlyphCount;
+        uint32_t mUnitsPerEm;
+        bool mLongLoca;
+        int mAscender;
+        int mDescender;
+        int mLineGap;
+        uint32_t mHMetricCount;
+
+        uint32_t mHmtx;
+        uint32_t mLoca;
+        uint32_t mGlyf;
+        uint32_t mGlyfSize;
+        uint32_t mCmap;
+        int mCmapFormat;
+        uint32_t mCmapGroupCount;
+
+        int mXMin;
+        int mYMin;
+        int mXMax;
+        int mYMax;
+    };
+}
@@ -0,0 +1,86 @@
+//--------------------------------------------------------------------------------------
+// File: Utf8.h
+//
+// Decodes UTF-8 one codepoint at a time, so SpriteFont can lay out UTF-8 strings
+// without converting them to wchar_t first. Nothing here touches D3D, so it can be
+// tested and benchmarked without a device.
+//--------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace DirectX
+{
+    namespace Utf8
+    {
+        // Substituted for malformed sequences.
+        const uint32_t ReplacementCharacter = 0xFFFD;
+
+        // Returns the codepoint at text and moves text past it. Overlong encodings,
+        // surrogates, codepoints above U+10FFFF and truncated sequences decode as
+        // ReplacementCharacter and skip only their lead byte, so decoding picks up
+        // again at the next valid character. Nothing is read past the terminating null.
+        inline uint32_t Decode(char const*& text)
+        {
+            auto s = reinterpret_cast<uint8_t const*>(text);
+            uint32_t lead = s[0];
+
+            if (lead < 0x80)
+            {
+                text++;
+                return lead;
+            }
+
+            uint32_t codepoint;
+            uint32_t minimum;
+            int length;
+
+            if ((lead & 0xE0) == 0xC0)
+            {
+                codepoint = lead & 0x1F;
+                minimum = 0x80;
+                length = 2;
+            }
+            else if ((lead & 0xF0) == 0xE0)
+            {
+                codepoint = lead & 0x0F;
+                minimum = 0x800;
+                length = 3;
+            }
+            else if ((lead & 0xF8) == 0xF0)
+            {
+                codepoint = lead & 0x07;
+                minimum = 0x10000;
+                length = 4;
+            }
+            else
+            {
+                text++;
+                return ReplacementCharacter;
+            }
+
+            for (int i = 1; i < length; i++)
+            {
+                // A null terminator is not a continuation byte, so this stops there.
+                if ((s[i] & 0xC0) != 0x80)
+                {
+                    text++;
+                    return ReplacementCharacter;
+                }
+
+                codepoint = (codepoint << 6) | (s[i] & 0x3F);
+            }
+
+            if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+            {
+                text++;
+                return ReplacementCharacter;
+            }
+
+            text += length;
+            return codepoint;
+        }
+    }
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace MyGame {
+
+	struct AxisAlignedBox {
+		XMFLOAT3 Min;
+		XMFLOAT3 Max;
+
+		// ҫŶl World, GMOb (|쥻P@I)
+		static AxisAlignedBox Transform(const AxisAlignedBox& box, const XMFLOAT4X4& m) {
+			float c[3] = { (box.Min.x + box.Max.x) * 0.5f, (box.Min.y + box.Max.y) * 0.5f, (box.Min.z + box.Max.z) * 0.5f };
+			float e[3] = { (box.Max.x - box.Min.x) * 0.5f, (box.Max.y - box.Min.y) * 0.5f, (box.Max.z - box.Min.z) * 0.5f };
+			float center[3], extent[3];
+			for (int j = 0; j < 3; j++) {
+				center[j] = c[0] * m.m[0][j] + c[1] * m.m[1][j] + c[2] * m.m[2][j] + m.m[3][j];
+				extent[j] = e[0] * fabsf(m.m[0][j]) + e[1] * fabsf(m.m[1][j]) + e[2] * fabsf(m.m[2][j]);
+			}
+			AxisAlignedBox result;
+			result.Min = XMFLOAT3(center[0] - extent[0], center[1] - extent[1], center[2] - extent[2]);
+			result.Max = XMFLOAT3(center[0] + extent[0], center[1] + extent[1], center[2] + extent[2]);
+			return result;
+		}
+
+		static AxisAlignedBox Merge(const AxisAlignedBox& a, const AxisAlignedBox& b) {
+			AxisAlignedBox result;
+			result.Min = XMFLOAT3(min(a.Min.x, b.Min.x), min(a.Min.y, b.Min.y), min(a.Min.z, b.Min.z));
+			result.Max = XMFLOAT3(max(a.Max.x, b.Max.x), max(a.Max.y, b.Max.y), max(a.Max.z, b.Max.z));
+			return result;
+		}
+	};
+
+	// ӥ ax + by + cz + d >= 0 , kVqݭnW
+	struct ViewFrustum {
+		XMFLOAT4 Planes[6];
+
+		// q View * Projection ( World * View * Projection, N|bҫŶ) X
+		// D3D  clip space O -w <= x, y <= w, 0 <= z <= w, Vqbx}ҥHO
+		static ViewFrustum FromMatrix(const XMFLOAT4X4& m) {
+			ViewFrustum f;
+			for (int j = 0; j < 4; j++) {
+				float x = m.m[j][0], y = m.m[j][1], z = m.m[j][2], w = m.m[j][3];
+				(&f.Planes[0].x)[j] = w + x;	// 
+				(&f.Planes[1].x)[j] = w - x;	// k
+				(&f.Planes[2].x)[j] = w + y;	// U
+				(&f.Planes[3].x)[j] = w - y;	// W
+				(&f.Planes[4].x)[j] = z;		// 
+				(&f.Planes[5].x)[j] = w - z;	// 
+			}
+			return f;
+		}
+	};
+
+	// ]鶥h (BVH), CӸ`I̦h LeafSize Ӫ
+	// `I̫eǦs: l`INOU@, @ʤl𪺪b order ̤]Os򪺤@q
+	// 鲾ʮɥ Update + Refit uvT`I; 𪺧Ϊ, ʫܤjɦA Build @
+	class BoundingVolumeHierarchy {
+
+	public:
+		static const int LeafSize = 4;
+
+		void Build(const vector<AxisAlignedBox>& boxes) {
+			items = boxes;
+			nodes.clear();
+			order.resize(items.size());
+			leafOf.assign(items.size(), -1);
+			dirty.clear();
+			dirtyNodes.clear();
+			depth = 0;
+			for (int i = 0; i < (int)order.size(); i++) order[i] = i;
+			if (items.empty()) return;
+
+			vector<XMFLOAT3> centers(items.size());
+			for (size_t i = 0; i < items.size(); i++) {
+				const AxisAlignedBox& b = items[i];
+				centers[i] = XMFLOAT3((b.Min.x + b.Max.x) * 0.5f, (b.Min.y + b.Max.y) * 0.5f, (b.Min.z + b.Max.z) * 0.5f);
+			}
+			nodes.reserve(items.size() / LeafSize * 2 + 1);
+			BuildNode(-1, 0, (int)items.size(), 1, centers);
+			dirty.assign(nodes.size(), 0);
+		}
+
+		// OUs World ], Refit evT Cull
+		void Update(int item, const AxisAlignedBox& box) {
+			items[item] = box;
+			for (int n = leafOf[item]; n >= 0 && !dirty[n]; n = nodes[n].Parent) {
+				dirty[n] = 1;
+				dirtyNodes.push_back(n);
+			}
+		}
+
+		// u⦳ܰʪ`IM̪, l`Iޤ@w`Ij, ѤjpNn
+		void Refit() {
+			if (dirtyNodes.empty()) return;
+			sort(dirtyNodes.begin(), dirtyNodes.end(), greater<int>());
+			for (int n : dirtyNodes) {
+				Node& node = nodes[n];
+				if (node.Right < 0) {
+					AxisAlignedBox box = items[order[node.First]];
+					for (int i = 1; i < node.Count; i++) box = AxisAlignedBox::Merge(box, items[order[node.First + i]]);
+					node.Box = box;
+				} else {
+					node.Box = AxisAlignedBox::Merge(nodes[n + 1].Box, nodes[node.Right].Box);
+				}
+				dirty[n] = 0;
+			}
+			dirtyNodes.clear();
+		}
+
+		// ݱo쪺ީi visible (ǬO𪺶)
+		// Ӹ`Ib@ɪUʤl, AU
+		void Cull(const ViewFrustum& frustum, vector<int>& visible) const {
+			visible.clear();
+			if (nodes.empty()) return;
+
+			//  k h, |̳̦hOe k - 1 hU@ӥkl`IA[Wih, |WL depth + 1
+			// @몺ΩTw}CN, `ɭԤ~tm
+			struct Entry { int Node; int Planes; };
+			Entry fixed[64];
+			vector<Entry> large;
+			Entry* stack = fixed;
+			if (depth + 1 > 64) {
+				large.resize(depth + 1);
+				stack = large.data();
+			}
+			int top = 0;
+			stack[top++] = { 0, 0x3F };
+			while (top > 0) {
+				Entry e = stack[--top];
+				const Node& node = nodes[e.Node];
+				int planes = e.Planes;
+				if (!Test(frustum, node.Box, planes)) continue;
+				if (planes == 0) {
+					visible.insert(visible.end(), order.begin() + node.First, order.begin() + node.First + node.Count);
+				} else if (node.Right < 0) {
+					for (int i = 0; i < node.Count; i++) {
+						int item = order[node.First + i];
+						int itemPlanes = planes;
+						if (Test(frustum, items[item], itemPlanes)) visible.push_back(item);
+					}
+				} else {
+					// Bz, XǤ~| order @P
+					stack[top++] = { node.Right, planes };
+					stack[top++] = { e.Node + 1, planes };
+				}
+			}
+		}
+
+		int Count() const {
+			return (int)items.size();
+		}
+
+		// ڨ̲``IgLXӸ`I, žO 0
+		int Depth() const {
+			return depth;
+		}
+
+		const AxisAlignedBox& Bounds(int item) const {
+			return items[item];
+		}
+
+	private:
+		struct Node {
+			AxisAlignedBox Box;
+			int Parent;
+			int Right;		// `IO -1, l`ITwOۤvU@
+			int First;		// lb order ̪d
+			int Count;
+		};
+
+		int BuildNode(int parent, int first, int count, int level, const vector<XMFLOAT3>& centers) {
+			int index = (int)nodes.size();
+			depth = max(depth, level);
+			nodes.push_back(Node());
+			nodes[index].Parent = parent;
+			nodes[index].Right = -1;
+			nodes[index].First = first;
+			nodes[index].Count = count;
+
+			AxisAlignedBox box = items[order[first]];
+			XMFLOAT3 cmin = centers[order[first]], cmax = cmin;
+			for (int i = first + 1; i < first + count; i++) {
+				box = AxisAlignedBox::Merge(box, items[order[i]]);
+				const XMFLOAT3& c = centers[order[i]];
+				cmin = XMFLOAT3(min(cmin.x, c.x), min(cmin.y, c.y), min(cmin.z, c.z));
+				cmax = XMFLOAT3(max(cmax.x, c.x), max(cmax.y, c.y), max(cmax.z, c.z));
+			}
+			nodes[index].Box = box;
+
+			if (count <= LeafSize) {
+				for (int i = first; i < first + count; i++) leafOf[order[i]] = index;
+				return index;
+			}
+
+			// uۤI̪b, qƤb
+			float dx = cmax.x - cmin.x, dy = cmax.y - cmin.y, dz = cmax.z - cmin.z;
+			int axis = dx >= dy && dx >= dz ? 0 : (dy >= dz ? 1 : 2);
+			int half = count / 2;
+			nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count, [&](int a, int b) {
+				return (&centers[a].x)[axis] < (&centers[b].x)[axis];
+			});
+
+			BuildNode(index, first, half, level + 1, centers);
+			int right = BuildNode(index, first + half, count - half, level + 1, centers);
+			nodes[index].Right = right;
+			return index;
+		}
+
+		// planes CӦ줸Nٻݭn, bYӥNMӦ줸
+		static bool Test(const ViewFrustum& frustum, const AxisAlignedBox& box, int& planes) {
+			for (int i = 0; i < 6; i++) {
+				if (!(planes & (1 << i))) continue;
+				const XMFLOAT4& p = frustum.Planes[i];
+				// ̻]b~, Ӳlb~
+				float outside = p.w
+					+ p.x * (p.x > 0 ? box.Max.x : box.Min.x)
+					+ p.y * (p.y > 0 ? box.Max.y : box.Min.y)
+					+ p.z * (p.z > 0 ? box.Max.z : box.Min.z);
+				if (outside < 0) return false;
+				float inside = p.w
+					+ p.x * (p.x > 0 ? box.Min.x : box.Max.x)
+					+ p.y * (p.y > 0 ? box.Min.y : box.Max.y)
+					+ p.z * (p.z > 0 ? box.Min.z : box.Max.z);
+				if (inside >= 0) planes &= ~(1 << i);
+			}
+			return true;
+		}
+
+	private:
+		vector<AxisAlignedBox> items;	// CӪ骺 World ]
+		vector<Node> nodes;
+		vector<int> order;
+		vector<int> leafOf;
+		vector<uint8_t> dirty;
+		vector<int> dirtyNodes;
+		int depth = 0;
+	};
+}
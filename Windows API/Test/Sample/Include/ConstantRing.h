@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace MyGame {
+
+	// @V̨C draw  constant iP@Ӥj buffer, qYuʰtm
+	// offset H 256 bytes , oO D3D11.1 *SetConstantBuffers1 ̤p (16  float4)
+	// buffer CVH WRITE_DISCARD , driver |@sO, ε GPU ΧW@V
+	// o̥u offset, I˸m
+	class ConstantRing {
+
+	public:
+		static const size_t Alignment = 256;
+		static const size_t Invalid = (size_t)-1;
+
+		static size_t Align(size_t size) {
+			return (size + Alignment - 1) & ~(Alignment - 1);
+		}
+
+		// *SetConstantBuffers1  FirstConstant / NumConstants OH 16 bytes 
+		static uint32_t FirstConstant(size_t offset) {
+			return (uint32_t)(offset / 16);
+		}
+
+		static uint32_t ConstantCount(size_t size) {
+			return (uint32_t)(Align(size) / 16);
+		}
+
+		// CV}lɩIs, capacity Oo@V쪺 buffer jp
+		void Reset(size_t capacity) {
+			this->capacity = capacity;
+			head.store(0, memory_order_relaxed);
+		}
+
+		// iHqhPɩIs, Ŷɦ^ Invalid
+		size_t Allocate(size_t size) {
+			size_t aligned = Align(size);
+			size_t offset = head.fetch_add(aligned, memory_order_relaxed);
+			if (offset + aligned > capacity) return Invalid;
+			return offset;
+		}
+
+		size_t Capacity() const {
+			return capacity;
+		}
+
+		// o@VnD`q, ]t񤣤U, WL Capacity ɤU@Vӥ[j buffer
+		size_t Requested() const {
+			return head.load(memory_order_relaxed);
+		}
+
+	private:
+		size_t capacity = 0;
+		atomic<size_t> head{ 0 };
+	};
+}
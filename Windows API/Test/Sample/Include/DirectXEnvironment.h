@@ -5,6 +5,8 @@
 #include "SimpleVertex.h"
 #include "Shader.h"
 #include "Scene.h"
+#include "RenderQueue.h"
+#include "Profiler.h"
 
 #define CHECKRETURN(a,b) if(CheckFailed(a,b)){return;}
 
@@ -15,30 +17,21 @@ namespace MyGame {
 		public:
 		DirectXPanel() {
 
-			fbxSdkManager = FbxManager::Create();
-			FbxImporter* fbxImportor = FbxImporter::Create(fbxSdkManager, "");
-			FbxIOSettings* pIOsettings = FbxIOSettings::Create(fbxSdkManager, IOSROOT);
-			fbxSdkManager->SetIOSettings(pIOsettings);
+			fbxSdkManager = nullptr;
+			fbxScene = nullptr;
+			myScence = nullptr;
 
-			if (fbxImportor->Initialize("./Resource/new_objects.fbx", -1, fbxSdkManager->GetIOSettings())) {
-				fbxScene = FbxScene::Create(fbxSdkManager, "");
-				if (fbxImportor->Import(fbxScene) == false) {
-					fbxScene->Destroy();
-					fbxScene = nullptr;
-				} else {
-					OutputDebug(TEXT("Load FBX success\n"));
-					// Populate the FBX file format version numbers with the import file.
-					int major, minor, revision;
-					fbxImportor->GetFileVersion(major, minor, revision);
-					OutputDebug(TEXT("FBX File Version: %d %d %d\n"), major, minor, revision);
-					
-					if (FbxNode* fbxRootNode = fbxScene->GetRootNode()) {
-						PrintFBXHierarchy(fbxRootNode);
+			// ֨ .fbx oWNҰ FBX SDK
+			{
+				PROFILE_SCOPE("OpenSceneCache");
+				if (SceneCacheFormat::HashFile(TEXT("./Resource/new_objects.fbx"), sourceHash, sourceSize)) {
+					if (sceneCache.Open(TEXT("./Resource/new_objects.scenecache")) && !sceneCache.Matches(sourceHash, sourceSize)) {
+						sceneCache.Close();
 					}
 				}
 			}
 
-			if (fbxImportor) fbxImportor->Destroy();
+			if (!sceneCache.IsOpen()) ImportFBX();
 
 			HRESULT hr;
 			// bu{l COM եեμҦAåB]wPB/DPB
@@ -380,6 +373,30 @@ namespace MyGame {
 				// Set the input layout to the input-assembler
 				context->IASetInputLayout(VertexLayout.Get());
 
+				// P@ mesh h draw X֮ɥΪ shader, x}qĤGӳIwİϳv instance Ū
+				// Soɮ״N instancing
+				ShaderCode instancedShaderCode;
+				instancedShaderCode.LoadFromFile(TEXT("InstancedVertexShader.cso"));
+				if (instancedShaderCode.IsOK) {
+					D3D11_INPUT_ELEMENT_DESC instancedLayout[] =
+					{
+						{ "POSITION",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0,	 D3D11_INPUT_PER_VERTEX_DATA, 0 },
+						{ "COLOR",     0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+						{ "TEXCOORD",  0, DXGI_FORMAT_R32G32_FLOAT,		  0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+						{ "TRANSFORM", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,	 D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+						{ "TRANSFORM", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+						{ "TRANSFORM", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+						{ "TRANSFORM", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+					};
+					hr = D3D11Device->CreateVertexShader(instancedShaderCode.Code, instancedShaderCode.Length, nullptr, &InstancedVertexShader);
+					CHECKRETURN(hr, TEXT("Create InstancedVertexShader"));
+					hr = D3D11Device->CreateInputLayout(instancedLayout, sizeof(instancedLayout) / sizeof(D3D11_INPUT_ELEMENT_DESC), instancedShaderCode.Code,
+						instancedShaderCode.Length, InstancedVertexLayout.ReleaseAndGetAddressOf());
+					CHECKRETURN(hr, TEXT("Create InstancedVertexLayout"));
+					Instances = make_unique<InstanceBuffer>();
+					Instances->Create(D3D11Device.Get());
+				}
+
 				// Load Shader bytecode
 				ShaderCode pixelShaderCode;
 				pixelShaderCode.LoadFromFile(TEXT("PixelShader.cso"));
@@ -407,6 +424,35 @@ namespace MyGame {
 			}
 		}
 
+		private:
+		void ImportFBX() {
+			PROFILE_SCOPE("ImportFBX");
+			fbxSdkManager = FbxManager::Create();
+			FbxImporter* fbxImportor = FbxImporter::Create(fbxSdkManager, "");
+			FbxIOSettings* pIOsettings = FbxIOSettings::Create(fbxSdkManager, IOSROOT);
+			fbxSdkManager->SetIOSettings(pIOsettings);
+
+			if (fbxImportor->Initialize("./Resource/new_objects.fbx", -1, fbxSdkManager->GetIOSettings())) {
+				fbxScene = FbxScene::Create(fbxSdkManager, "");
+				if (fbxImportor->Import(fbxScene) == false) {
+					fbxScene->Destroy();
+					fbxScene = nullptr;
+				} else {
+					OutputDebug(TEXT("Load FBX success\n"));
+					// Populate the FBX file format version numbers with the import file.
+					int major, minor, revision;
+					fbxImportor->GetFileVersion(major, minor, revision);
+					OutputDebug(TEXT("FBX File Version: %d %d %d\n"), major, minor, revision);
+				
+					if (FbxNode* fbxRootNode = fbxScene->GetRootNode()) {
+						PrintFBXHierarchy(fbxRootNode);
+					}
+				}
+			}
+
+			if (fbxImportor) fbxImportor->Destroy();
+		}
+
 		private:
 		void PrepareData() {
 			
@@ -417,8 +463,32 @@ namespace MyGame {
 			float h = abs((float)rect.bottom - (float)rect.top);
 
 			myScence = new MyScene(fbxSdkManager, fbxScene);
-			if (myScence->CreateBuffer(D3D11Device.Get())) {
-				OutputDebug(TEXT("Create Scence Success\n"));
+			PROFILE_SCOPE("CreateSceneBuffer");
+			bool cached = false;
+			if (sceneCache.IsOpen()) {
+				cached = myScence->CreateFromCache(D3D11Device.Get(), sceneCache);
+				sceneCache.Close();
+				if (cached) {
+					OutputDebug(TEXT("Load Scene Cache Success\n"));
+				} else {
+					//  .fbx oWoŪX, ֨aF: R, q .fbx פJíg@
+					OutputDebug(TEXT("Load Scene Cache Failed\n"));
+					DeleteFile(TEXT("./Resource/new_objects.scenecache"));
+					delete myScence;
+					ImportFBX();
+					myScence = new MyScene(fbxSdkManager, fbxScene);
+				}
+			}
+			if (!cached) {
+				SceneCacheWriter writer(sizeof(SimpleVertex));
+				writer.SetSource(sourceHash, sourceSize);
+				if (myScence->CreateBuffer(D3D11Device.Get(), &writer)) {
+					OutputDebug(TEXT("Create Scence Success\n"));
+					// UҰʴNŪo; gJѥuOUAפJ@
+					if (sourceSize > 0 && !writer.Save(TEXT("./Resource/new_objects.scenecache"))) {
+						OutputDebug(TEXT("Save Scene Cache Failed\n"));
+					}
+				}
 			}
 
 			// ҫ
@@ -469,6 +539,12 @@ namespace MyGame {
 			constDesc.CPUAccessFlags = 0;
 			hr = D3D11Device->CreateBuffer(&constDesc, NULL, &ConstantBuffer);
 			CHECKRETURN(hr, TEXT("Create ConstBuffer"));
+
+			// D3D11.1 HWV`qgiP@ buffer,  offset jw; 䴩N¨C draw UpdateSubresource
+			ConstantsRing = make_unique<ConstantRingBuffer>();
+			if (!ConstantsRing->Create(D3D11Device.Get(), ImmediateContext.Get())) {
+				ConstantsRing.reset();
+			}
 		}
 
 		private:
@@ -536,16 +612,17 @@ namespace MyGame {
 		void Direct2DRneder() {
 			if (D2DDeviceContext.Get()) {
 				D2DDeviceContext->BeginDraw();
-				const String info = Info->ToString();
-				if (!info.IsNullOrEmpty()) {
-					LPCTSTR str = info.c_str();
+				// ˸mT|, uդ@; fpsString uΦۤvŶ, CVΰtmO
+				if (infoString.IsNullOrEmpty()) {
+					infoString = Info->ToString();
+				}
+				if (!infoString.IsNullOrEmpty()) {
 					D2D1_RECT_F layoutRect = { 0, 0, 300, 300 };
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(infoString.c_str(), (UINT32)infoString.Length(), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 
 				if (!(fpsString.IsNullOrEmpty())) {
-					LPCTSTR str = fpsString.c_str();
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), FPSFormat.Get(), fpsLayoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(fpsString.c_str(), (UINT32)fpsString.Length(), FPSFormat.Get(), fpsLayoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 				D2DDeviceContext->EndDraw();
 			}
@@ -626,7 +703,8 @@ namespace MyGame {
 			const double UpdatePeriod = 100.0;
 			if (Elapsed > UpdatePeriod) {
 				double fps = 1000.0 * fpsCounter / Elapsed;
-				fpsString.Format(TEXT("%.2lf"), fps);
+				// ᭱Oo@Vڵe / , draw call , HαƧǫ٤UA]w
+				fpsString.Format(TEXT("%.2lf  %d/%d  draws %d  saved %d"), fps, (int)myScence->Visible.size(), (int)myScence->Drawables.size(), QueueStats.Draws, QueueStats.StateChangesSaved);
 				fpsCounter = 0;
 				time = now;
 			}
@@ -635,7 +713,8 @@ namespace MyGame {
 
 		private:
 		void Render() {
-			
+			PROFILE_SCOPE("Render");
+
 			if (myScence) {
 				ImmediateContext->OMSetRenderTargets(1, RenderTargetView.GetAddressOf(), nullptr);
 				ImmediateContext->ClearDepthStencilView(DepthStencilView.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
@@ -657,36 +736,72 @@ namespace MyGame {
 				Direct2DRneder();
 
 				// enGXùWI
+				PROFILE_SCOPE("Present");
 				SwapChain->Present(0, Tearing ? DXGI_PRESENT_ALLOW_TEARING : 0);
 			}
 		}
 
 		private:
 		void RenderScence(MyScene* scence, ID3D11DeviceContext* deviceContext) {
-			RenderNode(scence->Root, deviceContext);
-		}
+			// @uʱy⧹Ҧ`I World * View * Projection, SʹL`I World
+			{
+				PROFILE_SCOPE("UpdateTransforms");
+				scence->Transforms.UpdateRange(0, scence->Transforms.Count(), view * projection);
+			}
 
-		private:
-		void RenderNode(MyNode* node, ID3D11DeviceContext* deviceContext) {
-			if (node->Children.size()) {
-				for (size_t i = 0; i < node->Children.size(); i++) {
+			//  BVH DX@, uoǪ DrawIndexed
+			{
+				PROFILE_SCOPE("Cull");
+				scence->UpdateBounds();
+				scence->Transforms.ClearDirty();
+				scence->Cull(view * projection);
+			}
 
-					RenderNode(node->Children[i], deviceContext);
+			//  shader / material / `ױƧǫAeX, W@ draw @˪ANA]
+			{
+				PROFILE_SCOPE("BuildQueue");
+				Queue.Clear();
+				// CVss, _hL buffer / texture |@ֿn, MeshIds u 16 줸]|
+				ShaderIds.Clear();
+				MaterialIds.Clear();
+				MeshIds.Clear();
+				for (int i : scence->Visible) {
+					RenderNode(scence, scence->Drawables[i]);
 				}
-			} else if (node->Mesh) {
-				UINT stride = sizeof(SimpleVertex);
-				UINT offset = 0;
-
-				Matrix transform = node->GlobalTransfrom * view * projection;
-				deviceContext->UpdateSubresource(ConstantBuffer.Get(), 0, NULL, &transform, 0, 0);
-				deviceContext->IASetVertexBuffers(0, 1, &node->Mesh->VertexBuffer, &stride, &offset);
-				deviceContext->IASetIndexBuffer(node->Mesh->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-				// ]whΩݾ
-				deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-				deviceContext->DrawIndexed(node->Mesh->indexCount, 0, 0);
+				Queue.Sort();
+			}
+
+			{
+				PROFILE_SCOPE("Submit");
+				QueueStats = Queue.Submit(deviceContext, ConstantBuffer.Get(), ConstantsRing.get(), Instances.get());
 			}
 		}
 
+		private:
+		void RenderNode(MyScene* scence, MyNode* node) {
+			DrawPacket packet;
+			packet.InputLayout = VertexLayout.Get();
+			packet.VertexShader = VertexShader.Get();
+			packet.PixelShader = PixelShader.Get();
+			packet.Texture = ResourceView.Get();
+			packet.BlendState = nullptr;
+			packet.VertexBuffer = node->Mesh->VertexBuffer;
+			packet.Stride = sizeof(SimpleVertex);
+			packet.IndexBuffer = node->Mesh->IndexBuffer;
+			packet.IndexFormat = DXGI_FORMAT_R32_UINT;
+			// ]whΩݾ
+			packet.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+			packet.IndexCount = node->Mesh->indexCount;
+			packet.Constants = scence->Transforms.WorldViewProjection(node->Transform);
+			packet.InstancedVertexShader = InstancedVertexShader.Get();
+			packet.InstancedInputLayout = InstancedVertexLayout.Get();
+
+			// P@ mesh Ʀb@_~X֦ instancing
+			uint32_t shader = ShaderIds.Get(packet.PixelShader);
+			uint32_t material = (MaterialIds.Get(packet.Texture) << 16) | (MeshIds.Get(packet.VertexBuffer) & 0xFFFF);
+			Queue.Add(SortKey::Opaque(0, shader, material, SortKey::Depth(packet.Constants)), packet);
+		}
+
 		public:
 		HANDLE StartGameLoop(HWND hWnd) {
 			if (Running == false) {
@@ -699,7 +814,9 @@ namespace MyGame {
 
 		private:
 		void Run() {
+			PROFILE_THREAD("Render");
 			while (Running) {
+				PROFILE_FRAME();
 				if (!resized) {
 					SetViewport(ImmediateContext.Get());
 					resized = true;
@@ -707,6 +824,13 @@ namespace MyGame {
 				HandleUserControl();
 				Render();
 			}
+
+			//  chrome://tracing  https://ui.perfetto.dev }
+			FILE* stream;
+			if (_tfopen_s(&stream, TEXT("Profile.json"), TEXT("w")) == 0) {
+				Profiler::Instance().WriteChromeTrace(stream);
+				fclose(stream);
+			}
 		}
 
 		public:
@@ -739,7 +863,7 @@ namespace MyGame {
 		}
 
 		void CreateWICTexture(byte* data, size_t size) {
-			
+			PROFILE_SCOPE("CreateWICTexture");
 			HRESULT hr;
 			hr = CreateWICTextureFromMemory(D3D11Device.Get(), ImmediateContext.Get(), data, size, nullptr, &ResourceView);
 			CHECKRETURN(hr, TEXT("CreateWICTextureFromMemory"));
@@ -1042,6 +1166,8 @@ namespace MyGame {
 		ComPtr<ID3D11DepthStencilState> DepthStencilState;
 		ComPtr<ID3D11InputLayout> VertexLayout;
 		ComPtr<ID3D11VertexShader> VertexShader;
+		ComPtr<ID3D11VertexShader> InstancedVertexShader;
+		ComPtr<ID3D11InputLayout> InstancedVertexLayout;
 		ComPtr<ID3D11PixelShader> PixelShader;
 		ComPtr<ID3D11ShaderReflection> Reflector;
 		ComPtr<ID3D11ShaderResourceView> ResourceView;
@@ -1050,6 +1176,13 @@ namespace MyGame {
 		ComPtr<ID3D11Buffer> IndexBuffer;
 		ComPtr<ID3D11Buffer> ConstantBuffer;
 		ComPtr<ID3D11SamplerState> SamplerState;
+		RenderQueue Queue;
+		unique_ptr<ConstantRingBuffer> ConstantsRing;
+		SortKeyIds ShaderIds;
+		SortKeyIds MaterialIds;
+		SortKeyIds MeshIds;
+		unique_ptr<InstanceBuffer> Instances;
+		RenderQueueStats QueueStats;
 
 		BOOL TearingSupport = false;
 		D3D11_FEATURE_DATA_THREADING ThreadingSupport;
@@ -1068,6 +1201,7 @@ namespace MyGame {
 		LARGE_INTEGER time;
 		LARGE_INTEGER freq;
 		String fpsString;
+		String infoString;
 		Matrix world;
 		Matrix view;
 		Matrix projection;
@@ -1080,5 +1214,8 @@ namespace MyGame {
 		FbxScene* fbxScene;
 		FbxManager* fbxSdkManager;
 		MyScene* myScence;
+		SceneCache sceneCache;
+		uint64_t sourceHash = 0;
+		uint64_t sourceSize = 0;
 	};
 }
\ No newline at end of file
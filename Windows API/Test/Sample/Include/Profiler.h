@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Ϊk:
+//   PROFILE_SCOPE("Render");    OoӰ϶᪺ɶ
+//   PROFILE_FRAME();            bɶbWаO@V}l
+// ɥ Profiler::Instance().WriteChromeTrace() X, iHi chrome://tracing  Perfetto
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) MyGame::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_FRAME() MyGame::Profiler::Instance().Mark("Frame")
+#define PROFILE_THREAD(name) MyGame::Profiler::Instance().SetThreadName(name)
+
+namespace MyGame {
+
+	struct ProfileEvent {
+		const char* Name;	// Or`, |ƻs
+		int64_t Begin;		// steady_clock l tick
+		int64_t End;		// p 0 ܬO@ӼаO
+	};
+
+	// Cۤv@wİ, u̷֦|gJ, ݭn
+	// gл\ªƥ
+	class ProfileThreadBuffer {
+
+	public:
+		static const size_t Capacity = 1 << 16;
+
+		ProfileThreadBuffer(int id)
+			: Id(id), events(new ProfileEvent[Capacity]) {
+		}
+
+		void Push(const char* name, int64_t begin, int64_t end) {
+			uint64_t n = written.load(memory_order_relaxed);
+			ProfileEvent& e = events[n & (Capacity - 1)];
+			e.Name = name;
+			e.Begin = begin;
+			e.End = end;
+			written.store(n + 1, memory_order_release);
+		}
+
+		template<typename Function>
+		void ForEach(Function&& func) const {
+			uint64_t n = written.load(memory_order_acquire);
+			uint64_t first = n > Capacity ? n - Capacity : 0;
+			for (uint64_t i = first; i < n; i++) {
+				func(events[i & (Capacity - 1)]);
+			}
+		}
+
+		const int Id;
+		const char* Name = nullptr;
+
+	private:
+		unique_ptr<ProfileEvent[]> events;
+		atomic<uint64_t> written{ 0 };
+	};
+
+	class Profiler {
+
+	public:
+		static Profiler& Instance() {
+			static Profiler profiler;
+			return profiler;
+		}
+
+		// |uŪ, ⦨LdXɦA
+		static int64_t Now() {
+			return chrono::steady_clock::now().time_since_epoch().count();
+		}
+
+		// Ĥ@Isɤ~V Profiler nO, ᳣uOŪ thread_local
+		ProfileThreadBuffer& ThreadBuffer() {
+			static thread_local ProfileThreadBuffer* buffer = nullptr;
+			if (buffer == nullptr) {
+				lock_guard<mutex> lock(mtx);
+				buffers.emplace_back(new ProfileThreadBuffer((int)buffers.size() + 1));
+				buffer = buffers.back().get();
+			}
+			return *buffer;
+		}
+
+		void SetThreadName(const char* name) {
+			ThreadBuffer().Name = name;
+		}
+
+		void Mark(const char* name) {
+			int64_t now = Now();
+			ThreadBuffer().Push(name, now, -1);
+		}
+
+		// X Trace Event Format, ӦbLUӤIs
+		void WriteChromeTrace(FILE* stream) {
+			lock_guard<mutex> lock(mtx);
+			const double toMicroseconds = 1000000.0 * chrono::steady_clock::period::num / chrono::steady_clock::period::den;
+			bool first = true;
+			fprintf(stream, "{\"traceEvents\":[\n");
+			for (auto& b : buffers) {
+				if (b->Name) {
+					fprintf(stream, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+						first ? "" : ",\n", b->Id, b->Name);
+					first = false;
+				}
+				b->ForEach([&](const ProfileEvent& e) {
+					if (e.End < 0) {
+						fprintf(stream, "%s{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+							first ? "" : ",\n", e.Name, (e.Begin - start) * toMicroseconds, b->Id);
+					} else {
+						fprintf(stream, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+							first ? "" : ",\n", e.Name, (e.Begin - start) * toMicroseconds, (e.End - e.Begin) * toMicroseconds, b->Id);
+					}
+					first = false;
+				});
+			}
+			fprintf(stream, "\n],\"displayTimeUnit\":\"ms\"}\n");
+		}
+
+	private:
+		Profiler() : start(Now()) {}
+
+		int64_t start;
+		mutex mtx;
+		vector<unique_ptr<ProfileThreadBuffer>> buffers;
+	};
+
+	class ProfileZone {
+
+	public:
+		explicit ProfileZone(const char* name)
+			: buffer(Profiler::Instance().ThreadBuffer()), name(name), begin(Profiler::Now()) {
+		}
+
+		~ProfileZone() {
+			buffer.Push(name, begin, Profiler::Now());
+		}
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		ProfileThreadBuffer& buffer;
+		const char* name;
+		int64_t begin;
+	};
+}
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ConstantRing.h"
+#include "SortKey.h"
+#include "../../../DirectXTK/Src/RadixSort.h"
+
+namespace MyGame {
+
+	// @ DrawIndexed ݭnA,  RenderQueue ƧǫAeX
+	struct DrawPacket {
+		ID3D11InputLayout* InputLayout;
+		ID3D11VertexShader* VertexShader;
+		ID3D11PixelShader* PixelShader;
+		ID3D11ShaderResourceView* Texture;
+		ID3D11BlendState* BlendState;
+		ID3D11Buffer* VertexBuffer;
+		UINT Stride;
+		ID3D11Buffer* IndexBuffer;
+		DXGI_FORMAT IndexFormat;
+		D3D11_PRIMITIVE_TOPOLOGY Topology;
+		UINT IndexCount;
+		XMFLOAT4X4 Constants;		// gi constant buffer  World * View * Projection
+		// iHX֦ instancing ɧΪ vertex shader PJtm, x}ѲĤGӳIwİϳv instance Ū
+		// S (nullptr) o draw @߳We
+		ID3D11VertexShader* InstancedVertexShader;
+		ID3D11InputLayout* InstancedInputLayout;
+	};
+
+	struct RenderQueueStats {
+		int Objects = 0;			// [J DrawPacket 
+		int Draws = 0;				// کIs DrawIndexed / DrawIndexedInstanced 
+		int Instanced = 0;			// H instancing eX
+		int StateChanges = 0;		// کIs Set 
+		int StateChangesSaved = 0;	// W@ draw @˦ӲL
+	};
+
+	// CV Map @ DYNAMIC constant buffer, offset  ConstantRing tm, H VSSetConstantBuffers1 qjw
+	class ConstantRingBuffer {
+
+	public:
+		// ݭn D3D11.1  context ӥBXʵ{䴩 constant buffer offset, _h^ false
+		bool Create(ID3D11Device* device, ID3D11DeviceContext* context) {
+			this->device = device;
+			D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+			ZeroMemory(&options, sizeof(options));
+			if (FAILED(context->QueryInterface(IID_PPV_ARGS(&context1)))) return false;
+			if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options)))) return false;
+			return options.ConstantBufferOffsetting == TRUE;
+		}
+
+		// eqɭsإ (ܤ֥[), H WRITE_DISCARD  buffer
+		uint8_t* Map(size_t required) {
+			if (required > Ring.Capacity() || !buffer) {
+				size_t capacity = max(ConstantRing::Align(required), Ring.Capacity() * 2);
+				D3D11_BUFFER_DESC desc;
+				ZeroMemory(&desc, sizeof(desc));
+				desc.ByteWidth = (UINT)capacity;
+				desc.Usage = D3D11_USAGE_DYNAMIC;
+				desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+				desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+				buffer.Reset();
+				HRESULT hr = device->CreateBuffer(&desc, nullptr, &buffer);
+				if (CheckFailed(hr, TEXT("Create ConstantRingBuffer"))) return nullptr;
+				Ring.Reset(capacity);
+			}
+
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = context1->Map(buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+			if (CheckFailed(hr, TEXT("Map ConstantRingBuffer"))) return nullptr;
+			Ring.Reset(Ring.Capacity());
+			return (uint8_t*)mapped.pData;
+		}
+
+		void Unmap() {
+			context1->Unmap(buffer.Get(), 0);
+		}
+
+		void Bind(UINT slot, size_t offset, size_t size) {
+			UINT first = ConstantRing::FirstConstant(offset);
+			UINT count = ConstantRing::ConstantCount(size);
+			context1->VSSetConstantBuffers1(slot, 1, buffer.GetAddressOf(), &first, &count);
+		}
+
+		ConstantRing Ring;
+
+	private:
+		ComPtr<ID3D11Device> device;
+		ComPtr<ID3D11DeviceContext1> context1;
+		ComPtr<ID3D11Buffer> buffer;
+	};
+
+	// CV Map @ DYNAMIC Iwİ,  instancing Ϊx}
+	class InstanceBuffer {
+
+	public:
+		static const UINT Stride = sizeof(XMFLOAT4X4);
+
+		void Create(ID3D11Device* device) {
+			this->device = device;
+		}
+
+		// eqɭsإ (ܤ֥[), H WRITE_DISCARD 
+		uint8_t* Map(ID3D11DeviceContext* context, size_t required) {
+			if (required > capacity || !buffer) {
+				size_t size = max(required, capacity * 2);
+				D3D11_BUFFER_DESC desc;
+				ZeroMemory(&desc, sizeof(desc));
+				desc.ByteWidth = (UINT)size;
+				desc.Usage = D3D11_USAGE_DYNAMIC;
+				desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+				desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+				buffer.Reset();
+				capacity = 0;
+				HRESULT hr = device->CreateBuffer(&desc, nullptr, &buffer);
+				if (CheckFailed(hr, TEXT("Create InstanceBuffer"))) return nullptr;
+				capacity = size;
+			}
+
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = context->Map(buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+			if (CheckFailed(hr, TEXT("Map InstanceBuffer"))) return nullptr;
+			return (uint8_t*)mapped.pData;
+		}
+
+		void Unmap(ID3D11DeviceContext* context) {
+			context->Unmap(buffer.Get(), 0);
+		}
+
+		ID3D11Buffer* Get() const {
+			return buffer.Get();
+		}
+
+	private:
+		ComPtr<ID3D11Device> device;
+		ComPtr<ID3D11Buffer> buffer;
+		size_t capacity = 0;
+	};
+
+	// @V DrawPacket, ̱Ƨ䰵 radix sort, eXɲLثe@˪A
+	class RenderQueue {
+
+	public:
+		struct Entry {
+			uint64_t Key;
+			uint32_t Index;
+		};
+
+		void Clear() {
+			entries.clear();
+			packets.clear();
+		}
+
+		void Add(uint64_t key, const DrawPacket& packet) {
+			entries.push_back({ key, (uint32_t)packets.size() });
+			packets.push_back(packet);
+		}
+
+		//  DirectXTK  RadixSorter ( SpriteBatch P@), ۦPɫO[J
+		void Sort() {
+			size_t count = entries.size();
+			keys.resize(count);
+			for (size_t i = 0; i < count; i++) keys[i] = entries[i].Key;
+			const uint32_t* order = sorter.Sort(keys.data(), count);
+			scratch.resize(count);
+			for (size_t i = 0; i < count; i++) scratch[i] = entries[order[i]];
+			entries.swap(scratch);
+		}
+
+		// ̱Ƨǫ᪺ǰeX, Aubܮɤ~]; Ĥ@ draw @ߥ]w, ]D context ثeA
+		//  ring ɾV constant @gA offset jw, _hC draw  UpdateSubresource(constantBuffer)
+		//  instances , Ƨǫ۾FӥButbx} draw X֦@ DrawIndexedInstanced
+		RenderQueueStats Submit(ID3D11DeviceContext* context, ID3D11Buffer* constantBuffer, ConstantRingBuffer* ring = nullptr, InstanceBuffer* instances = nullptr) {
+			size_t instanceCount = BuildBatches(instances != nullptr);
+
+			uint8_t* instanceData = instanceCount ? instances->Map(context, instanceCount * InstanceBuffer::Stride) : nullptr;
+			if (instanceData) {
+				size_t next = 0;
+				for (Batch& b : batches) {
+					if (b.Count < 2) continue;
+					b.Offset = next;
+					for (uint32_t i = 0; i < b.Count; i++) {
+						memcpy(instanceData + (next + i) * InstanceBuffer::Stride, &packets[entries[b.First + i].Index].Constants, sizeof(XMFLOAT4X4));
+					}
+					next += b.Count;
+				}
+				instances->Unmap(context);
+			} else if (instanceCount) {
+				BuildBatches(false);
+			}
+
+			uint8_t* mapped = ring ? ring->Map(batches.size() * ConstantRing::Align(sizeof(XMFLOAT4X4))) : nullptr;
+			if (mapped) {
+				for (Batch& b : batches) {
+					if (b.Count > 1) continue;
+					b.Offset = ring->Ring.Allocate(sizeof(XMFLOAT4X4));
+					memcpy(mapped + b.Offset, &packets[entries[b.First].Index].Constants, sizeof(XMFLOAT4X4));
+				}
+				// n Unmap ~e
+				ring->Unmap();
+			}
+
+			RenderQueueStats stats;
+			stats.Objects = (int)entries.size();
+			auto changed = [&stats](bool same) {
+				if (same) {
+					stats.StateChangesSaved++;
+					return false;
+				}
+				stats.StateChanges++;
+				return true;
+			};
+
+			// instance x}TwbĤGӼ, We draw ΪJtm|Ū
+			if (instanceData) {
+				ID3D11Buffer* buffer = instances->Get();
+				UINT stride = InstanceBuffer::Stride;
+				UINT offset = 0;
+				context->IASetVertexBuffers(1, 1, &buffer, &stride, &offset);
+				stats.StateChanges++;
+			}
+
+			DrawPacket current = {};
+			bool first = true;
+			for (const Batch& b : batches) {
+				const DrawPacket& p = packets[entries[b.First].Index];
+				bool instanced = b.Count > 1;
+				ID3D11InputLayout* inputLayout = instanced ? p.InstancedInputLayout : p.InputLayout;
+				ID3D11VertexShader* vertexShader = instanced ? p.InstancedVertexShader : p.VertexShader;
+
+				if (changed(!first && current.InputLayout == inputLayout)) {
+					context->IASetInputLayout(inputLayout);
+				}
+				if (changed(!first && current.VertexShader == vertexShader)) {
+					context->VSSetShader(vertexShader, nullptr, 0);
+				}
+				if (changed(!first && current.PixelShader == p.PixelShader)) {
+					context->PSSetShader(p.PixelShader, nullptr, 0);
+				}
+				if (changed(!first && current.Texture == p.Texture)) {
+					context->PSSetShaderResources(0, 1, &p.Texture);
+				}
+				if (changed(!first && current.BlendState == p.BlendState)) {
+					context->OMSetBlendState(p.BlendState, nullptr, 0xFFFFFFFF);
+				}
+				if (changed(!first && current.VertexBuffer == p.VertexBuffer && current.Stride == p.Stride)) {
+					UINT offset = 0;
+					context->IASetVertexBuffers(0, 1, &p.VertexBuffer, &p.Stride, &offset);
+				}
+				if (changed(!first && current.IndexBuffer == p.IndexBuffer && current.IndexFormat == p.IndexFormat)) {
+					context->IASetIndexBuffer(p.IndexBuffer, p.IndexFormat, 0);
+				}
+				if (changed(!first && current.Topology == p.Topology)) {
+					context->IASetPrimitiveTopology(p.Topology);
+				}
+				current = p;
+				current.InputLayout = inputLayout;
+				current.VertexShader = vertexShader;
+				first = false;
+
+				if (instanced) {
+					context->DrawIndexedInstanced(p.IndexCount, b.Count, 0, 0, (UINT)b.Offset);
+					stats.Instanced += b.Count;
+				} else {
+					if (mapped) {
+						ring->Bind(0, b.Offset, sizeof(XMFLOAT4X4));
+					} else {
+						context->UpdateSubresource(constantBuffer, 0, NULL, &p.Constants, 0, 0);
+					}
+					context->DrawIndexed(p.IndexCount, 0, 0);
+				}
+				stats.Draws++;
+			}
+			return stats;
+		}
+
+		int Count() const {
+			return (int)entries.size();
+		}
+
+		const vector<Entry>& Entries() const {
+			return entries;
+		}
+
+	private:
+		struct Batch {
+			uint32_t First;		// entries 
+			uint32_t Count;
+			size_t Offset;		// WeO constant ring  offset, instancing OĤ@ instance
+		};
+
+		// Fx}H~@˪ draw ~X
+		static bool CanInstance(const DrawPacket& a, const DrawPacket& b) {
+			return a.InstancedVertexShader != nullptr
+				&& a.InstancedVertexShader == b.InstancedVertexShader
+				&& a.InstancedInputLayout == b.InstancedInputLayout
+				&& a.InputLayout == b.InputLayout
+				&& a.VertexShader == b.VertexShader
+				&& a.PixelShader == b.PixelShader
+				&& a.Texture == b.Texture
+				&& a.BlendState == b.BlendState
+				&& a.VertexBuffer == b.VertexBuffer
+				&& a.Stride == b.Stride
+				&& a.IndexBuffer == b.IndexBuffer
+				&& a.IndexFormat == b.IndexFormat
+				&& a.Topology == b.Topology
+				&& a.IndexCount == b.IndexCount;
+		}
+
+		// ^Ƿ|H instancing e
+		size_t BuildBatches(bool instancing) {
+			batches.clear();
+			size_t instanced = 0;
+			for (uint32_t i = 0; i < (uint32_t)entries.size(); ) {
+				const DrawPacket& p = packets[entries[i].Index];
+				uint32_t count = 1;
+				if (instancing) {
+					while (i + count < entries.size() && CanInstance(p, packets[entries[i + count].Index])) count++;
+				}
+				batches.push_back({ i, count, 0 });
+				if (count > 1) instanced += count;
+				i += count;
+			}
+			return instanced;
+		}
+
+	private:
+		vector<Entry> entries;
+		vector<Entry> scratch;
+		vector<uint64_t> keys;
+		DirectX::RadixSorter sorter;
+		vector<DrawPacket> packets;
+		vector<Batch> batches;
+	};
+}
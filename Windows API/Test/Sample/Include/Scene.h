@@ -1,6 +1,9 @@
 #pragma once
 
 #include <fbxsdk.h>
+#include "TransformHierarchy.h"
+#include "BoundingVolumeHierarchy.h"
+#include "SceneCache.h"
 // http://www.arkaistudio.com/blog/1078/unity/%E4%B8%80%E8%B5%B7%E5%AD%B8-unity-shader-%E4%B8%80%EF%BC%9A%E6%96%B0%E6%89%8B%E5%85%A5%E9%96%80
 // http://help.autodesk.com/view/FBX/2018/ENU/?guid=FBX_Developer_Help_importing_and_exporting_a_scene_importing_a_scene_html
 
@@ -11,6 +14,7 @@ namespace MyGame {
 		ID3D11Buffer* VertexBuffer;
 		ID3D11Buffer* IndexBuffer;
 		int indexCount;
+		AxisAlignedBox Bounds;	// ҫŶ
 		~MyMesh() {
 			if (VertexBuffer) {
 				VertexBuffer->Release();
@@ -24,17 +28,16 @@ namespace MyGame {
 
 	class MyNode {
 	public:
-		MyMesh* Mesh;
+		shared_ptr<MyMesh> Mesh;	// ޥΦP@ FbxMesh `I@
 		String Name;
 		vector<MyNode*> Children;
-		Matrix GlobalTransfrom;
+		int Transform;		// b MyScene::Transforms ̪
 		~MyNode() {
 			if (Children.size()) {
 				for (size_t i = 0; i < Children.size(); i++) {
 					delete Children[i];
 				}
 			}
-			if (Mesh) delete Mesh;
 		}
 	};
 
@@ -53,8 +56,15 @@ namespace MyGame {
 	public:
 		MyNode* Root;
 		MyCamera* Camera;
+		TransformHierarchy Transforms;
+		vector<MyNode*> Drawables;	//  Mesh `I, eɭԤΦAʾ
+		BoundingVolumeHierarchy DrawableBounds;	// ޸ Drawables @
+		vector<int> Visible;		// W@ Cull G, Drawables 
+		unordered_map<FbxMesh*, shared_ptr<MyMesh>> Meshes;
 		FbxManager* fbxManager;
 		FbxScene* fbxScene;
+	private:
+		unordered_map<const MyMesh*, int> cacheMeshes;	// gJ֨, @Ϊҫus@
 	public:
 		MyScene(FbxManager* fbxManager, FbxScene* fbxScene) {
 			this->fbxManager = fbxManager;
@@ -63,70 +73,209 @@ namespace MyGame {
 			Camera = nullptr;
 		}
 
-		bool CreateBuffer(ID3D11Device* device) {
+		// cache O nullptr , Pɧ`IPzLҫOU
+		bool CreateBuffer(ID3D11Device* device, SceneCacheWriter* cache = nullptr) {
+			if (fbxScene == nullptr) return false;
 			FbxNode* root = fbxScene->GetRootNode();
 			if (fbxScene->GetRootNode() != nullptr && device != nullptr) {
 				Root = new MyNode();
 				Root->Name = TEXT("");
 				Root->Mesh = nullptr;
 
-				FbxAMatrix& transform = root->EvaluateGlobalTransform();
-
-				for (int i = 0; i < 4; i++) {
-					for (int j = 0; j < 4; j++) {
-						Root->GlobalTransfrom.m[i][j] = (float)transform.Get(i, j);
-					}
-				}
+				Transforms.Clear();
+				Drawables.clear();
+				Meshes.clear();
+				cacheMeshes.clear();
+				XMFLOAT4X4 global = ToFloat4x4(root->EvaluateGlobalTransform());
+				Root->Transform = Transforms.Add(-1, global);
+				if (cache) cache->AddNode(-1, "", &global.m[0][0]);
 
 				for (int i = 0; i < root->GetChildCount(); i++) {
 					FbxNode* child = root->GetChild(i);
-					if (CreateBuffer(device, child, Root) == false) return false;
+					if (CreateBuffer(device, child, Root, cache) == false) return false;
 				}
+				CollectDrawables(Root);
 				return true;
 			}
 			return false;
 		}
 
+		// q SceneCache , ݭn FBX SDK; IPުqOإ buffer
+		bool CreateFromCache(ID3D11Device* device, const SceneCache& cache) {
+			if (!cache.IsOpen() || device == nullptr || cache.VertexStride() != sizeof(SimpleVertex)) return false;
+
+			Transforms.Clear();
+			Drawables.clear();
+			Meshes.clear();
+
+			vector<shared_ptr<MyMesh>> meshes(cache.MeshCount());
+			for (uint32_t i = 0; i < cache.MeshCount(); i++) {
+				const SceneCacheMesh& m = cache.Mesh(i);
+				meshes[i] = make_shared<MyMesh>();
+				meshes[i]->Bounds.Min = XMFLOAT3(m.BoundsMin);
+				meshes[i]->Bounds.Max = XMFLOAT3(m.BoundsMax);
+				if (!CreateMeshBuffer(device, meshes[i].get(), (const SimpleVertex*)cache.Vertices(m), m.VertexCount, cache.Indices(m), m.IndexCount)) {
+					return false;
+				}
+			}
+
+			// `IOeǱƦC, `I@wwgئnF
+			vector<MyNode*> nodes(cache.NodeCount());
+			for (uint32_t i = 0; i < cache.NodeCount(); i++) {
+				const SceneCacheNode& c = cache.Node(i);
+				MyNode* n = new MyNode();
+				if (c.Parent < 0) {
+					Root = n;
+				} else {
+					nodes[c.Parent]->Children.push_back(n);
+				}
+				n->Name = ToName(cache.Name(c), (int)c.NameLength);
+				n->Transform = Transforms.Add(c.Parent, XMFLOAT4X4(c.Local));
+				if (c.Mesh >= 0) n->Mesh = meshes[c.Mesh];
+				nodes[i] = n;
+			}
+			CollectDrawables(Root);
+			return true;
+		}
+
+		// b Transforms s, ClearDirty eIs, u Refit ʹL
+		void UpdateBounds() {
+			if (DrawableBounds.Count() != (int)Drawables.size()) {
+				vector<AxisAlignedBox> boxes(Drawables.size());
+				for (size_t i = 0; i < Drawables.size(); i++) {
+					boxes[i] = WorldBounds(Drawables[i]);
+				}
+				DrawableBounds.Build(boxes);
+				return;
+			}
+			for (size_t i = 0; i < Drawables.size(); i++) {
+				if (Transforms.Changed(Drawables[i]->Transform)) {
+					DrawableBounds.Update((int)i, WorldBounds(Drawables[i]));
+				}
+			}
+			DrawableBounds.Refit();
+		}
+
+		void Cull(const XMFLOAT4X4& viewProjection) {
+			DrawableBounds.Cull(ViewFrustum::FromMatrix(viewProjection), Visible);
+		}
+
 		~MyScene() {
 			if (Root) delete Root;
 			if (Camera) delete Camera;
 		}
 
 	private:
-		bool CreateBuffer(ID3D11Device* device, FbxNode* node, MyNode* parentNode) {
+		AxisAlignedBox WorldBounds(const MyNode* node) const {
+			return AxisAlignedBox::Transform(node->Mesh->Bounds, Transforms.World(node->Transform));
+		}
+
+		static String ToName(const char* name, int length) {
+			String s = String((size_t)MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, name, length, nullptr, 0));
+			MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, name, length, (wchar_t*)s, (int)s.Length());
+			return s;
+		}
+
+		static bool CreateMeshBuffer(ID3D11Device* device, MyMesh* mesh, const SimpleVertex* vertices, UINT vertexCount, const uint32_t* indices, UINT indexCount) {
+			mesh->indexCount = (int)indexCount;
+
+			// إ߼ҫIwİ
+			HRESULT hr;
+			D3D11_BUFFER_DESC bd;
+			ZeroMemory(&bd, sizeof(bd));
+			bd.Usage = D3D11_USAGE_DEFAULT;
+			bd.ByteWidth = vertexCount * sizeof(SimpleVertex);
+			bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+			bd.CPUAccessFlags = 0;
+			D3D11_SUBRESOURCE_DATA srd;
+			ZeroMemory(&srd, sizeof(srd));
+			srd.pSysMem = vertices;
+			hr = device->CreateBuffer(&bd, &srd, &mesh->VertexBuffer);
+			if (!SUCCEEDED(hr)) {
+				return false;
+			}
+
+			// إ߯޽wİ
+			D3D11_BUFFER_DESC indexDesc;
+			ZeroMemory(&indexDesc, sizeof(indexDesc));
+			indexDesc.ByteWidth = indexCount * sizeof(uint32_t);
+			indexDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+			indexDesc.Usage = D3D11_USAGE_DEFAULT;
+			indexDesc.CPUAccessFlags = 0;
+			D3D11_SUBRESOURCE_DATA indexsrd;
+			ZeroMemory(&indexsrd, sizeof(indexsrd));
+			indexsrd.pSysMem = indices;
+			hr = device->CreateBuffer(&indexDesc, &indexsrd, &mesh->IndexBuffer);
+			if (!SUCCEEDED(hr)) {
+				return false;
+			}
+			return true;
+		}
+
+		// l`I`Iuel`I, `I~eۤv Mesh, HejɪWh@
+		void CollectDrawables(MyNode* node) {
+			if (node->Children.size()) {
+				for (size_t i = 0; i < node->Children.size(); i++) {
+					CollectDrawables(node->Children[i]);
+				}
+			} else if (node->Mesh) {
+				Drawables.push_back(node);
+			}
+		}
+
+		static XMFLOAT4X4 ToFloat4x4(const FbxAMatrix& transform) {
+			XMFLOAT4X4 m;
+			for (int i = 0; i < 4; i++) {
+				for (int j = 0; j < 4; j++) {
+					m.m[i][j] = (float)transform.Get(i, j);
+				}
+			}
+			return m;
+		}
+
+	private:
+		bool CreateBuffer(ID3D11Device* device, FbxNode* node, MyNode* parentNode, SceneCacheWriter* cache) {
 			if (node != nullptr && device != nullptr) {
 
 				MyNode* n = new MyNode();
 				
 				int count = node->GetChildCount();
 				const char* name = node->GetName();
-				n->Name = String(strlen(name));
-				MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, name, -1, (wchar_t*)n->Name, n->Name.Length());;
+				n->Name = ToName(name, (int)strlen(name));
 				parentNode->Children.push_back(n);
 
-				FbxAMatrix& transform = node->EvaluateGlobalTransform();
-				
-				for (int i = 0; i < 4; i++) {
-					for (int j = 0; j < 4; j++) {
-						n->GlobalTransfrom.m[i][j] = (float)transform.Get(i, j);
-					}
-				}
+				// s۹`Ix}, World  TransformHierarchy 
+				XMFLOAT4X4 global = ToFloat4x4(node->EvaluateGlobalTransform());
+				XMFLOAT4X4 parentGlobal = ToFloat4x4(node->GetParent()->EvaluateGlobalTransform());
+				XMFLOAT4X4 local;
+				XMStoreFloat4x4(&local, XMMatrixMultiply(XMLoadFloat4x4(&global), XMMatrixInverse(nullptr, XMLoadFloat4x4(&parentGlobal))));
+				n->Transform = Transforms.Add(parentNode->Transform, local);
+				if (cache) cache->AddNode(parentNode->Transform, name, &local.m[0][0]);
 				FbxNodeAttribute* NodeAttribute = node->GetNodeAttribute();
 				FbxNodeAttribute::EType AttributeType = NodeAttribute->GetAttributeType();
 				if (AttributeType == FbxNodeAttribute::eMesh) {
 
-					n->Mesh = new MyMesh();
 					FbxMesh* mesh = (FbxMesh*)node->GetNodeAttribute();
 
+					// P@ FbxMesh uؤ@ buffer, eɭ RenderQueue ~⥦̦X֦ instancing
+					auto shared = Meshes.find(mesh);
+					if (shared != Meshes.end()) {
+						n->Mesh = shared->second;
+						if (cache) cache->SetNodeMesh(n->Transform, cacheMeshes[n->Mesh.get()]);
+						return true;
+					}
+					n->Mesh = make_shared<MyMesh>();
+					Meshes[mesh] = n->Mesh;
+
 					FbxVector4* fbxVertices = mesh->GetControlPoints();
 					int controlPointsCount = mesh->GetControlPointsCount();
 					int cPolygonCount = mesh->GetPolygonCount();
 
 					vector<SimpleVertex> vertices;
-					vector<int> indices;
+					vector<uint32_t> indices;
 
 					for (int j = 0; j < controlPointsCount; j++) {
-						SimpleVertex v;
+						SimpleVertex v = {};
 						v.Position = XMFLOAT4(
 							(float)fbxVertices[j].mData[0],
 							(float)fbxVertices[j].mData[1],
@@ -165,39 +314,30 @@ namespace MyGame {
 						}
 					}
 
-					n->Mesh->indexCount = (int)indices.size();
-
-					// إ߼ҫIwİ
-					HRESULT hr;
-					D3D11_BUFFER_DESC bd;
-					ZeroMemory(&bd, sizeof(bd));
-					bd.Usage = D3D11_USAGE_DEFAULT;
-					bd.ByteWidth = vertices.size() * sizeof(SimpleVertex);
-					bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-					bd.CPUAccessFlags = 0;
-					D3D11_SUBRESOURCE_DATA srd;
-					ZeroMemory(&srd, sizeof(srd));
-					srd.pSysMem = vertices.data();
-					hr = device->CreateBuffer(&bd, &srd, &n->Mesh->VertexBuffer);
-					if (!SUCCEEDED(hr)) {
-						return false;
+					// X֭ƪIí, ̦֨sNOoG
+					MeshOptimizer::Optimize(vertices, indices);
+
+					if (vertices.size() > 0) {
+						XMFLOAT3 p(vertices[0].Position.x, vertices[0].Position.y, vertices[0].Position.z);
+						n->Mesh->Bounds.Min = n->Mesh->Bounds.Max = p;
+						for (const SimpleVertex& v : vertices) {
+							p = XMFLOAT3(v.Position.x, v.Position.y, v.Position.z);
+							n->Mesh->Bounds = AxisAlignedBox::Merge(n->Mesh->Bounds, AxisAlignedBox{ p, p });
+						}
+					} else {
+						n->Mesh->Bounds.Min = n->Mesh->Bounds.Max = XMFLOAT3(0, 0, 0);
 					}
 
-					// إ߯޽wİ
-					D3D11_BUFFER_DESC indexDesc;
-					ZeroMemory(&indexDesc, sizeof(indexDesc));
-					indexDesc.ByteWidth = indices.size() * sizeof(int);
-					indexDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-					indexDesc.Usage = D3D11_USAGE_DEFAULT;
-					indexDesc.CPUAccessFlags = 0;
-					D3D11_SUBRESOURCE_DATA indexsrd;
-					ZeroMemory(&indexsrd, sizeof(indexsrd));
-					indexsrd.pSysMem = indices.data();
-					hr = device->CreateBuffer(&indexDesc, &indexsrd, &n->Mesh->IndexBuffer);
-					if (!SUCCEEDED(hr)) {
+					if (!CreateMeshBuffer(device, n->Mesh.get(), vertices.data(), (UINT)vertices.size(), indices.data(), (UINT)indices.size())) {
 						return false;
 					}
 
+					if (cache) {
+						int index = cache->AddMesh(vertices.data(), (uint32_t)vertices.size(), indices.data(), (uint32_t)indices.size(), &n->Mesh->Bounds.Min.x, &n->Mesh->Bounds.Max.x);
+						cacheMeshes[n->Mesh.get()] = index;
+						cache->SetNodeMesh(n->Transform, index);
+					}
+
 				} else if (AttributeType == FbxNodeAttribute::eLight) {
 
 				} else if (AttributeType == FbxNodeAttribute::eCamera) {
@@ -219,7 +359,7 @@ namespace MyGame {
 				} else if (AttributeType == FbxNodeAttribute::eNull && count > 0) {
 					for (int i = 0; i < count; i++) {
 						FbxNode* child = node->GetChild(i);
-						if (CreateBuffer(device, child, n) == false) return false;
+						if (CreateBuffer(device, child, n, cache) == false) return false;
 					}
 				}
 				return true;
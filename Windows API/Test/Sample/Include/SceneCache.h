@@ -0,0 +1,473 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace MyGame {
+
+	// FBX פJGGi֨ (little-endian), ɮ׹iO餧᪽ϥ, ݭnAѪR:
+	//   SceneCacheHeader
+	//   SceneCacheNode[NodeCount]	̷ TransformHierarchy eǱƦC, Parent @wۤvp
+	//   SceneCacheMesh[MeshCount]
+	//   Wٰ, t 0
+	//   I, ް, U۹ Alignment
+	// SourceHash P SourceSize Oӷ .fbx, 藍WN@L, sפJмg
+	struct SceneCacheHeader {
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceHash;
+		uint64_t SourceSize;
+		uint32_t NodeCount;
+		uint32_t MeshCount;
+		uint32_t VertexStride;
+		uint32_t NamesOffset;		// HU Offset qɮ׶}Y_
+		uint32_t NamesSize;
+		uint32_t VerticesOffset;
+		uint32_t VertexCount;
+		uint32_t IndicesOffset;
+		uint32_t IndexCount;
+		uint32_t Reserved;
+	};
+
+	struct SceneCacheNode {
+		int32_t Parent;			// ڸ`IO -1
+		int32_t Mesh;			// SҫO -1
+		uint32_t NameOffset;	// qWٰ϶}Y_
+		uint32_t NameLength;
+		float Local[16];		// ۹`Ix}, ƦC XMFLOAT4X4 @
+	};
+
+	struct SceneCacheMesh {
+		uint32_t FirstVertex;	// Iϸ̪ĴXӳI, ެO۹o
+		uint32_t VertexCount;
+		uint32_t FirstIndex;
+		uint32_t IndexCount;
+		float BoundsMin[3];		// ҫŶ
+		float BoundsMax[3];
+	};
+
+	static_assert(sizeof(SceneCacheHeader) == 64, "SceneCacheHeader layout");
+	static_assert(sizeof(SceneCacheNode) == 80, "SceneCacheNode layout");
+	static_assert(sizeof(SceneCacheMesh) == 40, "SceneCacheMesh layout");
+
+	class SceneCacheFormat {
+	public:
+		static const uint32_t Magic = 0x434E4353;	// "SCNC"
+		static const uint32_t Version = 1;
+		static const uint32_t Alignment = 16;
+
+		// FNV-1a
+		static uint64_t Hash(const void* data, size_t size) {
+			const uint8_t* p = (const uint8_t*)data;
+			uint64_t h = 14695981039346656037ull;
+			for (size_t i = 0; i < size; i++) {
+				h ^= p[i];
+				h *= 1099511628211ull;
+			}
+			return h;
+		}
+
+		// ӷɪ, Ūɮצ FBX SDK ѪRֱoh
+		template<typename Char>
+		static bool HashFile(const Char* path, uint64_t& hash, uint64_t& size) {
+			DirectX::MappedFile file;
+			if (!file.Open(path)) return false;
+			hash = Hash(file.Data(), file.Size());
+			size = file.Size();
+			return true;
+		}
+	};
+
+	// gJ֨ezҫ, FBX פJ֨J]o@˪ buffer
+	class MeshOptimizer {
+	public:
+		// X֤eۦPI (v줸), ާVdUӪ@
+		template<typename Vertex>
+		static void Weld(vector<Vertex>& vertices, vector<uint32_t>& indices) {
+			uint32_t tableSize = 1;
+			while (tableSize < vertices.size() * 2) tableSize <<= 1;
+			uint32_t mask = tableSize - 1;
+			vector<uint32_t> table(tableSize, UINT32_MAX);
+			vector<uint32_t> remap(vertices.size());
+			vector<Vertex> unique;
+			unique.reserve(vertices.size());
+			for (size_t i = 0; i < vertices.size(); i++) {
+				uint32_t slot = (uint32_t)SceneCacheFormat::Hash(&vertices[i], sizeof(Vertex)) & mask;
+				for (;;) {
+					uint32_t u = table[slot];
+					if (u == UINT32_MAX) {
+						u = (uint32_t)unique.size();
+						unique.push_back(vertices[i]);
+						table[slot] = u;
+					} else if (memcmp(&unique[u], &vertices[i], sizeof(Vertex)) != 0) {
+						slot = (slot + 1) & mask;
+						continue;
+					}
+					remap[i] = u;
+					break;
+				}
+			}
+			for (uint32_t& index : indices) {
+				index = remap[index];
+			}
+			vertices.swap(unique);
+		}
+
+		// ƤTI֨Rv@I (Tom Forsyth  linear-speed vertex cache optimisation)
+		// uBz triangle list, ޼ƤO 3 ƴN
+		static void OptimizeVertexCache(vector<uint32_t>& indices, uint32_t vertexCount) {
+			const int CacheSize = 32;
+			size_t triangleCount = indices.size() / 3;
+			if (triangleCount == 0 || indices.size() % 3 != 0) return;
+
+			// CӳI٨SXT, adjacency[offsets[v], offsets[v] + remaining[v])
+			vector<uint32_t> offsets(vertexCount + 1, 0);
+			for (uint32_t v : indices) offsets[v + 1]++;
+			for (uint32_t v = 0; v < vertexCount; v++) offsets[v + 1] += offsets[v];
+			vector<uint32_t> remaining(vertexCount, 0);
+			vector<uint32_t> adjacency(indices.size());
+			for (size_t t = 0; t < triangleCount; t++) {
+				for (int k = 0; k < 3; k++) {
+					uint32_t v = indices[t * 3 + k];
+					adjacency[offsets[v] + remaining[v]++] = (uint32_t)t;
+				}
+			}
+
+			vector<int> cachePosition(vertexCount, -1);
+			auto score = [&](uint32_t v) -> float {
+				if (remaining[v] == 0) return -1.0f;
+				float s = 0.0f;
+				int p = cachePosition[v];
+				if (p >= 0) {
+					// ιLTӳI@w|bU@ӤTΤeQΨ, Tw
+					s = p < 3 ? 0.75f : powf(1.0f - (p - 3) / (float)(CacheSize - 3), 1.5f);
+				}
+				return s + 2.0f / sqrtf((float)remaining[v]);
+			};
+
+			vector<float> vertexScore(vertexCount);
+			for (uint32_t v = 0; v < vertexCount; v++) vertexScore[v] = score(v);
+			vector<float> triangleScore(triangleCount);
+			for (size_t t = 0; t < triangleCount; t++) {
+				triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+			}
+			vector<uint8_t> emitted(triangleCount, 0);
+
+			vector<uint32_t> result;
+			result.reserve(indices.size());
+			uint32_t cache[CacheSize + 3];
+			int cacheCount = 0;
+			size_t scan = 0;
+			int64_t best = -1;
+			while (result.size() < indices.size()) {
+				if (best < 0) {
+					// ̪֨IΧF, ӭ쥻ǨU@
+					while (emitted[scan]) scan++;
+					best = (int64_t)scan;
+				}
+				uint32_t t = (uint32_t)best;
+				emitted[t] = 1;
+
+				// oӤTΪI̫֨e, L
+				uint32_t next[CacheSize + 3];
+				int nextCount = 0;
+				for (int k = 0; k < 3; k++) {
+					uint32_t v = indices[t * 3 + k];
+					result.push_back(v);
+					uint32_t* list = &adjacency[offsets[v]];
+					for (uint32_t i = 0; i < remaining[v]; i++) {
+						if (list[i] == t) {
+							list[i] = list[--remaining[v]];
+							break;
+						}
+					}
+					bool present = false;
+					for (int i = 0; i < nextCount; i++) present |= next[i] == v;
+					if (!present) next[nextCount++] = v;
+				}
+				int fresh = nextCount;
+				for (int i = 0; i < cacheCount; i++) {
+					uint32_t v = cache[i];
+					bool present = false;
+					for (int j = 0; j < fresh; j++) present |= next[j] == v;
+					if (!present) next[nextCount++] = v;
+				}
+				for (int i = 0; i < nextCount; i++) {
+					cachePosition[next[i]] = i < CacheSize ? i : -1;
+				}
+				cacheCount = nextCount < CacheSize ? nextCount : CacheSize;
+				memcpy(cache, next, cacheCount * sizeof(uint32_t));
+
+				// u̪֨IQXhIƷ|
+				for (int i = 0; i < nextCount; i++) {
+					uint32_t v = next[i];
+					float s = score(v);
+					float delta = s - vertexScore[v];
+					vertexScore[v] = s;
+					const uint32_t* list = &adjacency[offsets[v]];
+					for (uint32_t j = 0; j < remaining[v]; j++) {
+						triangleScore[list[j]] += delta;
+					}
+				}
+				best = -1;
+				float bestScore = -1.0f;
+				for (int i = 0; i < cacheCount; i++) {
+					uint32_t v = cache[i];
+					const uint32_t* list = &adjacency[offsets[v]];
+					for (uint32_t j = 0; j < remaining[v]; j++) {
+						if (triangleScore[list[j]] > bestScore) {
+							bestScore = triangleScore[list[j]];
+							best = list[j];
+						}
+					}
+				}
+			}
+			indices.swap(result);
+		}
+
+		// I̷ӲĤ@QΨ쪺ǭ, SQΨ쪺Iᱼ
+		template<typename Vertex>
+		static void OptimizeVertexFetch(vector<Vertex>& vertices, vector<uint32_t>& indices) {
+			vector<uint32_t> remap(vertices.size(), UINT32_MAX);
+			vector<Vertex> ordered;
+			ordered.reserve(vertices.size());
+			for (uint32_t& index : indices) {
+				if (remap[index] == UINT32_MAX) {
+					remap[index] = (uint32_t)ordered.size();
+					ordered.push_back(vertices[index]);
+				}
+				index = remap[index];
+			}
+			vertices.swap(ordered);
+		}
+
+		template<typename Vertex>
+		static void Optimize(vector<Vertex>& vertices, vector<uint32_t>& indices) {
+			Weld(vertices, indices);
+			OptimizeVertexCache(indices, (uint32_t)vertices.size());
+			OptimizeVertexFetch(vertices, indices);
+		}
+	};
+
+	// Ū, ɮץu@, IPު浹 CreateBuffer
+	class SceneCache {
+
+	public:
+		template<typename Char>
+		bool Open(const Char* path) {
+			header = nullptr;
+			if (!file.Open(path)) return false;
+			if (!Validate()) {
+				file.Close();
+				return false;
+			}
+			return true;
+		}
+
+		void Close() {
+			header = nullptr;
+			file.Close();
+		}
+
+		bool IsOpen() const {
+			return header != nullptr;
+		}
+
+		// ֨OOѳoӨӷɲͪ
+		bool Matches(uint64_t sourceHash, uint64_t sourceSize) const {
+			return header && header->SourceHash == sourceHash && header->SourceSize == sourceSize;
+		}
+
+		uint32_t NodeCount() const {
+			return header ? header->NodeCount : 0;
+		}
+
+		uint32_t MeshCount() const {
+			return header ? header->MeshCount : 0;
+		}
+
+		uint32_t VertexStride() const {
+			return header ? header->VertexStride : 0;
+		}
+
+		const SceneCacheNode& Node(uint32_t index) const {
+			return nodes[index];
+		}
+
+		const SceneCacheMesh& Mesh(uint32_t index) const {
+			return meshes[index];
+		}
+
+		// H 0 , ׬O node.NameLength
+		const char* Name(const SceneCacheNode& node) const {
+			return (const char*)file.Data() + header->NamesOffset + node.NameOffset;
+		}
+
+		const void* Vertices(const SceneCacheMesh& mesh) const {
+			return file.Data() + header->VerticesOffset + (size_t)mesh.FirstVertex * header->VertexStride;
+		}
+
+		const uint32_t* Indices(const SceneCacheMesh& mesh) const {
+			return (const uint32_t*)(file.Data() + header->IndicesOffset) + mesh.FirstIndex;
+		}
+
+	private:
+		static bool InRange(uint64_t offset, uint64_t size, uint64_t limit) {
+			return offset <= limit && size <= limit - offset;
+		}
+
+		bool Validate() {
+			size_t size = file.Size();
+			if (size < sizeof(SceneCacheHeader)) return false;
+			const SceneCacheHeader* h = (const SceneCacheHeader*)file.Data();
+			if (h->Magic != SceneCacheFormat::Magic || h->Version != SceneCacheFormat::Version) return false;
+			if (h->NodeCount == 0 || h->VertexStride == 0) return false;
+			uint64_t tables = sizeof(SceneCacheHeader) + (uint64_t)h->NodeCount * sizeof(SceneCacheNode) + (uint64_t)h->MeshCount * sizeof(SceneCacheMesh);
+			if (tables > size) return false;
+			if (!InRange(h->NamesOffset, h->NamesSize, size)) return false;
+			if (!InRange(h->VerticesOffset, (uint64_t)h->VertexCount * h->VertexStride, size)) return false;
+			if (!InRange(h->IndicesOffset, (uint64_t)h->IndexCount * sizeof(uint32_t), size)) return false;
+			if (h->VerticesOffset % SceneCacheFormat::Alignment != 0 || h->IndicesOffset % SceneCacheFormat::Alignment != 0) return false;
+
+			const SceneCacheNode* n = (const SceneCacheNode*)(file.Data() + sizeof(SceneCacheHeader));
+			const SceneCacheMesh* m = (const SceneCacheMesh*)(n + h->NodeCount);
+			for (uint32_t i = 0; i < h->MeshCount; i++) {
+				if (!InRange(m[i].FirstVertex, m[i].VertexCount, h->VertexCount)) return false;
+				if (!InRange(m[i].FirstIndex, m[i].IndexCount, h->IndexCount)) return false;
+				const uint32_t* indices = (const uint32_t*)(file.Data() + h->IndicesOffset) + m[i].FirstIndex;
+				for (uint32_t j = 0; j < m[i].IndexCount; j++) {
+					if (indices[j] >= m[i].VertexCount) return false;
+				}
+			}
+			// uĤ@Ӹ`IO, L`I`Ibۤve
+			for (uint32_t i = 0; i < h->NodeCount; i++) {
+				if (i == 0 ? n[i].Parent != -1 : (n[i].Parent < 0 || (uint32_t)n[i].Parent >= i)) return false;
+				if (n[i].Mesh >= 0 && (uint32_t)n[i].Mesh >= h->MeshCount) return false;
+				if (!InRange(n[i].NameOffset, n[i].NameLength, h->NamesSize)) return false;
+			}
+			header = h;
+			nodes = n;
+			meshes = m;
+			return true;
+		}
+
+	private:
+		DirectX::MappedFile file;
+		const SceneCacheHeader* header = nullptr;
+		const SceneCacheNode* nodes = nullptr;
+		const SceneCacheMesh* meshes = nullptr;
+	};
+
+	// פJ FBX ɭԶKO, `I TransformHierarchy @˥Heǥ[J
+	class SceneCacheWriter {
+
+	public:
+		explicit SceneCacheWriter(uint32_t vertexStride) : vertexStride(vertexStride) {}
+
+		void SetSource(uint64_t hash, uint64_t size) {
+			sourceHash = hash;
+			sourceSize = size;
+		}
+
+		int AddNode(int parent, const char* name, const float local[16]) {
+			SceneCacheNode n;
+			n.Parent = parent;
+			n.Mesh = -1;
+			n.NameOffset = (uint32_t)names.size();
+			n.NameLength = (uint32_t)strlen(name);
+			memcpy(n.Local, local, sizeof(n.Local));
+			names.insert(names.end(), name, name + n.NameLength);
+			nodes.push_back(n);
+			return (int)nodes.size() - 1;
+		}
+
+		void SetNodeMesh(int node, int mesh) {
+			nodes[node].Mesh = mesh;
+		}
+
+		// vertices O vertexCount  vertexStride jpI, ӤwggL MeshOptimizer
+		int AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, const float boundsMin[3], const float boundsMax[3]) {
+			SceneCacheMesh m;
+			m.FirstVertex = (uint32_t)(vertexData.size() / vertexStride);
+			m.VertexCount = vertexCount;
+			m.FirstIndex = (uint32_t)indexData.size();
+			m.IndexCount = indexCount;
+			memcpy(m.BoundsMin, boundsMin, sizeof(m.BoundsMin));
+			memcpy(m.BoundsMax, boundsMax, sizeof(m.BoundsMax));
+			vertexData.insert(vertexData.end(), (const uint8_t*)vertices, (const uint8_t*)vertices + (size_t)vertexCount * vertexStride);
+			indexData.insert(indexData.end(), indices, indices + indexCount);
+			meshes.push_back(m);
+			return (int)meshes.size() - 1;
+		}
+
+		vector<uint8_t> Build() const {
+			SceneCacheHeader h;
+			memset(&h, 0, sizeof(h));
+			h.Magic = SceneCacheFormat::Magic;
+			h.Version = SceneCacheFormat::Version;
+			h.SourceHash = sourceHash;
+			h.SourceSize = sourceSize;
+			h.NodeCount = (uint32_t)nodes.size();
+			h.MeshCount = (uint32_t)meshes.size();
+			h.VertexStride = vertexStride;
+			h.NamesOffset = (uint32_t)(sizeof(SceneCacheHeader) + nodes.size() * sizeof(SceneCacheNode) + meshes.size() * sizeof(SceneCacheMesh));
+			h.NamesSize = (uint32_t)names.size();
+			h.VerticesOffset = Align(h.NamesOffset + h.NamesSize);
+			h.VertexCount = (uint32_t)(vertexData.size() / vertexStride);
+			h.IndicesOffset = Align(h.VerticesOffset + (uint32_t)vertexData.size());
+			h.IndexCount = (uint32_t)indexData.size();
+
+			vector<uint8_t> out(h.IndicesOffset + indexData.size() * sizeof(uint32_t), 0);
+			uint8_t* p = out.data();
+			memcpy(p, &h, sizeof(h));
+			p += sizeof(h);
+			if (nodes.size()) memcpy(p, nodes.data(), nodes.size() * sizeof(SceneCacheNode));
+			p += nodes.size() * sizeof(SceneCacheNode);
+			if (meshes.size()) memcpy(p, meshes.data(), meshes.size() * sizeof(SceneCacheMesh));
+			if (names.size()) memcpy(out.data() + h.NamesOffset, names.data(), names.size());
+			if (vertexData.size()) memcpy(out.data() + h.VerticesOffset, vertexData.data(), vertexData.size());
+			if (indexData.size()) memcpy(out.data() + h.IndicesOffset, indexData.data(), indexData.size() * sizeof(uint32_t));
+			return out;
+		}
+
+		template<typename Char>
+		bool Save(const Char* path) const {
+			vector<uint8_t> data = Build();
+			FILE* stream = OpenForWrite(path);
+			if (stream == nullptr) return false;
+			bool ok = fwrite(data.data(), 1, data.size(), stream) == data.size();
+			ok = fclose(stream) == 0 && ok;
+			return ok;
+		}
+
+	private:
+		static uint32_t Align(uint32_t offset) {
+			return (offset + SceneCacheFormat::Alignment - 1) & ~(SceneCacheFormat::Alignment - 1);
+		}
+
+		static FILE* OpenForWrite(const char* path) {
+			return fopen(path, "wb");
+		}
+#ifdef _WIN32
+		static FILE* OpenForWrite(const wchar_t* path) {
+			return _wfopen(path, L"wb");
+		}
+#endif
+
+	private:
+		uint32_t vertexStride;
+		uint64_t sourceHash = 0;
+		uint64_t sourceSize = 0;
+		vector<SceneCacheNode> nodes;
+		vector<SceneCacheMesh> meshes;
+		vector<char> names;
+		vector<uint8_t> vertexData;
+		vector<uint32_t> indexData;
+	};
+}
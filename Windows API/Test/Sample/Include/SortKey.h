@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace MyGame {
+
+	// 64 줸Ƨ, ѰC:
+	//   z: pass(2) | 0 | shader(12) | material(24) | depth(24)    P@ shader/material Eb@_, Ѫ컷
+	//   bz: pass(2) | 1 | depth(24) ϦV | shader(12) | material(24)  @wnѻ, AuƲĤG
+	class SortKey {
+	public:
+		static const int DepthBits = 24;
+
+		static uint64_t Opaque(uint32_t pass, uint32_t shader, uint32_t material, uint32_t depth) {
+			return ((uint64_t)(pass & 0x3) << 62)
+				| ((uint64_t)(shader & 0xFFF) << 48)
+				| ((uint64_t)(material & 0xFFFFFF) << 24)
+				| (depth & 0xFFFFFF);
+		}
+
+		static uint64_t Transparent(uint32_t pass, uint32_t shader, uint32_t material, uint32_t depth) {
+			return ((uint64_t)(pass & 0x3) << 62)
+				| ((uint64_t)1 << 61)
+				| ((uint64_t)(~depth & 0xFFFFFF) << 36)
+				| ((uint64_t)(shader & 0xFFF) << 24)
+				| (material & 0xFFFFFF);
+		}
+
+		// ΪIb clip space  z / w (0 ~ 1, 컷ջW) `
+		static uint32_t Depth(const XMFLOAT4X4& worldViewProjection) {
+			float z = worldViewProjection.m[3][2];
+			float w = worldViewProjection.m[3][3];
+			float d = w > 0 ? z / w : 0.0f;
+			if (!(d > 0)) d = 0;
+			if (d > 1) d = 1;
+			return (uint32_t)(d * (float)((1 << DepthBits) - 1));
+		}
+	};
+
+	// дq 0 }lp, iƧ䪺 shader / material 
+	class SortKeyIds {
+	public:
+		uint32_t Get(const void* resource) {
+			auto it = ids.find(resource);
+			if (it != ids.end()) return it->second;
+			uint32_t id = (uint32_t)ids.size();
+			ids.emplace(resource, id);
+			return id;
+		}
+
+		void Clear() {
+			ids.clear();
+		}
+
+	private:
+		unordered_map<const void*, uint32_t> ids;
+	};
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace MyGame {
+
+	// uh, H structure-of-arrays s
+	// `I̷Ӳ`ueǱƦC: `Iޤ@wl`Ip, @ʤls򪺤@q [i, SubtreeEnd(i))
+	// ҥHunѫeᱽ@N⧹Ҧ World, ݭnjΰl
+	class TransformHierarchy {
+
+	public:
+		// ̷ӫeǥ[J, ]NO parent Oثe̫@Ӹ`IΥ; ڸ`I parent O -1
+		int Add(int parent, const XMFLOAT4X4& local) {
+			int index = (int)parents.size();
+			parents.push_back(parent);
+			subtreeEnd.push_back(index + 1);
+			locals.push_back(local);
+			worlds.push_back(local);
+			worldViewProjections.push_back(local);
+			dirty.push_back(1);
+			changed.push_back(1);
+			for (int p = parent; p >= 0; p = parents[p]) {
+				subtreeEnd[p] = index + 1;
+			}
+			anyDirty = true;
+			return index;
+		}
+
+		void Clear() {
+			parents.clear();
+			subtreeEnd.clear();
+			locals.clear();
+			worlds.clear();
+			worldViewProjections.clear();
+			dirty.clear();
+			changed.clear();
+			anyDirty = false;
+		}
+
+		// U@ Update ɭoӸ`IPʤl
+		void SetLocal(int index, const XMFLOAT4X4& local) {
+			locals[index] = local;
+			dirty[index] = 1;
+			anyDirty = true;
+		}
+
+		// `I̦h parts q, Cqѧ㪺lզ (ڸ`IH~Ĥ@hl𬰳)
+		//  UpdateRange(0, 1, ...) ڸ`I, UqiH浹P
+		void Split(int parts, vector<pair<int, int>>& ranges) const {
+			ranges.clear();
+			int count = Count();
+			if (count <= 1 || parts <= 1) {
+				if (count > 1) ranges.push_back({ 1, count });
+				return;
+			}
+			int target = (count - 1 + parts - 1) / parts;
+			int begin = 1;
+			int i = 1;
+			while (i < count) {
+				int next = subtreeEnd[i];
+				if (next - begin >= target) {
+					ranges.push_back({ begin, next });
+					begin = next;
+				}
+				i = next;
+			}
+			if (begin < count) ranges.push_back({ begin, count });
+		}
+
+		// s
+		void Update(FXMMATRIX viewProjection) {
+			UpdateRange(0, Count(), viewProjection);
+			ClearDirty();
+		}
+
+		// @uʱyPɺ World P World * View * Projection
+		// Ϭq~`IwgsL
+		void UpdateRange(int begin, int end, FXMMATRIX viewProjection) {
+			if (!anyDirty) {
+				for (int i = begin; i < end; i++) {
+					XMStoreFloat4x4(&worldViewProjections[i], XMMatrixMultiply(XMLoadFloat4x4(&worlds[i]), viewProjection));
+				}
+				return;
+			}
+			for (int i = begin; i < end; i++) {
+				int parent = parents[i];
+				changed[i] = dirty[i] | (parent >= 0 ? changed[parent] : 0);
+				XMMATRIX world;
+				if (changed[i]) {
+					// SܰʪRA`IuΤW@V World
+					world = XMLoadFloat4x4(&locals[i]);
+					if (parent >= 0) world = XMMatrixMultiply(world, XMLoadFloat4x4(&worlds[parent]));
+					XMStoreFloat4x4(&worlds[i], world);
+				} else {
+					world = XMLoadFloat4x4(&worlds[i]);
+				}
+				XMStoreFloat4x4(&worldViewProjections[i], XMMatrixMultiply(world, viewProjection));
+			}
+		}
+
+		// ҦϬqsIs
+		void ClearDirty() {
+			if (!anyDirty) return;
+			memset(dirty.data(), 0, dirty.size());
+			memset(changed.data(), 0, changed.size());
+			anyDirty = false;
+		}
+
+		int Count() const {
+			return (int)parents.size();
+		}
+
+		// o@sS World (ۤvίQ SetLocal L), b ClearDirty e
+		bool Changed(int index) const {
+			return changed[index] != 0;
+		}
+
+		int Parent(int index) const {
+			return parents[index];
+		}
+
+		int SubtreeEnd(int index) const {
+			return subtreeEnd[index];
+		}
+
+		const XMFLOAT4X4& Local(int index) const {
+			return locals[index];
+		}
+
+		const XMFLOAT4X4& World(int index) const {
+			return worlds[index];
+		}
+
+		const XMFLOAT4X4& WorldViewProjection(int index) const {
+			return worldViewProjections[index];
+		}
+
+	private:
+		vector<int> parents;
+		vector<int> subtreeEnd;
+		vector<XMFLOAT4X4> locals;
+		vector<XMFLOAT4X4> worlds;
+		vector<XMFLOAT4X4> worldViewProjections;
+		vector<uint8_t> dirty;
+		vector<uint8_t> changed;
+		bool anyDirty = false;
+	};
+}
@@ -0,0 +1,28 @@
+struct VertexShaderInput
+{
+    float4 position : POSITION;
+    float4 color : COLOR;
+    float2 tex : TEXCOORD;
+    // World * View * Projection of this instance, one row per element
+    float4 transform0 : TRANSFORM0;
+    float4 transform1 : TRANSFORM1;
+    float4 transform2 : TRANSFORM2;
+    float4 transform3 : TRANSFORM3;
+};
+
+struct PixelShaderInput
+{
+    float4 position : SV_POSITION;
+    float4 color : COLOR;
+    float2 tex : TEXCOORD0;
+};
+
+PixelShaderInput main(VertexShaderInput input)
+{
+    PixelShaderInput output = (PixelShaderInput) 0;
+    float4x4 transform = float4x4(input.transform0, input.transform1, input.transform2, input.transform3);
+    output.position = mul(input.position, transform);
+    output.color = input.color;
+    output.tex = input.tex;
+    return output;
+}
\ No newline at end of file
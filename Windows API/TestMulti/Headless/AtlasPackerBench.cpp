@@ -0,0 +1,201 @@
+// SpriteAtlas 的 AtlasLayout (skyline): 填滿率與每次插入的時間, 跟逐列擺放的 shelf packer 比較
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Src AtlasPackerBench.cpp -o atlaspackerbench
+//   ./atlaspackerbench [size]
+//
+// 1. 依序插入直到放不下, 記錄數量與填滿率
+// 2. Defragment (由高到低重新擺放) 之後能再放多少
+// 3. 隨機移除與插入 (跟 SpriteAtlas::Add 一樣放不下時先 Defragment) 的平均時間
+// 任何時候 entry 重疊或超出邊界就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "AtlasPacker.h"
+
+using namespace DirectX;
+
+static const int Padding = 1;
+
+struct Size {
+	int Width, Height;
+};
+
+// 逐列擺放: 放不下這一列就開新的一列, 列高是這一列最高的 entry
+class ShelfPacker {
+	int width, height;
+	int x = 0, y = 0, rowHeight = 0;
+	int64_t used = 0;
+
+public:
+	ShelfPacker(int width, int height) : width(width), height(height) {}
+
+	bool Insert(int w, int h) {
+		if (x + w > width) {
+			y += rowHeight;
+			x = 0;
+			rowHeight = 0;
+		}
+		if (w > width || y + h > height) return false;
+		x += w;
+		rowHeight = max(rowHeight, h);
+		used += (int64_t)w * h;
+		return true;
+	}
+
+	float Occupancy() const {
+		return (float)((double)used / ((double)width * height));
+	}
+};
+
+// 每個 live entry (含 padding) 都在範圍內且互不重疊
+static bool Validate(const AtlasLayout& layout) {
+	vector<uint8_t> covered((size_t)layout.Width() * layout.Height());
+	for (size_t id = 0; id < layout.Size(); id++) {
+		const AtlasLayout::Entry& e = layout[(int)id];
+		if (!e.live) continue;
+		int left = e.x - Padding, top = e.y - Padding, right = e.x + e.width + Padding, bottom = e.y + e.height + Padding;
+		if (left < 0 || top < 0 || right > layout.Width() || bottom > layout.Height()) return false;
+		for (int y = top; y < bottom; y++) {
+			for (int x = left; x < right; x++) {
+				uint8_t& c = covered[(size_t)y * layout.Width() + x];
+				if (c) return false;
+				c = 1;
+			}
+		}
+	}
+	return true;
+}
+
+struct Workload {
+	const char* Name;
+	Size (*Next)(mt19937&);
+};
+
+// UI 圖示: 大多 16 ~ 64 的方形
+static Size NextIcon(mt19937& random) {
+	int s = 16 + (int)(random() % 49);
+	return { s, s + (int)(random() % 9) - 4 };
+}
+
+// 字形: 窄而高度接近
+static Size NextGlyph(mt19937& random) {
+	return { 4 + (int)(random() % 29), 12 + (int)(random() % 29) };
+}
+
+// 混合: 多數小圖, 偶爾有 128 ~ 256 的面板
+static Size NextMixed(mt19937& random) {
+	if (random() % 32 == 0) return { 128 + (int)(random() % 129), 128 + (int)(random() % 129) };
+	return { 8 + (int)(random() % 57), 8 + (int)(random() % 57) };
+}
+
+int main(int argc, char* argv[]) {
+	int size = argc > 1 ? atoi(argv[1]) : 2048;
+	if (size < 256) size = 256;
+
+	Workload workloads[] = { { "icons", NextIcon }, { "glyphs", NextGlyph }, { "mixed", NextMixed } };
+
+	printf("%dx%d atlas, %d texel padding\n", size, size, Padding);
+	printf("%-8s %8s %8s %10s %8s %10s %8s\n", "", "shelf", "skyline", "ns/insert", "entries", "defrag", "+entries");
+	for (const Workload& workload : workloads) {
+		// 同一串大小給兩種 packer
+		mt19937 random(12345);
+		vector<Size> sizes;
+		for (int i = 0; i < 1000000; i++) sizes.push_back(workload.Next(random));
+
+		ShelfPacker shelf(size, size);
+		for (const Size& s : sizes) {
+			if (!shelf.Insert(s.Width + Padding * 2, s.Height + Padding * 2)) break;
+		}
+
+		AtlasLayout layout(size, size, Padding);
+		size_t inserted = 0;
+		auto begin = chrono::steady_clock::now();
+		for (const Size& s : sizes) {
+			if (layout.Insert(s.Width, s.Height) < 0) break;
+			inserted++;
+		}
+		auto end = chrono::steady_clock::now();
+		double nsPerInsert = chrono::duration<double, nano>(end - begin).count() / (double)max<size_t>(inserted, 1);
+		float skyline = layout.Occupancy();
+		if (!Validate(layout)) {
+			fprintf(stderr, "%s: entries overlap after inserting\n", workload.Name);
+			ok = false;
+		}
+
+		// 重新由高到低擺放後, 繼續插入同一串剩下的大小
+		vector<AtlasLayout::Move> moves;
+		size_t more = 0;
+		if (layout.Defragment(&moves)) {
+			for (size_t i = inserted; i < sizes.size(); i++) {
+				if (layout.Insert(sizes[i].Width, sizes[i].Height) < 0) break;
+				more++;
+			}
+		}
+		if (!Validate(layout)) {
+			fprintf(stderr, "%s: entries overlap after defragmenting\n", workload.Name);
+			ok = false;
+		}
+
+		printf("%-8s %7.1f%% %7.1f%% %10.0f %8zu %9.1f%% %8zu\n", workload.Name, shelf.Occupancy() * 100, skyline * 100,
+			nsPerInsert, inserted, layout.Occupancy() * 100, more);
+	}
+
+	// 隨機替換: 保持 1000 個 entry, 每步移除一個再插入一個新的
+	{
+		mt19937 random(6789);
+		AtlasLayout layout(size, size, Padding);
+		vector<int> live;
+		for (int i = 0; i < 1000; i++) {
+			Size s = NextMixed(random);
+			int id = layout.Insert(s.Width, s.Height);
+			if (id >= 0) live.push_back(id);
+		}
+
+		const int steps = 200000;
+		int defragments = 0, failures = 0;
+		double defragmentTime = 0;
+		float lowest = 1, highest = 0;
+		auto begin = chrono::steady_clock::now();
+		for (int step = 0; step < steps; step++) {
+			size_t victim = random() % live.size();
+			layout.Remove(live[victim]);
+			live[victim] = live.back();
+			live.pop_back();
+
+			Size s = NextMixed(random);
+			int id = layout.Insert(s.Width, s.Height);
+			if (id < 0 && layout.ReclaimableArea() > 0) {
+				auto d0 = chrono::steady_clock::now();
+				if (layout.Defragment(nullptr)) defragments++;
+				defragmentTime += chrono::duration<double, micro>(chrono::steady_clock::now() - d0).count();
+				id = layout.Insert(s.Width, s.Height);
+			}
+			if (id >= 0) live.push_back(id);
+			else failures++;
+
+			float occupancy = layout.Occupancy();
+			lowest = min(lowest, occupancy);
+			highest = max(highest, occupancy);
+		}
+		auto end = chrono::steady_clock::now();
+		if (!Validate(layout)) {
+			fprintf(stderr, "churn: entries overlap\n");
+			ok = false;
+		}
+
+		printf("churn    %d steps  %.0f ns/step  %d defragments (%.0f us each)  %d failed  occupancy %.1f%% - %.1f%%\n",
+			steps, chrono::duration<double, nano>(end - begin).count() / steps, defragments,
+			defragments ? defragmentTime / defragments : 0.0, failures, lowest * 100, highest * 100);
+	}
+
+	return ExitCode();
+}
@@ -0,0 +1,18 @@
+// Headless 測試共用的檢查: Fail 印出哪一項不對並記下失敗, main 最後 return ExitCode()
+// 每個測試程式只有一個 .cpp, 所以直接放在標頭裡
+
+#pragma once
+
+#include <cstdio>
+
+static bool ok = true;
+
+inline void Fail(const char* message) {
+	fprintf(stderr, "%s\n", message);
+	ok = false;
+}
+
+// 任何一項失敗就回傳 1, ctest 以此判斷測試是否通過
+inline int ExitCode() {
+	return ok ? 0 : 1;
+}
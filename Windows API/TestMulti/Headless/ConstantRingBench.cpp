@@ -0,0 +1,149 @@
+// ConstantRing 的配置邏輯, 不需要裝置: 對齊, 空間不夠時回傳 Invalid, 多條執行緒同時配置不重疊, 以及每次 Allocate 的成本
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include ConstantRingBench.cpp -o constantringbench
+//   ./constantringbench [allocations] [threads]
+//
+// 另外用 NullRenderDevice 檢查 FramePipeline 依賴的 deferred context Map:
+// 寫進去的內容要等指令清單在 immediate context 執行時才出現在 buffer 裡; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "ConstantRing.h"
+#include "NullRenderDevice.h"
+
+using namespace MyGame;
+
+static void TestAlignment() {
+	if (ConstantRing::Align(0) != 0 || ConstantRing::Align(1) != 256 || ConstantRing::Align(256) != 256 || ConstantRing::Align(257) != 512) Fail("align: sizes are not rounded up to 256 bytes");
+	if (ConstantRing::FirstConstant(512) != 32) Fail("align: FirstConstant is not in 16-byte units");
+	if (ConstantRing::ConstantCount(64) != 16 || ConstantRing::ConstantCount(300) != 32) Fail("align: ConstantCount does not cover whole 256-byte blocks");
+}
+
+static void TestSingleThread() {
+	ConstantRing ring;
+	if (ring.Allocate(16) != ConstantRing::Invalid) Fail("single: an empty ring handed out memory");
+
+	ring.Reset(1024);
+	size_t expected[] = { 0, 256, 512, 768 };
+	for (size_t e : expected) {
+		if (ring.Allocate(64) != e) Fail("single: offsets are not linear and aligned");
+	}
+	if (ring.Allocate(1) != ConstantRing::Invalid) Fail("single: a full ring handed out memory");
+	if (ring.Requested() != 1280) Fail("single: Requested does not include the allocation that did not fit");
+
+	// 一次要求超過容量要失敗, Reset 之後從頭開始
+	ring.Reset(1024);
+	if (ring.Allocate(2000) != ConstantRing::Invalid) Fail("single: an oversized allocation succeeded");
+	ring.Reset(1024);
+	if (ring.Allocate(1024) != 0 || ring.Capacity() != 1024) Fail("single: Reset did not rewind the ring");
+}
+
+// 每條執行緒配置 count 次; 成功的數量要剛好是容量裝得下的數量, 而且排起來是連續不重疊的
+static void TestThreads(int threads, int count, size_t capacity) {
+	ConstantRing ring;
+	ring.Reset(capacity);
+	vector<vector<size_t>> offsets(threads);
+	vector<thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&, t] {
+			offsets[t].reserve(count);
+			for (int i = 0; i < count; i++) offsets[t].push_back(ring.Allocate(sizeof(float) * 16));
+		});
+	}
+	for (auto& w : workers) w.join();
+
+	vector<size_t> all;
+	for (auto& o : offsets) {
+		for (size_t offset : o) {
+			if (offset != ConstantRing::Invalid) all.push_back(offset);
+		}
+	}
+	sort(all.begin(), all.end());
+	size_t fit = min(capacity / ConstantRing::Alignment, (size_t)threads * count);
+	if (all.size() != fit) Fail("threads: the number of successful allocations is wrong");
+	for (size_t i = 0; i < all.size(); i++) {
+		if (all[i] != i * ConstantRing::Alignment) {
+			Fail("threads: allocations overlap or leave gaps");
+			break;
+		}
+	}
+}
+
+// 防止編譯器把迴圈整個拿掉
+static volatile size_t sink;
+
+static double TimeAllocate(int threads, int count) {
+	ConstantRing ring;
+	ring.Reset(ConstantRing::Alignment * (size_t)threads * count);
+	vector<thread> workers;
+	auto begin = chrono::steady_clock::now();
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&] {
+			size_t sum = 0;
+			for (int i = 0; i < count; i++) sum += ring.Allocate(sizeof(float) * 16);
+			sink = sum;
+		});
+	}
+	for (auto& w : workers) w.join();
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - begin).count() / ((double)threads * count);
+}
+
+// FramePipeline 在各自的 deferred context 上 Map 自己的 buffer, 內容跟著指令清單送出
+static void TestDeferredMap() {
+	NullRenderDevice device;
+	const size_t size = ConstantRing::Alignment * 4;
+	unique_ptr<RenderBuffer> buffer = device.CreateBuffer(BufferType::DynamicConstant, size, nullptr);
+	const vector<uint8_t>& data = static_cast<NullBuffer*>(buffer.get())->Data;
+	unique_ptr<RenderContext> first = device.CreateDeferredContext();
+	unique_ptr<RenderContext> second = device.CreateDeferredContext();
+
+	uint8_t* a = (uint8_t*)first->Map(buffer.get());
+	uint8_t* b = (uint8_t*)second->Map(buffer.get());
+	if (a == nullptr || b == nullptr) {
+		Fail("deferred: Map on a deferred context failed");
+		return;
+	}
+	if (a == data.data() || a == b) Fail("deferred: Map did not return fresh memory");
+	memset(a, 0x11, size);
+	memset(b, 0x22, size);
+	first->Unmap(buffer.get());
+	second->Unmap(buffer.get());
+	unique_ptr<RenderCommandList> firstList = first->FinishCommandList();
+	unique_ptr<RenderCommandList> secondList = second->FinishCommandList();
+	if (data[0] != 0) Fail("deferred: the buffer changed before the command list ran");
+
+	device.Immediate()->ExecuteCommandList(firstList.get());
+	if (data[0] != 0x11 || data[size - 1] != 0x11) Fail("deferred: the first command list did not upload its contents");
+	device.Immediate()->ExecuteCommandList(secondList.get());
+	if (data[0] != 0x22 || data[size - 1] != 0x22) Fail("deferred: the second command list did not replace the contents");
+	if (device.Stats.BufferUpdates != 2 || device.Stats.BytesUploaded != 2 * size) Fail("deferred: uploads were not counted");
+}
+
+int main(int argc, char* argv[]) {
+	int allocations = argc > 1 ? atoi(argv[1]) : 10000000;
+	int cores = (int)max(1u, thread::hardware_concurrency());
+	int threads = argc > 2 ? atoi(argv[2]) : max(cores, 4);
+	if (allocations <= 0) allocations = 1;
+	if (threads <= 0) threads = 1;
+
+	TestAlignment();
+	TestSingleThread();
+	TestThreads(threads, 10000, ConstantRing::Alignment * threads * 10000);
+	// 只放得下一半
+	TestThreads(threads, 10000, ConstantRing::Alignment * threads * 5000);
+	TestDeferredMap();
+
+	printf("%-24s %8.2f ns\n", "one thread", TimeAllocate(1, allocations));
+	printf("%-24s %8.2f ns (%d threads, %d cores)\n", "contended", TimeAllocate(threads, allocations / threads), threads, cores);
+
+	return ExitCode();
+}
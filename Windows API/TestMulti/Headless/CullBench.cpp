@@ -0,0 +1,163 @@
+// BoundingVolumeHierarchy 的視錐剔除: 10k 到 1M 個物體, 每一種數量輸出看得到的 / 全部的數量與 Cull 的時間
+//
+//   g++ -std=c++14 -O2 -I../../Test/Sample/Include CullBench.cpp -o cullbench
+//   ./cullbench [max objects] [rounds]
+//
+// 看得到的物體要跟逐一測試每個物體 (brute force) 得到的集合相同, 移動 1% 的物體並 Refit 之後也要相同
+// 樹的深度要在中位數切割的上限之內, Cull 的堆疊依照這個深度配置; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+
+// Linux 上沒有 DirectXMath, 只需要這幾個儲存用的型別
+struct XMFLOAT3 {
+	float x, y, z;
+	XMFLOAT3() {}
+	XMFLOAT3(float x, float y, float z) : x(x), y(y), z(z) {}
+};
+
+struct XMFLOAT4 {
+	float x, y, z, w;
+};
+
+struct XMFLOAT4X4 {
+	float m[4][4];
+};
+
+#include "BoundingVolumeHierarchy.h"
+
+using namespace MyGame;
+
+// 跟 XMMatrixPerspectiveFovLH 一樣, 攝影機在原點看 +z, 所以 View 是單位矩陣
+static XMFLOAT4X4 Perspective(float fovY, float aspect, float nearPlane, float farPlane) {
+	XMFLOAT4X4 m = {};
+	float yScale = 1.0f / tanf(fovY * 0.5f);
+	float range = farPlane / (farPlane - nearPlane);
+	m.m[0][0] = yScale / aspect;
+	m.m[1][1] = yScale;
+	m.m[2][2] = range;
+	m.m[2][3] = 1.0f;
+	m.m[3][2] = -range * nearPlane;
+	return m;
+}
+
+// 每個平面都至少有一個角落在內側才算看得到, 跟 Cull 對單一物體的判斷相同
+static bool Visible(const ViewFrustum& frustum, const AxisAlignedBox& box) {
+	for (int i = 0; i < 6; i++) {
+		const XMFLOAT4& p = frustum.Planes[i];
+		float outside = p.w
+			+ p.x * (p.x > 0 ? box.Max.x : box.Min.x)
+			+ p.y * (p.y > 0 ? box.Max.y : box.Min.y)
+			+ p.z * (p.z > 0 ? box.Max.z : box.Min.z);
+		if (outside < 0) return false;
+	}
+	return true;
+}
+
+static void BruteForce(const ViewFrustum& frustum, const vector<AxisAlignedBox>& boxes, vector<int>& visible) {
+	visible.clear();
+	for (int i = 0; i < (int)boxes.size(); i++) {
+		if (Visible(frustum, boxes[i])) visible.push_back(i);
+	}
+}
+
+static AxisAlignedBox RandomBox(mt19937& random) {
+	uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+	uniform_real_distribution<float> size(0.5f, 8.0f);
+	float x = position(random), y = position(random), z = position(random), s = size(random);
+	AxisAlignedBox box;
+	box.Min = XMFLOAT3(x - s, y - s, z - s);
+	box.Max = XMFLOAT3(x + s, y + s, z + s);
+	return box;
+}
+
+static bool SameSet(vector<int> a, vector<int> b) {
+	sort(a.begin(), a.end());
+	sort(b.begin(), b.end());
+	return a == b;
+}
+
+int main(int argc, char* argv[]) {
+	int maxCount = argc > 1 ? atoi(argv[1]) : 1000000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 20;
+	if (maxCount < 10000) maxCount = 10000;
+	if (rounds <= 0) rounds = 1;
+
+	ViewFrustum frustum = ViewFrustum::FromMatrix(Perspective(3.14159265f / 3, 16.0f / 9.0f, 0.1f, 1000.0f));
+	mt19937 random(11);
+
+	printf("%10s %10s %12s %12s %8s %12s\n", "objects", "visible", "cull ms", "brute ms", "depth", "refit 1% ms");
+	for (int count = 10000; count <= maxCount; count *= 10) {
+		vector<AxisAlignedBox> boxes(count);
+		for (AxisAlignedBox& box : boxes) box = RandomBox(random);
+
+		BoundingVolumeHierarchy bvh;
+		bvh.Build(boxes);
+		// 中位數切割: 每往下一層物體減半, 到 LeafSize 以下就停
+		int limit = 1;
+		for (int n = count; n > BoundingVolumeHierarchy::LeafSize; n = (n + 1) / 2) limit++;
+		if (bvh.Depth() < 1 || bvh.Depth() > limit) Fail("build: the tree is deeper than a median split allows");
+
+		vector<int> visible, expected;
+		auto begin = chrono::steady_clock::now();
+		for (int r = 0; r < rounds; r++) bvh.Cull(frustum, visible);
+		double cullMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count() / rounds;
+		begin = chrono::steady_clock::now();
+		for (int r = 0; r < rounds; r++) BruteForce(frustum, boxes, expected);
+		double bruteMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count() / rounds;
+		if (!SameSet(visible, expected)) Fail("cull: the visible set differs from brute force");
+
+		// 移動 1% 的物體, 只 Refit 不重建
+		begin = chrono::steady_clock::now();
+		for (int i = 0; i < count / 100; i++) {
+			int item = (int)(random() % (unsigned)count);
+			boxes[item] = RandomBox(random);
+			bvh.Update(item, boxes[item]);
+		}
+		bvh.Refit();
+		double refitMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		bvh.Cull(frustum, visible);
+		BruteForce(frustum, boxes, expected);
+		if (!SameSet(visible, expected)) Fail("refit: the visible set differs from brute force");
+
+		printf("%10d %10zu %12.3f %12.3f %8d %12.3f\n", count, expected.size(), cullMs, bruteMs, bvh.Depth(), refitMs);
+	}
+
+	// 邊界情況: 空的樹, 一個物體, 全部在視錐內, 全部在視錐外
+	{
+		BoundingVolumeHierarchy bvh;
+		vector<int> visible(1, 7);
+		bvh.Build(vector<AxisAlignedBox>());
+		bvh.Cull(frustum, visible);
+		if (!visible.empty() || bvh.Depth() != 0) Fail("empty: an empty tree returned objects");
+
+		vector<AxisAlignedBox> inside(1000), outside(1000);
+		for (int i = 0; i < 1000; i++) {
+			float z = 10.0f + i * 0.5f;
+			inside[i].Min = XMFLOAT3(-0.1f, -0.1f, z);
+			inside[i].Max = XMFLOAT3(0.1f, 0.1f, z + 0.1f);
+			outside[i].Min = XMFLOAT3(-0.1f, -0.1f, -z - 0.1f);
+			outside[i].Max = XMFLOAT3(0.1f, 0.1f, -z);
+		}
+		bvh.Build(vector<AxisAlignedBox>(inside.begin(), inside.begin() + 1));
+		bvh.Cull(frustum, visible);
+		if (visible.size() != 1 || bvh.Depth() != 1) Fail("single: one visible object was not returned");
+		bvh.Build(inside);
+		bvh.Cull(frustum, visible);
+		if (visible.size() != inside.size()) Fail("inside: objects fully inside the frustum were dropped");
+		bvh.Build(outside);
+		bvh.Cull(frustum, visible);
+		if (!visible.empty()) Fail("outside: objects behind the camera were returned");
+	}
+
+	return ExitCode();
+}
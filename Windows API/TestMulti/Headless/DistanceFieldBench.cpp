@@ -0,0 +1,578 @@
+// SpriteFont 的距離場字型: 產生距離場圖集的速度, 以及放大縮小後畫出來的字跟真正的輪廓差多少
+//
+//   g++ -std=c++14 -O2 -pthread -I../../DirectXTK/Src DistanceFieldBench.cpp -o distancefieldbench
+//   ./distancefieldbench [font.ttf] [pixelSize] [range]      在 Headless 目錄下執行, Golden/ 是相對路徑
+//   ./distancefieldbench --update-golden        重新產生 Golden/ 裡的參考圖
+//   ./distancefieldbench --dump dir font.ttf     另外把字型的渲染結果與差異寫成 PGM
+//
+// 1. 距離: 正方形 (中間挖洞) 與圓的距離場, 每個 texel 要跟解析解差不到 1/255
+// 2. Golden: 幾個有尖角, 圓弧, 洞與單一尖角 (淚滴) 的圖形, 用 SpriteEffect.fx 的距離場 pixel shader 的算法
+//    在 CPU 上放大 1x, 2.5x, 6x 畫出來, 跟 Golden/*.pgm 逐像素比對
+// 3. 字型: 一行字在 0.5x 到 8x 畫出來, 跟用 GlyphRasterizer 在該大小直接點陣化 (精確面積覆蓋率) 比較,
+//    再跟把 1x 的點陣圖雙線性放大比較; 多通道的尖角要比單通道銳利
+// 4. 產生: 整個字集在 1 個與多個執行緒下產生的時間, 多執行緒的結果要逐位元相同; 記憶體跟每種大小各烘焙一張點陣圖集比較
+// 任何一項不對就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "TrueTypeFont.h"
+#include "GlyphRasterizer.h"
+#include "DistanceFieldGenerator.h"
+#include "AtlasPacker.h"
+
+using namespace DirectX;
+
+static bool ReadWholeFile(const char* path, vector<uint8_t>& data) {
+	FILE* stream = fopen(path, "rb");
+	if (stream == nullptr) return false;
+	fseek(stream, 0, SEEK_END);
+	long length = ftell(stream);
+	fseek(stream, 0, SEEK_SET);
+	data.resize(length > 0 ? (size_t)length : 0);
+	bool read = fread(data.data(), 1, data.size(), stream) == data.size();
+	fclose(stream);
+	return read && length > 0;
+}
+
+// 灰階影像, 0-255
+struct Image {
+	int width = 0, height = 0;
+	vector<uint8_t> pixels;
+	Image() {}
+	Image(int w, int h) : width(w), height(h), pixels((size_t)w * h) {}
+	uint8_t& At(int x, int y) { return pixels[(size_t)y * width + x]; }
+	uint8_t At(int x, int y) const { return pixels[(size_t)y * width + x]; }
+};
+
+static bool WritePgm(const string& path, const Image& image) {
+	FILE* stream = fopen(path.c_str(), "wb");
+	if (stream == nullptr) return false;
+	fprintf(stream, "P5\n%d %d\n255\n", image.width, image.height);
+	bool written = fwrite(image.pixels.data(), 1, image.pixels.size(), stream) == image.pixels.size();
+	fclose(stream);
+	return written;
+}
+
+static bool ReadPgm(const string& path, Image& image) {
+	vector<uint8_t> data;
+	if (!ReadWholeFile(path.c_str(), data)) return false;
+	int w, h, maxValue, headerLength;
+	data.push_back(0);
+	if (sscanf((const char*)data.data(), "P5 %d %d %d%n", &w, &h, &maxValue, &headerLength) != 3 || maxValue != 255) return false;
+	data.pop_back();
+	size_t start = (size_t)headerLength + 1;
+	if (w <= 0 || h <= 0 || data.size() < start + (size_t)w * h) return false;
+	image = Image(w, h);
+	memcpy(image.pixels.data(), data.data() + start, image.pixels.size());
+	return true;
+}
+
+// 產生出來的距離場, 一個字形一張
+struct Field {
+	int width = 0, height = 0, channels = 1;
+	DistanceFieldGenerator::Bounds bounds = {};
+	vector<uint8_t> texels;
+
+	float Texel(int x, int y, int c) const {
+		x = min(max(x, 0), width - 1);
+		y = min(max(y, 0), height - 1);
+		return texels[((size_t)y * width + x) * channels + c] / 255.0f;
+	}
+};
+
+static Field MakeField(const GlyphOutline& outline, float scale, float range, bool multiChannel) {
+	static DistanceFieldGenerator generator;
+	Field field;
+	field.bounds = DistanceFieldGenerator::Measure(outline, scale, range);
+	field.width = field.bounds.width;
+	field.height = field.bounds.height;
+	field.channels = multiChannel ? 4 : 1;
+	field.texels.assign((size_t)field.width * field.height * field.channels, 0);
+	generator.Generate(outline, scale, field.bounds, range, multiChannel, field.texels.data(), (size_t)field.width * field.channels);
+	return field;
+}
+
+static float Median(float a, float b, float c) {
+	return max(min(a, b), min(max(a, b), c));
+}
+
+// SpriteEffect.fx 的 SpriteDistanceFieldPixelShader / SpriteMultiChannelDistanceFieldPixelShader:
+// 雙線性取樣, 單通道取 alpha, 多通道取 RGB 的中位數, 再用螢幕上一個距離範圍有幾個像素把邊緣拉成一個像素寬
+// 距離場放大 zoom 倍, 畫在 (zoom * field 寬) 大的影像上
+static Image RenderField(const Field& field, float range, float zoom, int width, int height) {
+	Image image(width, height);
+	// 軸對齊時 fwidth(texCoord) * texSize 就是 1 / zoom
+	float screenRange = max(range * zoom, 1.0f);
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			float u = (x + 0.5f) / zoom - 0.5f, v = (y + 0.5f) / zoom - 0.5f;
+			int x0 = (int)floor(u), y0 = (int)floor(v);
+			float fx = u - x0, fy = v - y0;
+			float s[4];
+			for (int c = 0; c < field.channels; c++) {
+				float top = field.Texel(x0, y0, c) * (1 - fx) + field.Texel(x0 + 1, y0, c) * fx;
+				float bottom = field.Texel(x0, y0 + 1, c) * (1 - fx) + field.Texel(x0 + 1, y0 + 1, c) * fx;
+				s[c] = top * (1 - fy) + bottom * fy;
+			}
+			float d = field.channels == 4 ? Median(s[0], s[1], s[2]) : s[0];
+			float opacity = min(max(screenRange * (d - 0.5f) + 0.5f, 0.0f), 1.0f);
+			image.At(x, y) = (uint8_t)(opacity * 255 + 0.5f);
+		}
+	}
+	return image;
+}
+
+// 把輪廓換到 "距離場放大 zoom 倍" 的座標, 讓 GlyphRasterizer 用 scale 1 畫出對應的精確覆蓋率
+static Image RenderExact(const GlyphOutline& outline, float scale, const DistanceFieldGenerator::Bounds& bounds, float zoom, int width, int height) {
+	GlyphOutline moved = outline;
+	auto move = [&](GlyphOutline::Point& p) {
+		p.x = (p.x * scale - bounds.left) * zoom;
+		p.y = (p.y * scale - bounds.top) * zoom;
+	};
+	for (auto& s : moved.segments) { move(s.p0); move(s.control); move(s.p1); }
+	moved.xMin = (outline.xMin * scale - bounds.left) * zoom;
+	moved.xMax = (outline.xMax * scale - bounds.left) * zoom;
+	moved.yMin = (outline.yMin * scale - bounds.top) * zoom;
+	moved.yMax = (outline.yMax * scale - bounds.top) * zoom;
+	Image image(width, height);
+	GlyphRasterizer rasterizer;
+	rasterizer.Rasterize(moved, 1, GlyphRasterizer::Bounds{ 0, 0, width, height }, image.pixels.data(), width);
+	return image;
+}
+
+// 現在的做法: 在 1x 點陣化, 再雙線性放大
+static Image RenderBitmap(const GlyphOutline& outline, float scale, const DistanceFieldGenerator::Bounds& bounds, float zoom, int width, int height) {
+	Image bitmap = RenderExact(outline, scale, bounds, 1, bounds.width, bounds.height);
+	Field field;
+	field.width = bitmap.width;
+	field.height = bitmap.height;
+	field.texels = bitmap.pixels;
+	Image image(width, height);
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			float u = (x + 0.5f) / zoom - 0.5f, v = (y + 0.5f) / zoom - 0.5f;
+			int x0 = (int)floor(u), y0 = (int)floor(v);
+			float fx = u - x0, fy = v - y0;
+			float top = field.Texel(x0, y0, 0) * (1 - fx) + field.Texel(x0 + 1, y0, 0) * fx;
+			float bottom = field.Texel(x0, y0 + 1, 0) * (1 - fx) + field.Texel(x0 + 1, y0 + 1, 0) * fx;
+			image.At(x, y) = (uint8_t)((top * (1 - fy) + bottom * fy) * 255 + 0.5f);
+		}
+	}
+	return image;
+}
+
+// 差異: 平均絕對誤差 (0-255), 以及差超過 1/4 的像素比例
+struct Difference {
+	double sum = 0;
+	size_t wrong = 0, pixels = 0, worst = 0;
+	void Add(const Image& a, const Image& b) {
+		for (size_t i = 0; i < a.pixels.size(); i++) {
+			int d = abs((int)a.pixels[i] - (int)b.pixels[i]);
+			sum += d;
+			wrong += d > 64;
+			worst = max(worst, (size_t)d);
+		}
+		pixels += a.pixels.size();
+	}
+	double Mean() const { return pixels ? sum / pixels : 0; }
+	double WrongPercent() const { return pixels ? 100.0 * wrong / pixels : 0; }
+};
+
+static Image DiffImage(const Image& a, const Image& b) {
+	Image diff(a.width, a.height);
+	for (size_t i = 0; i < a.pixels.size(); i++) diff.pixels[i] = (uint8_t)abs((int)a.pixels[i] - (int)b.pixels[i]);
+	return diff;
+}
+
+// ---- 圖形 ----
+
+static void AddLine(GlyphOutline& o, float x0, float y0, float x1, float y1) {
+	o.segments.push_back({ { x0, y0 }, { (x0 + x1) / 2, (y0 + y1) / 2 }, { x1, y1 }, false });
+}
+
+static void AddPolygon(GlyphOutline& o, const vector<GlyphOutline::Point>& points) {
+	for (size_t i = 0; i < points.size(); i++) {
+		auto a = points[i], b = points[(i + 1) % points.size()];
+		AddLine(o, a.x, a.y, b.x, b.y);
+	}
+	o.contourEnds.push_back(o.segments.size());
+}
+
+// 八段二次曲線, direction 1 是逆時針 (y 向上)
+static void AddCircle(GlyphOutline& o, float cx, float cy, float r, int direction) {
+	const double step = 3.14159265358979 / 4;
+	for (int i = 0; i < 8; i++) {
+		double a0 = i * step * direction, a1 = (i + 1) * step * direction, k = r / cos(step / 2);
+		double am = (a0 + a1) / 2;
+		o.segments.push_back({ { cx + r * (float)cos(a0), cy + r * (float)sin(a0) }, { cx + (float)(k * cos(am)), cy + (float)(k * sin(am)) },
+			{ cx + r * (float)cos(a1), cy + r * (float)sin(a1) }, true });
+	}
+	o.contourEnds.push_back(o.segments.size());
+}
+
+static void Finish(GlyphOutline& o) {
+	bool first = true;
+	for (auto& s : o.segments) {
+		for (auto p : { s.p0, s.control, s.p1 }) {
+			if (first) { o.xMin = o.xMax = p.x; o.yMin = o.yMax = p.y; first = false; }
+			o.xMin = min(o.xMin, p.x); o.xMax = max(o.xMax, p.x);
+			o.yMin = min(o.yMin, p.y); o.yMax = max(o.yMax, p.y);
+		}
+	}
+}
+
+// TrueType 的方向: 外框順時針, 洞逆時針 (y 向上)
+static vector<GlyphOutline> Shapes() {
+	vector<GlyphOutline> shapes(4);
+	for (auto& s : shapes) s.Clear();
+	// 中間挖洞的正方形
+	AddPolygon(shapes[0], { { 2, 2 }, { 2, 22 }, { 22, 22 }, { 22, 2 } });
+	AddPolygon(shapes[0], { { 8, 8 }, { 16, 8 }, { 16, 16 }, { 8, 16 } });
+	// 圓
+	AddCircle(shapes[1], 12, 12, 10, -1);
+	// 五角星: 36 度的尖角與凹角
+	{
+		vector<GlyphOutline::Point> star;
+		for (int i = 0; i < 10; i++) {
+			double a = 3.14159265358979 / 2 - i * 3.14159265358979 / 5, r = (i & 1) ? 4.2 : 11;
+			star.push_back({ 12 + (float)(r * cos(a)), 12 + (float)(r * sin(a)) });
+		}
+		AddPolygon(shapes[2], star);
+	}
+	// 淚滴: 兩條二次曲線在底部平滑相接, 只有頂端一個尖角, 要先切成三段才能上三種顏色
+	shapes[3].segments.push_back({ { 12, 23 }, { 26, 2 }, { 12, 2 }, true });
+	shapes[3].segments.push_back({ { 12, 2 }, { -2, 2 }, { 12, 23 }, true });
+	shapes[3].contourEnds.push_back(2);
+	for (auto& s : shapes) Finish(s);
+	return shapes;
+}
+
+// ---- 1. 距離 ----
+
+static double SegmentDistance(double px, double py, double ax, double ay, double bx, double by) {
+	double dx = bx - ax, dy = by - ay;
+	double t = max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / (dx * dx + dy * dy)));
+	return hypot(px - ax - t * dx, py - ay - t * dy);
+}
+
+static void TestDistances() {
+	const float range = 4;
+	auto shapes = Shapes();
+	int worst = 0;
+
+	// 正方形: 輪廓都是直線, 距離可以直接算
+	{
+		const GlyphOutline& o = shapes[0];
+		for (bool multi : { false, true }) {
+			Field field = MakeField(o, 1, range, multi);
+			for (int y = 0; y < field.height; y++) {
+				for (int x = 0; x < field.width; x++) {
+					double px = field.bounds.left + x + 0.5, py = field.bounds.top - y - 0.5;
+					double d = 1e9;
+					for (auto& s : o.segments) d = min(d, SegmentDistance(px, py, s.p0.x, s.p0.y, s.p1.x, s.p1.y));
+					bool inside = px > 2 && px < 22 && py > 2 && py < 22 && !(px > 8 && px < 16 && py > 8 && py < 16);
+					double expected = min(max((inside ? d : -d) / range + 0.5, 0.0), 1.0) * 255;
+					int alpha = field.texels[((size_t)y * field.width + x) * field.channels + field.channels - 1];
+					worst = max(worst, (int)ceil(fabs(alpha - expected) - 0.5));
+					// 直線與直角: 多通道的中位數在角的外面是到延長線的距離, 其他地方跟真正的距離一樣
+					if (multi) {
+						const uint8_t* t = &field.texels[((size_t)y * field.width + x) * 4];
+						float m = Median(t[0], t[1], t[2]);
+						if ((m > 127.5f) != inside) Fail("distance: multi-channel median is on the wrong side of the square");
+					}
+				}
+			}
+		}
+	}
+
+	// 圓: 八段二次曲線跟真正的圓差了 0.03 像素, 所以拿曲線切成很細的折線來算距離
+	{
+		const GlyphOutline& o = shapes[1];
+		vector<GlyphOutline::Point> polyline;
+		for (auto& s : o.segments) {
+			for (int i = 0; i < 1000; i++) {
+				float t = i / 1000.0f, u = 1 - t;
+				polyline.push_back({ u * u * s.p0.x + 2 * u * t * s.control.x + t * t * s.p1.x, u * u * s.p0.y + 2 * u * t * s.control.y + t * t * s.p1.y });
+			}
+		}
+		Field field = MakeField(o, 1, range, false);
+		for (int y = 0; y < field.height; y++) {
+			for (int x = 0; x < field.width; x++) {
+				double px = field.bounds.left + x + 0.5, py = field.bounds.top - y - 0.5;
+				double d = 1e9;
+				bool inside = false;
+				for (size_t i = 0; i < polyline.size(); i++) {
+					auto a = polyline[i], b = polyline[(i + 1) % polyline.size()];
+					d = min(d, SegmentDistance(px, py, a.x, a.y, b.x, b.y));
+					if ((a.y > py) != (b.y > py) && px < a.x + (py - a.y) * (b.x - a.x) / (b.y - a.y)) inside = !inside;
+				}
+				double expected = min(max((inside ? d : -d) / range + 0.5, 0.0), 1.0) * 255;
+				worst = max(worst, (int)ceil(fabs(field.texels[(size_t)y * field.width + x] - expected) - 0.5));
+			}
+		}
+	}
+	if (worst > 0) Fail("distance: field differs from the exact distance by more than one step");
+	printf("distance: square and circle fields within %d step%s of the exact distance\n", worst + 1, worst ? "s" : "");
+}
+
+// ---- 2. Golden ----
+
+static const float GoldenZooms[] = { 1, 2.5f, 6 };
+
+static Image GoldenImage(bool multi) {
+	const float range = 4;
+	auto shapes = Shapes();
+	// 每個圖形一列, 每種放大倍率一行
+	vector<Field> fields;
+	int rowHeight = 0, width = 0;
+	for (auto& o : shapes) {
+		fields.push_back(MakeField(o, 1, range, multi));
+		rowHeight = max(rowHeight, (int)ceil(fields.back().height * GoldenZooms[2]));
+	}
+	int columnX[3], x = 0;
+	for (int z = 0; z < 3; z++) {
+		columnX[z] = x;
+		int columnWidth = 0;
+		for (auto& f : fields) columnWidth = max(columnWidth, (int)ceil(f.width * GoldenZooms[z]));
+		x += columnWidth;
+	}
+	width = x;
+	Image image(width, rowHeight * (int)fields.size());
+	for (size_t s = 0; s < fields.size(); s++) {
+		for (int z = 0; z < 3; z++) {
+			int w = (int)ceil(fields[s].width * GoldenZooms[z]), h = (int)ceil(fields[s].height * GoldenZooms[z]);
+			Image tile = RenderField(fields[s], range, GoldenZooms[z], w, h);
+			for (int ty = 0; ty < h; ty++) {
+				memcpy(&image.At(columnX[z], (int)s * rowHeight + ty), &tile.At(0, ty), w);
+			}
+		}
+	}
+	return image;
+}
+
+static string GoldenPath(const char* directory, bool multi) {
+	return string(directory) + (multi ? "/DistanceField_Multi.pgm" : "/DistanceField_Single.pgm");
+}
+
+static void TestGolden(const char* directory, bool update) {
+	for (bool multi : { false, true }) {
+		Image image = GoldenImage(multi);
+		string path = GoldenPath(directory, multi);
+		if (update) {
+			if (!WritePgm(path, image)) Fail("golden: cannot write the reference image");
+			else printf("golden: wrote %s\n", path.c_str());
+			continue;
+		}
+		Image golden;
+		if (!ReadPgm(path, golden)) {
+			fprintf(stderr, "cannot read %s (run with --update-golden to create it)\n", path.c_str());
+			Fail("golden: reference image missing");
+			continue;
+		}
+		if (golden.width != image.width || golden.height != image.height) {
+			Fail("golden: image size differs from the reference");
+			continue;
+		}
+		// 距離場差 1/255, 放大 6 倍後邊緣像素可以差到 range * 6 / 255; 只容許少數這種像素
+		Difference d;
+		d.Add(image, golden);
+		size_t changed = 0;
+		for (size_t i = 0; i < image.pixels.size(); i++) changed += abs((int)image.pixels[i] - (int)golden.pixels[i]) > 2;
+		printf("golden: %s %dx%d, mean difference %.3f, %zu pixels off by more than 2, worst %zu\n", multi ? "multi-channel " : "single channel",
+			image.width, image.height, d.Mean(), changed, d.worst);
+		if (changed * 1000 > image.pixels.size() || d.worst > 48) {
+			WritePgm(path + ".actual.pgm", image);
+			Fail("golden: rendering differs from the reference image (see *.actual.pgm)");
+		}
+	}
+}
+
+// ---- 3. 字型 ----
+
+static void TestFontRendering(const TrueTypeFont& font, float pixelSize, float range, const char* dumpDirectory) {
+	const char* text = "Hamburgefonstiv AVWM 0123456789 &@%$#";
+	const float zooms[] = { 0.5f, 1, 2, 4, 8 };
+	float scale = pixelSize / font.UnitsPerEm();
+
+	printf("rendering \"%s\" from %.0f px fields, range %.0f: mean error / pixels off by more than 1/4, against exact coverage\n", text, pixelSize, range);
+	printf("  zoom    bitmap              single channel      multi-channel\n");
+
+	GlyphOutline outline;
+	double singleAt8 = 0, multiAt8 = 0, bitmapAt8 = 0;
+	for (float zoom : zooms) {
+		Difference bitmap, single, multi;
+		for (const char* p = text; *p; p++) {
+			uint32_t glyph = font.FindGlyph((uint8_t)*p);
+			font.GetOutline(glyph, &outline);
+			if (outline.Empty()) continue;
+			Field fieldSingle = MakeField(outline, scale, range, false);
+			Field fieldMulti = MakeField(outline, scale, range, true);
+			int w = (int)ceil(fieldSingle.width * zoom), h = (int)ceil(fieldSingle.height * zoom);
+			Image exact = RenderExact(outline, scale, fieldSingle.bounds, zoom, w, h);
+			Image b = RenderBitmap(outline, scale, fieldSingle.bounds, zoom, w, h);
+			Image s = RenderField(fieldSingle, range, zoom, w, h);
+			Image m = RenderField(fieldMulti, range, zoom, w, h);
+			bitmap.Add(b, exact);
+			single.Add(s, exact);
+			multi.Add(m, exact);
+			if (dumpDirectory && (*p == 'A' || *p == '&')) {
+				char name[256];
+				snprintf(name, sizeof(name), "%s/%s_%gx", dumpDirectory, *p == '&' ? "amp" : "A", zoom);
+				WritePgm(string(name) + "_exact.pgm", exact);
+				WritePgm(string(name) + "_bitmap.pgm", b);
+				WritePgm(string(name) + "_single.pgm", s);
+				WritePgm(string(name) + "_multi.pgm", m);
+				WritePgm(string(name) + "_multi_diff.pgm", DiffImage(m, exact));
+			}
+		}
+		printf("  %4gx    %5.2f / %5.2f%%    %5.2f / %5.2f%%    %5.2f / %5.2f%%\n", zoom, bitmap.Mean(), bitmap.WrongPercent(),
+			single.Mean(), single.WrongPercent(), multi.Mean(), multi.WrongPercent());
+		if (zoom == 8) {
+			bitmapAt8 = bitmap.Mean();
+			singleAt8 = single.Mean();
+			multiAt8 = multi.Mean();
+		}
+		// 距離場在任何大小都要接近精確的覆蓋率
+		if (zoom >= 1 && (single.WrongPercent() > 1.5 || multi.WrongPercent() > 1.0)) Fail("rendering: distance field text differs too much from the exact outline");
+	}
+	if (!(multiAt8 < singleAt8 && singleAt8 < bitmapAt8)) Fail("rendering: at 8x, multi-channel should beat single channel, which should beat the bitmap");
+}
+
+// ---- 4. 產生 ----
+
+static int BakedBitmapAtlasSize(const TrueTypeFont& font, float pixelSize, const vector<uint32_t>& characters) {
+	float scale = pixelSize / font.UnitsPerEm();
+	GlyphOutline outline;
+	vector<pair<int, int>> sizes;
+	for (uint32_t c : characters) {
+		font.GetOutline(font.FindGlyph(c), &outline);
+		auto b = GlyphRasterizer::Measure(outline, scale);
+		if (b.width) sizes.push_back({ b.height + 2, b.width + 2 });
+	}
+	sort(sizes.rbegin(), sizes.rend());
+	for (int size = 16; size <= 16384; size *= 2) {
+		SkylinePacker packer(size, size);
+		bool fits = true;
+		int x, y;
+		for (auto& s : sizes) {
+			if (!packer.Insert(s.second, s.first, &x, &y)) { fits = false; break; }
+		}
+		if (fits) return size;
+	}
+	return 0;
+}
+
+// 每個字形在圖集裡的位置要在圖集內, 內容要跟單獨產生的距離場一模一樣
+static void CheckAtlas(const TrueTypeFont& font, const DistanceFieldAtlas& atlas, float pixelSize, float range, bool multi) {
+	float scale = pixelSize / font.UnitsPerEm();
+	size_t bytes = atlas.BytesPerTexel(), pitch = atlas.Width() * bytes;
+	GlyphOutline outline;
+	for (auto& g : atlas.Glyphs()) {
+		if (!g.width) continue;
+		if (g.x < 0 || g.y < 0 || g.x + g.width > atlas.Width() || g.y + g.height > atlas.Height()) {
+			Fail("generate: glyph outside the atlas");
+			return;
+		}
+		font.GetOutline(font.FindGlyph(g.character), &outline);
+		Field field = MakeField(outline, scale, range, multi);
+		if (field.width != g.width || field.height != g.height || field.bounds.left != g.left || field.bounds.top != g.top) {
+			Fail("generate: glyph rectangle differs from its field");
+			return;
+		}
+		for (int y = 0; y < g.height; y++) {
+			if (memcmp(&atlas.Texels()[(g.y + y) * pitch + g.x * bytes], &field.texels[y * g.width * bytes], g.width * bytes)) {
+				Fail("generate: atlas texels differ from the glyph field");
+				return;
+			}
+		}
+	}
+}
+
+static void BenchGeneration(const TrueTypeFont& font, float pixelSize, float range) {
+	vector<uint32_t> characters;
+	font.GetCharacters(&characters);
+	unsigned hardwareThreads = max(thread::hardware_concurrency(), 1u);
+	unsigned threadCounts[] = { 1, max(hardwareThreads, 4u) };
+
+	printf("generate: %zu characters at %.0f px, range %.0f, %u hardware thread%s\n", characters.size(), pixelSize, range, hardwareThreads, hardwareThreads > 1 ? "s" : "");
+	size_t fieldBytes[2] = {};
+	for (bool multi : { false, true }) {
+		vector<uint8_t> serial;
+		for (unsigned threads : threadCounts) {
+			DistanceFieldAtlas atlas;
+			auto t0 = chrono::steady_clock::now();
+			bool built = atlas.Build(font, characters.data(), characters.size(), pixelSize, range, multi, threads, 16384);
+			auto t1 = chrono::steady_clock::now();
+			if (!built) {
+				Fail("generate: atlas does not fit");
+				return;
+			}
+			double ms = chrono::duration<double, milli>(t1 - t0).count();
+			printf("  %-14s %2u thread%s %8.1f ms  %6.1f us/glyph   atlas %dx%d = %.2f MB\n", multi ? "multi-channel" : "single channel", threads, threads > 1 ? "s" : " ",
+				ms, ms * 1000 / max<size_t>(atlas.Glyphs().size(), 1), atlas.Width(), atlas.Height(), atlas.Texels().size() / 1048576.0);
+			if (threads == 1) {
+				serial = atlas.Texels();
+				CheckAtlas(font, atlas, pixelSize, range, multi);
+			}
+			else if (atlas.Texels() != serial) Fail("generate: threads changed the atlas");
+			fieldBytes[multi] = atlas.Texels().size();
+		}
+	}
+
+	// 點陣字型每種大小一張 (32 位元), 距離場一張就夠
+	const int sizes[] = { 12, 16, 24, 32, 48, 64 };
+	size_t bitmapBytes = 0;
+	printf("memory: baked bitmap atlases at");
+	for (int size : sizes) {
+		int atlas = BakedBitmapAtlasSize(font, (float)size, characters);
+		bitmapBytes += (size_t)atlas * atlas * 4;
+		printf(" %d", size);
+	}
+	printf(" px = %.2f MB; one distance field atlas %.2f MB single channel, %.2f MB multi-channel\n",
+		bitmapBytes / 1048576.0, fieldBytes[0] / 1048576.0, fieldBytes[1] / 1048576.0);
+}
+
+int main(int argc, char* argv[]) {
+	const char* goldenDirectory = "Golden";
+	const char* dumpDirectory = nullptr;
+	bool update = false;
+	vector<const char*> arguments;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--update-golden")) update = true;
+		else if (!strcmp(argv[i], "--dump") && i + 1 < argc) dumpDirectory = argv[++i];
+		else arguments.push_back(argv[i]);
+	}
+
+	TestDistances();
+	TestGolden(goldenDirectory, update);
+
+	if (!arguments.empty()) {
+		float pixelSize = arguments.size() > 1 ? (float)atof(arguments[1]) : 32;
+		float range = arguments.size() > 2 ? (float)atof(arguments[2]) : 4;
+		if (pixelSize < 4) pixelSize = 4;
+		if (range < 1) range = 1;
+
+		vector<uint8_t> data;
+		TrueTypeFont font;
+		if (!ReadWholeFile(arguments[0], data) || !font.Load(data.data(), data.size())) {
+			fprintf(stderr, "cannot load %s\n", arguments[0]);
+			return 1;
+		}
+		TestFontRendering(font, pixelSize, range, dumpDirectory);
+		BenchGeneration(font, pixelSize, range);
+	}
+
+	return ExitCode();
+}
@@ -0,0 +1,554 @@
+// SpriteFont 的 UTF-8 與 TrueType 動態字型: UTF-8 直接解碼的速度, 字形點陣化的速度與正確性, 以及 LRU 字形圖集
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Src DynamicFontBench.cpp -o dynamicfontbench
+//   ./dynamicfontbench font.ttf [pixelSize] [atlasSize] [frames]
+//
+// 1. UTF-8: 每個 codepoint 編碼再解碼要一樣, 錯誤的序列要變成 U+FFFD; 比較邊排版邊解碼與先轉成 wchar_t 再排版
+// 2. 點陣化: 矩形與圓的覆蓋率要跟面積相符, 字型裡每個英數字形的覆蓋率總和要跟輪廓面積相符
+// 3. 圖集: 模擬聊天視窗, 每幀畫滿一個畫面的字; 字形用到才點陣化, 滿了換掉最久沒用的, 全都是本幀用過的就把圖集加高一倍
+//    本幀用過的字形不能被換掉, 每個字都要放得進去, 活著的字形不能重疊, 圖集的內容要跟每個字形重新點陣化的結果逐位元相同
+//    架子 (shelf) 照字形實際的高度開, 清空的架子要合併回去給更高的字形用
+// 4. 記憶體: 整個字集預先烘焙成一張圖集的大小, 跟動態圖集比較
+// 5. 損毀的字型: cmap 群組數超過子表長度, 互相參照的複合字形, 都要很快結束
+// 任何一項不對就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "Utf8.h"
+#include "TrueTypeFont.h"
+#include "GlyphRasterizer.h"
+#include "GlyphAtlasCache.h"
+#include "AtlasPacker.h"
+
+using namespace DirectX;
+
+static const int Padding = 1;
+
+static void Encode(uint32_t c, string& out) {
+	if (c < 0x80) out += (char)c;
+	else if (c < 0x800) { out += (char)(0xC0 | (c >> 6)); out += (char)(0x80 | (c & 0x3F)); }
+	else if (c < 0x10000) { out += (char)(0xE0 | (c >> 12)); out += (char)(0x80 | ((c >> 6) & 0x3F)); out += (char)(0x80 | (c & 0x3F)); }
+	else { out += (char)(0xF0 | (c >> 18)); out += (char)(0x80 | ((c >> 12) & 0x3F)); out += (char)(0x80 | ((c >> 6) & 0x3F)); out += (char)(0x80 | (c & 0x3F)); }
+}
+
+static vector<uint32_t> DecodeAll(const char* text) {
+	vector<uint32_t> result;
+	while (*text) result.push_back(Utf8::Decode(text));
+	return result;
+}
+
+static void TestUtf8() {
+	string all;
+	vector<uint32_t> expected;
+	for (uint32_t c = 1; c <= 0x10FFFF; c++) {
+		if (c >= 0xD800 && c <= 0xDFFF) continue;
+		Encode(c, all);
+		expected.push_back(c);
+	}
+	if (DecodeAll(all.c_str()) != expected) Fail("utf-8: valid codepoints do not round trip");
+
+	const uint32_t R = Utf8::ReplacementCharacter;
+	struct Case { const char* text; vector<uint32_t> decoded; };
+	const Case cases[] = {
+		{ "\xC0\xAF", { R, R } },                       // 過長的 '/'
+		{ "\xE0\x80\xAF", { R, R, R } },
+		{ "\xED\xA0\x80", { R, R, R } },                // surrogate
+		{ "\xF4\x90\x80\x80", { R, R, R, R } },         // > U+10FFFF
+		{ "\xF8\x88\x80\x80\x80", { R, R, R, R, R } },
+		{ "a\xE4\xB8", { 'a', R, R } },                 // 被截斷, 不會讀過結尾
+		{ "\xE4\xB8" "a", { R, R, 'a' } },
+		{ "\x80\xBF", { R, R } },
+		{ "\xE4\xB8\xAD\xF0\x9F\x98\x80", { 0x4E2D, 0x1F600 } },
+	};
+	for (const Case& c : cases) {
+		if (DecodeAll(c.text) != c.decoded) Fail("utf-8: malformed sequence decoded wrongly");
+	}
+}
+
+// 邊解碼邊排版 (UTF-8 DrawString) 與先轉成 wchar_t 字串再排版 (呼叫端自己 MultiByteToWideChar)
+static void BenchUtf8() {
+	mt19937 random(12345);
+	string text;
+	size_t characters = 0;
+	while (text.size() < 4000000) {
+		uint32_t r = random() % 100, c;
+		if (r < 70) c = 32 + random() % 95;
+		else if (r < 80) c = 0xA0 + random() % 0x500;
+		else if (r < 98) c = 0x4E00 + random() % 0x5000;
+		else c = 0x1F600 + random() % 0x50;
+		Encode(c, text);
+		characters++;
+	}
+
+	vector<float> advances(4096);
+	for (size_t i = 0; i < advances.size(); i++) advances[i] = (float)(i % 7 + 4);
+
+	auto t0 = chrono::steady_clock::now();
+	float x0 = 0;
+	for (const char* p = text.c_str(); *p; ) x0 += advances[Utf8::Decode(p) & 4095];
+	auto t1 = chrono::steady_clock::now();
+	vector<wchar_t> wide;
+	wide.reserve(characters + 1);
+	for (const char* p = text.c_str(); *p; ) wide.push_back((wchar_t)Utf8::Decode(p));
+	wide.push_back(0);
+	float x1 = 0;
+	for (const wchar_t* p = wide.data(); *p; p++) x1 += advances[(uint32_t)*p & 4095];
+	auto t2 = chrono::steady_clock::now();
+	if (x0 != x1) Fail("utf-8: decoding in place and converting first disagree");
+
+	double directNs = chrono::duration<double, nano>(t1 - t0).count() / characters;
+	double convertNs = chrono::duration<double, nano>(t2 - t1).count() / characters;
+	printf("utf-8: %zu characters, %.1f MB (70%% ASCII, 18%% CJK)\n", characters, text.size() / 1e6);
+	printf("  decode while laying out   %5.2f ns/char\n", directNs);
+	printf("  convert, then lay out     %5.2f ns/char, plus %zu KB for the copy\n", convertNs, wide.size() * sizeof(wchar_t) / 1024);
+}
+
+// 輪廓的面積 (曲線細分得很密)
+static double OutlineArea(const GlyphOutline& outline, float scale) {
+	double area = 0;
+	for (const auto& s : outline.segments) {
+		const int n = s.curve ? 64 : 1;
+		double px = s.p0.x, py = s.p0.y;
+		for (int i = 1; i <= n; i++) {
+			double t = (double)i / n, u = 1 - t;
+			double x = s.curve ? u * u * s.p0.x + 2 * u * t * s.control.x + t * t * s.p1.x : s.p1.x;
+			double y = s.curve ? u * u * s.p0.y + 2 * u * t * s.control.y + t * t * s.p1.y : s.p1.y;
+			area += px * y - x * py;
+			px = x;
+			py = y;
+		}
+	}
+	return fabs(area) * 0.5 * scale * scale;
+}
+
+static double Ink(const vector<uint8_t>& coverage) {
+	double sum = 0;
+	for (uint8_t c : coverage) sum += c;
+	return sum / 255;
+}
+
+static void AddLine(GlyphOutline& o, float x0, float y0, float x1, float y1) {
+	o.segments.push_back({ { x0, y0 }, { (x0 + x1) / 2, (y0 + y1) / 2 }, { x1, y1 }, false });
+}
+
+static void TestRasterizer(const TrueTypeFont& font, float pixelSize) {
+	GlyphRasterizer rasterizer;
+
+	// 邊在像素中間的矩形: 每個像素的覆蓋率都算得出來
+	{
+		GlyphOutline o;
+		o.Clear();
+		AddLine(o, 0.25f, 0.5f, 5.75f, 0.5f);
+		AddLine(o, 5.75f, 0.5f, 5.75f, 3.25f);
+		AddLine(o, 5.75f, 3.25f, 0.25f, 3.25f);
+		AddLine(o, 0.25f, 3.25f, 0.25f, 0.5f);
+		o.contourEnds.push_back(4);
+		o.xMin = 0.25f; o.yMin = 0.5f; o.xMax = 5.75f; o.yMax = 3.25f;
+		auto b = GlyphRasterizer::Measure(o, 1);
+		vector<uint8_t> c(b.width * b.height);
+		rasterizer.Rasterize(o, 1, b, c.data(), b.width);
+		for (int y = 0; y < b.height; y++) {
+			for (int x = 0; x < b.width; x++) {
+				double px0 = b.left + x, py1 = b.top - y;
+				double w = max(0.0, min(px0 + 1, 5.75) - max(px0, 0.25));
+				double h = max(0.0, min(py1, 3.25) - max(py1 - 1, 0.5));
+				if (fabs(c[y * b.width + x] - w * h * 255) > 1) Fail("rasterizer: rectangle coverage is wrong");
+			}
+		}
+	}
+
+	// 八段二次曲線組成的圓
+	{
+		GlyphOutline o;
+		o.Clear();
+		const float r = 20.3f, cx = 24.6f, cy = 25.1f;
+		const double step = 3.14159265358979 / 4;
+		for (int i = 0; i < 8; i++) {
+			double a0 = i * step, a1 = (i + 1) * step, am = (a0 + a1) / 2, k = r / cos(step / 2);
+			o.segments.push_back({ { cx + r * (float)cos(a0), cy + r * (float)sin(a0) }, { cx + (float)(k * cos(am)), cy + (float)(k * sin(am)) },
+				{ cx + r * (float)cos(a1), cy + r * (float)sin(a1) }, true });
+		}
+		o.contourEnds.push_back(8);
+		o.xMin = cx - r * 1.1f; o.yMin = cy - r * 1.1f; o.xMax = cx + r * 1.1f; o.yMax = cy + r * 1.1f;
+		auto b = GlyphRasterizer::Measure(o, 1);
+		vector<uint8_t> c(b.width * b.height);
+		rasterizer.Rasterize(o, 1, b, c.data(), b.width);
+		if (fabs(Ink(c) - OutlineArea(o, 1)) > OutlineArea(o, 1) * 0.002) Fail("rasterizer: circle coverage does not match its area");
+	}
+
+	// 字型的英數字: 輪廓不重疊, 覆蓋率總和就是面積
+	const char* letters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789&@%";
+	float scale = pixelSize / font.UnitsPerEm();
+	GlyphOutline outline;
+	double worst = 0;
+	for (const char* p = letters; *p; p++) {
+		font.GetOutline(font.FindGlyph((uint8_t)*p), &outline);
+		auto b = GlyphRasterizer::Measure(outline, scale);
+		vector<uint8_t> c(b.width * b.height);
+		rasterizer.Rasterize(outline, scale, b, c.data(), b.width);
+		double area = OutlineArea(outline, scale);
+		double error = fabs(Ink(c) - area) / area;
+		worst = max(worst, error);
+		if (error > 0.01) {
+			fprintf(stderr, "'%c': coverage %.1f, outline area %.1f\n", *p, Ink(c), area);
+			Fail("rasterizer: glyph coverage does not match its outline area");
+		}
+	}
+	printf("rasterizer: letters and digits within %.2f%% of their outline area\n", worst * 100);
+}
+
+// 損毀或惡意的字型: 自己組一個只有必要表格的字型
+// cmap 是 format 12, 群組數寫 0xFFFFFFFF 但子表只放得下兩組, 後面還跟著一組涵蓋全部字元的假群組
+// 字形 2 ~ 9 是複合字形, 每層 10 個元件都指向下一層, 不限制元件總數的話要展開 10^8 個三角形
+static void PutU16(vector<uint8_t>& v, uint32_t x) {
+	v.push_back((uint8_t)(x >> 8));
+	v.push_back((uint8_t)x);
+}
+
+static void PutU32(vector<uint8_t>& v, uint32_t x) {
+	PutU16(v, x >> 16);
+	PutU16(v, x & 0xFFFF);
+}
+
+static vector<uint8_t> MalformedFont() {
+	const uint32_t Glyphs = 10, Components = 10;
+	vector<uint8_t> head(54), hhea(36), maxp(6), cmap, hmtx(Glyphs * 4), loca, glyf;
+	head[18] = 0x04;    // unitsPerEm 1024
+	hhea[35] = (uint8_t)Glyphs;
+	maxp[5] = (uint8_t)Glyphs;
+
+	PutU16(cmap, 0);
+	PutU16(cmap, 1);
+	PutU16(cmap, 3);
+	PutU16(cmap, 10);
+	PutU32(cmap, 12);
+	PutU16(cmap, 12);
+	PutU16(cmap, 0);
+	PutU32(cmap, 16 + 2 * 12);
+	PutU32(cmap, 0);
+	PutU32(cmap, 0xFFFFFFFF);
+	uint32_t groups[3][3] = { { 'A', 'A', 9 }, { 0x10000, 0x10000, 1 }, { 0, 0x10FFFF, 1 } };
+	for (auto& g : groups) {
+		for (uint32_t x : g) PutU32(cmap, x);
+	}
+
+	// 0 是空的 .notdef, 1 是一個三角形
+	PutU16(loca, 0);
+	PutU16(loca, 0);
+	uint8_t triangle[] = { 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 1, 1, 0, 0, 0, 100, 0xFF, 0xCE, 0, 0, 0, 0, 0, 100, 0 };
+	glyf.insert(glyf.end(), triangle, triangle + sizeof(triangle));
+	PutU16(loca, (uint32_t)glyf.size() / 2);
+	for (uint32_t g = 2; g < Glyphs; g++) {
+		PutU16(glyf, 0xFFFF);
+		glyf.insert(glyf.end(), 8, 0);
+		for (uint32_t i = 0; i < Components; i++) {
+			PutU16(glyf, 0x0003 | (i + 1 < Components ? 0x0020 : 0));
+			PutU16(glyf, g - 1);
+			PutU16(glyf, i);
+			PutU16(glyf, 0);
+		}
+		PutU16(loca, (uint32_t)glyf.size() / 2);
+	}
+
+	const char* tags[] = { "head", "hhea", "maxp", "cmap", "hmtx", "loca", "glyf" };
+	vector<uint8_t>* tables[] = { &head, &hhea, &maxp, &cmap, &hmtx, &loca, &glyf };
+	vector<uint8_t> font;
+	PutU32(font, 0x00010000);
+	PutU16(font, 7);
+	font.insert(font.end(), 6, 0);
+	uint32_t offset = 12 + 7 * 16;
+	for (int i = 0; i < 7; i++) {
+		font.insert(font.end(), tags[i], tags[i] + 4);
+		PutU32(font, 0);
+		PutU32(font, offset);
+		PutU32(font, (uint32_t)tables[i]->size());
+		offset += (uint32_t)tables[i]->size();
+	}
+	for (auto* t : tables) font.insert(font.end(), t->begin(), t->end());
+	return font;
+}
+
+static void TestMalformedFont() {
+	vector<uint8_t> data = MalformedFont();
+	TrueTypeFont font;
+	if (!font.Load(data.data(), data.size())) {
+		Fail("malformed: the test font did not load");
+		return;
+	}
+
+	auto t0 = chrono::steady_clock::now();
+	vector<uint32_t> characters;
+	font.GetCharacters(&characters);
+	if (characters != vector<uint32_t>({ 'A', 0x10000 })) Fail("malformed: cmap groups past the subtable length were read");
+	if (font.FindGlyph('B') || font.FindGlyph('A') != 9) Fail("malformed: FindGlyph used groups past the subtable length");
+
+	GlyphOutline outline;
+	font.GetOutline(9, &outline);
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+	if (outline.Empty() || outline.segments.size() > 1024 * 3) Fail("malformed: the composite glyph was not capped by its component count");
+	printf("malformed: 0xFFFFFFFF cmap groups and a 10^8-component glyph in %.2f ms (%zu segments)\n", ms, outline.segments.size());
+}
+
+// 架子的配置: 一排排一樣高的字形, 放滿後換成比任何架子都高的字形, 要換掉舊字形合併出夠高的空間; 全都是本幀用過的才需要加高
+static void TestShelves() {
+	GlyphAtlasCache atlas(64, 64, Padding);
+	for (uint32_t key = 0; key < 36; key++) {
+		if (atlas.Insert(key, 8, 8) < 0) Fail("shelves: glyphs of the same height do not fill the atlas");
+	}
+	if (atlas.ShelfCount() != 6 || atlas.UsedHeight() != 60) Fail("shelves: a shelf is not as tall as its glyphs");
+	atlas.NextFrame();
+
+	int tall = atlas.Insert(100, 8, 30);
+	if (tall < 0 || atlas[tall].y + 30 + Padding > atlas.Height()) Fail("shelves: emptied shelves were not merged for a taller glyph");
+	if (atlas.Insert(101, 8, 40) >= 0) Fail("shelves: a glyph used this frame was replaced");
+	atlas.Grow(128);
+	int grown = atlas.Insert(101, 8, 40);
+	if (grown < 0 || atlas[grown].y + 40 + Padding > atlas.Height() || atlas[tall].y != Padding) Fail("shelves: the grown atlas did not take the glyph");
+}
+
+// 跟 SpriteFont::Impl 的動態字形一樣, 只是上傳到 CPU 上的圖集
+struct DynamicFont {
+	// D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION
+	static const int MaxHeight = 16384;
+
+	const TrueTypeFont& font;
+	float scale;
+	int maxGlyphHeight;
+	GlyphAtlasCache atlas;
+	GlyphRasterizer rasterizer;
+	GlyphOutline outline;
+	vector<uint8_t> coverage;
+	vector<uint8_t> image;
+	double rasterizeUs = 0;
+	size_t rasterized = 0;
+
+	DynamicFont(const TrueTypeFont& font, float pixelSize, int atlasSize) :
+		font(font), scale(pixelSize / font.UnitsPerEm()),
+		maxGlyphHeight((int)(ceil(font.YMax() * scale) - floor(font.YMin() * scale))),
+		atlas(atlasSize, atlasSize, Padding),
+		image((size_t)atlasSize * atlasSize) {}
+
+	// 高度加倍, 原本的點陣留在原位 (一列一列存, 直接接在後面)
+	bool Grow() {
+		if (atlas.Height() >= MaxHeight) return false;
+		int height = min(atlas.Height() * 2, MaxHeight);
+		image.resize((size_t)atlas.Width() * height);
+		atlas.Grow(height);
+		return true;
+	}
+
+	// 回傳 entry id, 圖集已經最大還放不下是 -1
+	int Find(uint32_t codepoint) {
+		uint32_t glyph = font.FindGlyph(codepoint);
+		int id = atlas.Find(glyph);
+		if (id >= 0) return id;
+
+		auto t0 = chrono::steady_clock::now();
+		font.GetOutline(glyph, &outline);
+		auto b = GlyphRasterizer::Measure(outline, scale);
+		b.width = min(b.width, atlas.Width() - Padding * 2);
+		b.height = min(b.height, maxGlyphHeight);
+		id = atlas.Insert(glyph, b.width, b.height);
+		while (id < 0 && Grow()) id = atlas.Insert(glyph, b.width, b.height);
+		if (id < 0) return -1;
+		const auto& e = atlas[id];
+		if (e.width) {
+			coverage.resize((size_t)e.width * e.height);
+			rasterizer.Rasterize(outline, scale, b, coverage.data(), e.width);
+			for (int y = -Padding; y < e.height + Padding; y++) {
+				uint8_t* row = &image[(size_t)(e.y + y) * atlas.Width() + e.x];
+				for (int x = -Padding; x < e.width + Padding; x++) {
+					bool inside = x >= 0 && y >= 0 && x < e.width && y < e.height;
+					row[x] = inside ? coverage[y * e.width + x] : 0;
+				}
+			}
+		}
+		rasterizeUs += chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count();
+		rasterized++;
+		return id;
+	}
+
+	// 活著的字形不重疊, 而且圖集裡的點陣 (含邊框) 跟重新點陣化的一樣
+	bool Verify() {
+		vector<int> owner(image.size(), -1);
+		for (size_t id = 0; id < atlas.Size(); id++) {
+			const auto& e = atlas[(int)id];
+			if (!e.live || !e.width) continue;
+			if (e.x < Padding || e.y < Padding || e.x + e.width + Padding > atlas.Width() || e.y + e.height + Padding > atlas.Height()) return false;
+			font.GetOutline(e.key, &outline);
+			auto b = GlyphRasterizer::Measure(outline, scale);
+			b.width = e.width;
+			b.height = e.height;
+			coverage.resize((size_t)e.width * e.height);
+			rasterizer.Rasterize(outline, scale, b, coverage.data(), e.width);
+			for (int y = -Padding; y < e.height + Padding; y++) {
+				for (int x = -Padding; x < e.width + Padding; x++) {
+					size_t i = (size_t)(e.y + y) * atlas.Width() + e.x + x;
+					if (owner[i] >= 0) return false;
+					owner[i] = (int)id;
+					bool inside = x >= 0 && y >= 0 && x < e.width && y < e.height;
+					if (image[i] != (inside ? coverage[y * e.width + x] : 0)) return false;
+				}
+			}
+		}
+		return true;
+	}
+};
+
+// 整個字集用 skyline 預先擺進一張方形圖集 (2 的次方), 回傳邊長
+static int BakedAtlasSize(const TrueTypeFont& font, float pixelSize, const vector<uint32_t>& glyphs) {
+	float scale = pixelSize / font.UnitsPerEm();
+	GlyphOutline outline;
+	vector<pair<int, int>> sizes;
+	for (uint32_t g : glyphs) {
+		font.GetOutline(g, &outline);
+		auto b = GlyphRasterizer::Measure(outline, scale);
+		if (b.width) sizes.push_back({ b.height + Padding * 2, b.width + Padding * 2 });
+	}
+	sort(sizes.rbegin(), sizes.rend());
+	for (int size = 64; size <= 16384; size *= 2) {
+		SkylinePacker packer(size, size);
+		bool fits = true;
+		int x, y;
+		for (auto& s : sizes) {
+			if (!packer.Insert(s.second, s.first, &x, &y)) { fits = false; break; }
+		}
+		if (fits) return size;
+	}
+	return 0;
+}
+
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s font.ttf [pixelSize] [atlasSize] [frames]\n", argv[0]);
+		return 2;
+	}
+	float pixelSize = argc > 2 ? (float)atof(argv[2]) : 32;
+	int atlasSize = argc > 3 ? atoi(argv[3]) : 512;
+	int frames = argc > 4 ? atoi(argv[4]) : 300;
+	if (pixelSize < 4) pixelSize = 4;
+	if (atlasSize < 128) atlasSize = 128;
+	if (frames <= 0) frames = 1;
+
+	vector<uint8_t> data;
+	if (FILE* f = fopen(argv[1], "rb")) {
+		uint8_t buffer[65536];
+		size_t n;
+		while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) data.insert(data.end(), buffer, buffer + n);
+		fclose(f);
+	}
+	TrueTypeFont font;
+	if (!font.Load(data.data(), data.size())) {
+		fprintf(stderr, "%s is not a TrueType font with glyf outlines\n", argv[1]);
+		return 1;
+	}
+
+	TestUtf8();
+	BenchUtf8();
+	TestRasterizer(font, pixelSize);
+	TestMalformedFont();
+	TestShelves();
+
+	// 字型裡有的字元, 跟對應的字形
+	vector<uint32_t> charset, glyphs;
+	for (uint32_t c = 32; c <= 0x10FFFF; c++) {
+		uint32_t g = font.FindGlyph(c);
+		if (g) {
+			charset.push_back(c);
+			glyphs.push_back(g);
+		}
+	}
+	sort(glyphs.begin(), glyphs.end());
+	glyphs.erase(unique(glyphs.begin(), glyphs.end()), glyphs.end());
+
+	// 每個字形都點陣化一次: 不能當掉, 覆蓋率不會寫出邊界 (用 -fsanitize=address 跑)
+	{
+		float scale = pixelSize / font.UnitsPerEm();
+		GlyphRasterizer rasterizer;
+		GlyphOutline outline;
+		vector<uint8_t> c;
+		auto t0 = chrono::steady_clock::now();
+		for (uint32_t g = 0; g < font.GlyphCount(); g++) {
+			font.GetOutline(g, &outline);
+			auto b = GlyphRasterizer::Measure(outline, scale);
+			c.resize((size_t)b.width * b.height);
+			if (b.width) rasterizer.Rasterize(outline, scale, b, c.data(), b.width);
+		}
+		double us = chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count();
+		printf("font: %u glyphs, %zu characters, %.0f px: outline + rasterize %.1f us/glyph\n", font.GlyphCount(), charset.size(), pixelSize, us / font.GlyphCount());
+	}
+
+	// 聊天視窗: 40 行 x 48 字, 每幀捲動 2 行; 字元照 Zipf 分布從字集裡挑, 常用的字排前面
+	DynamicFont dynamic(font, pixelSize, atlasSize);
+	mt19937 random(6789);
+	vector<double> weights(charset.size());
+	for (size_t i = 0; i < weights.size(); i++) weights[i] = 1.0 / pow((double)(i + 1), 0.9);
+	shuffle(charset.begin(), charset.end(), random);
+	discrete_distribution<size_t> pick(weights.begin(), weights.end());
+	const int Lines = 40, Columns = 48;
+	vector<vector<uint32_t>> screen;
+	auto newLine = [&]() {
+		vector<uint32_t> line(Columns);
+		for (auto& c : line) c = (random() % 6 == 0) ? ' ' : charset[pick(random)];
+		return line;
+	};
+	for (int i = 0; i < Lines; i++) screen.push_back(newLine());
+
+	size_t lookups = 0, overflows = 0;
+	double frameUs = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		screen.erase(screen.begin(), screen.begin() + 2);
+		screen.push_back(newLine());
+		screen.push_back(newLine());
+
+		vector<pair<int, GlyphAtlasCache::Entry>> used;
+		auto t0 = chrono::steady_clock::now();
+		for (auto& line : screen) {
+			for (uint32_t c : line) {
+				int id = dynamic.Find(c);
+				lookups++;
+				if (id < 0) overflows++;
+				else used.push_back({ id, dynamic.atlas[id] });
+			}
+		}
+		frameUs += chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count();
+
+		// 本幀用過的字形到幀尾都還在原位
+		for (auto& u : used) {
+			const auto& e = dynamic.atlas[u.first];
+			if (!e.live || e.key != u.second.key || e.x != u.second.x || e.y != u.second.y) {
+				Fail("atlas: a glyph used this frame was replaced");
+				break;
+			}
+		}
+		dynamic.atlas.NextFrame();
+	}
+	if (!dynamic.Verify()) Fail("atlas: live glyphs overlap or their texels were overwritten");
+	if (overflows) Fail("atlas: characters did not fit even after growing the atlas");
+
+	auto stats = dynamic.atlas.GetStatistics();
+	size_t atlasBytes = (size_t)dynamic.atlas.Width() * dynamic.atlas.Height() * 4;
+	int baked = BakedAtlasSize(font, pixelSize, glyphs);
+	size_t bakedBytes = (size_t)baked * baked * 4;
+	printf("chat: %d frames of %dx%d characters, %dx%d atlas grown to %dx%d, %zu shelves in %d px\n", frames, Lines, Columns, atlasSize, atlasSize,
+		dynamic.atlas.Width(), dynamic.atlas.Height(), dynamic.atlas.ShelfCount(), dynamic.atlas.UsedHeight());
+	printf("  %.1f us/frame, %.0f ns/character   (%zu rasterized, %.1f us each)\n", frameUs / frames, frameUs * 1000 / lookups,
+		dynamic.rasterized, dynamic.rasterizeUs / max<size_t>(dynamic.rasterized, 1));
+	printf("  hits %zu  misses %zu (%.2f%% hit)  evictions %zu  resident %zu  no room %zu\n", stats.Hits, stats.Misses,
+		100.0 * stats.Hits / max<size_t>(stats.Hits + stats.Misses, 1), stats.Evictions, stats.Glyphs, overflows);
+	printf("memory: whole character set baked %dx%d = %.1f MB, dynamic atlas %.1f MB\n", baked, baked, bakedBytes / 1048576.0, atlasBytes / 1048576.0);
+
+	return ExitCode();
+}
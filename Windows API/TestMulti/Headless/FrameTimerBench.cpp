@@ -0,0 +1,194 @@
+// 用假的時鐘測試 FrameTimer 的固定時間步長, 以及每一步只處理屬於自己的 InputRing 事件
+//
+//   g++ -std=c++14 -O2 -I../Sample/Include FrameTimerBench.cpp -o frametimerbench
+//   ./frametimerbench [frames]
+//
+// 模擬 DirectXPanel::Run 的固定時間步長模式: 幀長度亂數變動, 偶爾卡頓超過 MaxStepsPerFrame
+// 每個事件都要在時間包含它的那一步被處理, 還沒到的事件要留在佇列裡
+// 畫面只在最後一步的前後狀態之間內插, 一幀跑好幾步時也不能倒退
+// 另外檢查 FrameHistogram 的百分位數, 並量 Tick 的成本; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "FrameTimer.h"
+#include "InputRing.h"
+
+using namespace MyGame;
+
+// 1 tick = 1 微秒
+class FakeClock : public FrameClock {
+public:
+	int64_t Now() override {
+		return now;
+	}
+
+	int64_t Frequency() override {
+		return 1000000;
+	}
+
+	int64_t now = 1000;
+};
+
+static const uint32_t KeyDown = 0x0100; // WM_KEYDOWN
+
+static void TestSteps() {
+	FakeClock clock;
+	FrameTimer timer(clock, 1.0 / 60.0);
+
+	clock.now += 10000;
+	if (timer.Tick() != 0) Fail("steps: a 10 ms frame ran a 16.7 ms step");
+	clock.now += 10000;
+	if (timer.Tick() != 1) Fail("steps: 20 ms of accumulated time did not run one step");
+	if (fabs(timer.Alpha() - (0.020 - 1.0 / 60.0) * 60.0) > 1e-6) Fail("steps: alpha is not the leftover fraction of a step");
+
+	clock.now += 50000;
+	int steps = timer.Tick();
+	if (steps != 3) Fail("steps: 50 ms did not run three steps");
+	// 最後一步結束在 now - 剩下的時間, 之前每一步間隔一個 step
+	if (timer.StepEnd(steps - 1) != clock.now - (int64_t)(timer.Alpha() * timer.Step() * 1e6)) Fail("steps: the last step does not end at now minus the remainder");
+	for (int i = 1; i < steps; i++) {
+		if (llabs(timer.StepEnd(i) - timer.StepEnd(i - 1) - 16667) > 1) Fail("steps: step ends are not one step apart");
+	}
+
+	// 卡頓: 最多補 MaxStepsPerFrame 步, 丟掉的時間算在最後一步, 之後不再落後
+	clock.now += 1000000;
+	steps = timer.Tick();
+	if (steps != FrameTimer::MaxStepsPerFrame) Fail("hitch: steps were not clamped");
+	if (timer.StepEnd(steps - 1) != clock.now) Fail("hitch: the last clamped step does not end now");
+	if (timer.Alpha() != 0.0) Fail("hitch: the dropped time was carried into the next frame");
+	clock.now += 16667;
+	if (timer.Tick() != 1) Fail("hitch: the frame after a hitch is still catching up");
+}
+
+// DirectXPanel::Run 的固定時間步長迴圈, state 代表 world, 每個按鍵把 state 加上 wParam
+static void TestInputSteps(int frames) {
+	FakeClock clock;
+	FrameTimer timer(clock, 1.0 / 60.0);
+	static InputRing input;
+	mt19937 random(99);
+
+	struct Posted {
+		int64_t Timestamp;
+		int64_t HandledStepEnd;
+		int64_t HandledStepBegin;
+	};
+	vector<Posted> posted;
+	int64_t state = 0;
+	int64_t lastStepEnd = clock.now;
+	bool misplaced = false;
+
+	for (int frame = 0; frame < frames; frame++) {
+		// 這一幀期間 WndProc 收到的按鍵, 時間落在上一幀與這一幀之間
+		int64_t frameBegin = clock.now;
+		int64_t length = random() % 20 == 0 ? 100000 + random() % 200000 : 4000 + random() % 30000;
+		int events = random() % 6;
+		vector<int64_t> times;
+		for (int e = 0; e < events; e++) times.push_back(frameBegin + 1 + random() % length);
+		sort(times.begin(), times.end());
+		for (int64_t t : times) {
+			if (!input.Post(KeyDown, posted.size(), t, t)) Fail("input: ring full");
+			posted.push_back({ t, -1, -1 });
+		}
+		clock.now = frameBegin + length;
+
+		int steps = timer.Tick();
+		for (int i = 0; i < steps; i++) {
+			int64_t stepBegin = lastStepEnd, stepEnd = timer.StepEnd(i);
+			input.DrainUntil(stepEnd, [&](const InputEvent& e) {
+				posted[(size_t)e.wParam].HandledStepBegin = stepBegin;
+				posted[(size_t)e.wParam].HandledStepEnd = stepEnd;
+				state += (int64_t)e.wParam + 1;
+			});
+			lastStepEnd = stepEnd;
+		}
+	}
+
+	size_t handled = 0;
+	for (const Posted& p : posted) {
+		if (p.HandledStepEnd < 0) continue;
+		handled++;
+		if (p.Timestamp <= p.HandledStepBegin || p.Timestamp > p.HandledStepEnd) misplaced = true;
+	}
+	// 還沒處理的事件只能是最後一步之後才送來的
+	for (const Posted& p : posted) {
+		if (p.HandledStepEnd < 0 && p.Timestamp <= lastStepEnd) misplaced = true;
+	}
+	if (misplaced) Fail("input: an event was handled in a step that does not contain its timestamp");
+	if (handled == 0) Fail("input: no events were handled");
+	printf("input: %zu of %zu events handled in the step containing their timestamp\n", handled, posted.size());
+}
+
+// Run 的內插: 每一步前進 1, 上一個狀態在每一步之前記下
+// 畫出來的位置要剛好比模擬落後一步 (已模擬的步數 - 1 + alpha), 追趕好幾步的幀也一樣, 所以不會倒退或跳動
+static void TestInterpolation(int frames) {
+	FakeClock clock;
+	FrameTimer timer(clock, 1.0 / 60.0);
+	mt19937 random(7);
+	double previous = 0, current = 0, lastRendered = 0;
+	int64_t simulated = 0;
+	bool off = false, backwards = false;
+
+	for (int frame = 0; frame < frames; frame++) {
+		clock.now += random() % 20 == 0 ? 30000 + random() % 40000 : 4000 + random() % 30000;
+		int steps = timer.Tick();
+		for (int i = 0; i < steps; i++) {
+			previous = current;
+			current += 1;
+			simulated++;
+		}
+		if (simulated == 0) continue;
+		double alpha = timer.Alpha();
+		double rendered = previous + (current - previous) * alpha;
+		if (fabs(rendered - (simulated - 1 + alpha)) > 1e-9) off = true;
+		if (rendered < lastRendered) backwards = true;
+		lastRendered = rendered;
+	}
+	if (off) Fail("interpolation: a catch-up frame did not interpolate across the last step only");
+	if (backwards) Fail("interpolation: the rendered state moved backwards");
+}
+
+static void TestHistogram() {
+	FrameHistogram h;
+	// 1 ~ 100 ms 各一幀
+	for (int i = 1; i <= 100; i++) h.Record(i);
+	if (h.Count() != 100) Fail("histogram: wrong count");
+	if (fabs(h.Mean() - 50.5) > 1e-9) Fail("histogram: wrong mean");
+	if (fabs(h.Percentile(50.0) - 50.05) > 1e-9) Fail("histogram: wrong p50");
+	if (fabs(h.Percentile(99.0) - 99.05) > 1e-9) Fail("histogram: wrong p99");
+	if (h.Percentile(100.0) != 100.0 || h.Max() != 100.0) Fail("histogram: max is not capped at the largest frame");
+	h.Reset();
+	if (h.Count() != 0 || h.Percentile(50.0) != 0.0) Fail("histogram: reset left data behind");
+}
+
+int main(int argc, char* argv[]) {
+	int frames = argc > 1 ? atoi(argv[1]) : 100000;
+	if (frames <= 0) frames = 1;
+
+	TestSteps();
+	TestInputSteps(frames);
+	TestInterpolation(frames);
+	TestHistogram();
+
+	// Tick 每一幀都會呼叫, 量一次的成本
+	FakeClock clock;
+	FrameTimer timer(clock, 1.0 / 60.0);
+	int total = 0;
+	auto begin = chrono::steady_clock::now();
+	for (int i = 0; i < frames; i++) {
+		clock.now += 16000 + i % 1500;
+		total += timer.Tick();
+	}
+	auto end = chrono::steady_clock::now();
+	printf("Tick: %.1f ns/frame (%d steps)\n", chrono::duration<double, nano>(end - begin).count() / frames, total);
+
+	return ExitCode();
+}
@@ -0,0 +1,130 @@
+// SpriteFont 的 FindGlyph: GlyphIndex (整頁直接查表 + 完美雜湊) 跟原本 lower_bound 二分搜尋比較
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Src GlyphLookupBench.cpp -o glyphlookupbench
+//   ./glyphlookupbench [characters]
+//
+// 字型: 只有 ASCII, ASCII + Latin-1, ASCII + 常用中文 (含標點與全形), 以及零散的符號 (全部走雜湊)
+// 文字: 從字型裡的字元隨機挑, 夾雜一些字型沒有的字元 (走預設字元)
+// 0 ~ 0x10FFFF 每個 codepoint 兩種查法的結果都要相同, 否則回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "GlyphIndex.h"
+
+using namespace DirectX;
+
+static const uint32_t NotFound = GlyphIndex::NotFound;
+
+// 原本的 FindGlyph: 在排序好的 Character 上 lower_bound
+static uint32_t BinarySearch(const vector<uint32_t>& characters, uint32_t character) {
+	auto it = lower_bound(characters.begin(), characters.end(), character);
+	if (it != characters.end() && *it == character) return (uint32_t)(it - characters.begin());
+	return NotFound;
+}
+
+struct Font {
+	const char* Name;
+	vector<uint32_t> Characters;
+};
+
+static void AddRange(vector<uint32_t>& characters, uint32_t first, uint32_t last) {
+	for (uint32_t c = first; c <= last; c++) characters.push_back(c);
+}
+
+static Font MakeFont(const char* name, vector<uint32_t> characters) {
+	sort(characters.begin(), characters.end());
+	characters.erase(unique(characters.begin(), characters.end()), characters.end());
+	return { name, characters };
+}
+
+int main(int argc, char* argv[]) {
+	size_t length = argc > 1 ? (size_t)atol(argv[1]) : 1000000;
+	if (length == 0) length = 1;
+
+	mt19937 random(12345);
+	vector<Font> fonts;
+	{
+		vector<uint32_t> c;
+		AddRange(c, 32, 126);
+		fonts.push_back(MakeFont("ascii", c));
+		AddRange(c, 160, 255);
+		fonts.push_back(MakeFont("latin-1", c));
+		// 常用字 3500 個, 散在 CJK 統一表意文字區
+		AddRange(c, 0x3000, 0x303F);
+		AddRange(c, 0xFF01, 0xFF5E);
+		for (int i = 0; i < 3500; i++) c.push_back(0x4E00 + random() % (0x9FFF - 0x4E00 + 1));
+		fonts.push_back(MakeFont("cjk", c));
+	}
+	{
+		// 每頁都不到 16 個的零散符號
+		vector<uint32_t> c;
+		for (uint32_t page = 0x20; page < 0x2F; page++) {
+			for (int i = 0; i < 12; i++) c.push_back((page << 8) + random() % 256);
+		}
+		c.push_back(0x1F600);
+		c.push_back(0x1F44D);
+		fonts.push_back(MakeFont("symbols", c));
+	}
+
+	printf("%zu characters per run\n", length);
+	printf("%-8s %7s %9s %12s %12s %8s\n", "font", "glyphs", "index KB", "lower_bound", "GlyphIndex", "speedup");
+	for (const Font& font : fonts) {
+		GlyphIndex index;
+		auto b0 = chrono::steady_clock::now();
+		index.Build(font.Characters.data(), font.Characters.size());
+		double buildUs = chrono::duration<double, micro>(chrono::steady_clock::now() - b0).count();
+
+		for (uint32_t c = 0; c <= GlyphIndex::MaxCodepoint; c++) {
+			if (index.Find(c) != BinarySearch(font.Characters, c)) {
+				fprintf(stderr, "%s: U+%04X found differently\n", font.Name, c);
+				ok = false;
+				break;
+			}
+		}
+		if (index.Find(0xFFFFFFFE) != NotFound) Fail("a codepoint past MaxCodepoint was found");
+
+		// 96% 是字型裡的字, 其餘是字型沒有的
+		vector<uint32_t> text(length);
+		for (uint32_t& c : text) {
+			c = (random() % 25) ? font.Characters[random() % font.Characters.size()] : (uint32_t)(random() % 0x10000);
+		}
+
+		uint64_t sum = 0;
+		auto t0 = chrono::steady_clock::now();
+		for (uint32_t c : text) sum += BinarySearch(font.Characters, c);
+		auto t1 = chrono::steady_clock::now();
+		for (uint32_t c : text) sum -= index.Find(c);
+		auto t2 = chrono::steady_clock::now();
+		if (sum != 0) {
+			fprintf(stderr, "%s: lookups over the text disagree\n", font.Name);
+			ok = false;
+		}
+
+		double searchNs = chrono::duration<double, nano>(t1 - t0).count() / length;
+		double indexNs = chrono::duration<double, nano>(t2 - t1).count() / length;
+		printf("%-8s %7zu %9.1f %9.2f ns %9.2f ns %7.1fx   (built in %.0f us)\n", font.Name, font.Characters.size(), index.MemorySize() / 1024.0,
+			searchNs, indexNs, searchNs / indexNs, buildUs);
+	}
+
+	// 重複的 codepoint: 跟 lower_bound 一樣回傳第一個
+	{
+		vector<uint32_t> c = { 'A', 'A', 'B', 0x2603, 0x2603, 0x2604 };
+		GlyphIndex index;
+		index.Build(c.data(), c.size());
+		if (index.Find('A') != 0 || index.Find('B') != 2 || index.Find(0x2603) != 3 || index.Find(0x2604) != 5) {
+			fprintf(stderr, "repeated codepoints do not resolve to the first glyph\n");
+			ok = false;
+		}
+	}
+
+	return ExitCode();
+}
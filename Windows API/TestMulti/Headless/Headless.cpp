@@ -0,0 +1,112 @@
+// 不需要 Windows 與 GPU, 用 NullRenderDevice 跑 FramePipeline 的 update / record / submit 並計時
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include Headless.cpp -o headless
+//   ./headless [frames] [draws] [contexts] [ring]
+//
+// ring = 0 時每個 draw 用 UpdateBuffer 更新常量緩衝區, 否則每個區間寫進自己的 DynamicConstant buffer
+//
+// 輸出每幀時間的 p50 / p95 / p99 / max 與送出的指令統計
+// 多執行緒錄製的 StreamHash 必須跟單執行緒相同, 否則回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "NullRenderDevice.h"
+#include "FramePipeline.h"
+
+using namespace MyGame;
+
+struct HeadlessResult {
+	NullDeviceStats Stats;
+	vector<double> FrameTimes;	// 微秒
+};
+
+static HeadlessResult RunFrames(int frames, int draws, int contexts, bool parallel, bool ring) {
+	NullRenderDevice device;
+	device.ConstantOffsets = ring;
+	FramePipeline pipeline(device);
+
+	// 跟 DirectXPanel::PreparePipeline 相同的資料量
+	float vertices[4 * 10] = {};
+	uint32_t indices[] = { 0, 1, 2, 1, 3, 2 };
+	pipeline.VertexBuffer = device.CreateBuffer(BufferType::Vertex, sizeof(vertices), vertices);
+	pipeline.VertexStride = sizeof(float) * 10;
+	pipeline.IndexBuffer = device.CreateBuffer(BufferType::Index, sizeof(indices), indices);
+	pipeline.ConstantBuffer = device.CreateBuffer(BufferType::Constant, sizeof(Float4x4), nullptr);
+	pipeline.Shader = device.CreateShader(nullptr, 0, nullptr, 0, nullptr, 0);
+	unique_ptr<RenderTexture> texture = device.CreateTexture(128, 128, nullptr);
+	pipeline.Texture = texture.get();
+
+	for (int i = 0; i < draws; i++) {
+		pipeline.DrawList.push_back({ Float4x4::Translation((float)(i % 64), (float)(i / 64), 0), 6, 0, 0 });
+	}
+	pipeline.Initialize(contexts, parallel);
+
+	HeadlessResult result;
+	result.FrameTimes.reserve(frames);
+	const float color[4] = { 47 / 255.0f, 51 / 255.0f, 61 / 255.0f, 1.0f };
+	Float4x4 viewProjection = Float4x4::Identity();
+	for (int frame = 0; frame < frames; frame++) {
+		auto begin = chrono::steady_clock::now();
+		Float4x4 world = Float4x4::Translation((float)frame, 0, 0);
+		pipeline.Render(world, viewProjection, color);
+		device.Present(false);
+		auto end = chrono::steady_clock::now();
+		result.FrameTimes.push_back(chrono::duration<double, micro>(end - begin).count());
+	}
+	pipeline.Shutdown();
+
+	result.Stats = device.Stats;
+	return result;
+}
+
+static void Report(const char* name, HeadlessResult& r) {
+	vector<double>& t = r.FrameTimes;
+	sort(t.begin(), t.end());
+	auto percentile = [&](double p) {
+		if (t.empty()) return 0.0;
+		size_t i = (size_t)(p * (t.size() - 1));
+		return t[i];
+	};
+	double total = 0;
+	for (double v : t) total += v;
+
+	printf("%-8s frames=%zu mean=%.2fus p50=%.2fus p95=%.2fus p99=%.2fus max=%.2fus\n",
+		name, t.size(), t.empty() ? 0.0 : total / t.size(),
+		percentile(0.50), percentile(0.95), percentile(0.99), t.empty() ? 0.0 : t.back());
+	printf("%-8s draws=%llu indices=%llu updates=%llu bytes=%llu states=%llu lists=%llu presents=%llu hash=%016llx\n",
+		name,
+		(unsigned long long)r.Stats.Draws,
+		(unsigned long long)r.Stats.Indices,
+		(unsigned long long)r.Stats.BufferUpdates,
+		(unsigned long long)r.Stats.BytesUploaded,
+		(unsigned long long)r.Stats.StateChanges,
+		(unsigned long long)r.Stats.CommandLists,
+		(unsigned long long)r.Stats.Presents,
+		(unsigned long long)r.Stats.StreamHash);
+}
+
+int main(int argc, char* argv[]) {
+	int frames = argc > 1 ? atoi(argv[1]) : 1000;
+	int draws = argc > 2 ? atoi(argv[2]) : 2;
+	int contexts = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+	bool ring = argc > 4 ? atoi(argv[4]) != 0 : true;
+	if (contexts <= 0) contexts = 1;
+
+	HeadlessResult serial = RunFrames(frames, draws, contexts, false, ring);
+	HeadlessResult parallel = RunFrames(frames, draws, contexts, true, ring);
+	Report("serial", serial);
+	Report("parallel", parallel);
+
+	if (serial.Stats.StreamHash != parallel.Stats.StreamHash) Fail("command stream mismatch between serial and parallel recording");
+	return ExitCode();
+}
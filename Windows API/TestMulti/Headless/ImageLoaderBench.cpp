@@ -0,0 +1,239 @@
+// ImageLoader 的讀檔 + 解碼吞吐量: 跟在一條執行緒上依序讀檔解碼比較, 並檢查 DecodeBitmap 的各種格式
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include ImageLoaderBench.cpp -o imageloaderbench
+//   ./imageloaderbench [images] [size] [maxThreads]
+//
+// 在暫存目錄寫 images 張 size x size 的 BMP, 用 NullRenderDevice 上傳, 解碼執行緒數從 1 加倍到 maxThreads
+// 每一張都要成功, 解出來的像素要跟寫進去的一樣; 取消與讀檔失敗要回報對的狀態
+// BI_BITFIELDS 要依照遮罩解碼, 不連續的遮罩與高度 INT32_MIN 要拒絕; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+
+#include "Check.h"
+#include "NullRenderDevice.h"
+#include "ImageLoader.h"
+
+using namespace MyGame;
+
+static void Put32(vector<uint8_t>& file, size_t offset, uint32_t value) {
+	for (int i = 0; i < 4; i++) file[offset + i] = (uint8_t)(value >> (8 * i));
+}
+
+// BITMAPINFOHEADER (40 bytes) 或 BITMAPV4HEADER (108 bytes), 像素由呼叫端填
+static vector<uint8_t> MakeBitmap(int32_t width, int32_t height, uint32_t bpp, uint32_t compression, uint32_t headerSize) {
+	uint32_t rows = (uint32_t)(height < 0 ? -(int64_t)height : height);
+	size_t pitch = ((size_t)width * bpp / 8 + 3) & ~(size_t)3;
+	size_t offset = 14 + headerSize + (compression == 3 && headerSize == 40 ? 12 : 0);
+	vector<uint8_t> file(offset + pitch * rows);
+	file[0] = 'B';
+	file[1] = 'M';
+	Put32(file, 2, (uint32_t)file.size());
+	Put32(file, 10, (uint32_t)offset);
+	Put32(file, 14, headerSize);
+	Put32(file, 18, (uint32_t)width);
+	Put32(file, 22, (uint32_t)height);
+	file[26] = 1;
+	file[28] = (uint8_t)bpp;
+	Put32(file, 30, compression);
+	return file;
+}
+
+// 第 (x, y) 個像素 (由上往下) 的顏色
+static void Pattern(uint32_t x, uint32_t y, uint32_t seed, uint8_t rgba[4]) {
+	rgba[0] = (uint8_t)(x * 3 + seed);
+	rgba[1] = (uint8_t)(y * 5 + seed);
+	rgba[2] = (uint8_t)(x ^ y);
+	rgba[3] = (uint8_t)(x + y * 7);
+}
+
+static vector<uint8_t> PatternBitmap(uint32_t size, uint32_t seed) {
+	vector<uint8_t> file = MakeBitmap((int32_t)size, (int32_t)size, 32, 0, 40);
+	size_t offset = file.size() - (size_t)size * size * 4;
+	for (uint32_t y = 0; y < size; y++) {
+		// 高度是正的, 所以最上面一列存在最後
+		uint8_t* row = file.data() + offset + (size_t)(size - 1 - y) * size * 4;
+		for (uint32_t x = 0; x < size; x++) {
+			uint8_t rgba[4];
+			Pattern(x, y, seed, rgba);
+			row[x * 4 + 0] = rgba[2];
+			row[x * 4 + 1] = rgba[1];
+			row[x * 4 + 2] = rgba[0];
+			row[x * 4 + 3] = rgba[3];
+		}
+	}
+	return file;
+}
+
+static bool MatchesPattern(const DecodedImage& image, uint32_t size, uint32_t seed) {
+	if (image.Width != size || image.Height != size) return false;
+	for (uint32_t y = 0; y < size; y++) {
+		for (uint32_t x = 0; x < size; x++) {
+			uint8_t rgba[4];
+			Pattern(x, y, seed, rgba);
+			if (memcmp(&image.Pixels[((size_t)y * size + x) * 4], rgba, 4) != 0) return false;
+		}
+	}
+	return true;
+}
+
+static void TestDecodeBitmap() {
+	DecodedImage image;
+
+	// 24 位元, 由上往下, 每列補到 4 bytes
+	vector<uint8_t> file = MakeBitmap(3, -2, 24, 0, 40);
+	for (size_t i = 54; i < file.size(); i++) file[i] = (uint8_t)i;
+	if (!DecodeBitmap(file.data(), file.size(), image) || image.Width != 3 || image.Height != 2) Fail("bmp: 24-bit top-down was rejected");
+	else if (image.Pixels[0] != 56 || image.Pixels[2] != 54 || image.Pixels[3] != 255 || image.Pixels[12] != 68) Fail("bmp: 24-bit pixels or row padding are wrong");
+
+	// BI_BITFIELDS, 40 bytes header 後面接三個遮罩: 10-10-10, 沒有 alpha
+	file = MakeBitmap(1, 1, 32, 3, 40);
+	Put32(file, 54, 0x3FF00000);
+	Put32(file, 58, 0x000FFC00);
+	Put32(file, 62, 0x000003FF);
+	Put32(file, 66, (1023u << 20) | (0u << 10) | 512u);
+	if (!DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: BI_BITFIELDS was rejected");
+	else if (image.Pixels[0] != 255 || image.Pixels[1] != 0 || image.Pixels[2] != 128 || image.Pixels[3] != 255) Fail("bmp: BI_BITFIELDS masks were not applied");
+
+	// BITMAPV4HEADER: 遮罩與 alpha 遮罩都在 header 裡, 這裡故意用 RGBA 而不是 BGRA 的順序
+	file = MakeBitmap(1, 1, 32, 3, 108);
+	Put32(file, 54, 0x000000FF);
+	Put32(file, 58, 0x0000FF00);
+	Put32(file, 62, 0x00FF0000);
+	Put32(file, 66, 0xFF000000);
+	Put32(file, 122, 0x80332211);
+	if (!DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: V4 BI_BITFIELDS was rejected");
+	else if (image.Pixels[0] != 0x11 || image.Pixels[1] != 0x22 || image.Pixels[2] != 0x33 || image.Pixels[3] != 0x80) Fail("bmp: V4 alpha mask was not applied");
+
+	Put32(file, 54, 0x000000F3);
+	if (DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: a non-contiguous mask was accepted");
+
+	file = MakeBitmap(1, 1, 24, 3, 40);
+	if (DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: 24-bit BI_BITFIELDS was accepted");
+
+	file = MakeBitmap(1, 1, 32, 0, 40);
+	Put32(file, 22, 0x80000000);
+	if (DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: height INT32_MIN was accepted");
+
+	// 宣稱的大小超過檔案
+	file = MakeBitmap(16, 16, 32, 0, 40);
+	Put32(file, 22, 0x7FFFFFFF);
+	if (DecodeBitmap(file.data(), file.size(), image)) Fail("bmp: pixel data past the end of the file was accepted");
+	if (DecodeBitmap(file.data(), 53, image)) Fail("bmp: a truncated header was accepted");
+}
+
+static bool WriteFile(const string& path, const vector<uint8_t>& data) {
+	FILE* stream = fopen(path.c_str(), "wb");
+	if (stream == nullptr) return false;
+	bool written = fwrite(data.data(), 1, data.size(), stream) == data.size();
+	return fclose(stream) == 0 && written;
+}
+
+int main(int argc, char* argv[]) {
+	int images = argc > 1 ? atoi(argv[1]) : 200;
+	uint32_t size = argc > 2 ? (uint32_t)atoi(argv[2]) : 512;
+	int maxThreads = argc > 3 ? atoi(argv[3]) : (int)max(4u, thread::hardware_concurrency());
+	if (images <= 0) images = 1;
+	if (size == 0) size = 1;
+	if (maxThreads <= 0) maxThreads = 1;
+
+	TestDecodeBitmap();
+
+	char directory[] = "/tmp/imageloaderbenchXXXXXX";
+	if (mkdtemp(directory) == nullptr) {
+		Fail("cannot create a temporary directory");
+		return 1;
+	}
+	vector<string> paths;
+	size_t bytes = 0;
+	for (int i = 0; i < images; i++) {
+		vector<uint8_t> file = PatternBitmap(size, (uint32_t)i);
+		paths.push_back(string(directory) + "/" + to_string(i) + ".bmp");
+		if (!WriteFile(paths.back(), file)) Fail("cannot write a test image");
+		bytes += file.size();
+	}
+	printf("%d images, %u x %u, %.1f MB\n", images, size, size, bytes / 1048576.0);
+
+	// 不經過 ImageLoader, 一條執行緒依序讀檔解碼; 檢查像素的時間不算在內
+	double serial = 0;
+	chrono::steady_clock::time_point begin;
+	for (int i = 0; i < images; i++) {
+		begin = chrono::steady_clock::now();
+		FILE* stream = fopen(paths[i].c_str(), "rb");
+		vector<uint8_t> data(bytes / images + 1);
+		size_t read = stream ? fread(data.data(), 1, data.size(), stream) : 0;
+		if (stream) fclose(stream);
+		DecodedImage image;
+		bool decoded = DecodeBitmap(data.data(), read, image);
+		serial += chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		if (!decoded || !MatchesPattern(image, size, (uint32_t)i)) Fail("serial: image decoded wrong");
+	}
+	printf("%-20s %9.2f ms %8.1f images/s %8.1f MB/s\n", "serial", serial, images * 1000.0 / serial, bytes / 1048.576 / serial);
+
+	for (int threads = 1; threads <= maxThreads; threads *= 2) {
+		NullRenderDevice device;
+		vector<char> verified(images, 0);
+		ImageLoader loader(device, [&](const uint8_t* data, size_t length, DecodedImage& image) {
+			return DecodeBitmap(data, length, image);
+		});
+		int completed = 0;
+
+		begin = chrono::steady_clock::now();
+		loader.Start(threads);
+		for (int i = 0; i < images; i++) {
+			loader.Load(paths[i], [&, i](ImageLoadResult& result) {
+				if (result.Status == ImageLoadStatus::Completed && result.Texture && result.Width == size && result.Height == size) completed++;
+				verified[i] = 1;
+			});
+		}
+		while (loader.Pending()) {
+			if (loader.Upload(images) == 0) this_thread::yield();
+		}
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		loader.Stop();
+
+		if (completed != images || count(verified.begin(), verified.end(), 1) != images) Fail("loader: not every image completed");
+		char name[32];
+		snprintf(name, sizeof(name), "%d decode threads", threads);
+		printf("%-20s %9.2f ms %8.1f images/s %8.1f MB/s %6.2fx\n", name, ms, images * 1000.0 / ms, bytes / 1048.576 / ms, serial / ms);
+	}
+
+	// 解碼結果要跟寫進去的一樣, 讀檔失敗與取消要回報對的狀態
+	{
+		NullRenderDevice device;
+		int mismatched = 0;
+		ImageLoader loader(device, [&](const uint8_t* data, size_t length, DecodedImage& image) {
+			if (!DecodeBitmap(data, length, image)) return false;
+			if (!MatchesPattern(image, size, 0)) mismatched++;
+			return true;
+		});
+		ImageLoadStatus missing = ImageLoadStatus::Completed, cancelled = ImageLoadStatus::Completed;
+		loader.Load(paths[0], nullptr);
+		loader.Load(string(directory) + "/missing.bmp", [&](ImageLoadResult& r) { missing = r.Status; });
+		uint64_t id = loader.Load(paths[0], [&](ImageLoadResult& r) { cancelled = r.Status; });
+		loader.Cancel(id);
+		loader.Start(2);
+		while (loader.Pending()) {
+			if (loader.Upload(8) == 0) this_thread::yield();
+		}
+		loader.Stop();
+		if (mismatched) Fail("loader: decoded pixels differ from the file");
+		if (missing != ImageLoadStatus::Failed) Fail("loader: a missing file was not reported as failed");
+		if (cancelled != ImageLoadStatus::Cancelled) Fail("loader: a cancelled load was not reported as cancelled");
+	}
+
+	for (const string& path : paths) unlink(path.c_str());
+	rmdir(directory);
+
+	return ExitCode();
+}
@@ -0,0 +1,137 @@
+// InputRing 的壓力測試: 一條執行緒當 WndProc 一直送, 另一條當 render thread 一直收
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include InputRingBench.cpp -o inputringbench
+//   ./inputringbench [events]
+//
+// SpscRing: 每個事件帶流水號, 收到的順序必須連續, 不可以遺失或重複, 並量吞吐量與 Push 到 Pop 的延遲
+// InputRing: 按鍵不可以遺失或亂序, 滑鼠移動可以合併, 但收到的座標只能往後, 最後一筆一定要收到
+// 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "InputRing.h"
+
+using namespace MyGame;
+
+static const uint32_t KeyDown = 0x0100; // WM_KEYDOWN
+
+static int64_t Now() {
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void TestSpscRing(uint64_t events) {
+	static SpscRing<InputEvent, 1024> ring;
+	vector<int64_t> latencies;
+	latencies.reserve((size_t)min<uint64_t>(events, 1 << 20));
+
+	auto begin = chrono::steady_clock::now();
+	thread producer([&] {
+		for (uint64_t i = 0; i < events; i++) {
+			InputEvent e = { KeyDown, i, 0, Now() };
+			while (!ring.Push(e)) this_thread::yield();
+		}
+	});
+
+	uint64_t expected = 0;
+	bool ordered = true;
+	while (expected < events) {
+		InputEvent e;
+		if (!ring.Pop(e)) {
+			this_thread::yield();
+			continue;
+		}
+		if (e.wParam != expected) ordered = false;
+		if (latencies.size() < latencies.capacity()) latencies.push_back(Now() - e.Timestamp);
+		expected++;
+	}
+	producer.join();
+	auto end = chrono::steady_clock::now();
+
+	if (!ordered) Fail("SpscRing: events arrived out of order or were lost");
+	if (!ring.Empty()) Fail("SpscRing: ring not empty after every event was popped");
+
+	sort(latencies.begin(), latencies.end());
+	auto percentile = [&](double p) { return latencies.empty() ? 0.0 : latencies[(size_t)(p * (latencies.size() - 1))] / 1000.0; };
+	double seconds = chrono::duration<double>(end - begin).count();
+	printf("SpscRing   %llu events  %8.2f M events/s  latency p50=%.2fus p99=%.2fus max=%.2fus\n",
+		(unsigned long long)events, events / seconds / 1e6, percentile(0.50), percentile(0.99), percentile(1.0));
+}
+
+static void TestInputRing(uint64_t events) {
+	static InputRing input;
+	atomic<bool> finished{ false };
+	uint64_t keys = 0;
+	int64_t lastMove = 0;
+
+	// 大約四分之三是滑鼠移動, lParam 是一直增加的座標
+	auto begin = chrono::steady_clock::now();
+	thread producer([&] {
+		int64_t x = 0;
+		for (uint64_t i = 0; i < events; i++) {
+			if (i % 4 != 0) {
+				input.Post(InputRing::MouseMove, 0, ++x, Now());
+			} else {
+				while (!input.Post(KeyDown, keys, x, Now())) this_thread::yield();
+				keys++;
+			}
+		}
+		lastMove = x;
+		// 最後送一個按鍵, 佇列滿時暫存的移動也會先送出
+		while (!input.Post(KeyDown, keys, x, Now())) this_thread::yield();
+		keys++;
+		finished.store(true, memory_order_release);
+	});
+
+	uint64_t nextKey = 0;
+	int64_t move = 0;
+	uint64_t received = 0;
+	bool ordered = true;
+	auto consume = [&](const InputEvent& e) {
+		received++;
+		if (e.Message == InputRing::MouseMove) {
+			if (e.lParam <= move) ordered = false;
+			move = e.lParam;
+		} else {
+			if (e.wParam != nextKey) ordered = false;
+			// 按鍵之前的移動一定已經收到
+			if (e.lParam != move && e.lParam > 0) ordered = false;
+			nextKey++;
+		}
+	};
+	for (;;) {
+		bool done = finished.load(memory_order_acquire);
+		if (input.Drain(consume) == 0) {
+			if (done) break;
+			this_thread::yield();
+		}
+	}
+	producer.join();
+	auto end = chrono::steady_clock::now();
+
+	if (!ordered) Fail("InputRing: keys out of order or mouse moves went backwards");
+	if (nextKey != keys) Fail("InputRing: key events were lost");
+	if (move != lastMove) Fail("InputRing: the last mouse position never arrived");
+
+	double seconds = chrono::duration<double>(end - begin).count();
+	printf("InputRing  %llu posted  %llu delivered  %8.2f M posts/s\n",
+		(unsigned long long)events + 1, (unsigned long long)received, (events + 1) / seconds / 1e6);
+}
+
+int main(int argc, char* argv[]) {
+	uint64_t events = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+	if (events == 0) events = 1;
+
+	TestSpscRing(events);
+	TestInputRing(events);
+
+	return ExitCode();
+}
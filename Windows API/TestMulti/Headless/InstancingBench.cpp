@@ -0,0 +1,323 @@
+// RenderQueue 自動 instancing 減少多少 draw call: 100k 個立方體, 跑真正的 RenderQueue::Submit
+//
+//   g++ -std=c++14 -O2 -I../../Test/Sample/Include InstancingBench.cpp -o instancingbench
+//   ./instancingbench [cubes] [rounds]
+//
+// Linux 上沒有 D3D11, 這裡只宣告 RenderQueue.h 用到的型別, context 只計算呼叫次數, Map 給一塊記憶體
+// 場景: 全部共用一個 mesh, 8 種 mesh x 4 張貼圖, 以及 10% 的物體沒有 instancing 用的 shader (走 constant ring)
+// draw call 數, 每個立方體剛好畫一次, instance buffer 裡的矩陣屬於同一批的 mesh, 任何一項不對就回傳 1
+// ms 是建鍵 + 排序 + Submit 的 CPU 時間; 替身的 context 幾乎不花時間, 省下的驅動程式成本要在 Windows 上量
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+
+// ---- D3D11 的替身, 只有 RenderQueue.h 用到的部分 ----
+
+typedef unsigned int UINT;
+typedef long HRESULT;
+#define S_OK 0
+#define FAILED(hr) ((hr) < 0)
+#define TRUE 1
+#define TEXT(s) s
+#define ZeroMemory(p, size) memset((p), 0, (size))
+#define IID_PPV_ARGS(pp) (pp)
+
+enum DXGI_FORMAT { DXGI_FORMAT_R32_UINT = 42 };
+enum D3D11_PRIMITIVE_TOPOLOGY { D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4 };
+enum D3D11_USAGE { D3D11_USAGE_DYNAMIC = 2 };
+enum D3D11_BIND_FLAG { D3D11_BIND_VERTEX_BUFFER = 0x1, D3D11_BIND_CONSTANT_BUFFER = 0x4 };
+enum D3D11_CPU_ACCESS_FLAG { D3D11_CPU_ACCESS_WRITE = 0x10000 };
+enum D3D11_MAP { D3D11_MAP_WRITE_DISCARD = 4 };
+enum D3D11_FEATURE { D3D11_FEATURE_D3D11_OPTIONS = 2 };
+
+struct D3D11_BUFFER_DESC {
+	UINT ByteWidth;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+	UINT StructureByteStride;
+};
+
+struct D3D11_MAPPED_SUBRESOURCE {
+	void* pData;
+	UINT RowPitch;
+	UINT DepthPitch;
+};
+
+struct D3D11_FEATURE_DATA_D3D11_OPTIONS {
+	int ConstantBufferOffsetting;
+};
+
+struct D3D11_BOX;
+struct ID3D11InputLayout {};
+struct ID3D11VertexShader {};
+struct ID3D11PixelShader {};
+struct ID3D11ShaderResourceView {};
+struct ID3D11BlendState {};
+
+struct ID3D11Buffer {
+	vector<uint8_t> Data;
+};
+
+struct XMFLOAT4X4 {
+	float m[4][4];
+};
+
+// 不做參考計數, 物件由 ID3D11Device 或 main 擁有
+template <typename T>
+class ComPtr {
+public:
+	ComPtr& operator=(T* other) {
+		p = other;
+		return *this;
+	}
+	T* operator->() const { return p; }
+	T** operator&() { return &p; }
+	explicit operator bool() const { return p != nullptr; }
+	T* Get() const { return p; }
+	T** GetAddressOf() { return &p; }
+	void Reset() { p = nullptr; }
+
+private:
+	T* p = nullptr;
+};
+
+struct ContextCalls {
+	int DrawIndexed = 0;
+	int DrawInstanced = 0;
+	int Instances = 0;
+	int Updates = 0;
+	int ConstantBinds = 0;
+	int StateSets = 0;
+	vector<pair<UINT, UINT>> Batches;	// 每次 DrawIndexedInstanced 的 (instance 數, 第一個 instance)
+};
+
+struct ID3D11DeviceContext1;
+
+struct ID3D11DeviceContext {
+	ContextCalls Calls;
+
+	template <typename T>
+	HRESULT QueryInterface(T** out) {
+		*out = static_cast<T*>(this);
+		return S_OK;
+	}
+	void IASetInputLayout(ID3D11InputLayout*) { Calls.StateSets++; }
+	void VSSetShader(ID3D11VertexShader*, const void*, UINT) { Calls.StateSets++; }
+	void PSSetShader(ID3D11PixelShader*, const void*, UINT) { Calls.StateSets++; }
+	void PSSetShaderResources(UINT, UINT, ID3D11ShaderResourceView* const*) { Calls.StateSets++; }
+	void OMSetBlendState(ID3D11BlendState*, const float*, UINT) { Calls.StateSets++; }
+	void IASetVertexBuffers(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*) { Calls.StateSets++; }
+	void IASetIndexBuffer(ID3D11Buffer*, DXGI_FORMAT, UINT) { Calls.StateSets++; }
+	void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY) { Calls.StateSets++; }
+	void UpdateSubresource(ID3D11Buffer* buffer, UINT, const D3D11_BOX*, const void* data, UINT, UINT) {
+		memcpy(buffer->Data.data(), data, min(buffer->Data.size(), sizeof(XMFLOAT4X4)));
+		Calls.Updates++;
+	}
+	void DrawIndexed(UINT, UINT, int) { Calls.DrawIndexed++; }
+	void DrawIndexedInstanced(UINT, UINT instanceCount, UINT, int, UINT startInstance) {
+		Calls.DrawInstanced++;
+		Calls.Instances += instanceCount;
+		Calls.Batches.push_back({ instanceCount, startInstance });
+	}
+	HRESULT Map(ID3D11Buffer* buffer, UINT, D3D11_MAP, UINT, D3D11_MAPPED_SUBRESOURCE* mapped) {
+		mapped->pData = buffer->Data.data();
+		return S_OK;
+	}
+	void Unmap(ID3D11Buffer*, UINT) {}
+};
+
+struct ID3D11DeviceContext1 : ID3D11DeviceContext {
+	void VSSetConstantBuffers1(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*) { Calls.ConstantBinds++; }
+};
+
+struct ID3D11Device {
+	vector<unique_ptr<ID3D11Buffer>> Buffers;
+
+	HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const void*, ID3D11Buffer** out) {
+		Buffers.emplace_back(new ID3D11Buffer());
+		Buffers.back()->Data.resize(desc->ByteWidth);
+		*out = Buffers.back().get();
+		return S_OK;
+	}
+	HRESULT CheckFeatureSupport(D3D11_FEATURE, void* data, UINT) {
+		static_cast<D3D11_FEATURE_DATA_D3D11_OPTIONS*>(data)->ConstantBufferOffsetting = TRUE;
+		return S_OK;
+	}
+};
+
+static bool CheckFailed(HRESULT result, const char*) {
+	return FAILED(result);
+}
+
+#include "RenderQueue.h"
+
+using namespace MyGame;
+
+// 場景裡共用的資源
+struct Resources {
+	ID3D11InputLayout Layout, InstancedLayout;
+	ID3D11VertexShader VertexShader, InstancedVertexShader;
+	ID3D11PixelShader PixelShader;
+	ID3D11ShaderResourceView Textures[4];
+	ID3D11Buffer VertexBuffers[8];
+	ID3D11Buffer IndexBuffers[8];
+};
+
+// 矩陣的 m[0][1] 放立方體的編號, 用來檢查每個立方體都畫到而且只畫一次
+static DrawPacket Cube(Resources& r, int index, int mesh, int texture, bool instancing) {
+	DrawPacket p;
+	p.InputLayout = &r.Layout;
+	p.VertexShader = &r.VertexShader;
+	p.PixelShader = &r.PixelShader;
+	p.Texture = &r.Textures[texture];
+	p.BlendState = nullptr;
+	p.VertexBuffer = &r.VertexBuffers[mesh];
+	p.Stride = 32;
+	p.IndexBuffer = &r.IndexBuffers[mesh];
+	p.IndexFormat = DXGI_FORMAT_R32_UINT;
+	p.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	p.IndexCount = 36;
+	memset(&p.Constants, 0, sizeof(p.Constants));
+	p.Constants.m[0][0] = p.Constants.m[1][1] = p.Constants.m[2][2] = 1;
+	p.Constants.m[0][1] = (float)index;
+	float w = 1.0f + (float)(index * 7919 % 1000);
+	p.Constants.m[3][2] = w * 0.5f;
+	p.Constants.m[3][3] = w;
+	p.InstancedVertexShader = instancing ? &r.InstancedVertexShader : nullptr;
+	p.InstancedInputLayout = instancing ? &r.InstancedLayout : nullptr;
+	return p;
+}
+
+struct Scene {
+	const char* Name;
+	int Meshes;
+	int Textures;
+	int PlainPercent;		// 沒有 instancing shader 的比例, 放在最後一種 mesh
+};
+
+struct Result {
+	ContextCalls Calls;
+	RenderQueueStats Stats;
+	double Milliseconds;
+};
+
+// 跟 DirectXPanel::RenderScence 一樣: 清掉編號, 建鍵, 排序, 送出
+static Result Run(const Scene& scene, int cubes, int rounds, bool instancing, bool ring) {
+	Resources r;
+	ID3D11Device device;
+	ID3D11Buffer constantBuffer;
+	constantBuffer.Data.resize(sizeof(XMFLOAT4X4));
+
+	vector<DrawPacket> packets;
+	for (int i = 0; i < cubes; i++) {
+		bool plain = i % 100 < scene.PlainPercent;
+		int mesh = plain ? scene.Meshes : i % scene.Meshes;
+		packets.push_back(Cube(r, i, mesh, (i / scene.Meshes) % scene.Textures, !plain));
+	}
+
+	Result result = {};
+	for (int round = 0; round < rounds; round++) {
+		ID3D11DeviceContext1 context;
+		ConstantRingBuffer constantRing;
+		InstanceBuffer instances;
+		if (ring && !constantRing.Create(&device, &context)) Fail("setup: the constant ring was not created");
+		instances.Create(&device);
+		RenderQueue queue;
+		SortKeyIds shaderIds, materialIds, meshIds;
+
+		auto begin = chrono::steady_clock::now();
+		for (const DrawPacket& p : packets) {
+			uint32_t shader = shaderIds.Get(p.PixelShader);
+			uint32_t material = (materialIds.Get(p.Texture) << 16) | (meshIds.Get(p.VertexBuffer) & 0xFFFF);
+			queue.Add(SortKey::Opaque(0, shader, material, SortKey::Depth(p.Constants)), p);
+		}
+		queue.Sort();
+		result.Stats = queue.Submit(&context, &constantBuffer, ring ? &constantRing : nullptr, instancing ? &instances : nullptr);
+		result.Milliseconds += chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		result.Calls = context.Calls;
+
+		if (round == 0 && instancing) {
+			// 每一批的矩陣都來自同一種 mesh, 所有批次合起來每個立方體剛好一次
+			vector<int> seen(cubes, 0);
+			const uint8_t* data = instances.Get() ? instances.Get()->Data.data() : nullptr;
+			for (const auto& b : context.Calls.Batches) {
+				int mesh = -1;
+				for (UINT i = 0; i < b.first; i++) {
+					const XMFLOAT4X4* m = (const XMFLOAT4X4*)(data + (b.second + i) * InstanceBuffer::Stride);
+					int index = (int)m->m[0][1];
+					if (index < 0 || index >= cubes) {
+						Fail("instances: the instance buffer holds a matrix that is not a cube");
+						return result;
+					}
+					seen[index]++;
+					int cubeMesh = (int)(packets[index].VertexBuffer - r.VertexBuffers);
+					if (mesh >= 0 && cubeMesh != mesh) Fail("instances: one batch mixes meshes");
+					mesh = cubeMesh;
+				}
+			}
+			int instanced = 0;
+			for (int i = 0; i < cubes; i++) {
+				if (seen[i] > 1) Fail("instances: a cube was drawn twice");
+				instanced += seen[i];
+			}
+			if (instanced != result.Stats.Instanced) Fail("instances: the instance buffer does not match the instanced count");
+		}
+	}
+	result.Milliseconds /= rounds;
+	return result;
+}
+
+int main(int argc, char* argv[]) {
+	int cubes = argc > 1 ? atoi(argv[1]) : 100000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 10;
+	if (cubes < 1000) cubes = 1000;
+	if (rounds <= 0) rounds = 1;
+
+	const Scene scenes[] = {
+		{ "one mesh", 1, 1, 0 },
+		{ "8 meshes x 4 textures", 8, 4, 0 },
+		{ "10% not instanceable", 1, 1, 10 },
+	};
+
+	printf("%-24s %-12s %10s %10s %10s %10s %10s\n", "scene", "mode", "objects", "draws", "instanced", "constants", "ms");
+	for (const Scene& scene : scenes) {
+		int plain = 0;
+		for (int i = 0; i < cubes; i++) plain += i % 100 < scene.PlainPercent;
+		int groups = scene.Meshes * scene.Textures;
+
+		for (int mode = 0; mode < 3; mode++) {
+			bool instancing = mode > 0;
+			bool ring = mode == 2;
+			Result r = Run(scene, cubes, rounds, instancing, ring);
+			int constants = r.Calls.Updates + r.Calls.ConstantBinds;
+			printf("%-24s %-12s %10d %10d %10d %10d %10.3f\n", scene.Name, !instancing ? "separate" : (ring ? "inst+ring" : "instanced"),
+				r.Stats.Objects, r.Stats.Draws, r.Stats.Instanced, constants, r.Milliseconds);
+
+			if (r.Stats.Objects != cubes) Fail("submit: not every cube was queued");
+			if (r.Calls.DrawIndexed + r.Calls.DrawInstanced != r.Stats.Draws) Fail("submit: Draws differs from the draw calls made");
+			if (r.Calls.DrawIndexed + r.Calls.Instances != cubes) Fail("submit: the draw calls do not cover every cube once");
+			if (!instancing) {
+				if (r.Stats.Draws != cubes || r.Calls.Updates != cubes) Fail("separate: expected one draw and one constant update per cube");
+			} else {
+				// 沒有 instancing shader 的物體各畫一次, 其他每一組 mesh / 貼圖合成一次
+				if (r.Calls.DrawInstanced != groups || r.Calls.DrawIndexed != plain) Fail("instanced: wrong number of draw calls");
+				if (r.Stats.Instanced != cubes - plain) Fail("instanced: wrong number of instanced cubes");
+				if (constants != plain) Fail("instanced: only the separate draws should set constants");
+				if (ring && r.Calls.Updates != 0) Fail("ring: separate draws still used UpdateSubresource");
+			}
+		}
+	}
+
+	return ExitCode();
+}
@@ -0,0 +1,173 @@
+// MappedFile 與原本整個檔案讀進 heap 的比較: 冷快取 / 熱快取的時間, 以及常駐記憶體
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Inc MappedFileBench.cpp -o mappedfilebench
+//   ./mappedfilebench [megabytes] [rounds]
+//
+// 冷快取用 posix_fadvise(POSIX_FADV_DONTNEED) 把檔案從 page cache 丟掉 (不需要 root, 但有些檔案系統會忽略)
+// 每一種做法都在 fork 出來的子行程裡跑, 各自量 peak RSS, 以及讀完之後 RssAnon (heap) 與 RssFile (對應的檔案) 各多少
+// 兩種做法都要把每一頁讀一次並算出相同的 checksum; 空檔案要能開, 不存在的檔案要失敗, 否則回傳 1
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+
+#include "Check.h"
+#include "MappedFile.h"
+
+using namespace DirectX;
+
+// 跟 BinaryReader::ReadEntireFile 一樣, 配置整個檔案大小的 buffer 再讀進來
+static bool ReadEntireFile(const char* path, vector<uint8_t>& data) {
+	FILE* stream = fopen(path, "rb");
+	if (stream == nullptr) return false;
+	fseek(stream, 0, SEEK_END);
+	long length = ftell(stream);
+	fseek(stream, 0, SEEK_SET);
+	data.resize((size_t)length);
+	bool read = fread(data.data(), 1, data.size(), stream) == data.size();
+	fclose(stream);
+	return read;
+}
+
+// 每一頁讀一個 byte, 模擬解析時會走過整個檔案
+static uint64_t TouchPages(const uint8_t* data, size_t size) {
+	uint64_t sum = 0;
+	for (size_t i = 0; i < size; i += 4096) sum = sum * 31 + data[i];
+	return sum;
+}
+
+static void DropCache(const char* path) {
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return;
+	fdatasync(fd);
+	posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+}
+
+static long StatusKilobytes(const char* field) {
+	FILE* stream = fopen("/proc/self/status", "r");
+	if (stream == nullptr) return -1;
+	char line[256];
+	long value = -1;
+	size_t length = strlen(field);
+	while (fgets(line, sizeof(line), stream)) {
+		if (strncmp(line, field, length) == 0 && line[length] == ':') {
+			value = atol(line + length + 1);
+			break;
+		}
+	}
+	fclose(stream);
+	return value;
+}
+
+struct Measurement {
+	double Milliseconds;
+	uint64_t Checksum;
+	long PeakKilobytes;
+	long AnonKilobytes;
+	long FileKilobytes;
+};
+
+// 在子行程裡跑, 結果透過 pipe 傳回來, 這樣每一種做法的 peak RSS 互不影響
+static Measurement Measure(const char* path, bool mapped, bool cold) {
+	Measurement result = {};
+	int fds[2];
+	if (pipe(fds) != 0) return result;
+	if (cold) DropCache(path);
+
+	pid_t child = fork();
+	if (child == 0) {
+		close(fds[0]);
+		Measurement m = {};
+		auto begin = chrono::steady_clock::now();
+		vector<uint8_t> copy;
+		MappedFile file;
+		if (mapped) {
+			if (file.Open(path)) m.Checksum = TouchPages(file.Data(), file.Size());
+		} else {
+			if (ReadEntireFile(path, copy)) m.Checksum = TouchPages(copy.data(), copy.size());
+		}
+		m.Milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		m.PeakKilobytes = usage.ru_maxrss;
+		m.AnonKilobytes = StatusKilobytes("RssAnon");
+		m.FileKilobytes = StatusKilobytes("RssFile");
+		ssize_t written = write(fds[1], &m, sizeof(m));
+		_exit(written == (ssize_t)sizeof(m) ? 0 : 1);
+	}
+
+	close(fds[1]);
+	if (child < 0 || read(fds[0], &result, sizeof(result)) != (ssize_t)sizeof(result)) Fail("cannot run the measurement in a child process");
+	close(fds[0]);
+	if (child > 0) waitpid(child, nullptr, 0);
+	return result;
+}
+
+int main(int argc, char* argv[]) {
+	size_t megabytes = argc > 1 ? (size_t)atol(argv[1]) : 64;
+	int rounds = argc > 2 ? atoi(argv[2]) : 5;
+	if (megabytes == 0) megabytes = 1;
+	if (rounds <= 0) rounds = 1;
+
+	char path[] = "/tmp/mappedfilebenchXXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		Fail("cannot create a temporary file");
+		return 1;
+	}
+	vector<uint8_t> block(1 << 20);
+	for (size_t i = 0; i < block.size(); i++) block[i] = (uint8_t)(i * 2654435761u >> 24);
+	for (size_t i = 0; i < megabytes; i++) {
+		block[0] = (uint8_t)i;
+		if (write(fd, block.data(), block.size()) != (ssize_t)block.size()) Fail("cannot write the temporary file");
+	}
+	close(fd);
+
+	// 開檔的邊界情況
+	{
+		MappedFile file;
+		if (file.Open("/tmp/mappedfilebench-does-not-exist")) Fail("a missing file was opened");
+		char empty[] = "/tmp/mappedfilebenchemptyXXXXXX";
+		int e = mkstemp(empty);
+		if (e >= 0) {
+			close(e);
+			if (!file.Open(empty) || file.Size() != 0 || file.Data() != nullptr) Fail("an empty file did not open as an empty view");
+			unlink(empty);
+		}
+		if (!file.Open(path) || file.Size() != megabytes << 20) Fail("the mapped size differs from the file size");
+		file.Close();
+		if (file.Data() != nullptr || file.Size() != 0) Fail("Close left the view behind");
+	}
+
+	printf("%zu MB file, best of %d\n", megabytes, rounds);
+	printf("%-16s %10s %12s %12s %12s\n", "", "ms", "peak RSS MB", "anon MB", "file MB");
+	uint64_t expected = 0;
+	for (int cold = 1; cold >= 0; cold--) {
+		for (int mapped = 0; mapped <= 1; mapped++) {
+			Measurement best = {};
+			for (int r = 0; r < rounds; r++) {
+				Measurement m = Measure(path, mapped != 0, cold != 0);
+				if (expected == 0) expected = m.Checksum;
+				if (m.Checksum != expected) Fail("the two readers saw different data");
+				if (r == 0 || m.Milliseconds < best.Milliseconds) best = m;
+			}
+			string name = string(cold ? "cold " : "warm ") + (mapped ? "map" : "copy");
+			printf("%-16s %10.2f %12.1f %12.1f %12.1f\n", name.c_str(), best.Milliseconds,
+				best.PeakKilobytes / 1024.0, best.AnonKilobytes / 1024.0, best.FileKilobytes / 1024.0);
+		}
+	}
+
+	unlink(path);
+	return ExitCode();
+}
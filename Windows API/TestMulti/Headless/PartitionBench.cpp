@@ -0,0 +1,157 @@
+// DrawPartitioner 的單元測試, 以及 FramePipeline 錄製時間隨 DeferredContext 數量的變化
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include PartitionBench.cpp -o partitionbench
+//   ./partitionbench [draws] [frames] [maxContexts]
+//
+// 單元測試: 區間要連續, 涵蓋所有 draw, 不可以有空的區間, 段數不超過要求, 每段成本不超過平均加上最大的單一成本
+// 速度: 用 NullRenderDevice 跑 1, 2, 4 ... maxContexts 個 context, 平行錄製的 StreamHash 必須跟同樣切法的單執行緒相同
+// 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "NullRenderDevice.h"
+#include "FramePipeline.h"
+
+using namespace MyGame;
+
+static void CheckPartition(const char* name, const vector<unsigned long long>& costs, int parts) {
+	DrawPartitioner partitioner;
+	partitioner.Partition(costs, parts);
+
+	if (costs.empty() || parts <= 0) {
+		if (partitioner.Count() != 0) {
+			fprintf(stderr, "%s: ", name);
+			Fail("ranges produced for an empty list");
+		}
+		return;
+	}
+
+	unsigned long long total = 0, largest = 0;
+	for (auto c : costs) {
+		total += c;
+		largest = max(largest, c);
+	}
+	int expected = min((int)costs.size(), parts);
+	if (partitioner.Count() != expected) {
+		fprintf(stderr, "%s: %d ranges, expected %d\n", name, partitioner.Count(), expected);
+		ok = false;
+	}
+
+	size_t next = 0;
+	for (int i = 0; i < partitioner.Count(); i++) {
+		const DrawRange& range = partitioner[i];
+		if (range.Begin != next || range.End <= range.Begin) {
+			fprintf(stderr, "%s: range %d is [%zu, %zu), expected to start at %zu and not be empty\n", name, i, range.Begin, range.End, next);
+			ok = false;
+			return;
+		}
+		unsigned long long cost = 0;
+		for (size_t d = range.Begin; d < range.End; d++) cost += costs[d];
+		// 貪婪切法最多超過平均一個 draw 的成本
+		if (cost > total / expected + largest) {
+			fprintf(stderr, "%s: range %d costs %llu, average %llu, largest draw %llu\n", name, i, cost, total / expected, largest);
+			ok = false;
+		}
+		next = range.End;
+	}
+	if (next != costs.size()) {
+		fprintf(stderr, "%s: ranges end at %zu of %zu draws\n", name, next, costs.size());
+		ok = false;
+	}
+}
+
+static void TestPartitioner() {
+	CheckPartition("empty", {}, 4);
+	CheckPartition("no parts", { 1, 2, 3 }, 0);
+	CheckPartition("one draw", { 100 }, 8);
+	CheckPartition("fewer draws than parts", { 5, 5, 5 }, 8);
+	CheckPartition("uniform", vector<unsigned long long>(1000, DrawPartitioner::EstimateCost(36, 1)), 6);
+	CheckPartition("one huge draw first", { 1000000, 1, 1, 1, 1, 1, 1, 1 }, 4);
+	CheckPartition("one huge draw last", { 1, 1, 1, 1, 1, 1, 1, 1000000 }, 4);
+
+	// 大部分是小物件, 偶爾有大模型
+	mt19937 random(7);
+	for (int round = 0; round < 200; round++) {
+		vector<unsigned long long> costs(1 + random() % 500);
+		for (auto& c : costs) {
+			unsigned int indices = random() % 16 == 0 ? 30000 + random() % 60000 : 6 + random() % 600;
+			c = DrawPartitioner::EstimateCost(indices, 1 + random() % 3);
+		}
+		CheckPartition("random", costs, 1 + (int)(random() % 32));
+	}
+
+	// 同一個 partitioner 重新切要清掉上一次的結果
+	DrawPartitioner partitioner;
+	partitioner.Partition(vector<unsigned long long>(100, 1), 8);
+	partitioner.Partition(vector<unsigned long long>(3, 1), 8);
+	if (partitioner.Count() != 3) Fail("repartition kept ranges from the previous call");
+}
+
+struct ScalingResult {
+	double Milliseconds;
+	uint64_t StreamHash;
+};
+
+static ScalingResult RunPipeline(int draws, int frames, int contexts, bool parallel) {
+	NullRenderDevice device;
+	FramePipeline pipeline(device);
+
+	float vertices[4 * 10] = {};
+	uint32_t indices[] = { 0, 1, 2, 1, 3, 2 };
+	pipeline.VertexBuffer = device.CreateBuffer(BufferType::Vertex, sizeof(vertices), vertices);
+	pipeline.VertexStride = sizeof(float) * 10;
+	pipeline.IndexBuffer = device.CreateBuffer(BufferType::Index, sizeof(indices), indices);
+	pipeline.ConstantBuffer = device.CreateBuffer(BufferType::Constant, sizeof(Float4x4), nullptr);
+	pipeline.Shader = device.CreateShader(nullptr, 0, nullptr, 0, nullptr, 0);
+	for (int i = 0; i < draws; i++) {
+		pipeline.DrawList.push_back({ Float4x4::Translation((float)(i % 64), (float)(i / 64), 0), 6, 0, 0 });
+	}
+	pipeline.Initialize(contexts, parallel);
+
+	const float color[4] = { 0, 0, 0, 1 };
+	Float4x4 viewProjection = Float4x4::Identity();
+	pipeline.Render(Float4x4::Identity(), viewProjection, color);
+	auto begin = chrono::steady_clock::now();
+	for (int frame = 0; frame < frames; frame++) {
+		pipeline.Render(Float4x4::Translation((float)frame, 0, 0), viewProjection, color);
+	}
+	auto end = chrono::steady_clock::now();
+	pipeline.Shutdown();
+
+	return { chrono::duration<double, milli>(end - begin).count() / frames, device.Stats.StreamHash };
+}
+
+int main(int argc, char* argv[]) {
+	int draws = argc > 1 ? atoi(argv[1]) : 20000;
+	int frames = argc > 2 ? atoi(argv[2]) : 50;
+	int maxContexts = argc > 3 ? atoi(argv[3]) : (int)max(8u, thread::hardware_concurrency());
+	if (draws <= 0) draws = 1;
+	if (frames <= 0) frames = 1;
+	if (maxContexts <= 0) maxContexts = 1;
+
+	TestPartitioner();
+
+	printf("%d draws, %u hardware threads\n", draws, thread::hardware_concurrency());
+	double base = 0;
+	for (int contexts = 1; contexts <= maxContexts; contexts *= 2) {
+		ScalingResult serial = RunPipeline(draws, frames, contexts, false);
+		ScalingResult parallel = RunPipeline(draws, frames, contexts, true);
+		if (serial.StreamHash != parallel.StreamHash) Fail("parallel recording differs from serial recording");
+		if (contexts == 1) base = parallel.Milliseconds;
+		printf("%3d contexts  serial %8.3f ms  parallel %8.3f ms  %5.2fx\n",
+			contexts, serial.Milliseconds, parallel.Milliseconds, parallel.Milliseconds > 0 ? base / parallel.Milliseconds : 0.0);
+	}
+
+	return ExitCode();
+}
@@ -0,0 +1,141 @@
+// PROFILE_SCOPE 的成本: 目標是每個 zone 50 ns 以下, 並檢查 WriteChromeTrace 的輸出
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include ProfilerBench.cpp -o profilerbench
+//   ./profilerbench [zones] [threads]
+//
+// 每個 zone 讀兩次 Profiler::Now (x86 上是 rdtsc) 再寫進自己執行緒的緩衝區, 整個 zone 的成本 (含讀時鐘) 要在 50 ns 以下
+// 取幾輪裡最快的一輪, 不讓被打斷的那一輪決定結果; 多條執行緒同時記錄也量一次 (執行緒數超過核心數時只輸出, 不檢查)
+// 有些虛擬機會攔截 rdtsc, 光是讀兩次時鐘就超過 50 ns, 這種機器上也只輸出, 不檢查
+// 輸出時原始 tick 才換算成微秒: 一個睡 20 ms 的 zone 在 trace 裡要是 20 ms 左右
+// 超過預算, 時間換算不對, 或輸出的事件數量 / 執行緒名稱不對就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "Profiler.h"
+
+using namespace MyGame;
+
+static const double Budget = 50.0;
+static const int Rounds = 5;
+
+// 防止編譯器把迴圈整個拿掉
+static volatile int64_t sink;
+
+static double TimeZones(int zones) {
+	auto begin = chrono::steady_clock::now();
+	for (int i = 0; i < zones; i++) {
+		PROFILE_SCOPE("Zone");
+		sink = i;
+	}
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, nano>(end - begin).count() / zones;
+}
+
+static double TimeClock(int zones) {
+	auto begin = chrono::steady_clock::now();
+	for (int i = 0; i < zones; i++) {
+		sink = Profiler::Now();
+	}
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, nano>(end - begin).count() / zones;
+}
+
+// 幾輪裡最快的一輪, 每個 zone 平均幾 ns
+static double BestZones(int zones) {
+	double best = TimeZones(zones);
+	for (int r = 1; r < Rounds; r++) best = min(best, TimeZones(zones));
+	return best;
+}
+
+static size_t Count(const string& text, const char* pattern) {
+	size_t n = 0;
+	for (size_t at = text.find(pattern); at != string::npos; at = text.find(pattern, at + 1)) n++;
+	return n;
+}
+
+int main(int argc, char* argv[]) {
+	int zones = argc > 1 ? atoi(argv[1]) : 5000000;
+	int cores = (int)max(1u, thread::hardware_concurrency());
+	int threads = argc > 2 ? atoi(argv[2]) : cores;
+	if (zones <= 0) zones = 1;
+	if (threads <= 0) threads = 1;
+
+	PROFILE_THREAD("Main");
+	// 第一次呼叫會登記執行緒並配置緩衝區, 不算在內
+	TimeZones(1000);
+
+	double clock = TimeClock(zones);
+	double single = BestZones(zones / Rounds);
+	printf("%-24s %8.2f ns\n", "Profiler::Now", clock);
+	printf("%-24s %8.2f ns/zone\n", "one thread", single);
+	bool clockFits = 2 * clock <= Budget;
+	if (!clockFits) printf("two Profiler::Now reads already take %.2f ns here, the 50 ns budget is not checked\n", 2 * clock);
+	if (clockFits && single > Budget) Fail("one thread: zone cost is over the 50 ns budget");
+
+	// 每條執行緒寫自己的緩衝區, 不應該互相拖慢
+	vector<double> perThread(threads);
+	vector<thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&, t] {
+			PROFILE_THREAD("Worker");
+			TimeZones(1000);
+			perThread[t] = BestZones(zones / threads / Rounds);
+		});
+	}
+	for (auto& w : workers) w.join();
+	double worst = *max_element(perThread.begin(), perThread.end());
+	printf("%-24s %8.2f ns/zone (slowest of %d)\n", "threads recording", worst, threads);
+	if (clockFits && threads <= cores && worst > Budget) Fail("threads: zone cost is over the 50 ns budget");
+
+	// 換算成微秒是在輸出時做的, 睡 20 ms 的 zone 輸出的 dur 要接近 20000
+	{
+		PROFILE_SCOPE("Sleep");
+		this_thread::sleep_for(chrono::milliseconds(20));
+	}
+
+	// 每條執行緒最多保留 Capacity 個事件, 名稱要寫成 thread_name metadata
+	PROFILE_FRAME();
+	FILE* stream = tmpfile();
+	if (stream == nullptr) {
+		Fail("trace: cannot create a temporary file");
+		return 1;
+	}
+	Profiler::Instance().WriteChromeTrace(stream);
+	string trace((size_t)ftell(stream), '\0');
+	rewind(stream);
+	size_t read = fread(&trace[0], 1, trace.size(), stream);
+	fclose(stream);
+	trace.resize(read);
+
+	size_t mainEvents = min<size_t>((size_t)(zones / Rounds) * Rounds + 1000 + 2, ProfileThreadBuffer::Capacity);
+	size_t workerEvents = min<size_t>((size_t)(zones / threads / Rounds) * Rounds + 1000, ProfileThreadBuffer::Capacity);
+	size_t expected = mainEvents + workerEvents * threads;
+	size_t zoneEvents = Count(trace, "\"name\":\"Zone\"");
+	size_t frameEvents = Count(trace, "\"name\":\"Frame\",\"ph\":\"i\"");
+	size_t sleepAt = trace.find("\"name\":\"Sleep\"");
+	if (zoneEvents + frameEvents + (sleepAt != string::npos) != expected) {
+		fprintf(stderr, "trace: %zu events, expected %zu\n", zoneEvents + frameEvents + (sleepAt != string::npos), expected);
+		ok = false;
+	}
+	if (frameEvents != 1) Fail("trace: the frame marker is missing");
+	double sleepMs = 0;
+	size_t durAt = sleepAt == string::npos ? string::npos : trace.find("\"dur\":", sleepAt);
+	if (durAt != string::npos) sleepMs = atof(trace.c_str() + durAt + 6) / 1000;
+	printf("%-24s %8.2f ms for a 20 ms sleep\n", "converted duration", sleepMs);
+	if (sleepMs < 19.5 || sleepMs > 40) Fail("trace: raw ticks were not converted to the right duration");
+	if (Count(trace, "\"args\":{\"name\":\"Main\"}") != 1 || Count(trace, "\"args\":{\"name\":\"Worker\"}") != (size_t)threads) Fail("trace: thread names are missing");
+	if (trace.compare(0, 15, "{\"traceEvents\":") != 0 || trace.find("],\"displayTimeUnit\":\"ms\"}") == string::npos) Fail("trace: not a Trace Event Format object");
+	printf("%-24s %8zu events, %zu bytes\n", "trace", zoneEvents + frameEvents, trace.size());
+
+	return ExitCode();
+}
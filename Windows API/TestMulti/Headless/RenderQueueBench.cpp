@@ -0,0 +1,207 @@
+// RenderQueue 在 CPU 上的成本: 建立排序鍵 (SortKeyIds + SortKey) 與 RadixSorter 排序, 10k 到 1M 個 draw
+//
+//   g++ -std=c++14 -O2 -I../../Test/Sample/Include -I../../DirectXTK/Src RenderQueueBench.cpp -o renderqueuebench
+//   ./renderqueuebench [max draws] [rounds]
+//
+// 建鍵的方式跟 DirectXPanel::RenderNode 一樣, 排序跟 RenderQueue::Sort 一樣 (先排 key 再依 index 搬 entry)
+// 結果必須跟 std::stable_sort 完全相同; 另外算出依加入順序與排序後送出時 shader / texture / mesh 各要換幾次
+// 排序後 shader 只能換 (種類數 - 1) 次, 半透明要由遠到近, SortKeyIds::Clear 之後要從 0 重新編號; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+
+// Linux 上沒有 DirectXMath, SortKey::Depth 只需要這個儲存用的型別
+struct XMFLOAT4X4 {
+	float m[4][4];
+};
+
+#include "SortKey.h"
+#include "RadixSort.h"
+
+using namespace MyGame;
+using namespace DirectX;
+
+// 跟 RenderQueue::Entry 一樣
+struct Entry {
+	uint64_t Key;
+	uint32_t Index;
+};
+
+// 只留排序會用到的欄位, 指標指向假的資源
+struct Draw {
+	const void* PixelShader;
+	const void* Texture;
+	const void* VertexBuffer;
+	XMFLOAT4X4 Constants;
+};
+
+static const int Shaders = 16;
+static const int Textures = 256;
+static const int Meshes = 4096;
+
+static char resources[Shaders + Textures + Meshes];
+
+static vector<Draw> MakeDraws(int count, mt19937& random) {
+	vector<Draw> draws(count);
+	uniform_real_distribution<float> distance(1.0f, 1000.0f);
+	for (Draw& d : draws) {
+		d.PixelShader = &resources[random() % Shaders];
+		d.Texture = &resources[Shaders + random() % Textures];
+		d.VertexBuffer = &resources[Shaders + Textures + random() % Meshes];
+		d.Constants = XMFLOAT4X4();
+		// clip space 的 z / w 落在 0 ~ 1
+		float w = distance(random);
+		d.Constants.m[3][2] = w * (w - 0.1f) / 999.9f;
+		d.Constants.m[3][3] = w;
+	}
+	return draws;
+}
+
+struct Queue {
+	SortKeyIds ShaderIds, MaterialIds, MeshIds;
+	vector<Entry> Entries, Scratch;
+	vector<uint64_t> Keys;
+	RadixSorter Sorter;
+
+	// DirectXPanel::RenderNode 的建鍵方式, 每幀先把編號清掉
+	void Build(const vector<Draw>& draws, bool transparent) {
+		ShaderIds.Clear();
+		MaterialIds.Clear();
+		MeshIds.Clear();
+		Entries.clear();
+		for (uint32_t i = 0; i < (uint32_t)draws.size(); i++) {
+			const Draw& d = draws[i];
+			uint32_t shader = ShaderIds.Get(d.PixelShader);
+			uint32_t material = (MaterialIds.Get(d.Texture) << 16) | (MeshIds.Get(d.VertexBuffer) & 0xFFFF);
+			uint32_t depth = SortKey::Depth(d.Constants);
+			Entries.push_back({ transparent ? SortKey::Transparent(0, shader, material, depth) : SortKey::Opaque(0, shader, material, depth), i });
+		}
+	}
+
+	// RenderQueue::Sort
+	void Sort() {
+		size_t count = Entries.size();
+		Keys.resize(count);
+		for (size_t i = 0; i < count; i++) Keys[i] = Entries[i].Key;
+		const uint32_t* order = Sorter.Sort(Keys.data(), count);
+		Scratch.resize(count);
+		for (size_t i = 0; i < count; i++) Scratch[i] = Entries[order[i]];
+		Entries.swap(Scratch);
+	}
+};
+
+struct Changes {
+	int Shader = 0;
+	int Texture = 0;
+	int Mesh = 0;
+
+	int Total() const {
+		return Shader + Texture + Mesh;
+	}
+};
+
+// 跟 RenderQueue::Submit 一樣, 第一個 draw 一律全部設定
+static Changes CountChanges(const vector<Draw>& draws, const vector<Entry>& entries) {
+	Changes c;
+	const Draw* previous = nullptr;
+	for (const Entry& e : entries) {
+		const Draw& d = draws[e.Index];
+		if (!previous || previous->PixelShader != d.PixelShader) c.Shader++;
+		if (!previous || previous->Texture != d.Texture) c.Texture++;
+		if (!previous || previous->VertexBuffer != d.VertexBuffer) c.Mesh++;
+		previous = &d;
+	}
+	return c;
+}
+
+static bool SameOrder(const vector<Entry>& a, const vector<Entry>& b) {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i].Key != b[i].Key || a[i].Index != b[i].Index) return false;
+	}
+	return true;
+}
+
+int main(int argc, char* argv[]) {
+	int maxCount = argc > 1 ? atoi(argv[1]) : 1000000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 10;
+	if (maxCount < 10000) maxCount = 10000;
+	if (rounds <= 0) rounds = 1;
+
+	mt19937 random(12);
+	Queue queue;
+
+	printf("%10s %10s %10s %12s %14s %14s\n", "draws", "build ms", "sort ms", "stable ms", "changes before", "changes after");
+	for (int count = 10000; count <= maxCount; count *= 10) {
+		vector<Draw> draws = MakeDraws(count, random);
+
+		double buildMs = 0, sortMs = 0, stableMs = 0;
+		vector<Entry> unsorted, expected;
+		for (int r = 0; r < rounds; r++) {
+			auto begin = chrono::steady_clock::now();
+			queue.Build(draws, false);
+			auto built = chrono::steady_clock::now();
+			unsorted = queue.Entries;
+			auto copied = chrono::steady_clock::now();
+			queue.Sort();
+			auto sorted = chrono::steady_clock::now();
+			buildMs += chrono::duration<double, milli>(built - begin).count();
+			sortMs += chrono::duration<double, milli>(sorted - copied).count();
+
+			expected = unsorted;
+			begin = chrono::steady_clock::now();
+			stable_sort(expected.begin(), expected.end(), [](const Entry& a, const Entry& b) { return a.Key < b.Key; });
+			stableMs += chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+		}
+		if (!SameOrder(queue.Entries, expected)) Fail("opaque: the radix sort differs from std::stable_sort");
+
+		Changes before = CountChanges(draws, unsorted);
+		Changes after = CountChanges(draws, queue.Entries);
+		if (after.Shader != Shaders) Fail("opaque: draws with the same shader were not grouped together");
+		if (after.Total() > before.Total()) Fail("opaque: sorting added state changes");
+		printf("%10d %10.3f %10.3f %12.3f %14d %14d\n", count, buildMs / rounds, sortMs / rounds, stableMs / rounds, before.Total(), after.Total());
+
+		// 半透明一定要由遠到近
+		queue.Build(draws, true);
+		expected = queue.Entries;
+		queue.Sort();
+		stable_sort(expected.begin(), expected.end(), [](const Entry& a, const Entry& b) { return a.Key < b.Key; });
+		if (!SameOrder(queue.Entries, expected)) Fail("transparent: the radix sort differs from std::stable_sort");
+		for (size_t i = 1; i < queue.Entries.size(); i++) {
+			if (SortKey::Depth(draws[queue.Entries[i - 1].Index].Constants) < SortKey::Depth(draws[queue.Entries[i].Index].Constants)) {
+				Fail("transparent: draws are not back to front");
+				break;
+			}
+		}
+	}
+
+	// 很短的佇列走 RadixSorter 的插入排序, 一樣要穩定
+	{
+		vector<Draw> draws = MakeDraws(40, random);
+		for (Draw& d : draws) d.Constants.m[3][2] = 0;
+		queue.Build(draws, false);
+		vector<Entry> expected = queue.Entries;
+		queue.Sort();
+		stable_sort(expected.begin(), expected.end(), [](const Entry& a, const Entry& b) { return a.Key < b.Key; });
+		if (!SameOrder(queue.Entries, expected)) Fail("short: the insertion sort is not stable");
+	}
+
+	// 每幀清掉之後從 0 開始, 不會一直累積
+	{
+		SortKeyIds ids;
+		for (int i = 0; i < Meshes; i++) ids.Get(&resources[i]);
+		if (ids.Get(&resources[Meshes - 1]) != (uint32_t)Meshes - 1) Fail("ids: an existing resource got a new id");
+		ids.Clear();
+		if (ids.Get(&resources[Meshes - 1]) != 0 || ids.Get(&resources[0]) != 1) Fail("ids: Clear did not restart the numbering");
+	}
+
+	return ExitCode();
+}
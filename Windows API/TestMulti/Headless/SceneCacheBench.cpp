@@ -0,0 +1,358 @@
+// SceneCache 的格式讀寫與 MeshOptimizer, 在 Linux 上不需要 FBX SDK 與 D3D 就能建置與測試
+//
+//   g++ -std=c++14 -O2 -I../../Test/Sample/Include -I../../DirectXTK/Inc SceneCacheBench.cpp -o scenecachebench
+//   ./scenecachebench [grid] [nodes]
+//
+// MeshOptimizer: 每個三角形各自有頂點而且順序打亂的格子, 合併後要剛好剩 (grid + 1)^2 個頂點, 三角形 (含頂點順序) 不變,
+//   頂點依第一次使用的順序排列, 16 格 FIFO 的 ACMR 要變小
+// SceneCache: 寫出再對應回來要逐項相同, 來源檔改過就不再 Matches, 各種損毀的檔案都要被 Open 拒絕
+// 最後輸出大場景的寫入 / 開啟 / 讀過所有頂點的時間; 任何一項失敗就回傳 1
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+
+#include "Check.h"
+#include "SceneCache.h"
+
+using namespace MyGame;
+
+// 跟 SimpleVertex 一樣的大小與排列
+struct Vertex {
+	float Position[4];
+	float Normal[4];
+	float TexCoord[2];
+};
+
+static_assert(sizeof(Vertex) == 40, "Vertex layout");
+
+// grid x grid 個四邊形, 每個三角形都有自己的三個頂點, 三角形的順序打亂
+static void MakeGrid(int grid, mt19937& random, vector<Vertex>& vertices, vector<uint32_t>& indices) {
+	vector<Vertex> corners;
+	for (int y = 0; y < grid; y++) {
+		for (int x = 0; x < grid; x++) {
+			int quad[4][2] = { { x, y }, { x + 1, y }, { x, y + 1 }, { x + 1, y + 1 } };
+			int triangles[2][3] = { { 0, 2, 1 }, { 1, 2, 3 } };
+			for (auto& t : triangles) {
+				for (int k : t) {
+					Vertex v = {};
+					v.Position[0] = (float)quad[k][0];
+					v.Position[2] = (float)quad[k][1];
+					v.Position[3] = 1;
+					v.Normal[1] = 1;
+					v.TexCoord[0] = quad[k][0] / (float)grid;
+					v.TexCoord[1] = quad[k][1] / (float)grid;
+					corners.push_back(v);
+				}
+			}
+		}
+	}
+	vector<uint32_t> order(corners.size() / 3);
+	for (size_t i = 0; i < order.size(); i++) order[i] = (uint32_t)i;
+	shuffle(order.begin(), order.end(), random);
+	vertices.clear();
+	indices.clear();
+	for (uint32_t t : order) {
+		for (int k = 0; k < 3; k++) {
+			indices.push_back((uint32_t)vertices.size());
+			vertices.push_back(corners[t * 3 + k]);
+		}
+	}
+}
+
+// 每個三角形以三個頂點的位置表示, 排序後比較, 三角形內的頂點順序必須保留
+static vector<array<float, 9>> Triangles(const vector<Vertex>& vertices, const vector<uint32_t>& indices) {
+	vector<array<float, 9>> result(indices.size() / 3);
+	for (size_t t = 0; t < result.size(); t++) {
+		for (int k = 0; k < 3; k++) {
+			const Vertex& v = vertices[indices[t * 3 + k]];
+			for (int c = 0; c < 3; c++) result[t][k * 3 + c] = v.Position[c];
+		}
+	}
+	sort(result.begin(), result.end());
+	return result;
+}
+
+// 平均每個三角形要轉換幾個頂點 (FIFO 快取)
+static double Acmr(const vector<uint32_t>& indices, uint32_t vertexCount, int cacheSize) {
+	vector<int64_t> stamp(vertexCount, -1000000);
+	int64_t misses = 0;
+	for (uint32_t v : indices) {
+		if (misses - stamp[v] >= cacheSize) {
+			stamp[v] = misses;
+			misses++;
+		}
+	}
+	return (double)misses / (indices.size() / 3);
+}
+
+static void TestOptimizer(int grid, mt19937& random) {
+	vector<Vertex> vertices;
+	vector<uint32_t> indices;
+	MakeGrid(grid, random, vertices, indices);
+	vector<array<float, 9>> before = Triangles(vertices, indices);
+
+	vector<Vertex> welded = vertices;
+	vector<uint32_t> weldedIndices = indices;
+	MeshOptimizer::Weld(welded, weldedIndices);
+	double acmrBefore = Acmr(weldedIndices, (uint32_t)welded.size(), 16);
+
+	auto begin = chrono::steady_clock::now();
+	size_t inputVertices = vertices.size();
+	MeshOptimizer::Optimize(vertices, indices);
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+	double acmrAfter = Acmr(indices, (uint32_t)vertices.size(), 16);
+
+	if (vertices.size() != (size_t)(grid + 1) * (grid + 1)) Fail("optimizer: Weld did not merge identical vertices");
+	if (Triangles(vertices, indices) != before) Fail("optimizer: the triangles changed");
+	uint32_t next = 0;
+	for (uint32_t index : indices) {
+		if (index > next) {
+			Fail("optimizer: vertices are not in first-use order");
+			break;
+		}
+		if (index == next) next++;
+	}
+	if (next != vertices.size()) Fail("optimizer: an unused vertex was kept");
+	if (!(acmrAfter < acmrBefore)) Fail("optimizer: the vertex cache order did not improve ACMR");
+	printf("optimize %dx%d grid: %zu -> %zu vertices, ACMR %.2f -> %.2f, %.1f ms\n", grid, grid, inputVertices, vertices.size(), acmrBefore, acmrAfter, ms);
+
+	// 索引數不是 3 的倍數不動
+	vector<uint32_t> odd = { 0, 1, 2, 3 };
+	MeshOptimizer::OptimizeVertexCache(odd, 4);
+	if (odd != vector<uint32_t>({ 0, 1, 2, 3 })) Fail("optimizer: a non-triangle index list was reordered");
+}
+
+static string temporaryDirectory;
+
+static string TemporaryPath(const char* name) {
+	return temporaryDirectory + "/" + name;
+}
+
+static bool WriteFile(const string& path, const vector<uint8_t>& data) {
+	FILE* stream = fopen(path.c_str(), "wb");
+	if (stream == nullptr) return false;
+	bool written = fwrite(data.data(), 1, data.size(), stream) == data.size();
+	return fclose(stream) == 0 && written;
+}
+
+// 根節點, 底下 nodes 個節點 (前序, 每個節點的父節點是前面隨機一個), 一部分指向兩個模型之一
+static SceneCacheWriter MakeScene(int nodes, int grid, mt19937& random, vector<vector<Vertex>>& meshVertices, vector<vector<uint32_t>>& meshIndices) {
+	SceneCacheWriter writer(sizeof(Vertex));
+	meshVertices.assign(2, vector<Vertex>());
+	meshIndices.assign(2, vector<uint32_t>());
+	MakeGrid(grid, random, meshVertices[0], meshIndices[0]);
+	MakeGrid(2, random, meshVertices[1], meshIndices[1]);
+	for (int m = 0; m < 2; m++) {
+		MeshOptimizer::Optimize(meshVertices[m], meshIndices[m]);
+		float boundsMin[3] = { 0, 0, 0 };
+		float boundsMax[3] = { (float)(m ? 2 : grid), 0, (float)(m ? 2 : grid) };
+		writer.AddMesh(meshVertices[m].data(), (uint32_t)meshVertices[m].size(), meshIndices[m].data(), (uint32_t)meshIndices[m].size(), boundsMin, boundsMax);
+	}
+
+	float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+	writer.AddNode(-1, "", identity);
+	for (int i = 1; i <= nodes; i++) {
+		float local[16];
+		memcpy(local, identity, sizeof(local));
+		local[12] = (float)i;
+		local[13] = (float)(i % 7);
+		string name = "Node" + to_string(i);
+		int node = writer.AddNode((int)(random() % (unsigned)i), name.c_str(), local);
+		if (i % 3 != 0) writer.SetNodeMesh(node, i % 3 - 1);
+	}
+	return writer;
+}
+
+static void TestRoundTrip(mt19937& random) {
+	string sourcePath = TemporaryPath("source.fbx");
+	vector<uint8_t> source(100000);
+	for (uint8_t& b : source) b = (uint8_t)random();
+	if (!WriteFile(sourcePath, source)) {
+		Fail("round trip: cannot write the source file");
+		return;
+	}
+	uint64_t hash = 0, size = 0;
+	if (!SceneCacheFormat::HashFile(sourcePath.c_str(), hash, size) || hash != SceneCacheFormat::Hash(source.data(), source.size()) || size != source.size()) {
+		Fail("round trip: HashFile differs from hashing the bytes");
+	}
+
+	vector<vector<Vertex>> meshVertices;
+	vector<vector<uint32_t>> meshIndices;
+	const int nodes = 50;
+	SceneCacheWriter writer = MakeScene(nodes, 16, random, meshVertices, meshIndices);
+	writer.SetSource(hash, size);
+	string cachePath = TemporaryPath("scene.scenecache");
+	if (!writer.Save(cachePath.c_str())) {
+		Fail("round trip: Save failed");
+		return;
+	}
+
+	SceneCache cache;
+	if (!cache.Open(cachePath.c_str())) {
+		Fail("round trip: the written cache was rejected");
+		return;
+	}
+	if (!cache.Matches(hash, size)) Fail("round trip: the cache does not match its own source");
+	if (cache.NodeCount() != (uint32_t)nodes + 1 || cache.MeshCount() != 2 || cache.VertexStride() != sizeof(Vertex)) Fail("round trip: wrong counts");
+	for (uint32_t m = 0; m < cache.MeshCount() && m < 2; m++) {
+		const SceneCacheMesh& mesh = cache.Mesh(m);
+		if (mesh.VertexCount != meshVertices[m].size() || mesh.IndexCount != meshIndices[m].size()
+			|| memcmp(cache.Vertices(mesh), meshVertices[m].data(), meshVertices[m].size() * sizeof(Vertex)) != 0
+			|| memcmp(cache.Indices(mesh), meshIndices[m].data(), meshIndices[m].size() * sizeof(uint32_t)) != 0) {
+			Fail("round trip: mesh data differs");
+		}
+	}
+	// 第一個模型的頂點就在頂點區塊的開頭
+	if ((uintptr_t)cache.Vertices(cache.Mesh(0)) % SceneCacheFormat::Alignment != 0) Fail("round trip: the vertex blob is not aligned");
+	for (uint32_t i = 1; i < cache.NodeCount(); i++) {
+		const SceneCacheNode& n = cache.Node(i);
+		string name = "Node" + to_string(i);
+		if (string(cache.Name(n), n.NameLength) != name || n.Local[12] != (float)i || n.Local[13] != (float)(i % 7)
+			|| n.Mesh != (i % 3 != 0 ? (int)(i % 3) - 1 : -1) || n.Parent < 0 || (uint32_t)n.Parent >= i) {
+			Fail("round trip: node data differs");
+			break;
+		}
+	}
+	cache.Close();
+
+	// 來源檔改了一個 byte, 快取就算過期
+	source[source.size() / 2] ^= 1;
+	WriteFile(sourcePath, source);
+	uint64_t newHash = 0, newSize = 0;
+	SceneCacheFormat::HashFile(sourcePath.c_str(), newHash, newSize);
+	if (!cache.Open(cachePath.c_str()) || cache.Matches(newHash, newSize)) Fail("stale: a cache for a modified source still matches");
+	cache.Close();
+	unlink(sourcePath.c_str());
+	unlink(cachePath.c_str());
+}
+
+static void TestCorrupt(mt19937& random) {
+	vector<vector<Vertex>> meshVertices;
+	vector<vector<uint32_t>> meshIndices;
+	vector<uint8_t> good = MakeScene(10, 4, random, meshVertices, meshIndices).Build();
+	const SceneCacheHeader* h = (const SceneCacheHeader*)good.data();
+	size_t firstNode = sizeof(SceneCacheHeader);
+	size_t firstMesh = firstNode + h->NodeCount * sizeof(SceneCacheNode);
+
+	struct Case {
+		const char* Name;
+		size_t Offset;
+		uint32_t Value;
+	};
+	const Case cases[] = {
+		{ "bad magic", offsetof(SceneCacheHeader, Magic), 0x12345678 },
+		{ "newer version", offsetof(SceneCacheHeader, Version), SceneCacheFormat::Version + 1 },
+		{ "no nodes", offsetof(SceneCacheHeader, NodeCount), 0 },
+		{ "zero vertex stride", offsetof(SceneCacheHeader, VertexStride), 0 },
+		{ "node table past the end", offsetof(SceneCacheHeader, NodeCount), (uint32_t)good.size() },
+		{ "names past the end", offsetof(SceneCacheHeader, NamesSize), (uint32_t)good.size() },
+		{ "misaligned vertices", offsetof(SceneCacheHeader, VerticesOffset), h->VerticesOffset + 4 },
+		{ "indices past the end", offsetof(SceneCacheHeader, IndexCount), (uint32_t)good.size() },
+		{ "root with a parent", firstNode + offsetof(SceneCacheNode, Parent), 0 },
+		{ "parent after the child", firstNode + sizeof(SceneCacheNode) + offsetof(SceneCacheNode, Parent), 1 },
+		{ "mesh out of range", firstNode + sizeof(SceneCacheNode) + offsetof(SceneCacheNode, Mesh), h->MeshCount },
+		{ "name past the names", firstNode + sizeof(SceneCacheNode) + offsetof(SceneCacheNode, NameOffset), h->NamesSize },
+		{ "mesh vertices past the blob", firstMesh + offsetof(SceneCacheMesh, VertexCount), h->VertexCount + 1 },
+		{ "mesh indices past the blob", firstMesh + offsetof(SceneCacheMesh, IndexCount), h->IndexCount + 1 },
+		{ "index past the mesh", h->IndicesOffset, (uint32_t)meshVertices[0].size() },
+	};
+	string path = TemporaryPath("corrupt.scenecache");
+	SceneCache cache;
+	if (!WriteFile(path, good) || !cache.Open(path.c_str())) Fail("corrupt: the unmodified cache was rejected");
+	cache.Close();
+	for (const Case& c : cases) {
+		vector<uint8_t> bad = good;
+		memcpy(bad.data() + c.Offset, &c.Value, sizeof(c.Value));
+		if (WriteFile(path, bad) && cache.Open(path.c_str())) {
+			fprintf(stderr, "corrupt: %s was accepted\n", c.Name);
+			ok = false;
+			cache.Close();
+		}
+	}
+	vector<uint8_t> truncated(good.begin(), good.end() - 1);
+	if (WriteFile(path, truncated) && cache.Open(path.c_str())) Fail("corrupt: a truncated cache was accepted");
+	cache.Close();
+	if (cache.Open(TemporaryPath("missing.scenecache").c_str())) Fail("corrupt: a missing file was opened");
+	unlink(path.c_str());
+}
+
+// 啟動時的工作: 開檔驗證, 然後照前序讀每個節點與它的模型 (建 buffer 時驅動程式會讀過這些頁)
+static void TimeLoad(int nodes, int grid, mt19937& random) {
+	vector<vector<Vertex>> meshVertices;
+	vector<vector<uint32_t>> meshIndices;
+	SceneCacheWriter writer = MakeScene(nodes, grid, random, meshVertices, meshIndices);
+	string path = TemporaryPath("large.scenecache");
+	auto begin = chrono::steady_clock::now();
+	if (!writer.Save(path.c_str())) {
+		Fail("load: Save failed");
+		return;
+	}
+	double saveMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+
+	begin = chrono::steady_clock::now();
+	SceneCache cache;
+	if (!cache.Open(path.c_str())) {
+		Fail("load: the large cache was rejected");
+		return;
+	}
+	double openMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+	uint64_t sum = 0;
+	for (uint32_t i = 0; i < cache.NodeCount(); i++) {
+		const SceneCacheNode& n = cache.Node(i);
+		sum += n.NameLength + (uint64_t)n.Local[12];
+	}
+	for (uint32_t m = 0; m < cache.MeshCount(); m++) {
+		const SceneCacheMesh& mesh = cache.Mesh(m);
+		const uint8_t* v = (const uint8_t*)cache.Vertices(mesh);
+		for (size_t b = 0; b < (size_t)mesh.VertexCount * sizeof(Vertex); b += 64) sum += v[b];
+		const uint32_t* idx = cache.Indices(mesh);
+		for (uint32_t j = 0; j < mesh.IndexCount; j += 16) sum += idx[j];
+	}
+	double loadMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+	FILE* stream = fopen(path.c_str(), "rb");
+	long bytes = 0;
+	if (stream) {
+		fseek(stream, 0, SEEK_END);
+		bytes = ftell(stream);
+		fclose(stream);
+	}
+	printf("cache %d nodes, %zu + %zu vertices: %ld bytes, save %.2f ms, open %.3f ms, open + read %.3f ms (%llu)\n",
+		nodes + 1, meshVertices[0].size(), meshVertices[1].size(), bytes, saveMs, openMs, loadMs, (unsigned long long)(sum & 0xFF));
+	cache.Close();
+	unlink(path.c_str());
+}
+
+int main(int argc, char* argv[]) {
+	int grid = argc > 1 ? atoi(argv[1]) : 200;
+	int nodes = argc > 2 ? atoi(argv[2]) : 10000;
+	if (grid < 2) grid = 2;
+	if (nodes < 1) nodes = 1;
+
+	char directory[] = "/tmp/scenecachebenchXXXXXX";
+	if (mkdtemp(directory) == nullptr) {
+		Fail("cannot create a temporary directory");
+		return 1;
+	}
+	temporaryDirectory = directory;
+
+	mt19937 random(15);
+	TestOptimizer(grid, random);
+	TestRoundTrip(random);
+	TestCorrupt(random);
+	TimeLoad(nodes, grid, random);
+
+	rmdir(directory);
+	return ExitCode();
+}
@@ -0,0 +1,222 @@
+// ShaderArchive 的測試與查詢速度: 寫出 Shaders.pak 再用 ShaderArchive 開啟, 檢查每個 blob 都找得到且內容正確
+//
+//   g++ -std=c++14 -O2 -I../Sample/Include -I../../DirectXTK/Inc ShaderArchiveBench.cpp -o shaderarchivebench
+//   ./shaderarchivebench [shaders] [lookups]
+//
+// 另外手動組出兩種 ShaderArchiveWriter 寫不出來的檔案:
+//   名稱雜湊相同的兩個項目放在同一條探測序列上, Find 必須比對名稱, 不能回傳另一個的 blob
+//   表格每一格都被佔滿 (EntryCount 卻宣稱有空格), Open 必須拒絕, 不能在 Find 裡無限迴圈
+// 以及各種損毀的檔案都要被 Open 拒絕; 任何一項失敗就回傳 1
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+
+#include "Check.h"
+#include "ShaderArchive.h"
+
+using namespace MyGame;
+
+static string temporaryPath;
+
+static bool WriteArchive(const vector<uint8_t>& data) {
+	FILE* stream = fopen(temporaryPath.c_str(), "wb");
+	if (stream == nullptr) return false;
+	bool written = fwrite(data.data(), 1, data.size(), stream) == data.size();
+	return fclose(stream) == 0 && written;
+}
+
+static bool OpenBytes(ShaderArchive& archive, const vector<uint8_t>& data) {
+	if (!WriteArchive(data)) {
+		Fail("cannot write the temporary archive");
+		return false;
+	}
+	return archive.Open(temporaryPath.c_str());
+}
+
+static bool Equals(const ShaderBlob& blob, const string& expected) {
+	return blob.Length == expected.size() && memcmp(blob.Code, expected.data(), expected.size()) == 0;
+}
+
+// 表格與資料區照格式手動排, slots 是每一格的 (名稱, 內容, 寫進表格的名稱雜湊)
+struct Slot {
+	string Name;
+	string Content;
+	uint64_t NameHash;
+};
+
+static vector<uint8_t> BuildRaw(const vector<Slot>& slots, uint32_t entryCount) {
+	uint32_t tableSize = (uint32_t)slots.size();
+	vector<uint8_t> out(sizeof(ShaderArchiveHeader) + tableSize * sizeof(ShaderArchiveEntry));
+	vector<ShaderArchiveEntry> table(tableSize);
+	memset(table.data(), 0, table.size() * sizeof(ShaderArchiveEntry));
+	for (uint32_t i = 0; i < tableSize; i++) {
+		if (slots[i].NameHash == 0) continue;
+		ShaderArchiveEntry& e = table[i];
+		e.NameHash = slots[i].NameHash;
+		e.NameOffset = (uint32_t)out.size();
+		e.NameLength = (uint32_t)slots[i].Name.size();
+		out.insert(out.end(), slots[i].Name.begin(), slots[i].Name.end());
+		e.Offset = (uint32_t)out.size();
+		e.Size = (uint32_t)slots[i].Content.size();
+		out.insert(out.end(), slots[i].Content.begin(), slots[i].Content.end());
+		e.ContentHash = ShaderArchiveFormat::Hash(slots[i].Content.data(), slots[i].Content.size());
+	}
+	ShaderArchiveHeader header = { ShaderArchiveFormat::Magic, ShaderArchiveFormat::Version, entryCount, tableSize };
+	memcpy(out.data(), &header, sizeof(header));
+	memcpy(out.data() + sizeof(header), table.data(), table.size() * sizeof(ShaderArchiveEntry));
+	return out;
+}
+
+static void TestCollision() {
+	// "Second" 放在 "First" 的起始格, 而且假裝跟 "First" 有相同的雜湊; 只比雜湊的話會拿到 "Second" 的內容
+	uint64_t hash = ShaderArchiveFormat::HashName("First");
+	uint32_t home = (uint32_t)hash & 7;
+	vector<Slot> slots(8, Slot{ "", "", 0 });
+	slots[home] = { "Second", "second blob", hash };
+	slots[(home + 1) & 7] = { "First", "first blob", hash };
+
+	ShaderArchive archive;
+	ShaderBlob blob;
+	if (!OpenBytes(archive, BuildRaw(slots, 2))) {
+		Fail("collision: a valid archive was rejected");
+		return;
+	}
+	if (!archive.Find("First", blob) || !Equals(blob, "first blob")) Fail("collision: Find returned the blob of a different name with the same hash");
+	if (archive.Find("Third", blob)) Fail("collision: found a name that is not in the archive");
+	if (!archive.Verify()) Fail("collision: content hashes did not verify");
+
+	// 寫入端: 名稱不同就要接受, 名稱相同才拒絕
+	ShaderArchiveWriter writer;
+	if (!writer.Add("A.cso", "a", 1) || writer.Add("A.cso", "b", 1)) Fail("writer: duplicate names were not rejected");
+}
+
+static void TestFullTable() {
+	// 4 格全部佔滿, 但 EntryCount 寫 3 所以通過舊的檢查; 查不存在的名稱時舊的 FindEntry 永遠找不到空格
+	vector<Slot> slots = {
+		{ "a", "1", 11 }, { "b", "2", 12 }, { "c", "3", 13 }, { "d", "4", 14 },
+	};
+	ShaderArchive archive;
+	if (OpenBytes(archive, BuildRaw(slots, 3))) {
+		ShaderBlob blob;
+		archive.Find("missing", blob);
+		Fail("full table: an archive with no empty slot was accepted");
+	}
+}
+
+static void TestCorrupt(const vector<uint8_t>& good) {
+	struct Case {
+		const char* Name;
+		size_t Offset;
+		uint32_t Value;
+	};
+	size_t firstEntry = sizeof(ShaderArchiveHeader);
+	const ShaderArchiveHeader* header = (const ShaderArchiveHeader*)good.data();
+	// 找一個有資料的格子來改
+	size_t used = firstEntry;
+	for (uint32_t i = 0; i < header->TableSize; i++) {
+		const ShaderArchiveEntry* e = (const ShaderArchiveEntry*)(good.data() + firstEntry + i * sizeof(ShaderArchiveEntry));
+		if (e->NameHash) {
+			used = firstEntry + i * sizeof(ShaderArchiveEntry);
+			break;
+		}
+	}
+	const Case cases[] = {
+		{ "bad magic", 0, 0x12345678 },
+		{ "old version", 4, 1 },
+		{ "table size not a power of two", 12, 3 },
+		{ "entry count over the table", 8, header->TableSize },
+		{ "entry count differs from the used slots", 8, header->EntryCount - 1 },
+		{ "blob offset past the end", used + offsetof(ShaderArchiveEntry, Offset), (uint32_t)good.size() + 1 },
+		{ "blob size past the end", used + offsetof(ShaderArchiveEntry, Size), (uint32_t)good.size() },
+		{ "name offset past the end", used + offsetof(ShaderArchiveEntry, NameOffset), (uint32_t)good.size() + 1 },
+		{ "name length past the end", used + offsetof(ShaderArchiveEntry, NameLength), (uint32_t)good.size() },
+	};
+	for (const Case& c : cases) {
+		vector<uint8_t> bad = good;
+		memcpy(bad.data() + c.Offset, &c.Value, sizeof(c.Value));
+		ShaderArchive archive;
+		if (OpenBytes(archive, bad)) {
+			fprintf(stderr, "corrupt: %s was accepted\n", c.Name);
+			ok = false;
+		}
+	}
+	ShaderArchive archive;
+	vector<uint8_t> truncated(good.begin(), good.begin() + sizeof(ShaderArchiveHeader) + 8);
+	if (OpenBytes(archive, truncated)) Fail("corrupt: a truncated table was accepted");
+}
+
+int main(int argc, char* argv[]) {
+	int shaders = argc > 1 ? atoi(argv[1]) : 2000;
+	int lookups = argc > 2 ? atoi(argv[2]) : 2000000;
+	if (shaders <= 1) shaders = 2;
+	if (lookups <= 0) lookups = 1;
+
+	char path[] = "/tmp/shaderarchivebenchXXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		Fail("cannot create a temporary file");
+		return 1;
+	}
+	close(fd);
+	temporaryPath = path;
+
+	// 每 4 個 permutation 裡有一個跟前一個內容相同, 應該只存一份
+	ShaderArchiveWriter writer;
+	vector<string> names, contents;
+	for (int i = 0; i < shaders; i++) {
+		names.push_back("Effect_" + to_string(i / 8) + "_Permutation" + to_string(i % 8) + ".cso");
+		contents.push_back(i % 4 == 3 ? contents.back() : "DXBC" + string((size_t)(64 + i % 200), (char)('a' + i % 26)) + to_string(i));
+		if (!writer.Add(names.back(), contents.back().data(), contents.back().size())) Fail("writer: a unique name was rejected");
+	}
+	vector<uint8_t> archiveBytes = writer.Build();
+	if (writer.UniqueBlobs() != (size_t)(shaders - shaders / 4)) Fail("writer: identical blobs were not shared");
+
+	ShaderArchive archive;
+	if (!OpenBytes(archive, archiveBytes)) {
+		Fail("round trip: the written archive was rejected");
+		unlink(path);
+		return 1;
+	}
+	if (archive.Count() != (uint32_t)shaders) Fail("round trip: wrong entry count");
+	if (!archive.Verify()) Fail("round trip: content hashes did not verify");
+	ShaderBlob blob;
+	for (int i = 0; i < shaders; i++) {
+		if (!archive.Find(names[i].c_str(), blob) || !Equals(blob, contents[i])) {
+			Fail("round trip: a blob is missing or has the wrong content");
+			break;
+		}
+		if (((uintptr_t)blob.Code & (ShaderArchiveFormat::Alignment - 1)) != 0) {
+			// 對應的位址本身是頁對齊的, 所以檔案內的 offset 對齊就代表位址對齊
+			Fail("round trip: a blob is not aligned");
+			break;
+		}
+	}
+	if (archive.Find("Effect_0_Permutation0", blob)) Fail("round trip: found a name without its extension");
+	if (archive.Find("", blob)) Fail("round trip: found an empty name");
+
+	// 查詢速度: 一半找得到, 一半找不到
+	vector<string> queries;
+	for (int i = 0; i < 1024; i++) queries.push_back(i % 2 ? names[(size_t)i * 7919 % shaders] : "Missing_" + to_string(i) + ".cso");
+	size_t found = 0;
+	auto begin = chrono::steady_clock::now();
+	for (int i = 0; i < lookups; i++) found += archive.Find(queries[i & 1023].c_str(), blob);
+	double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - begin).count() / lookups;
+	if (found != (size_t)(lookups / 2)) Fail("lookup: wrong number of hits");
+	printf("%d shaders, %zu unique blobs, %zu bytes, Find %.1f ns\n", shaders, writer.UniqueBlobs(), archiveBytes.size(), ns);
+
+	TestCollision();
+	TestFullTable();
+	TestCorrupt(archiveBytes);
+
+	unlink(path);
+	return ExitCode();
+}
@@ -0,0 +1,228 @@
+// SpriteLayer: 大部分不動的 UI 每幀只重新產生改過的 sprite, 跟每幀全部重畫的 SpriteBatch 比較 CPU 時間
+//
+//   g++ -std=c++14 -O2 -ffp-contract=off -I../../DirectXTK/Src SpriteLayerBench.cpp -o spritelayerbench
+//   ./spritelayerbench [sprites] [frames]
+//
+// 每幀全部重畫: 跟 Impl::Draw 一樣填 SpriteInfo, 再跟 RenderBatch 一樣每 2048 個寫進 Map 出來的頂點緩衝
+// SpriteLayer: 改掉一部分 sprite (移動, 換顏色, 偶爾移除再加入), Update 之後把要上傳的範圍複製到假的 GPU 緩衝
+// 最後 GPU 緩衝要跟整層重新產生的結果逐位元相同, draw run 要剛好涵蓋所有 sprite, 否則回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "RetainedSprites.h"
+
+using namespace DirectX;
+
+struct Float2 { float x, y; };
+struct Float3 { float x, y, z; };
+struct Float4 { float x, y, z, w; };
+
+// 跟 SpriteBatch::Impl::SpriteInfo 一樣的大小與排列
+struct alignas(16) SpriteInfo {
+	Float4 source;
+	Float4 destination;
+	Float4 color;
+	Float4 originRotationDepth;
+	const void* texture;
+	int flags;
+};
+
+// 跟 VertexPositionColorTexture 一樣
+struct Vertex {
+	Float3 position;
+	Float4 color;
+	Float2 textureCoordinate;
+};
+
+typedef RetainedSprites<SpriteInfo, Vertex, const void*> Layer;
+
+static const size_t MaxBatchSize = 2048;
+static const int TextureCount = 8;
+static char textures[TextureCount];
+
+static void GetTextureSize(const void*, float size[2]) {
+	size[0] = 1024;
+	size[1] = 1024;
+}
+
+// 呼叫端傳給 Draw 的參數
+struct DrawCall {
+	const void* texture;
+	Float2 position;
+	int sourceX, sourceY, sourceWidth, sourceHeight;
+	Float4 color;
+	float rotation;
+};
+
+// 跟 StoreSprite 一樣: 有 source rectangle 時 destination 的大小換成像素
+static SpriteInfo ToSprite(const DrawCall& call) {
+	SpriteInfo s = SpriteInfo();
+	s.source = { (float)call.sourceX, (float)call.sourceY, (float)call.sourceWidth, (float)call.sourceHeight };
+	s.destination = { call.position.x, call.position.y, (float)call.sourceWidth, (float)call.sourceHeight };
+	s.color = call.color;
+	s.originRotationDepth = { 0, 0, call.rotation, 0 };
+	s.texture = call.texture;
+	s.flags = SpriteVertexGenerator::SourceInTexels | SpriteVertexGenerator::DestSizeInPixels;
+	return s;
+}
+
+// 面板, 按鈕, 圖示: 同一張貼圖的 sprite 連在一起, 少數會旋轉
+static DrawCall RandomCall(mt19937& random, size_t i, size_t count) {
+	DrawCall call;
+	call.texture = &textures[i * TextureCount / count];
+	call.position = { (float)(random() % 1920), (float)(random() % 1080) };
+	call.sourceX = (int)(random() % 960);
+	call.sourceY = (int)(random() % 960);
+	call.sourceWidth = 8 + (int)(random() % 57);
+	call.sourceHeight = 8 + (int)(random() % 57);
+	call.color = { 1, 1, 1, 1 };
+	call.rotation = (random() % 16 == 0) ? (float)(random() % 628) / 100 : 0;
+	return call;
+}
+
+// 每幀全部重畫
+struct Immediate {
+	vector<SpriteInfo> queue;
+	vector<const SpriteInfo*> sorted;
+	vector<Vertex> mapped;
+	size_t position = 0;
+
+	void Frame(const vector<DrawCall>& calls) {
+		queue.resize(calls.size());
+		sorted.resize(calls.size());
+		for (size_t i = 0; i < calls.size(); i++) {
+			queue[i] = ToSprite(calls[i]);
+			sorted[i] = &queue[i];
+		}
+		float textureSize[2], inverseTextureSize[2];
+		for (size_t start = 0; start < sorted.size(); ) {
+			size_t end = start;
+			while (end < sorted.size() && sorted[end]->texture == sorted[start]->texture) end++;
+			GetTextureSize(sorted[start]->texture, textureSize);
+			inverseTextureSize[0] = 1.0f / textureSize[0];
+			inverseTextureSize[1] = 1.0f / textureSize[1];
+			for (size_t i = start; i < end; ) {
+				if (position == MaxBatchSize) position = 0;
+				size_t batch = min(end - i, MaxBatchSize - position);
+				SpriteVertexGenerator::Generate(&sorted[i], batch, &mapped[position * 4], textureSize, inverseTextureSize);
+				position += batch;
+				i += batch;
+			}
+			start = end;
+		}
+	}
+};
+
+int main(int argc, char* argv[]) {
+	size_t count = argc > 1 ? (size_t)atol(argv[1]) : 50000;
+	int frames = argc > 2 ? atoi(argv[2]) : 200;
+	if (count < TextureCount) count = TextureCount;
+	if (frames <= 0) frames = 1;
+
+	mt19937 random(12345);
+	vector<DrawCall> calls(count);
+	for (size_t i = 0; i < count; i++) calls[i] = RandomCall(random, i, count);
+
+	Immediate immediate;
+	immediate.mapped.resize(MaxBatchSize * 4);
+	auto begin = chrono::steady_clock::now();
+	for (int frame = 0; frame < frames; frame++) {
+		calls[random() % count].position.x += 1;
+		immediate.Frame(calls);
+	}
+	double immediateMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count() / frames;
+
+	printf("%zu sprites, %d textures, %d frames\n", count, TextureCount, frames);
+	printf("%-22s %10s %10s %12s\n", "", "ms/frame", "speedup", "KB/frame");
+	printf("%-22s %10.3f %10s %12.1f\n", "immediate (all)", immediateMs, "1.0x", count * 4 * sizeof(Vertex) / 1024.0);
+
+	const double editRates[] = { 0, 0.001, 0.01, 0.05, 0.2, 1 };
+	for (double rate : editRates) {
+		Layer layer;
+		vector<Vertex> gpu;
+		vector<size_t> ids;
+		size_t uploaded = 0;
+		auto upload = [&](size_t first, size_t end) {
+			memcpy(&gpu[first * 4], layer.Vertices() + first * 4, (end - first) * 4 * sizeof(Vertex));
+			uploaded += (end - first) * 4 * sizeof(Vertex);
+		};
+
+		for (size_t i = 0; i < count; i++) ids.push_back(layer.Add(ToSprite(calls[i])));
+		gpu.resize(layer.Size() * 4);
+		layer.Update(GetTextureSize, upload);
+		layer.Runs();
+
+		size_t edits = (size_t)(count * rate);
+		mt19937 edit(6789);
+		uploaded = 0;
+		begin = chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			for (size_t e = 0; e < edits; e++) {
+				size_t i = edit() % count;
+				switch (edit() % 64) {
+				case 0:
+					// 移除再加入同一個格子 (free list 會先拿回剛釋放的 id)
+					layer.Remove(ids[i]);
+					ids[i] = layer.Add(ToSprite(calls[i]));
+					break;
+				case 1:
+					layer.Edit(ids[i]).color = { 1, 0.5f, 0.5f, 1 };
+					break;
+				default:
+					layer.Edit(ids[i]).destination.x += 1;
+					break;
+				}
+			}
+			// Add 只會重複使用剛釋放的 id, 不會超出原本的大小
+			if (layer.Size() * 4 > gpu.size()) gpu.resize(layer.Size() * 4);
+			layer.Update(GetTextureSize, upload);
+			layer.Runs();
+		}
+		double retainedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count() / frames;
+
+		// 跟整層重新產生的結果比較
+		vector<Vertex> reference(layer.Size() * 4);
+		vector<const SpriteInfo*> all;
+		for (size_t id = 0; id < layer.Size(); id++) all.push_back(&layer[id]);
+		float textureSize[2] = { 1024, 1024 }, inverseTextureSize[2] = { 1.0f / 1024, 1.0f / 1024 };
+		SpriteVertexGenerator::Generate(all.data(), all.size(), reference.data(), textureSize, inverseTextureSize);
+		if (memcmp(reference.data(), gpu.data(), reference.size() * sizeof(Vertex)) != 0) {
+			fprintf(stderr, "%.1f%% edits: uploaded vertices differ from a full regeneration\n", rate * 100);
+			ok = false;
+		}
+
+		// 每個 sprite 剛好被一個 run 涵蓋, 而且 run 的貼圖跟 sprite 一樣
+		vector<int> covered(layer.Size());
+		bool runsMatch = true;
+		for (const Layer::Run& run : layer.Runs()) {
+			for (size_t id = run.first; id < run.first + run.count; id++) {
+				covered[id]++;
+				if (layer[id].texture != run.texture) runsMatch = false;
+			}
+		}
+		for (size_t id = 0; id < layer.Size(); id++) {
+			if (covered[id] != 1) runsMatch = false;
+		}
+		if (!runsMatch) {
+			fprintf(stderr, "%.1f%% edits: draw runs do not match the sprites\n", rate * 100);
+			ok = false;
+		}
+
+		char name[32];
+		snprintf(name, sizeof(name), "layer, %g%% edited", rate * 100);
+		if (retainedMs > 0.001) printf("%-22s %10.3f %9.1fx %12.1f\n", name, retainedMs, immediateMs / retainedMs, uploaded / 1024.0 / frames);
+		else printf("%-22s %10.3f %10s %12.1f\n", name, retainedMs, "-", uploaded / 1024.0 / frames);
+	}
+
+	return ExitCode();
+}
@@ -0,0 +1,130 @@
+// SpriteBatch 用 WorkerPool 分頭產生頂點: 跟單執行緒的 Generate 比較速度, 並逐位元比對結果
+//
+//   g++ -std=c++14 -O2 -ffp-contract=off -pthread -I../Sample/Include -I../../DirectXTK/Src SpriteParallelBench.cpp -o spriteparallelbench
+//   ./spriteparallelbench [sprites] [rounds] [threads]
+//
+// RenderBatch 每次 Map 最多 2048 個 sprite (MaxBatchSize), 所以一幀會切成很多段, 每段各 Dispatch 一次
+// 另外量一次整幀一起 Dispatch, 看每段喚醒 worker 的成本
+// 任何一種切法的輸出跟單執行緒不同就回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "WorkerPool.h"
+#include "SpriteVertexGenerator.h"
+
+using namespace MyGame;
+using namespace DirectX;
+
+struct Float2 { float x, y; };
+struct Float3 { float x, y, z; };
+struct Float4 { float x, y, z, w; };
+
+// 跟 SpriteBatch::Impl::SpriteInfo 一樣的大小與排列
+struct alignas(16) SpriteInfo {
+	Float4 source;
+	Float4 destination;
+	Float4 color;
+	Float4 originRotationDepth;
+	const void* texture;
+	int flags;
+};
+
+// 跟 VertexPositionColorTexture 一樣
+struct Vertex {
+	Float3 position;
+	Float4 color;
+	Float2 textureCoordinate;
+};
+
+// 跟 SpriteBatch::SetVertexDispatcher 收到的型別一樣
+typedef function<void(size_t, const function<void(size_t)>&)> Dispatcher;
+
+static const size_t MaxBatchSize = 2048;
+static const float textureSize[2] = { 1024, 1024 };
+static const float inverseTextureSize[2] = { 1.0f / 1024, 1.0f / 1024 };
+
+// 跟 RenderBatch 一樣每 batchSize 個 sprite 產生一次; jobs <= 1 時不經過 dispatcher
+static void GenerateFrame(const vector<const SpriteInfo*>& sprites, vector<Vertex>& vertices, size_t batchSize, const Dispatcher& dispatcher, size_t jobs) {
+	for (size_t begin = 0; begin < sprites.size(); begin += batchSize) {
+		size_t count = min(batchSize, sprites.size() - begin);
+		if (jobs > 1) SpriteVertexGenerator::GenerateParallel(&sprites[begin], count, &vertices[begin * 4], textureSize, inverseTextureSize, dispatcher, jobs);
+		else SpriteVertexGenerator::Generate(&sprites[begin], count, &vertices[begin * 4], textureSize, inverseTextureSize);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	size_t count = argc > 1 ? (size_t)atol(argv[1]) : 200000;
+	int rounds = argc > 2 ? atoi(argv[2]) : 50;
+	int threads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+	if (count == 0) count = 1;
+	if (rounds <= 0) rounds = 1;
+	if (threads <= 0) threads = 1;
+
+	// HUD 加上粒子: 大部分不旋轉, 一部分旋轉與翻轉
+	mt19937 random(12345);
+	uniform_real_distribution<float> unit(0, 1);
+	vector<SpriteInfo> queue(count);
+	vector<const SpriteInfo*> sprites(count);
+	for (size_t i = 0; i < count; i++) {
+		SpriteInfo& s = queue[i];
+		s = SpriteInfo();
+		s.source = { unit(random) * 1000, unit(random) * 1000, unit(random) * 24, unit(random) * 24 };
+		s.destination = { unit(random) * 1920, unit(random) * 1080, 1, 1 };
+		s.color = { unit(random), unit(random), unit(random), unit(random) };
+		s.originRotationDepth = { 12, 12, (random() % 4 == 0) ? unit(random) * 6.28f : 0.0f, unit(random) };
+		s.flags = SpriteVertexGenerator::SourceInTexels | (int)(random() % 4);
+		sprites[i] = &queue[i];
+	}
+
+	// 呼叫的執行緒也會領工作, 所以 threads 個工作只需要 threads - 1 條 worker
+	WorkerPool pool;
+	pool.Start((size_t)threads - 1);
+	Dispatcher dispatcher = [&](size_t jobCount, const function<void(size_t)>& job) {
+		pool.Dispatch((int)jobCount, [&](int index) { job((size_t)index); });
+	};
+
+	vector<Vertex> expected(count * 4), actual(count * 4);
+	auto time = [&](size_t batchSize, size_t jobs) {
+		auto begin = chrono::steady_clock::now();
+		for (int r = 0; r < rounds; r++) GenerateFrame(sprites, actual, batchSize, dispatcher, jobs);
+		auto end = chrono::steady_clock::now();
+		return chrono::duration<double, milli>(end - begin).count() / rounds;
+	};
+
+	// 先跑一次讓頂點緩衝區的分頁都配好
+	GenerateFrame(sprites, actual, MaxBatchSize, dispatcher, 1);
+	double serial = time(MaxBatchSize, 1);
+	expected = actual;
+	printf("%zu sprites, %d threads\n", count, threads);
+	printf("%-22s %8.3f ms %8.1f M sprites/s\n", "serial", serial, count / serial / 1000);
+
+	auto report = [&](const char* name, size_t batchSize, size_t jobs) {
+		memset(actual.data(), 0, actual.size() * sizeof(Vertex));
+		double ms = time(batchSize, jobs);
+		if (memcmp(expected.data(), actual.data(), expected.size() * sizeof(Vertex)) != 0) {
+			fprintf(stderr, "%s: vertices differ from the serial output\n", name);
+			ok = false;
+		}
+		printf("%-22s %8.3f ms %8.1f M sprites/s %6.2fx\n", name, ms, count / ms / 1000, ms > 0 ? serial / ms : 0.0);
+	};
+
+	report("per batch of 2048", MaxBatchSize, (size_t)threads);
+	report("whole frame", count, (size_t)threads);
+
+	// 工作數多於執行緒時結果也必須相同 (切法只跟數量有關)
+	report("per batch, 8 jobs", MaxBatchSize, 8);
+	report("whole frame, 64 jobs", count, 64);
+
+	return ExitCode();
+}
@@ -0,0 +1,127 @@
+// 比較 SpriteBatch 的三種排序: 原本對 SpriteInfo 指標的 std::sort, 與現在的 (key, index) radix sort
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Src SpriteSortBench.cpp -o spritesortbench
+//   ./spritesortbench [rounds]
+//
+// 數量從 1k 到 1M; 排序結果必須跟 std::stable_sort 完全相同 (相同的 key 維持送出的順序), 否則回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "RadixSort.h"
+
+using namespace DirectX;
+
+// 跟 SpriteBatch::Impl::SpriteInfo 一樣的大小與排列
+struct alignas(16) SpriteInfo {
+	float source[4];
+	float destination[4];
+	float color[4];
+	float originRotationDepth[4];
+	const void* texture;
+	int flags;
+};
+
+enum SortMode { Texture, BackToFront, FrontToBack };
+
+static const char* ModeName(SortMode mode) {
+	switch (mode) {
+	case Texture: return "texture";
+	case BackToFront: return "back-to-front";
+	default: return "front-to-back";
+	}
+}
+
+template<typename Compare>
+static void SortPointers(vector<const SpriteInfo*>& sorted, bool stable, Compare compare) {
+	if (stable) stable_sort(sorted.begin(), sorted.end(), compare);
+	else sort(sorted.begin(), sorted.end(), compare);
+}
+
+// 原本 SortSprites 的做法
+static void PointerSort(const vector<SpriteInfo>& queue, vector<const SpriteInfo*>& sorted, SortMode mode, bool stable) {
+	sorted.resize(queue.size());
+	for (size_t i = 0; i < queue.size(); i++) sorted[i] = &queue[i];
+	switch (mode) {
+	case Texture:
+		SortPointers(sorted, stable, [](const SpriteInfo* x, const SpriteInfo* y) { return x->texture < y->texture; });
+		break;
+	case BackToFront:
+		SortPointers(sorted, stable, [](const SpriteInfo* x, const SpriteInfo* y) { return x->originRotationDepth[3] > y->originRotationDepth[3]; });
+		break;
+	default:
+		SortPointers(sorted, stable, [](const SpriteInfo* x, const SpriteInfo* y) { return x->originRotationDepth[3] < y->originRotationDepth[3]; });
+		break;
+	}
+}
+
+// 現在 SortSprites 的做法
+static void KeySort(const vector<SpriteInfo>& queue, vector<const SpriteInfo*>& sorted, SortMode mode, vector<uint64_t>& keys, RadixSorter& sorter) {
+	size_t count = queue.size();
+	keys.resize(count);
+	sorted.resize(count);
+	for (size_t i = 0; i < count; i++) {
+		switch (mode) {
+		case Texture: keys[i] = reinterpret_cast<uintptr_t>(queue[i].texture); break;
+		case BackToFront: keys[i] = ~FloatToSortKey(queue[i].originRotationDepth[3]); break;
+		default: keys[i] = FloatToSortKey(queue[i].originRotationDepth[3]); break;
+		}
+	}
+	const uint32_t* order = sorter.Sort(keys.data(), count);
+	for (size_t i = 0; i < count; i++) sorted[i] = &queue[order[i]];
+}
+
+int main(int argc, char* argv[]) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 5;
+	if (rounds <= 0) rounds = 1;
+
+	// 粒子與 UI 常見的情況: 少量貼圖, 深度分成幾層再加上連續的值
+	vector<SpriteInfo> textures(256);
+	mt19937 random(12345);
+
+	printf("%-14s %8s %12s %12s %8s\n", "mode", "sprites", "std::sort", "radix", "speedup");
+	for (SortMode mode : { Texture, BackToFront, FrontToBack }) {
+		for (size_t count = 1000; count <= 1000000; count *= 10) {
+			vector<SpriteInfo> queue(count);
+			for (size_t i = 0; i < count; i++) {
+				SpriteInfo& s = queue[i];
+				s = SpriteInfo();
+				s.texture = &textures[random() % textures.size()];
+				s.originRotationDepth[3] = (random() % 4) ? (float)(random() % 16) / 16.0f : (float)(random() % 100000) / 100000.0f;
+				if (random() % 64 == 0) s.originRotationDepth[3] = -0.0f;
+			}
+
+			vector<const SpriteInfo*> reference, expected, actual;
+			vector<uint64_t> keys;
+			RadixSorter sorter;
+			double pointerTime = 0, radixTime = 0;
+			for (int r = 0; r < rounds; r++) {
+				auto t0 = chrono::steady_clock::now();
+				PointerSort(queue, reference, mode, false);
+				auto t1 = chrono::steady_clock::now();
+				KeySort(queue, actual, mode, keys, sorter);
+				auto t2 = chrono::steady_clock::now();
+				pointerTime += chrono::duration<double, milli>(t1 - t0).count();
+				radixTime += chrono::duration<double, milli>(t2 - t1).count();
+			}
+
+			// std::sort 對相同的 key 沒有固定順序, 所以用 stable_sort 逐一比對指標
+			PointerSort(queue, expected, mode, true);
+			if (expected != actual) {
+				fprintf(stderr, "%s %zu: order differs from std::stable_sort\n", ModeName(mode), count);
+				ok = false;
+			}
+
+			printf("%-14s %8zu %10.3fms %10.3fms %7.1fx\n", ModeName(mode), count,
+				pointerTime / rounds, radixTime / rounds, radixTime > 0 ? pointerTime / radixTime : 0.0);
+		}
+	}
+	return ExitCode();
+}
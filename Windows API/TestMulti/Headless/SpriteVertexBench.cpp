@@ -0,0 +1,194 @@
+// SpriteBatch 產生頂點的速度: 原本一次一個 sprite 的 RenderSprite, 與現在一次 4 / 8 個的 SpriteVertexGenerator
+//
+//   g++ -std=c++14 -O2 -ffp-contract=off -I../../DirectXTK/Src SpriteVertexBench.cpp -o spritevertexbench
+//   g++ -std=c++14 -O2 -ffp-contract=off -mavx2 -I../../DirectXTK/Src SpriteVertexBench.cpp -o spritevertexbench
+//   ./spritevertexbench [rounds]
+//
+// 每種寬度 (scalar, SSE2, AVX) 的輸出都必須跟 RenderSprite 的結果逐位元相同, 否則回傳 1
+// (-ffp-contract=off: 跟 MSVC 預設一樣不把乘加合併成 FMA, 否則純量的參考結果會有捨入差異)
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "SpriteVertexGenerator.h"
+
+using namespace DirectX;
+
+struct Float2 { float x, y; };
+struct Float3 { float x, y, z; };
+struct Float4 { float x, y, z, w; };
+
+// 跟 SpriteBatch::Impl::SpriteInfo 一樣的大小與排列
+struct alignas(16) SpriteInfo {
+	Float4 source;
+	Float4 destination;
+	Float4 color;
+	Float4 originRotationDepth;
+	const void* texture;
+	int flags;
+};
+
+// 跟 VertexPositionColorTexture 一樣
+struct Vertex {
+	Float3 position;
+	Float4 color;
+	Float2 textureCoordinate;
+};
+
+// DirectXMath 的 XMScalarSinCos
+static void ScalarSinCos(float* pSin, float* pCos, float Value) {
+	float quotient = 0.159154943f * Value;
+	if (Value >= 0.0f) quotient = (float)((int)(quotient + 0.5f));
+	else quotient = (float)((int)(quotient - 0.5f));
+	float y = Value - 6.283185307f * quotient;
+	float sign;
+	if (y > 1.570796327f) {
+		y = 3.141592654f - y;
+		sign = -1.0f;
+	}
+	else if (y < -1.570796327f) {
+		y = -3.141592654f - y;
+		sign = -1.0f;
+	}
+	else {
+		sign = +1.0f;
+	}
+	float y2 = y * y;
+	*pSin = (((((-2.3889859e-08f * y2 + 2.7525562e-06f) * y2 - 0.00019840874f) * y2 + 0.0083333310f) * y2 - 0.16666667f) * y2 + 1.0f) * y;
+	float p = ((((-2.6051615e-07f * y2 + 2.4760495e-05f) * y2 - 0.0013888378f) * y2 + 0.041666638f) * y2 - 0.5f) * y2 + 1.0f;
+	*pCos = sign * p;
+}
+
+// 原本的 RenderSprite 逐步改寫成純量, 運算順序相同
+static void RenderSprite(const SpriteInfo* sprite, Vertex* vertices, const float textureSize[2], const float inverseTextureSize[2]) {
+	float source[2] = { sprite->source.x, sprite->source.y };
+	float sourceSize[2] = { sprite->source.z, sprite->source.w };
+	float destination[2] = { sprite->destination.x, sprite->destination.y };
+	float destinationSize[2] = { sprite->destination.z, sprite->destination.w };
+	float origin[2];
+	for (int k = 0; k < 2; k++) {
+		float nonZero = sourceSize[k] == 0 ? SpriteVertexGenerator::Epsilon : sourceSize[k];
+		origin[k] = (k ? sprite->originRotationDepth.y : sprite->originRotationDepth.x) / nonZero;
+	}
+	for (int k = 0; k < 2; k++) {
+		if (sprite->flags & SpriteVertexGenerator::SourceInTexels) {
+			source[k] *= inverseTextureSize[k];
+			sourceSize[k] *= inverseTextureSize[k];
+		}
+		else {
+			origin[k] *= inverseTextureSize[k];
+		}
+		if (!(sprite->flags & SpriteVertexGenerator::DestSizeInPixels)) destinationSize[k] *= textureSize[k];
+	}
+	float r1[2] = { 1, 0 }, r2[2] = { 0, 1 };
+	if (sprite->originRotationDepth.z != 0) {
+		float sin, cos;
+		ScalarSinCos(&sin, &cos, sprite->originRotationDepth.z);
+		r1[0] = cos; r1[1] = sin;
+		r2[0] = -sin; r2[1] = cos;
+	}
+	static const float corners[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+	int mirror = sprite->flags & 3;
+	for (int i = 0; i < 4; i++) {
+		float offset[2] = { (corners[i][0] - origin[0]) * destinationSize[0], (corners[i][1] - origin[1]) * destinationSize[1] };
+		vertices[i].position.x = offset[1] * r2[0] + (offset[0] * r1[0] + destination[0]);
+		vertices[i].position.y = offset[1] * r2[1] + (offset[0] * r1[1] + destination[1]);
+		vertices[i].position.z = sprite->originRotationDepth.w;
+		vertices[i].color = sprite->color;
+		vertices[i].textureCoordinate.x = corners[i ^ mirror][0] * sourceSize[0] + source[0];
+		vertices[i].textureCoordinate.y = corners[i ^ mirror][1] * sourceSize[1] + source[1];
+	}
+}
+
+// 只用某一種寬度跑完全部 (Generate 會自動選最寬的, 這裡要分開量)
+template<typename Lanes>
+static void GenerateWith(const SpriteInfo* const* sprites, size_t count, Vertex* vertices, const float textureSize[2], const float inverseTextureSize[2]) {
+	size_t i = 0;
+	for (; i + Lanes::Width <= count; i += Lanes::Width)
+		SpriteVertexGenerator::GenerateBlock<Lanes>(sprites + i, vertices + i * 4, textureSize, inverseTextureSize);
+	for (; i < count; i++)
+		SpriteVertexGenerator::GenerateBlock<SpriteVertexGenerator::ScalarLanes>(sprites + i, vertices + i * 4, textureSize, inverseTextureSize);
+}
+
+template<typename Function>
+static double SpritesPerSecond(int rounds, size_t count, Function f) {
+	auto begin = chrono::steady_clock::now();
+	for (int r = 0; r < rounds; r++) f();
+	auto end = chrono::steady_clock::now();
+	double seconds = chrono::duration<double>(end - begin).count();
+	return seconds > 0 ? (double)count * rounds / seconds : 0.0;
+}
+
+int main(int argc, char* argv[]) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 200;
+	if (rounds <= 0) rounds = 1;
+
+	// 一個 batch 最多 2048 個 sprite (SpriteBatch 的 MaxBatchSize), 多出 3 個讓每種寬度都會走到剩下的尾巴
+	const size_t count = 2048 + 3;
+	const float textureSize[2] = { 512, 256 };
+	const float inverseTextureSize[2] = { 1.0f / textureSize[0], 1.0f / textureSize[1] };
+
+	mt19937 random(12345);
+	uniform_real_distribution<float> unit(0, 1);
+	vector<SpriteInfo> queue(count);
+	vector<const SpriteInfo*> sprites(count);
+	for (size_t i = 0; i < count; i++) {
+		SpriteInfo& s = queue[i];
+		s = SpriteInfo();
+		s.source = { unit(random) * 256, unit(random) * 128, unit(random) * 64, unit(random) * 64 };
+		if (random() % 16 == 0) s.source.z = 0;
+		s.destination = { unit(random) * 1920, unit(random) * 1080, unit(random) * 2, unit(random) * 2 };
+		s.color = { unit(random), unit(random), unit(random), 1 };
+		s.originRotationDepth = { unit(random) * 32, unit(random) * 32, (random() % 2) ? (unit(random) - 0.5f) * 20 : 0.0f, unit(random) };
+		s.flags = (int)(random() % 16);
+		sprites[i] = &queue[i];
+	}
+
+	vector<Vertex> expected(count * 4), actual(count * 4);
+	for (size_t i = 0; i < count; i++) RenderSprite(sprites[i], &expected[i * 4], textureSize, inverseTextureSize);
+	auto check = [&](const char* name) {
+		if (memcmp(expected.data(), actual.data(), expected.size() * sizeof(Vertex)) != 0) {
+			fprintf(stderr, "%s: vertices differ from RenderSprite\n", name);
+			ok = false;
+		}
+		memset(actual.data(), 0, actual.size() * sizeof(Vertex));
+	};
+
+	double reference = SpritesPerSecond(rounds, count, [&] {
+		for (size_t i = 0; i < count; i++) RenderSprite(sprites[i], &actual[i * 4], textureSize, inverseTextureSize);
+	});
+	check("RenderSprite");
+	printf("%-16s %8.1f M sprites/s\n", "per sprite", reference / 1e6);
+
+	auto report = [&](const char* name, double rate) {
+		check(name);
+		printf("%-16s %8.1f M sprites/s %6.1fx\n", name, rate / 1e6, reference > 0 ? rate / reference : 0.0);
+	};
+
+	report("scalar", SpritesPerSecond(rounds, count, [&] {
+		GenerateWith<SpriteVertexGenerator::ScalarLanes>(sprites.data(), count, actual.data(), textureSize, inverseTextureSize);
+	}));
+#if defined(SPRITE_VERTEX_SSE2)
+	report("sse2 x4", SpritesPerSecond(rounds, count, [&] {
+		GenerateWith<SpriteVertexGenerator::SSELanes>(sprites.data(), count, actual.data(), textureSize, inverseTextureSize);
+	}));
+#endif
+#if defined(SPRITE_VERTEX_AVX)
+	report("avx x8", SpritesPerSecond(rounds, count, [&] {
+		GenerateWith<SpriteVertexGenerator::AVXLanes>(sprites.data(), count, actual.data(), textureSize, inverseTextureSize);
+	}));
+#endif
+	report("Generate", SpritesPerSecond(rounds, count, [&] {
+		SpriteVertexGenerator::Generate(sprites.data(), count, actual.data(), textureSize, inverseTextureSize);
+	}));
+
+	return ExitCode();
+}
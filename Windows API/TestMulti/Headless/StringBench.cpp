@@ -0,0 +1,175 @@
+// 比較 String 與改寫前的實作 (每次 Format / 複製 / 相加都配置一次) 的 format, concat, copy 速度與配置次數
+//
+//   g++ -std=c++14 -O2 -I../Sample/Include StringBench.cpp -o stringbench
+//   ./stringbench [iterations]
+//
+// 每幀 HUD 的 Format 在第一次之後若還有配置記憶體就回傳 1
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+
+using namespace std;
+
+#include "Check.h"
+#include "String.h"
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+	allocations++;
+	if (void* p = malloc(size ? size : 1)) return p;
+	throw bad_alloc();
+}
+
+void* operator new[](size_t size) {
+	allocations++;
+	if (void* p = malloc(size ? size : 1)) return p;
+	throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// 改寫前 String 的配置方式: 先格式化到 BUFFER_MAX_CCH 的堆疊緩衝區, 再配置剛好的大小複製過去
+class LegacyString {
+	unique_ptr<TCHAR[]> string;
+	size_t length = 0;
+
+public:
+	LegacyString() = default;
+
+	LegacyString(const LegacyString& other) {
+		*this = other;
+	}
+
+	explicit LegacyString(size_t length) : string(new TCHAR[length + 1]), length(length) {
+		string[length] = TEXT('\0');
+	}
+
+	LegacyString& operator=(const LegacyString& other) {
+		if (this != &other) {
+			string.reset(new TCHAR[other.length + 1]);
+			length = other.length;
+			memcpy(string.get(), other.string.get(), (length + 1) * sizeof(TCHAR));
+		}
+		return *this;
+	}
+
+	LegacyString operator+(const LegacyString& other) const {
+		LegacyString ret(length + other.length);
+		memcpy(ret.string.get(), string.get(), length * sizeof(TCHAR));
+		memcpy(ret.string.get() + length, other.string.get(), (other.length + 1) * sizeof(TCHAR));
+		return ret;
+	}
+
+	void Format(LPCTSTR format, ...) {
+		TCHAR formatString[BUFFER_MAX_CCH];
+		va_list argptr;
+		va_start(argptr, format);
+		int n = StringTraits::VFormat(formatString, BUFFER_MAX_CCH, format, argptr);
+		va_end(argptr);
+		length = n < 0 ? 0 : (size_t)n;
+		string.reset(new TCHAR[length + 1]);
+		memcpy(string.get(), formatString, (length + 1) * sizeof(TCHAR));
+	}
+
+	size_t Length() const {
+		return length;
+	}
+};
+
+struct BenchResult {
+	double NanosecondsPerOp;
+	double AllocationsPerOp;
+};
+
+template<typename Function>
+static BenchResult Run(int iterations, Function f) {
+	size_t before = allocations;
+	auto begin = chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++) f(i);
+	auto end = chrono::steady_clock::now();
+	return { chrono::duration<double, nano>(end - begin).count() / iterations, (double)(allocations - before) / iterations };
+}
+
+static void Report(const char* name, const BenchResult& legacy, const BenchResult& current) {
+	printf("%-12s legacy %8.1f ns %5.2f allocs   string %8.1f ns %5.2f allocs   %.1fx\n",
+		name, legacy.NanosecondsPerOp, legacy.AllocationsPerOp, current.NanosecondsPerOp, current.AllocationsPerOp,
+		current.NanosecondsPerOp > 0 ? legacy.NanosecondsPerOp / current.NanosecondsPerOp : 0.0);
+}
+
+int main(int argc, char* argv[]) {
+	int iterations = argc > 1 ? atoi(argv[1]) : 1000000;
+	if (iterations <= 0) iterations = 1;
+	size_t sink = 0;
+
+	// 跟 Test 的 GetFPS 一樣的 HUD 文字
+	LegacyString legacyHud;
+	String hud;
+	BenchResult legacyFormat = Run(iterations, [&](int i) {
+		legacyHud.Format(TEXT("%.2lf  %d/%d  draws %d  saved %d"), 59.94 + i % 7, i % 1000, 1000, i % 37, i % 512);
+		sink += legacyHud.Length();
+	});
+	// 第一幀用最長的文字, 之後的 Format 都應該沿用同一塊空間
+	hud.Format(TEXT("%.2lf  %d/%d  draws %d  saved %d"), 65.94, 999, 1000, 36, 511);
+	BenchResult format = Run(iterations, [&](int i) {
+		hud.Format(TEXT("%.2lf  %d/%d  draws %d  saved %d"), 59.94 + i % 7, i % 1000, 1000, i % 37, i % 512);
+		sink += hud.Length();
+	});
+	Report("format", legacyFormat, format);
+
+	TCHAR buffer[64];
+	BenchResult formatTo = Run(iterations, [&](int i) {
+		sink += String::FormatTo(buffer, 64, TEXT("%.2lf"), 59.94 + i % 7);
+	});
+	Report("format to", legacyFormat, formatTo);
+
+	LegacyString legacyA, legacyB;
+	legacyA.Format(TEXT("Cores: %d"), 8);
+	legacyB.Format(TEXT("  LogicalProcessors: %d"), 16);
+	String a(TEXT("Cores: %d"), 8), b(TEXT("  LogicalProcessors: %d"), 16);
+	BenchResult legacyConcat = Run(iterations, [&](int) {
+		LegacyString c = legacyA + legacyB;
+		sink += c.Length();
+	});
+	BenchResult concat = Run(iterations, [&](int) {
+		String c = a + b;
+		sink += c.Length();
+	});
+	Report("concat", legacyConcat, concat);
+
+	BenchResult legacyCopy = Run(iterations, [&](int) {
+		LegacyString c(legacyA);
+		sink += c.Length();
+	});
+	BenchResult copy = Run(iterations, [&](int) {
+		String c(a);
+		sink += c.Length();
+	});
+	Report("copy", legacyCopy, copy);
+
+	LegacyString legacyLong;
+	legacyLong.Format(TEXT("%s\n%s\nCores: %d\nLogicalProcessors: %d\n%s"), TEXT("DirectX 11.1"), TEXT("NVIDIA GeForce GTX 1080"), 8, 16, TEXT("8 GB"));
+	String longText(TEXT("%s\n%s\nCores: %d\nLogicalProcessors: %d\n%s"), TEXT("DirectX 11.1"), TEXT("NVIDIA GeForce GTX 1080"), 8, 16, TEXT("8 GB"));
+	String assigned;
+	BenchResult legacyAssign = Run(iterations, [&](int) {
+		LegacyString c;
+		c = legacyLong;
+		sink += c.Length();
+	});
+	BenchResult assign = Run(iterations, [&](int) {
+		assigned = longText;
+		sink += assigned.Length();
+	});
+	Report("assign long", legacyAssign, assign);
+
+	printf("sink %zu\n", sink);
+	if (format.AllocationsPerOp != 0 || formatTo.AllocationsPerOp != 0) Fail("HUD formatting allocated after the first frame");
+	return ExitCode();
+}
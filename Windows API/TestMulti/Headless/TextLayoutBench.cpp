@@ -0,0 +1,436 @@
+// SpriteFont 的文字排版快取: 每幀都一樣的標籤, 比較每次重新排版逐字 Draw 與快取排版後整串 DrawRun 的 CPU 時間
+//
+//   g++ -std=c++14 -O2 -I../../DirectXTK/Src TextLayoutBench.cpp -o textlayoutbench
+//   ./textlayoutbench [labels] [frames]
+//
+// 1. 選單畫面: 每幀每個標籤 MeasureString 一次 (置中) 再 DrawString 一次, 字串都不變, 三分之一左右鏡像
+// 2. 聊天紀錄: 每幀有一部分字串是新的, 快取放得下全部與只放一半各量一次, 看命中率與淘汰數
+// 快取的字串連 sprite 的來源矩形與 origin 都留著, 命中時直接交給 DrawRun; 字串第二次畫才放進快取
+// 兩種做法排進佇列的 sprite 要逐位元相同, LRU 淘汰順序要對, 只見過一次的字串不能進快取, 否則回傳 1
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwctype>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "GlyphIndex.h"
+#include "TextLayoutCache.h"
+
+using namespace DirectX;
+
+struct Rect { int32_t left, top, right, bottom; };
+struct Float2 { float x, y; };
+struct Float4 { float x, y, z, w; };
+
+// 跟 SpriteFont::Glyph 一樣
+struct Glyph {
+	uint32_t Character;
+	Rect Subrect;
+	float XOffset, YOffset, XAdvance;
+};
+
+// 跟 SpriteBatch::Impl::SpriteInfo 一樣的大小與排列
+struct alignas(16) SpriteInfo {
+	Float4 source;
+	Float4 destination;
+	Float4 color;
+	Float4 originRotationDepth;
+	const void* texture;
+	int flags;
+};
+
+struct PlacedGlyph {
+	const Glyph* glyph;
+	float x, y, advance;
+};
+
+// 跟 SpriteFont::Impl::Layout 一樣
+struct Layout {
+	vector<PlacedGlyph> glyphs;
+	Float2 size = { 0, 0 };
+	int mirroring = -1;
+	vector<Rect> rectangles;
+	vector<Float2> origins;
+
+	void clear() {
+		glyphs.clear();
+		size = { 0, 0 };
+		mirroring = -1;
+		rectangles.clear();
+		origins.clear();
+	}
+};
+
+static char fontTexture;
+
+// ASCII 字型, 寬度不一
+struct Font {
+	vector<Glyph> glyphs;
+	GlyphIndex index;
+	float lineSpacing = 20;
+
+	Font() {
+		int x = 0, y = 0;
+		for (uint32_t c = 32; c < 127; c++) {
+			int w = (c == ' ') ? 1 : 5 + (int)(c * 7 % 6);
+			if (x + w > 256) { x = 0; y += 20; }
+			glyphs.push_back({ c, { x, y, x + w, y + 16 }, (c % 5 == 0) ? -1.0f : 0.0f, (float)(c % 3), (c == ' ') ? 4.0f : 1.0f });
+			x += w + 1;
+		}
+		vector<uint32_t> codepoints;
+		for (const Glyph& g : glyphs) codepoints.push_back(g.Character);
+		index.Build(codepoints.data(), codepoints.size());
+	}
+
+	const Glyph* FindGlyph(wchar_t c) const {
+		uint32_t i = index.Find((uint32_t)c);
+		return &glyphs[(i != GlyphIndex::NotFound) ? i : 0];
+	}
+
+	// 跟 SpriteFont::Impl::ForEachGlyph 一樣
+	template<typename TAction>
+	void ForEachGlyph(const wchar_t* text, TAction action) const {
+		float x = 0, y = 0;
+		for (; *text; text++) {
+			wchar_t character = *text;
+			switch (character) {
+			case '\r':
+				continue;
+			case '\n':
+				x = 0;
+				y += lineSpacing;
+				break;
+			default:
+				const Glyph* glyph = FindGlyph(character);
+				x += glyph->XOffset;
+				if (x < 0) x = 0;
+				float advance = glyph->Subrect.right - glyph->Subrect.left + glyph->XAdvance;
+				if (!iswspace(character) || ((glyph->Subrect.right - glyph->Subrect.left) > 1) || ((glyph->Subrect.bottom - glyph->Subrect.top) > 1)) {
+					action(glyph, x, y, advance);
+				}
+				x += advance;
+				break;
+			}
+		}
+	}
+};
+
+// SpriteBatch 的佇列: Impl::Draw 逐個加入, Impl::DrawRun 一次加入一整串
+struct Queue {
+	vector<SpriteInfo> sprites;
+	size_t count = 0;
+	vector<const void*> references;
+
+	void Reserve(size_t n) {
+		if (sprites.size() < n) sprites.resize(max(n, sprites.size() * 2));
+	}
+
+	static void Store(SpriteInfo* s, Float2 position, const Rect& r, Float2 origin, int effects) {
+		s->source = { (float)r.left, (float)r.top, (float)(r.right - r.left), (float)(r.bottom - r.top) };
+		s->destination = { position.x, position.y, s->source.z, s->source.w };
+		s->color = { 1, 1, 1, 1 };
+		s->originRotationDepth = { origin.x, origin.y, 0, 0 };
+		s->texture = &fontTexture;
+		s->flags = 4 | 8 | effects;
+	}
+
+	__attribute__((noinline)) void Draw(const void* texture, Float2 position, const Rect* source, Float2 origin, int effects) {
+		if (!texture) abort();
+		Reserve(count + 1);
+		Store(&sprites[count++], position, *source, origin, effects);
+		if (references.empty() || references.back() != texture) references.push_back(texture);
+	}
+
+	__attribute__((noinline)) void DrawRun(const void* texture, Float2 position, const Rect* sources, const Float2* origins, size_t n, int effects) {
+		if (!texture) abort();
+		Reserve(count + n);
+		SpriteInfo* s = &sprites[count];
+		for (size_t i = 0; i < n; i++) Store(&s[i], position, sources[i], origins[i], effects);
+		count += n;
+		if (references.empty() || references.back() != texture) references.push_back(texture);
+	}
+};
+
+// SpriteFont::Impl::DrawString 的 origin: 鏡像 (只有左右) 時從字串右邊往回放, 每個字指定右緣
+static Float2 GlyphOrigin(const Glyph* g, float x, float y, int effects, Float2 base) {
+	float w = (float)(g->Subrect.right - g->Subrect.left);
+	return { effects ? x + base.x + w : base.x - x, base.y - (y + g->YOffset) };
+}
+
+// 跟 SpriteFont::Impl::GlyphExtent 一樣
+static Float2 GlyphExtent(const Font& font, const Glyph* g, float x, float y) {
+	float w = (float)(g->Subrect.right - g->Subrect.left);
+	float h = max((float)(g->Subrect.bottom - g->Subrect.top) + g->YOffset, font.lineSpacing);
+	return { x + w, y + h };
+}
+
+static Float2 LayoutSize(const Font& font, const wchar_t* text) {
+	Float2 size = { 0, 0 };
+	font.ForEachGlyph(text, [&](const Glyph* g, float x, float y, float) {
+		Float2 e = GlyphExtent(font, g, x, y);
+		size.x = max(size.x, e.x);
+		size.y = max(size.y, e.y);
+	});
+	return size;
+}
+
+// 原本的 SpriteFont: 每次都排版, 每個字一次 Draw, 鏡像時每次都要先量一次
+struct Uncached {
+	const Font& font;
+	explicit Uncached(const Font& font) : font(font) {}
+
+	Float2 Measure(const wchar_t* text) {
+		return LayoutSize(font, text);
+	}
+
+	void DrawString(Queue& queue, const wchar_t* text, Float2 position, int effects) {
+		Float2 base = { effects ? -Measure(text).x : 0.0f, 0 };
+		font.ForEachGlyph(text, [&](const Glyph* g, float x, float y, float) {
+			queue.Draw(&fontTexture, position, &g->Subrect, GlyphOrigin(g, x, y, effects, base), effects);
+		});
+	}
+};
+
+// 現在的 SpriteFont: 排版, 大小與 sprite 都從快取拿, 整串一次 DrawRun; 只見過一次的字串直接排版
+struct Cached {
+	const Font& font;
+	TextLayoutCache<wchar_t, Layout> cache;
+	vector<Rect> rectangles;
+	vector<Float2> origins;
+
+	Cached(const Font& font, size_t capacity) : font(font) { cache.SetCapacity(capacity); }
+
+	// 跟 SpriteFont::Impl::FindLayout 一樣
+	Layout* FindLayout(const wchar_t* text, bool insert) {
+		if (!cache.Capacity()) return nullptr;
+		size_t length = wcslen(text);
+		Layout* layout = cache.Find(text, length);
+		if (!layout && insert) {
+			layout = cache.Insert(text, length);
+			if (layout) {
+				font.ForEachGlyph(text, [&](const Glyph* g, float x, float y, float advance) {
+					layout->glyphs.push_back({ g, x, y, advance });
+					Float2 e = GlyphExtent(font, g, x, y);
+					layout->size.x = max(layout->size.x, e.x);
+					layout->size.y = max(layout->size.y, e.y);
+				});
+			}
+		}
+		return layout;
+	}
+
+	Float2 Measure(const wchar_t* text) {
+		Layout* layout = FindLayout(text, false);
+		return layout ? layout->size : LayoutSize(font, text);
+	}
+
+	void DrawString(Queue& queue, const wchar_t* text, Float2 position, int effects) {
+		Layout* layout = FindLayout(text, true);
+		auto& runRectangles = layout ? layout->rectangles : rectangles;
+		auto& runOrigins = layout ? layout->origins : origins;
+		if (!layout || layout->mirroring != effects) {
+			Float2 base = { 0, 0 };
+			if (effects) base.x = -(layout ? layout->size : LayoutSize(font, text)).x;
+			runRectangles.clear();
+			runOrigins.clear();
+			auto place = [&](const Glyph* g, float x, float y, float) {
+				runRectangles.push_back(g->Subrect);
+				runOrigins.push_back(GlyphOrigin(g, x, y, effects, base));
+			};
+			if (layout) {
+				for (const PlacedGlyph& p : layout->glyphs) place(p.glyph, p.x, p.y, p.advance);
+				layout->mirroring = effects;
+			} else {
+				font.ForEachGlyph(text, place);
+			}
+		}
+		queue.DrawRun(&fontTexture, position, runRectangles.data(), runOrigins.data(), runRectangles.size(), effects);
+	}
+};
+
+static wstring RandomLabel(mt19937& random) {
+	static const wchar_t* words[] = { L"Start", L"Options", L"Audio", L"Video", L"Resolution", L"Fullscreen", L"Volume", L"Back",
+		L"Continue", L"Inventory", L"Quest", L"Map", L"Save", L"Load", L"Quit", L"Health:", L"Mana", L"Gold", L"Level", L"Score" };
+	wstring label;
+	int n = 1 + (int)(random() % 4);
+	for (int i = 0; i < n; i++) {
+		if (i) label += L' ';
+		label += words[random() % 20];
+	}
+	if (random() % 4 == 0) label += L"\n(" + to_wstring(random() % 1000) + L")";
+	return label;
+}
+
+// 置中畫一個標籤: 跟 UI 常見的用法一樣先量再畫
+template<typename TFont>
+static void DrawLabel(TFont& font, Queue& queue, const wstring& label, Float2 center, int effects) {
+	Float2 size = font.Measure(label.c_str());
+	font.DrawString(queue, label.c_str(), { center.x - size.x / 2, center.y - size.y / 2 }, effects);
+}
+
+static bool SameQueue(const Queue& a, const Queue& b) {
+	return a.count == b.count && memcmp(a.sprites.data(), b.sprites.data(), a.count * sizeof(SpriteInfo)) == 0;
+}
+
+static uint64_t Checksum(const Queue& queue) {
+	uint64_t hash = 14695981039346656037ull;
+	const uint8_t* bytes = reinterpret_cast<const uint8_t*>(queue.sprites.data());
+	for (size_t i = 0; i < queue.count * sizeof(SpriteInfo); i++) hash = (hash ^ bytes[i]) * 1099511628211ull;
+	return hash;
+}
+
+// 聊天紀錄: 每幀捲掉最舊的 newLines 行, 加上新的; 兩種做法用同一個亂數種子各跑一次, 回傳總共幾 us, 每幀的 sprite 記在 sums
+template<typename TFont>
+static double RunChat(TFont& font, vector<wstring> log, const vector<Float2>& centers, const vector<int>& mirrored,
+	int frames, size_t newLines, vector<uint64_t>& sums) {
+	mt19937 random(777);
+	Queue queue;
+	double us = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		for (size_t i = 0; i < newLines; i++) {
+			log.erase(log.begin());
+			log.push_back(RandomLabel(random));
+		}
+		queue.count = 0;
+		queue.references.clear();
+		auto t0 = chrono::steady_clock::now();
+		for (size_t i = 0; i < log.size(); i++) DrawLabel(font, queue, log[i], centers[i], mirrored[i]);
+		us += chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count();
+		sums.push_back(Checksum(queue));
+	}
+	return us;
+}
+
+int main(int argc, char* argv[]) {
+	size_t labelCount = argc > 1 ? (size_t)atol(argv[1]) : 300;
+	int frames = argc > 2 ? atoi(argv[2]) : 500;
+	if (labelCount == 0) labelCount = 1;
+	if (frames <= 0) frames = 1;
+
+	Font font;
+	mt19937 random(12345);
+	vector<wstring> labels;
+	vector<Float2> centers;
+	vector<int> mirrored;
+	size_t glyphs = 0;
+	for (size_t i = 0; i < labelCount; i++) {
+		labels.push_back(RandomLabel(random));
+		centers.push_back({ (float)(random() % 1920), (float)(random() % 1080) });
+		mirrored.push_back(random() % 3 == 0);
+		glyphs += labels.back().size();
+	}
+
+	// 1. 選單: 字串每幀都一樣
+	{
+		Uncached uncached(font);
+		Cached cached(font, 1024);
+		Queue a, b;
+
+		auto t0 = chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			a.count = 0;
+			a.references.clear();
+			for (size_t i = 0; i < labelCount; i++) DrawLabel(uncached, a, labels[i], centers[i], mirrored[i]);
+		}
+		auto t1 = chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			b.count = 0;
+			b.references.clear();
+			for (size_t i = 0; i < labelCount; i++) DrawLabel(cached, b, labels[i], centers[i], mirrored[i]);
+		}
+		auto t2 = chrono::steady_clock::now();
+
+		if (!SameQueue(a, b)) {
+			fprintf(stderr, "menu: cached layout queued different sprites\n");
+			ok = false;
+		}
+
+		double uncachedUs = chrono::duration<double, micro>(t1 - t0).count() / frames;
+		double cachedUs = chrono::duration<double, micro>(t2 - t1).count() / frames;
+		auto stats = cached.cache.GetStatistics();
+		printf("menu: %zu labels, %zu characters, %zu sprites per frame\n", labelCount, glyphs, a.count);
+		printf("  layout + Draw per glyph   %8.1f us/frame  %6.1f ns/sprite\n", uncachedUs, uncachedUs * 1000 / a.count);
+		printf("  cached layout + DrawRun   %8.1f us/frame  %6.1f ns/sprite  %.1fx\n", cachedUs, cachedUs * 1000 / a.count, uncachedUs / cachedUs);
+		printf("  hits %zu  misses %zu  evictions %zu  strings %zu\n", stats.Hits, stats.Misses, stats.Evictions, stats.Strings);
+	}
+
+	// 2. 聊天紀錄: 每幀畫最近 labelCount 行, 其中 10% 是新的一行 (捲動)
+	// 快取放得下全部與只放一半各量一次; 一行只活 10 幀, 前兩次一定沒命中
+	// 兩種做法輪流各跑三次, 每次都是新的快取, 取最快的一次
+	for (size_t capacity : { labelCount, labelCount / 2 }) {
+		size_t newLines = max<size_t>(labelCount / 10, 1);
+		// 鏡像跟著字串走, 不是跟著畫面上的位置; 聊天紀錄都不鏡像
+		vector<int> unmirrored(labelCount, 0);
+		double uncachedUs = 1e300, cachedUs = 1e300;
+		TextLayoutCache<wchar_t, Layout>::Statistics stats = {};
+		for (int round = 0; round < 3; round++) {
+			Uncached uncached(font);
+			Cached cached(font, capacity);
+			vector<uint64_t> a, b;
+			uncachedUs = min(uncachedUs, RunChat(uncached, labels, centers, unmirrored, frames, newLines, a));
+			cachedUs = min(cachedUs, RunChat(cached, labels, centers, unmirrored, frames, newLines, b));
+			if (a != b) Fail("chat: cached layout queued different sprites");
+			stats = cached.cache.GetStatistics();
+		}
+
+		printf("chat: %zu lines, %zu new per frame, cache holds %zu\n", labelCount, newLines, capacity);
+		printf("  layout + Draw per glyph   %8.1f us/frame\n", uncachedUs / frames);
+		printf("  cached layout + DrawRun   %8.1f us/frame  %.1fx\n", cachedUs / frames, uncachedUs / cachedUs);
+		printf("  hits %zu  misses %zu (%.1f%% hit)  evictions %zu\n", stats.Hits, stats.Misses,
+			100.0 * stats.Hits / max<size_t>(stats.Hits + stats.Misses, 1), stats.Evictions);
+	}
+
+	// 只見過一次的字串不放進快取, 第二次才放
+	{
+		TextLayoutCache<wchar_t, vector<int>> cache;
+		cache.SetCapacity(2);
+		// 跟 SpriteFont 一樣, Insert 之前一定是 Find 沒找到
+		auto insert = [&](const wchar_t* text, size_t length) {
+			return cache.Find(text, length) ? nullptr : cache.Insert(text, length);
+		};
+		if (insert(L"a", 1) || cache.Find(L"a", 1)) Fail("admission: a string seen once was cached");
+		if (!insert(L"a", 1) || !cache.Find(L"a", 1)) Fail("admission: a string seen twice was not cached");
+		for (int i = 0; i < 100; i++) {
+			wstring counter = L"FPS " + to_wstring(i);
+			insert(counter.c_str(), counter.size());
+		}
+		auto stats = cache.GetStatistics();
+		if (stats.Evictions || stats.Strings != 1) Fail("admission: strings seen once evicted a cached string");
+	}
+
+	// LRU: 容量 2, 最近用過的留下; 快取滿了之後, 新字串要比被換掉的字串畫得更多次才放得進去
+	{
+		TextLayoutCache<wchar_t, vector<int>> cache;
+		cache.SetCapacity(2);
+		auto insert = [&](const wchar_t* text, int value) {
+			int tries = 0;
+			vector<int>* layout = nullptr;
+			while (!layout && ++tries <= 10) layout = cache.Find(text, 1) ? nullptr : cache.Insert(text, 1);
+			if (layout) layout->push_back(value);
+			return tries;
+		};
+		insert(L"a", 1);
+		insert(L"b", 2);
+		cache.Find(L"a", 1);
+		if (insert(L"c", 3) != 3) Fail("admission: a string drawn as often as the one it replaces was admitted");
+		if (!cache.Find(L"a", 1) || cache.Find(L"b", 1) || !cache.Find(L"c", 1) || cache.Find(L"c", 1)->size() != 1 || cache.Find(L"c", 1)->at(0) != 3) {
+			fprintf(stderr, "LRU evicted the wrong string\n");
+			ok = false;
+		}
+		auto stats = cache.GetStatistics();
+		if (stats.Evictions != 1 || stats.Strings != 2) Fail("LRU statistics are wrong");
+		cache.SetCapacity(1);
+		if (cache.GetStatistics().Strings != 1 || !cache.Find(L"c", 1)) Fail("LRU did not shrink to the new capacity");
+	}
+
+	return ExitCode();
+}
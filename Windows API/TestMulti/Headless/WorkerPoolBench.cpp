@@ -0,0 +1,80 @@
+// WorkerPool 的 Dispatch 成本: 跟原本每一幀建立再 join 執行緒的做法比較, 並檢查每個 index 剛好執行一次
+//
+//   g++ -std=c++14 -O2 -pthread -I../Sample/Include WorkerPoolBench.cpp -o workerpoolbench
+//   ./workerpoolbench [frames] [jobs]
+//
+// 工作本身是空的, 量到的就是喚醒 worker 加上等全部做完的時間 (每一幀的固定成本)
+// 某個 index 沒執行或執行兩次就回傳 1
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include "Check.h"
+#include "WorkerPool.h"
+
+using namespace MyGame;
+
+int main(int argc, char* argv[]) {
+	int frames = argc > 1 ? atoi(argv[1]) : 20000;
+	int jobs = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+	if (frames <= 0) frames = 1;
+	if (jobs <= 1) jobs = 2;
+
+	vector<atomic<int>> hits(jobs);
+	auto check = [&](int expected) {
+		for (int i = 0; i < jobs; i++) {
+			if (hits[i].load() != expected) {
+				Fail("a job index was skipped or run twice");
+				return;
+			}
+		}
+	};
+	const function<void(int)> job = [&](int index) { hits[index].fetch_add(1, memory_order_relaxed); };
+
+	// 原本的做法: 每一幀建立 jobs 條執行緒再全部 join
+	int spawnFrames = max(1, frames / 20);
+	for (auto& h : hits) h = 0;
+	auto begin = chrono::steady_clock::now();
+	for (int f = 0; f < spawnFrames; f++) {
+		vector<thread> threads;
+		threads.reserve(jobs);
+		for (int i = 0; i < jobs; i++) threads.emplace_back(job, i);
+		for (auto& t : threads) t.join();
+	}
+	auto end = chrono::steady_clock::now();
+	check(spawnFrames);
+	double spawn = chrono::duration<double, micro>(end - begin).count() / spawnFrames;
+
+	// 常駐的 pool: 呼叫端也領工作, 所以只需要 jobs - 1 條 worker
+	WorkerPool pool;
+	pool.Start((size_t)jobs - 1);
+	for (auto& h : hits) h = 0;
+	pool.Dispatch(jobs, job);
+	begin = chrono::steady_clock::now();
+	for (int f = 0; f < frames; f++) pool.Dispatch(jobs, job);
+	end = chrono::steady_clock::now();
+	check(frames + 1);
+	double dispatch = chrono::duration<double, micro>(end - begin).count() / frames;
+
+	// 工作數多於 worker 時, 同一條執行緒會連續領好幾個 index
+	for (auto& h : hits) h = 0;
+	pool.Stop();
+	pool.Start(1);
+	for (int f = 0; f < 100; f++) pool.Dispatch(jobs, job);
+	check(100);
+	pool.Stop();
+
+	printf("%d jobs\n", jobs);
+	printf("%-26s %10.2f us/frame\n", "thread per job per frame", spawn);
+	printf("%-26s %10.2f us/frame %8.1fx\n", "WorkerPool::Dispatch", dispatch, dispatch > 0 ? spawn / dispatch : 0.0);
+
+	return ExitCode();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace MyGame {
+
+	// 一個 context 在一幀裡每個 draw 的 constant 都放進同一個大 buffer, 從頭線性配置
+	// offset 以 256 bytes 對齊, 這是 D3D11.1 *SetConstantBuffers1 的最小單位 (16 個 float4)
+	// buffer 每幀以 WRITE_DISCARD 對應, driver 會換一塊新的記憶體, 不用等 GPU 用完上一幀
+	// 這裡只管 offset, 不碰裝置
+	class ConstantRing {
+
+	public:
+		static const size_t Alignment = 256;
+		static const size_t Invalid = (size_t)-1;
+
+		static size_t Align(size_t size) {
+			return (size + Alignment - 1) & ~(Alignment - 1);
+		}
+
+		// *SetConstantBuffers1 的 FirstConstant / NumConstants 是以 16 bytes 為單位
+		static uint32_t FirstConstant(size_t offset) {
+			return (uint32_t)(offset / 16);
+		}
+
+		static uint32_t ConstantCount(size_t size) {
+			return (uint32_t)(Align(size) / 16);
+		}
+
+		// 每幀開始時呼叫, capacity 是這一幀對應到的 buffer 大小
+		void Reset(size_t capacity) {
+			this->capacity = capacity;
+			head.store(0, memory_order_relaxed);
+		}
+
+		// 可以從多條執行緒同時呼叫, 空間不夠時回傳 Invalid
+		size_t Allocate(size_t size) {
+			size_t aligned = Align(size);
+			size_t offset = head.fetch_add(aligned, memory_order_relaxed);
+			if (offset + aligned > capacity) return Invalid;
+			return offset;
+		}
+
+		size_t Capacity() const {
+			return capacity;
+		}
+
+		// 這一幀要求的總量, 包含放不下的部分, 超過 Capacity 時下一幀應該加大 buffer
+		size_t Requested() const {
+			return head.load(memory_order_relaxed);
+		}
+
+	private:
+		size_t capacity = 0;
+		atomic<size_t> head{ 0 };
+	};
+}
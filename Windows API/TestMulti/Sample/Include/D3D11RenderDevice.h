@@ -0,0 +1,307 @@
+#pragma once
+
+#include "RenderDevice.h"
+#include "ConstantRing.h"
+
+namespace MyGame {
+
+	class D3D11Buffer : public RenderBuffer {
+	public:
+		ComPtr<ID3D11Buffer> Buffer;
+	};
+
+	class D3D11Texture : public RenderTexture {
+	public:
+		ComPtr<ID3D11ShaderResourceView> View;
+	};
+
+	class D3D11Shader : public RenderShader {
+	public:
+		ComPtr<ID3D11VertexShader> VertexShader;
+		ComPtr<ID3D11PixelShader> PixelShader;
+		ComPtr<ID3D11InputLayout> InputLayout;
+	};
+
+	class D3D11CommandList : public RenderCommandList {
+	public:
+		ComPtr<ID3D11CommandList> CommandList;
+	};
+
+	class D3D11RenderDevice;
+
+	class D3D11Context : public RenderContext {
+
+	public:
+		D3D11Context(D3D11RenderDevice* device, ComPtr<ID3D11DeviceContext> context, bool deferred)
+			: device(device), context(context), deferred(deferred) {
+			// 只有 D3D11.1 才有, SetConstantBufferRange 需要
+			context.As(&context1);
+		}
+
+		void SetShader(RenderShader* shader) override {
+			D3D11Shader* s = static_cast<D3D11Shader*>(shader);
+			context->IASetInputLayout(s->InputLayout.Get());
+			context->VSSetShader(s->VertexShader.Get(), nullptr, 0);
+			context->PSSetShader(s->PixelShader.Get(), nullptr, 0);
+		}
+
+		void SetVertexBuffer(RenderBuffer* buffer, uint32_t stride) override {
+			UINT offset = 0;
+			context->IASetVertexBuffers(0, 1, static_cast<D3D11Buffer*>(buffer)->Buffer.GetAddressOf(), &stride, &offset);
+		}
+
+		void SetIndexBuffer(RenderBuffer* buffer) override {
+			context->IASetIndexBuffer(static_cast<D3D11Buffer*>(buffer)->Buffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+		}
+
+		void SetConstantBuffer(uint32_t slot, RenderBuffer* buffer) override {
+			context->VSSetConstantBuffers(slot, 1, static_cast<D3D11Buffer*>(buffer)->Buffer.GetAddressOf());
+		}
+
+		void SetConstantBufferRange(uint32_t slot, RenderBuffer* buffer, size_t offset, size_t size) override {
+			UINT first = ConstantRing::FirstConstant(offset);
+			UINT count = ConstantRing::ConstantCount(size);
+			context1->VSSetConstantBuffers1(slot, 1, static_cast<D3D11Buffer*>(buffer)->Buffer.GetAddressOf(), &first, &count);
+		}
+
+		void SetTexture(uint32_t slot, RenderTexture* texture) override;
+
+		void UpdateBuffer(RenderBuffer* buffer, const void* data, size_t size) override {
+			context->UpdateSubresource(static_cast<D3D11Buffer*>(buffer)->Buffer.Get(), 0, NULL, data, 0, 0);
+		}
+
+		void DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) override {
+			context->DrawIndexed(indexCount, startIndex, baseVertex);
+		}
+
+		void Clear(const float color[4]) override;
+
+		unique_ptr<RenderCommandList> FinishCommandList() override;
+
+		void ExecuteCommandList(RenderCommandList* commandList) override {
+			if (commandList) {
+				context->ExecuteCommandList(static_cast<D3D11CommandList*>(commandList)->CommandList.Get(), FALSE);
+			}
+		}
+
+		// deferred context 只能以 WRITE_DISCARD 對應 DYNAMIC buffer, 內容由 runtime 複製進指令清單
+		void* Map(RenderBuffer* buffer) override {
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = context->Map(static_cast<D3D11Buffer*>(buffer)->Buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+			if (CheckFailed(hr, TEXT("Map"))) return nullptr;
+			return mapped.pData;
+		}
+
+		void Unmap(RenderBuffer* buffer) override {
+			context->Unmap(static_cast<D3D11Buffer*>(buffer)->Buffer.Get(), 0);
+		}
+
+		// 設定 render target, viewport 與拓樸類型
+		void BindTargets();
+
+	private:
+		D3D11RenderDevice* device;
+		ComPtr<ID3D11DeviceContext> context;
+		ComPtr<ID3D11DeviceContext1> context1;
+		bool deferred;
+	};
+
+	class D3D11RenderDevice : public RenderDevice {
+
+	public:
+		D3D11RenderDevice(ComPtr<ID3D11Device> device, ComPtr<ID3D11DeviceContext> immediateContext, ComPtr<IDXGISwapChain1> swapChain)
+			: device(device), swapChain(swapChain), immediate(this, immediateContext, false) {
+
+			D3D11_SAMPLER_DESC sampDesc;
+			ZeroMemory(&sampDesc, sizeof(sampDesc));
+			sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+			sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+			sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+			sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+			sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+			sampDesc.MinLOD = 0;
+			sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
+			HRESULT hr = device->CreateSamplerState(&sampDesc, SamplerState.ReleaseAndGetAddressOf());
+			CheckFailed(hr, TEXT("CreateSamplerState"));
+
+			// *SetConstantBuffers1 要 D3D11.1 的 context, 而且驅動程式要支援 constant buffer offset
+			ComPtr<ID3D11DeviceContext1> context1;
+			D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+			ZeroMemory(&options, sizeof(options));
+			constantOffsets = SUCCEEDED(immediateContext.As(&context1))
+				&& SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options)))
+				&& options.ConstantBufferOffsetting;
+		}
+
+		void SetTargets(ComPtr<ID3D11RenderTargetView> renderTargetView, ComPtr<ID3D11DepthStencilView> depthStencilView, const D3D11_VIEWPORT& viewport) {
+			RenderTargetView = renderTargetView;
+			DepthStencilView = depthStencilView;
+			Viewport = viewport;
+		}
+
+		unique_ptr<RenderBuffer> CreateBuffer(BufferType type, size_t size, const void* initData) override {
+			D3D11_BUFFER_DESC desc;
+			ZeroMemory(&desc, sizeof(desc));
+			desc.ByteWidth = (UINT)size;
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.CPUAccessFlags = 0;
+			switch (type) {
+			case BufferType::Vertex:
+				desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+				break;
+			case BufferType::Index:
+				desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+				break;
+			case BufferType::Constant:
+				desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+				break;
+			case BufferType::DynamicConstant:
+				desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+				desc.Usage = D3D11_USAGE_DYNAMIC;
+				desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+				break;
+			}
+
+			D3D11_SUBRESOURCE_DATA srd;
+			ZeroMemory(&srd, sizeof(srd));
+			srd.pSysMem = initData;
+
+			unique_ptr<D3D11Buffer> buffer(new D3D11Buffer());
+			HRESULT hr = device->CreateBuffer(&desc, initData ? &srd : nullptr, &buffer->Buffer);
+			if (CheckFailed(hr, TEXT("CreateBuffer"))) return nullptr;
+			return move(buffer);
+		}
+
+		unique_ptr<RenderTexture> CreateTexture(uint32_t width, uint32_t height, const void* rgba) override {
+			D3D11_TEXTURE2D_DESC desc;
+			ZeroMemory(&desc, sizeof(desc));
+			desc.Width = width;
+			desc.Height = height;
+			desc.MipLevels = 1;
+			desc.ArraySize = 1;
+			desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+			desc.SampleDesc.Count = 1;
+			desc.SampleDesc.Quality = 0;
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+			D3D11_SUBRESOURCE_DATA initData;
+			initData.pSysMem = rgba;
+			initData.SysMemPitch = width * 4;
+			initData.SysMemSlicePitch = width * height * 4;
+
+			ComPtr<ID3D11Texture2D> tex;
+			HRESULT hr = device->CreateTexture2D(&desc, rgba ? &initData : nullptr, &tex);
+			if (CheckFailed(hr, TEXT("CreateTexture2D"))) return nullptr;
+
+			D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+			SRVDesc.Format = desc.Format;
+			SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			SRVDesc.Texture2D.MipLevels = 1;
+
+			unique_ptr<D3D11Texture> texture(new D3D11Texture());
+			hr = device->CreateShaderResourceView(tex.Get(), &SRVDesc, &texture->View);
+			if (CheckFailed(hr, TEXT("CreateShaderResourceView"))) return nullptr;
+			return move(texture);
+		}
+
+		// 給 WICTextureLoader / DDSTextureLoader 建立好的貼圖用
+		unique_ptr<RenderTexture> WrapTexture(ComPtr<ID3D11ShaderResourceView> view) {
+			unique_ptr<D3D11Texture> texture(new D3D11Texture());
+			texture->View = view;
+			return move(texture);
+		}
+
+		unique_ptr<RenderShader> CreateShader(
+			const void* vertexCode, size_t vertexLength,
+			const void* pixelCode, size_t pixelLength,
+			const VertexElement* elements, size_t elementCount) override {
+
+			unique_ptr<D3D11Shader> shader(new D3D11Shader());
+			HRESULT hr = device->CreateVertexShader(vertexCode, vertexLength, nullptr, &shader->VertexShader);
+			if (CheckFailed(hr, TEXT("CreateVertexShader"))) return nullptr;
+
+			vector<D3D11_INPUT_ELEMENT_DESC> layout(elementCount);
+			for (size_t i = 0; i < elementCount; i++) {
+				DXGI_FORMAT format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+				switch (elements[i].Format) {
+				case VertexFormat::Float2:
+					format = DXGI_FORMAT_R32G32_FLOAT;
+					break;
+				case VertexFormat::Float3:
+					format = DXGI_FORMAT_R32G32B32_FLOAT;
+					break;
+				case VertexFormat::Float4:
+					format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+					break;
+				}
+				layout[i] = { elements[i].Semantic, 0, format, 0, elements[i].Offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+			}
+
+			hr = device->CreateInputLayout(layout.data(), (UINT)layout.size(), vertexCode, vertexLength, &shader->InputLayout);
+			if (CheckFailed(hr, TEXT("Create VertexLayout"))) return nullptr;
+
+			hr = device->CreatePixelShader(pixelCode, pixelLength, nullptr, &shader->PixelShader);
+			if (CheckFailed(hr, TEXT("CreatePixelShader"))) return nullptr;
+			return move(shader);
+		}
+
+		RenderContext* Immediate() override {
+			return &immediate;
+		}
+
+		unique_ptr<RenderContext> CreateDeferredContext() override {
+			ComPtr<ID3D11DeviceContext> context;
+			HRESULT hr = device->CreateDeferredContext(0, &context);
+			if (CheckFailed(hr, TEXT("CreateDeferredContext"))) return nullptr;
+			unique_ptr<D3D11Context> deferred(new D3D11Context(this, context, true));
+			deferred->BindTargets();
+			return move(deferred);
+		}
+
+		bool SupportsConstantOffsets() const override {
+			return constantOffsets;
+		}
+
+		void Present(bool allowTearing) override {
+			swapChain->Present(0, allowTearing ? DXGI_PRESENT_ALLOW_TEARING : 0);
+		}
+
+		ComPtr<ID3D11RenderTargetView> RenderTargetView;
+		ComPtr<ID3D11DepthStencilView> DepthStencilView;
+		ComPtr<ID3D11SamplerState> SamplerState;
+		D3D11_VIEWPORT Viewport;
+
+	private:
+		ComPtr<ID3D11Device> device;
+		ComPtr<IDXGISwapChain1> swapChain;
+		D3D11Context immediate;
+		bool constantOffsets = false;
+	};
+
+	inline void D3D11Context::SetTexture(uint32_t slot, RenderTexture* texture) {
+		context->PSSetSamplers(slot, 1, device->SamplerState.GetAddressOf());
+		context->PSSetShaderResources(slot, 1, static_cast<D3D11Texture*>(texture)->View.GetAddressOf());
+	}
+
+	inline void D3D11Context::Clear(const float color[4]) {
+		context->ClearDepthStencilView(device->DepthStencilView.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
+		context->ClearRenderTargetView(device->RenderTargetView.Get(), color);
+	}
+
+	inline unique_ptr<RenderCommandList> D3D11Context::FinishCommandList() {
+		if (!deferred) return nullptr;
+		unique_ptr<D3D11CommandList> list(new D3D11CommandList());
+		// FALSE: 不保留狀態, 比較快, 所以下一次錄製前要重新設定 render target 跟 viewport
+		HRESULT hr = context->FinishCommandList(FALSE, &list->CommandList);
+		if (CheckFailed(hr, TEXT("Deferred FinishCommandList"))) return nullptr;
+		BindTargets();
+		return move(list);
+	}
+
+	inline void D3D11Context::BindTargets() {
+		context->OMSetRenderTargets(1, device->RenderTargetView.GetAddressOf(), device->DepthStencilView.Get());
+		context->RSSetViewports(1, &device->Viewport);
+		context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	}
+}
@@ -3,6 +3,13 @@
 #include "DeviceInfo.h"
 #include "SimpleVertex.h"
 #include "Shader.h"
+#include "ShaderArchive.h"
+#include "D3D11RenderDevice.h"
+#include "FramePipeline.h"
+#include "ImageLoader.h"
+#include "InputRing.h"
+#include "FrameTimer.h"
+#include "Profiler.h"
 
 #include <wbemidl.h>
 #include <comutil.h>
@@ -13,6 +20,21 @@
 
 namespace MyGame {
 
+	class QpcClock : public FrameClock {
+	public:
+		int64_t Now() override {
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			return now.QuadPart;
+		}
+
+		int64_t Frequency() override {
+			LARGE_INTEGER freq;
+			QueryPerformanceFrequency(&freq);
+			return freq.QuadPart;
+		}
+	};
+
 	class DirectXPanel {
 
 		public:
@@ -68,26 +90,35 @@ namespace MyGame {
 			
 			if (!CreateSwapChain(hWnd)) return;
 
-			HRESULT hr;
 			CreateRenderTargetView();
 			CreateDepthStencilView();
+
+			Device = make_unique<D3D11RenderDevice>(D3D11Device, ImmediateContext, SwapChain);
+			SetViewport();
+			Pipeline = make_unique<FramePipeline>(*Device);
+
 			PreparePipeline();
+			LoadShader();
+			SetupPipeline();
 
-			const int deferredCount = 2;
+			// 有幾個邏輯處理器就開幾個 DeferredContext
+			int deferredCount = Info->NumberOfLogicalProcessors;
+			if (deferredCount <= 0) deferredCount = (int)thread::hardware_concurrency();
+			if (deferredCount <= 0) deferredCount = 1;
 
-			for (int i = 0; i < deferredCount; i++) {
-				hr = D3D11Device->CreateDeferredContext(0, &DeferredContext[i]);
-				CHECKRETURN(hr, TEXT("CreateDeferredContext"));
-				//CommonStates states = CommonStates(D3D11Device.Get());
-				//auto cull = states.CullClockwise();
-				//DeferredContext[i]->RSSetState(cull);
-			}
+			// 錄製用的執行緒整個遊戲迴圈只建立一次, Render 時的呼叫端也會分擔一個 DeferredContext
+			Pipeline->Initialize(deferredCount, ThreadingSupport.DriverCommandLists == TRUE);
 
-			for (int i = 0; i < deferredCount; i++) {
-				LoadShader(DeferredContext[i].Get());
-				SetupPipeline(DeferredContext[i].Get());
-				SetViewport(DeferredContext[i].Get());
-			}
+			// 圖片在背景讀檔、解碼, 載入完成之前先顯示棋盤格
+			uint8_t checker[] = {
+				255, 0, 255, 255,	0, 0, 0, 255,
+				0, 0, 0, 255,		255, 0, 255, 255,
+			};
+			Placeholder = Device->CreateTexture(2, 2, checker);
+			Loader = make_unique<ImageLoader>(*Device, [this](const uint8_t* data, size_t size, DecodedImage& image) {
+				return DecodeWIC(data, size, image);
+			});
+			Loader->Start(max(1, deferredCount / 2));
 
 			PrepareDirect2D();
 			QueryPerformanceCounter(&time);
@@ -296,58 +327,52 @@ namespace MyGame {
 		}
 
 		private:
-		void SetViewport(ID3D11DeviceContext* context) {
-			if (context) {
+		void SetViewport() {
+			if (Device) {
 				RECT rect;
 				GetClientRect(hWnd, &rect);
 				Viewport vp(0, 0, ceilf((float)rect.right - (float)rect.left), ceilf((float)rect.bottom - (float)rect.top));
 				// 設定Render好的場景要畫在backbuffer的哪個區域(通常是全部的backbuffer區域)
-				context->RSSetViewports(1, vp.Get11());
+				Device->SetTargets(RenderTargetView, DepthStencilView, *vp.Get11());
 			}
 		}
 
 		private:
-		void LoadShader(ID3D11DeviceContext* context) {		
+		void LoadShader() {		
+			PROFILE_SCOPE("LoadShader");
 			if (D3D11Device.Get()) {
 				HRESULT hr;
+
+				// 先找打包好的 Shaders.pak (ShaderPack 產生), 沒有的話才讀個別的 .cso
+				ShaderArchive archive;
 				ShaderCode vertexShaderCode;
-				vertexShaderCode.LoadFromFile(TEXT("VertexShader.cso"));
-				hr = D3D11Device->CreateVertexShader(vertexShaderCode.Code, vertexShaderCode.Length, nullptr, &VertexShader);
-				CHECKRETURN(hr, TEXT("CreateVertexShader"));
+				ShaderCode pixelShaderCode;
+				ShaderBlob vs, ps;
+				if (!archive.Open(TEXT("Shaders.pak")) || !archive.Find("VertexShader.cso", vs) || !archive.Find("PixelShader.cso", ps)) {
+					vertexShaderCode.LoadFromFile(TEXT("VertexShader.cso"));
+					pixelShaderCode.LoadFromFile(TEXT("PixelShader.cso"));
+					vs.Code = vertexShaderCode.Code;
+					vs.Length = vertexShaderCode.Length;
+					ps.Code = pixelShaderCode.Code;
+					ps.Length = pixelShaderCode.Length;
+				}
 
-				D3D11_INPUT_ELEMENT_DESC layout[] =
+				VertexElement layout[] =
 				{
-					{ "POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-					{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-					{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+					{ "POSITION", VertexFormat::Float4, 0 },
+					{ "COLOR", VertexFormat::Float4, 16 },
+					{ "TEXCOORD", VertexFormat::Float2, 32 }
 				};
 
-				// Create the input layout
-				hr = D3D11Device->CreateInputLayout(layout, sizeof(layout) / sizeof(D3D11_INPUT_ELEMENT_DESC), vertexShaderCode.Code,
-					vertexShaderCode.Length, VertexLayout.ReleaseAndGetAddressOf());
-				CHECKRETURN(hr, TEXT("Create VertexLayout"));
-
-				// Set the input layout to the input-assembler
-				context->IASetInputLayout(VertexLayout.Get());
-
-				// Load Shader bytecode
-				ShaderCode pixelShaderCode;
-				pixelShaderCode.LoadFromFile(TEXT("PixelShader.cso"));
-
 				// Get Shader Reflection
-				hr = D3DReflect(pixelShaderCode, pixelShaderCode, IID_PPV_ARGS(&Reflector));
+				hr = D3DReflect(ps.Code, ps.Length, IID_PPV_ARGS(&Reflector));
 				CHECKRETURN(hr, TEXT("Create Shader Reflection"));
 				D3D11_SHADER_DESC shaderDesc;
 				hr = Reflector->GetDesc(&shaderDesc);
 				CHECKRETURN(hr, TEXT("Get Shader Description"));
 
-				// Create Shader
-				hr = D3D11Device->CreatePixelShader(pixelShaderCode, pixelShaderCode, nullptr, &PixelShader);
-				CHECKRETURN(hr, TEXT("CreatePixelShader"));
-
-				// Set Shader
-				context->VSSetShader(VertexShader.Get(), nullptr, 0);
-				context->PSSetShader(PixelShader.Get(), nullptr, 0);
+				// Create Shader + input layout
+				Pipeline->Shader = Device->CreateShader(vs.Code, vs.Length, ps.Code, ps.Length, layout, sizeof(layout) / sizeof(VertexElement));
 
 				//ShaderCode shaderCode;
 				//shaderCode.LoadFromFile(TEXT("Sample.cso"));
@@ -358,13 +383,7 @@ namespace MyGame {
 		}
 
 		private:
-			void SetupPipeline(ID3D11DeviceContext* context) {
-				UINT stride = sizeof(SimpleVertex);
-				UINT offset = 0;
-				context->IASetVertexBuffers(0, 1, VertexBuffer.GetAddressOf(), &stride, &offset);
-				context->IASetIndexBuffer(IndexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-				context->VSSetConstantBuffers(0, 1, ConstantBuffer.GetAddressOf());
-
+			void SetupPipeline() {
 				// 設定初始狀態
 				//Matrix::CreateLookAt()
 				world = XMMatrixIdentity();
@@ -378,23 +397,12 @@ namespace MyGame {
 				float height = ceilf(((float)rect.bottom - (float)rect.top) / 100.0f);
 				
 				projection = XMMatrixPerspectiveRH(width, height, nearZ, farZ);
-
-				// 設置變換矩陣給著色器
-				XMMATRIX transform = world * view * projection;
-				context->UpdateSubresource(ConstantBuffer.Get(), 0, NULL, &transform, 0, 0);
-
-				// 設定多邊形拓樸類型
-				context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
-				// 把DepthStencilView綁定到Output-Merger
-				context->OMSetRenderTargets(1, RenderTargetView.GetAddressOf(), DepthStencilView.Get());
 			}
 
 
 		private:
 		void PreparePipeline() {
 			
-			HRESULT hr;
 			RECT rect;
 			GetClientRect(hWnd, &rect);
 			float w = (float)rect.right - (float)rect.left;
@@ -410,41 +418,20 @@ namespace MyGame {
 			};
 
 			// 建立模型頂點緩衝區
-			D3D11_BUFFER_DESC bd;
-			ZeroMemory(&bd, sizeof(bd));
-			bd.Usage = D3D11_USAGE_DEFAULT;
-			bd.ByteWidth = sizeof(vertices);
-			bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-			bd.CPUAccessFlags = 0;
-			D3D11_SUBRESOURCE_DATA srd;
-			ZeroMemory(&srd, sizeof(srd));
-			srd.pSysMem = vertices;
-			hr = D3D11Device->CreateBuffer(&bd, &srd, &VertexBuffer);
-			CHECKRETURN(hr, TEXT("Create VertexBuffer"));
+			Pipeline->VertexBuffer = Device->CreateBuffer(BufferType::Vertex, sizeof(vertices), vertices);
+			Pipeline->VertexStride = sizeof(SimpleVertex);
 
 			// 建立模型頂點索引緩衝區
 			UINT indices[] = { 0, 1, 2, 1, 3, 2 };
-			D3D11_BUFFER_DESC indexDesc;
-			ZeroMemory(&indexDesc, sizeof(indexDesc));
-			indexDesc.ByteWidth = sizeof(UINT) * 6;
-			indexDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-			indexDesc.Usage = D3D11_USAGE_DEFAULT;
-			indexDesc.CPUAccessFlags = 0;
-			D3D11_SUBRESOURCE_DATA indexsrd;
-			ZeroMemory(&indexsrd, sizeof(indexsrd));
-			indexsrd.pSysMem = indices;
-			hr = D3D11Device->CreateBuffer(&indexDesc, &indexsrd, &IndexBuffer);
-			CHECKRETURN(hr, TEXT("Create IndexBuffer"));
+			Pipeline->IndexBuffer = Device->CreateBuffer(BufferType::Index, sizeof(indices), indices);
 
 			// 建立常量緩衝區
-			D3D11_BUFFER_DESC constDesc;
-			ZeroMemory(&constDesc, sizeof(constDesc));
-			constDesc.ByteWidth = sizeof(XMMATRIX);
-			constDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-			constDesc.Usage = D3D11_USAGE_DEFAULT;
-			constDesc.CPUAccessFlags = 0;
-			hr = D3D11Device->CreateBuffer(&constDesc, NULL, &ConstantBuffer);
-			CHECKRETURN(hr, TEXT("Create ConstBuffer"));
+			Pipeline->ConstantBuffer = Device->CreateBuffer(BufferType::Constant, sizeof(XMMATRIX), nullptr);
+
+			// 要畫的東西
+			Pipeline->DrawList.clear();
+			Pipeline->DrawList.push_back({ Float4x4::Identity(), 6, 0, 0 });
+			Pipeline->DrawList.push_back({ Float4x4::Translation(5, 100, 800), 6, 0, 0 });
 		}
 
 		private:
@@ -470,17 +457,18 @@ namespace MyGame {
 		void Direct2DRneder() {
 			if (D2DDeviceContext.Get()) {
 				D2DDeviceContext->BeginDraw();
-				const String info = Info->ToString();
-				if (!info.IsNullOrEmpty()) {
-					LPCTSTR str = info.c_str();
+				// 裝置資訊不會變, 只組一次; fpsString 沿用自己的空間, 每幀都不用配置記憶體
+				if (infoString.IsNullOrEmpty()) {
+					infoString = Info->ToString();
+				}
+				if (!infoString.IsNullOrEmpty()) {
 					D2D1_RECT_F layoutRect = { 0, 0, 300, 300 };
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(infoString.c_str(), (UINT32)infoString.Length(), InfoTextFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 
 				if (!(fpsString.IsNullOrEmpty())) {
-					LPCTSTR str = fpsString.c_str();
 					D2D1_RECT_F layoutRect = { 0, (FLOAT)SwapChainDesc.Height - 30, 300, (FLOAT)SwapChainDesc.Height };
-					D2DDeviceContext->DrawText(str, (UINT32)_tcslen(str), FPSFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
+					D2DDeviceContext->DrawText(fpsString.c_str(), (UINT32)fpsString.Length(), FPSFormat.Get(), layoutRect, TextBrush.Get(), D2D1_DRAW_TEXT_OPTIONS_CLIP, DWRITE_MEASURING_MODE_NATURAL);
 				}
 				D2DDeviceContext->EndDraw();
 			}
@@ -488,120 +476,96 @@ namespace MyGame {
 
 		private:
 		void HandleUserControl() {
-			MSG msg;
-			if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
-				float offsetX = 0.0f, offsetY = 0.0f;
+			// 每一幀把 WndProc 送來的輸入一次處理完
+			Input.Drain([this](const InputEvent& e) { HandleInput(e); });
+		}
+
+		// 固定時間步長: 只處理在這一步結束之前送來的輸入
+		void HandleUserControl(int64_t stepEnd) {
+			Input.DrainUntil(stepEnd, [this](const InputEvent& e) { HandleInput(e); });
+		}
+
+		private:
+		void HandleInput(const InputEvent& e) {
+			WPARAM wParam = (WPARAM)e.wParam;
+			LPARAM lParam = (LPARAM)e.lParam;
+			float offsetX = 0.0f, offsetY = 0.0f;
 
-				switch (msg.message) {
-					case WM_KEYDOWN:
+			switch (e.Message) {
+				case WM_KEYDOWN:
+				{
+					switch (LOBYTE(wParam))
 					{
-						switch (LOBYTE(msg.wParam))
-						{
-						case 'W':
-							offsetY = 10.0f;
-							break;
-						case 'S':
-							offsetY = -10.0f;
-							break;
-						case 'A':
-							offsetX = -10.0f;
-							break;
-						case 'D':
-							offsetX = 10.0f;
-							break;
-						case VK_PROCESSKEY: // IME key
-							break;
-						default:
-							break;
-						}
-						world = world * XMMatrixTranslation(offsetX, offsetY, 0.0f);
-					}
-					break;
-					case WM_CHAR:
-						OutputDebug(TEXT("Char = %c\n"), LODWORD(msg.wParam));
+					case 'W':
+						offsetY = 10.0f;
 						break;
-					case WM_MOUSEWHEEL:
-					{
-						auto x = (SHORT)HIWORD(msg.wParam) / 120;
-						auto rotate = XMMatrixRotationRollPitchYaw(0, x * XM_PI / 180.0f, 0);
-					
-						auto v = XMVector3Transform(XMLoadFloat3(&eye), rotate);
-						XMStoreFloat3(&eye, v);
-						view = XMMatrixLookAtRH(XMLoadFloat3(&eye), XMLoadFloat3(&focus_target), XMLoadFloat3(&up));
-						OutputDebug(TEXT("Wheel = %d\n"), x);
-					}
-					break;
-					case WM_LBUTTONDOWN:
-						point = MAKEPOINTS(msg.lParam);
+					case 'S':
+						offsetY = -10.0f;
 						break;
-					case WM_MOUSEMOVE:
-						if (msg.wParam & MK_LBUTTON) {
-
-							XMVECTOR _eye = XMLoadFloat3(&eye);
-							XMVECTOR _focus = XMLoadFloat3(&focus_target);
-							XMVECTOR v = _focus - _eye;
-							XMVECTOR _up = XMLoadFloat3(&up);
-
-							XMVECTOR ox = XMVector3Normalize(XMVector3Cross(v, _up));
-							XMVECTOR oy = _up;
-							XMVECTOR o = _eye + nearZ * XMVector3Normalize(v);
-
-							// calc new up
-							_up = XMLoadFloat3(&up);
-							XMVECTOR proje = v * XMVector3Dot(_up, v) / XMVector3Dot(v, v);
-							XMVECTOR new_up = XMVector3Normalize(_up - proje);
-							XMStoreFloat3(&up, new_up);
-
-							POINTS p = MAKEPOINTS(msg.lParam);
-							POINTS offs;
-							offs.x = p.x - point.x;
-							offs.y = p.y - point.y;
-							point = p;
-
-							XMVECTOR new_o = o + -ox * (float)offs.x + oy * (float)offs.y;
-							XMVECTOR new_eye = new_o + nearZ * XMVector3Normalize(new_o - _focus);
-							XMStoreFloat3(&eye, new_eye);
-							view = XMMatrixLookAtRH(XMLoadFloat3(&eye), XMLoadFloat3(&focus_target), XMLoadFloat3(&up));
-						}
+					case 'A':
+						offsetX = -10.0f;
 						break;
+					case 'D':
+						offsetX = 10.0f;
+						break;
+					case VK_PROCESSKEY: // IME key
+						break;
+					default:
+						break;
+					}
+					world = world * XMMatrixTranslation(offsetX, offsetY, 0.0f);
 				}
-			}
-		}
-
-		private:
-		void UpdateDeferred(int index) {
-			XMMATRIX transform;
-			if (index == 1) {
-				auto t = XMMatrixTranslation(5, 100, 800);
-				transform = world * t * view * projection;
-			}
-			else {
-				transform = world * view * projection;
-			}
+				break;
+				case WM_CHAR:
+					OutputDebug(TEXT("Char = %c\n"), LODWORD(wParam));
+					break;
+				case WM_MOUSEWHEEL:
+				{
+					auto x = (SHORT)HIWORD(wParam) / 120;
+					auto rotate = XMMatrixRotationRollPitchYaw(0, x * XM_PI / 180.0f, 0);
 				
-			auto context = DeferredContext[index];
-			auto constbuf = ConstantBuffer;
-			context->UpdateSubresource(constbuf.Get(), 0, NULL, &transform, 0, 0);
-
-			if (SamplerState.Get() && ResourceView.Get()) {
-				context->PSSetSamplers(0, 1, SamplerState.GetAddressOf());
-				context->PSSetShaderResources(0, 1, ResourceView.GetAddressOf());
+					auto v = XMVector3Transform(XMLoadFloat3(&eye), rotate);
+					XMStoreFloat3(&eye, v);
+					view = XMMatrixLookAtRH(XMLoadFloat3(&eye), XMLoadFloat3(&focus_target), XMLoadFloat3(&up));
+					OutputDebug(TEXT("Wheel = %d\n"), x);
+				}
+				break;
+				case WM_LBUTTONDOWN:
+					point = MAKEPOINTS(lParam);
+					break;
+				case WM_MOUSEMOVE:
+					if (wParam & MK_LBUTTON) {
+
+						XMVECTOR _eye = XMLoadFloat3(&eye);
+						XMVECTOR _focus = XMLoadFloat3(&focus_target);
+						XMVECTOR v = _focus - _eye;
+						XMVECTOR _up = XMLoadFloat3(&up);
+
+						XMVECTOR ox = XMVector3Normalize(XMVector3Cross(v, _up));
+						XMVECTOR oy = _up;
+						XMVECTOR o = _eye + nearZ * XMVector3Normalize(v);
+
+						// calc new up
+						_up = XMLoadFloat3(&up);
+						XMVECTOR proje = v * XMVector3Dot(_up, v) / XMVector3Dot(v, v);
+						XMVECTOR new_up = XMVector3Normalize(_up - proje);
+						XMStoreFloat3(&up, new_up);
+
+						POINTS p = MAKEPOINTS(lParam);
+						POINTS offs;
+						offs.x = p.x - point.x;
+						offs.y = p.y - point.y;
+						point = p;
+
+						XMVECTOR new_o = o + -ox * (float)offs.x + oy * (float)offs.y;
+						XMVECTOR new_eye = new_o + nearZ * XMVector3Normalize(new_o - _focus);
+						XMStoreFloat3(&eye, new_eye);
+						view = XMMatrixLookAtRH(XMLoadFloat3(&eye), XMLoadFloat3(&focus_target), XMLoadFloat3(&up));
+					}
+					break;
 			}
 		}
 
-		private:
-		void RenderDeferred(int index) {
-			HRESULT hr;
-			auto context = DeferredContext[index];
-			context->DrawIndexed(6, 0, 0);
-
-			// TRUE	: 重存之前設定的狀態
-			// FALSE: 不重存之前的狀態, 則下次使用時須重新設定Shader, Buffer, Viewport ...
-			BOOL restoreState = TRUE;
-			hr = context->FinishCommandList(restoreState, &DeferredCommandList[index]);
-			CHECKRETURN(hr, TEXT("Deferred FinishCommandList"));
-		}
-
 		private:
 		void GetFPS() {
 			LARGE_INTEGER now;
@@ -618,63 +582,39 @@ namespace MyGame {
 			fpsCounter++;
 		}
 
-		typedef struct _TEST {
-			DirectXPanel* panel;
-			int deferredIndex;
-		} TEST, *PTEST;
-
 		private:
-		static DWORD NTAPI myWork(
-			_Inout_opt_ PVOID                 Context
-		) {
-			PTEST test = (PTEST)Context;
-			if (test) {
-				test->panel->UpdateDeferred(test->deferredIndex);
-				test->panel->RenderDeferred(test->deferredIndex);
-			}
-			return 0;
+		static Float4x4 ToFloat4x4(FXMMATRIX m) {
+			Float4x4 r;
+			XMStoreFloat4x4(reinterpret_cast<XMFLOAT4X4*>(&r), m);
+			return r;
 		}
 
 		private:
 		void Render() {
-			
-			ImmediateContext->OMSetRenderTargets(1, RenderTargetView.GetAddressOf(), nullptr);
-			ImmediateContext->ClearDepthStencilView(DepthStencilView.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
-			FLOAT color[4] = { 47 / 255.0f, 51 / 255.0f, 61 / 255.0f, 255 / 255.0f };
-			ImmediateContext->ClearRenderTargetView(RenderTargetView.Get(), color);
-			
-			if (ThreadingSupport.DriverCommandLists) {
-				/// create threads
-				HANDLE Threads[2];
-				for (int i = 0; i < 2; i++) {
-					TEST t;
-					t.panel = this;
-					t.deferredIndex = i;
-					Threads[i] = CreateThread(NULL, 0, myWork, &t, 0, NULL);
-					break;
-				}
+			PROFILE_SCOPE("Render");
 
-				DWORD result = WaitForMultipleObjects(2, Threads, TRUE, INFINITE);
+			// 每一幀最多上傳一張載入好的圖片
+			Loader->Upload(1);
+			Pipeline->Texture = Loader->Pending() ? Placeholder.get() : Texture.get();
 
-			} else {
-				for (int i = 0; i < 2; i++) {
-					UpdateDeferred(i);
-					RenderDeferred(i);
-				}
-			}
-
-			for (int i = 0; i < 2; i++) {
-				if (DeferredCommandList[i].Get()) {
-					ImmediateContext->ExecuteCommandList(DeferredCommandList[i].Get(), FALSE);
-					DeferredCommandList[i].Reset();
-				}
-			}
+			// Update / Record / Submit 都在 FramePipeline 裡, 只透過 RenderDevice 跟 D3D11 溝通
+			FLOAT color[4] = { 47 / 255.0f, 51 / 255.0f, 61 / 255.0f, 255 / 255.0f };
+			Pipeline->Render(ToFloat4x4(renderWorld), ToFloat4x4(renderView * projection), color);
 
 			GetFPS();
 			Direct2DRneder();
 
 			// 把畫好的結果輸出到螢幕上！
-			SwapChain->Present(0, Tearing ? DXGI_PRESENT_ALLOW_TEARING : 0);
+			PROFILE_SCOPE("Present");
+			Device->Present(Tearing);
+		}
+
+		public:
+		// 由 WndProc 呼叫, 把輸入事件交給 render thread
+		bool PostInput(UINT message, WPARAM wParam, LPARAM lParam) {
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			return Input.Post(message, (uint64_t)wParam, (int64_t)lParam, now.QuadPart);
 		}
 
 		public:
@@ -689,10 +629,79 @@ namespace MyGame {
 
 		private:
 		void Run() {
+			PROFILE_THREAD("Render");
+			Timer.Reset();
 			while (Running) {
-				HandleUserControl();
+				PROFILE_FRAME();
+				int steps = Timer.Tick();
+				if (FixedStep) {
+					// 輸入以固定的時間步長處理, 畫面在最後一步的前後兩個狀態之間內插
+					// alpha 是不到一步的剩餘時間, 所以上一個狀態要在每一步之前記下, 追趕多步時才不會從好幾步前內插
+					// 每一步只處理時間落在那一步裡的輸入
+					for (int i = 0; i < steps; i++) {
+						previousWorld = world;
+						previousView = view;
+						HandleUserControl(Timer.StepEnd(i));
+					}
+					float alpha = (float)Timer.Alpha();
+					renderWorld = Interpolate(previousWorld, world, alpha);
+					renderView = Interpolate(previousView, view, alpha);
+				} else {
+					HandleUserControl();
+					renderWorld = world;
+					renderView = view;
+				}
 				Render();
 			}
+			Loader->Stop();
+			Pipeline->Shutdown();
+			DumpFrameTimes();
+		}
+
+		private:
+		static XMMATRIX Interpolate(FXMMATRIX from, CXMMATRIX to, float t) {
+			XMVECTOR s0, r0, t0, s1, r1, t1;
+			if (!XMMatrixDecompose(&s0, &r0, &t0, from) || !XMMatrixDecompose(&s1, &r1, &t1, to)) {
+				return to;
+			}
+			return XMMatrixAffineTransformation(
+				XMVectorLerp(s0, s1, t),
+				XMVectorZero(),
+				XMQuaternionSlerp(r0, r1, t),
+				XMVectorLerp(t0, t1, t));
+		}
+
+		private:
+		void DumpFrameTimes() {
+			const FrameHistogram& h = Timer.Histogram();
+			OutputDebug(TEXT("Frames: %llu p50: %.3lf ms p95: %.3lf ms p99: %.3lf ms max: %.3lf ms\n"),
+				h.Count(), h.Percentile(50.0), h.Percentile(95.0), h.Percentile(99.0), h.Max());
+
+			FILE* stream;
+			if (_tfopen_s(&stream, TEXT("FrameTime.csv"), TEXT("w")) == 0) {
+				h.WriteCsv(stream);
+				fclose(stream);
+			}
+			if (_tfopen_s(&stream, TEXT("FrameTime.json"), TEXT("w")) == 0) {
+				h.WriteJson(stream);
+				fclose(stream);
+			}
+			// 用 chrome://tracing 或 https://ui.perfetto.dev 開啟
+			if (_tfopen_s(&stream, TEXT("Profile.json"), TEXT("w")) == 0) {
+				Profiler::Instance().WriteChromeTrace(stream);
+				fclose(stream);
+			}
+		}
+
+		public:
+		const FrameHistogram& GetFrameTimes() const {
+			return Timer.Histogram();
+		}
+
+		public:
+		bool ToggleFixedStep() {
+			FixedStep = !FixedStep;
+			return FixedStep;
 		}
 
 		public:
@@ -713,33 +722,52 @@ namespace MyGame {
 		}
 
 		private:
-		void CreateTexture(uint8_t* data, long len) {
-			if (len >= 4) {
-				if (data[0] == 0x44 && data[1] == 0x44 && data[2] == 0x53 && data[3] == 0x20) {
-					//CreateDDSTextureFromMemory(d3dDevice, stream, out texture, out textureView, d3dContext);
-				} else {
-					CreateWICTexture(data, len);
-				}
-			}
+		// 在 ImageLoader 的解碼執行緒上執行 (那條執行緒已經初始化 COM), 失敗時不跳出訊息視窗
+		bool DecodeWIC(const uint8_t* data, size_t size, DecodedImage& image) {
+			HRESULT hr;
+			ComPtr<IWICStream> stream;
+			hr = WICImagingFactory->CreateStream(&stream);
+			if (FAILED(hr)) return false;
+			hr = stream->InitializeFromMemory(const_cast<BYTE*>(data), (DWORD)size);
+			if (FAILED(hr)) return false;
+
+			ComPtr<IWICBitmapDecoder> decoder;
+			hr = WICImagingFactory->CreateDecoderFromStream(stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder);
+			if (FAILED(hr)) return false;
+			ComPtr<IWICBitmapFrameDecode> frame;
+			hr = decoder->GetFrame(0, &frame);
+			if (FAILED(hr)) return false;
+
+			// 一律轉成 RGBA8
+			ComPtr<IWICFormatConverter> converter;
+			hr = WICImagingFactory->CreateFormatConverter(&converter);
+			if (FAILED(hr)) return false;
+			hr = converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+			if (FAILED(hr)) return false;
+
+			UINT width, height;
+			hr = converter->GetSize(&width, &height);
+			if (FAILED(hr) || width == 0 || height == 0) return false;
+			image.Width = width;
+			image.Height = height;
+			image.Pixels.resize((size_t)width * height * 4);
+			hr = converter->CopyPixels(nullptr, width * 4, (UINT)image.Pixels.size(), image.Pixels.data());
+			return SUCCEEDED(hr);
 		}
 
-		void CreateWICTexture(byte* data, size_t size) {
-			
-			HRESULT hr;
-			hr = CreateWICTextureFromMemory(D3D11Device.Get(), ImmediateContext.Get(), data, size, nullptr, &ResourceView);
-			CHECKRETURN(hr, TEXT("CreateWICTextureFromMemory"));
-
-			D3D11_SAMPLER_DESC sampDesc;
-			ZeroMemory(&sampDesc, sizeof(sampDesc));
-			sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-			sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-			sampDesc.MinLOD = 0;
-			sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
-			hr = D3D11Device->CreateSamplerState(&sampDesc, SamplerState.ReleaseAndGetAddressOf());
-			CHECKRETURN(hr, TEXT("CreateSamplerState"));
+		private:
+		// 只在 render thread 上呼叫 (ImageLoader::Upload 的 callback)
+		void OnImageLoaded(ImageLoadResult& result) {
+			switch (result.Status) {
+			case ImageLoadStatus::Completed:
+				Texture = move(result.Texture);
+				break;
+			case ImageLoadStatus::Failed:
+				OutputDebug(TEXT("Load Texture failed (%llu)\n"), result.Id);
+				break;
+			case ImageLoadStatus::Cancelled:
+				break;
+			}
 		}
 
 		public:
@@ -761,65 +789,25 @@ namespace MyGame {
 			ofn.Flags = OFN_EXPLORER | OFN_FILEMUSTEXIST;
 
 			if (GetOpenFileName(&ofn)) {
-
-				HANDLE hFile = CreateFile(ofn.lpstrFile, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-				if (hFile) {
-					LARGE_INTEGER fileSize;
-					GetFileSizeEx(hFile, &fileSize);
-					DWORD size = fileSize.LowPart;
-					HGLOBAL hData = GlobalAlloc(GMEM_FIXED, size);
-					if (hData) {
-						DWORD nRead;
-						if (ReadFile(hFile, hData, size, &nRead, NULL)) {
-							OutputDebug(TEXT("Create Texture %s\n"), ofn.lpstrFile);
-							CreateTexture((BYTE*)hData, size);
-						}
-						GlobalFree(hData);
-					}
-					CloseHandle(hFile);
-				}
-
-				//FILE* file;
-				//errno_t err = _tfopen_s(&file, ofn.lpstrFile, TEXT("rb"));
-				//if (err == 0) {
-
-				//	fseek(file, 0, SEEK_END);
-				//	long len = 0;
-				//	len = ftell(file);
-				//	rewind(file);
-
-				//	char* buffer = new char[len];
-				//	char* b = buffer;
-				//	size_t _len = len;
-				//	size_t nread;
-
-				//	while (_len) {
-				//		nread = fread(b, 1, _len, file);
-				//		b += nread;
-				//		_len -= nread;
-				//	}
-				//	
-				//	fclose(file);
-				//	CreateTexture((BYTE*)buffer, len);
-				//	delete[] buffer;
-				//}
+				OutputDebug(TEXT("Load Texture %s\n"), ofn.lpstrFile);
+				// 只保留最後一次選的圖片, 之前還沒載完的直接取消
+				Loader->Cancel(imageLoad);
+				imageLoad = Loader->Load(ofn.lpstrFile, [this](ImageLoadResult& result) { OnImageLoaded(result); });
 			}
 		}
 
 		public:
 		void Test() {
-			HRESULT hr;
-			ComPtr<ID3D11Texture2D> tex;
-			ComPtr<ID3D11ShaderResourceView> texView;
 			UINT width = 128;
 			UINT height = 128;
-			UINT bpp = 32;
-			UINT rowPitch = (width * bpp + 7) / 8;
-			unique_ptr<uint8_t[]> temp(new (std::nothrow) uint8_t[width * height * 4]);
+			DecodedImage image;
+			image.Width = width;
+			image.Height = height;
+			image.Pixels.resize(width * height * 4);
 
 			for (UINT i = 0; i < height; i++) {
 				for (UINT j = 0; j < width; j++) {
-					uint8_t* p = &temp[(i * width + j) * 4];
+					uint8_t* p = &image.Pixels[(i * width + j) * 4];
 					p[0] = 50;
 					p[1] = 0;
 					p[2] = 0;
@@ -827,48 +815,9 @@ namespace MyGame {
 				}
 			}
 
-
-			// Create Texutre2D
-			D3D11_TEXTURE2D_DESC desc;
-			desc.Width = width;
-			desc.Height = height;
-			desc.MipLevels = 1;
-			desc.ArraySize = 1;
-			desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-			desc.SampleDesc.Count = 1;
-			desc.SampleDesc.Quality = 0;
-			desc.Usage = D3D11_USAGE_DEFAULT;
-			desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-			desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-			desc.MiscFlags = 0;
-			D3D11_SUBRESOURCE_DATA initData;
-			initData.pSysMem = temp.get();
-			initData.SysMemPitch = static_cast<UINT>(rowPitch);
-			initData.SysMemSlicePitch = static_cast<UINT>(rowPitch * height);
-			hr = D3D11Device->CreateTexture2D(&desc, &initData, &tex);
-			CHECKRETURN(hr, TEXT("CreateTexture2D"));
-
-			D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
-			SRVDesc.Format = desc.Format;
-			SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-			SRVDesc.Texture2D.MipLevels = 1;
-
-			hr = D3D11Device->CreateShaderResourceView(tex.Get(), &SRVDesc, &texView);
-			CHECKRETURN(hr, TEXT("CreateShaderResourceView"));
-
-			D3D11_SAMPLER_DESC sampDesc;
-			ZeroMemory(&sampDesc, sizeof(sampDesc));
-			sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-			sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
-			sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-			sampDesc.MinLOD = 0;
-			sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
-			hr = D3D11Device->CreateSamplerState(&sampDesc, SamplerState.ReleaseAndGetAddressOf());
-			CHECKRETURN(hr, TEXT("CreateSamplerState"));
-			DeferredContext[0]->PSSetSamplers(0, 1, SamplerState.GetAddressOf());
-			DeferredContext[0]->PSSetShaderResources(0, 1, texView.GetAddressOf());
+			// 跟開啟圖片一樣交給 render thread 上傳
+			Loader->Cancel(imageLoad);
+			imageLoad = Loader->Load(move(image), [this](ImageLoadResult& result) { OnImageLoaded(result); });
 		}
 
 		private:
@@ -1019,12 +968,11 @@ namespace MyGame {
 			InfoTextFormat.Reset();
 			FPSFormat.Reset();
 			DWriteFactory.Reset();
-			SamplerState.Reset();
-			IndexBuffer.Reset();
-			VertexBuffer.Reset();
-			PixelShader.Reset();
-			VertexShader.Reset();
-			VertexLayout.Reset();
+			Loader.reset();
+			Pipeline.reset();
+			Placeholder.reset();
+			Texture.reset();
+			Device.reset();
 			RenderTargetView.Reset();
 			D2DDeviceContext.Reset();
 			ImmediateContext.Reset();
@@ -1042,24 +990,20 @@ namespace MyGame {
 		std::vector<UINT> MsaaQualities;
 
 		ComPtr<ID3D11DeviceContext> ImmediateContext;
-		ComPtr<ID3D11DeviceContext> DeferredContext[2];
-		ComPtr<ID3D11CommandList> DeferredCommandList[2];
 		ComPtr<IDXGISwapChain1> SwapChain;
 		DXGI_SWAP_CHAIN_DESC1 SwapChainDesc;
 		ComPtr<ID2D1DeviceContext> D2DDeviceContext;
 
 		ComPtr<ID3D11RenderTargetView> RenderTargetView;
 		ComPtr<ID3D11DepthStencilView> DepthStencilView;
-		ComPtr<ID3D11InputLayout> VertexLayout;
-		ComPtr<ID3D11VertexShader> VertexShader;
-		ComPtr<ID3D11PixelShader> PixelShader;
 		ComPtr<ID3D11ShaderReflection> Reflector;
-		ComPtr<ID3D11ShaderResourceView> ResourceView;
 
-		ComPtr<ID3D11Buffer> VertexBuffer;
-		ComPtr<ID3D11Buffer> IndexBuffer;
-		ComPtr<ID3D11Buffer> ConstantBuffer;
-		ComPtr<ID3D11SamplerState> SamplerState;
+		unique_ptr<D3D11RenderDevice> Device;
+		unique_ptr<FramePipeline> Pipeline;
+		unique_ptr<RenderTexture> Texture;
+		unique_ptr<RenderTexture> Placeholder;
+		unique_ptr<ImageLoader> Loader;
+		uint64_t imageLoad = 0;
 
 		BOOL TearingSupport = false;
 		D3D11_FEATURE_DATA_THREADING ThreadingSupport;
@@ -1078,14 +1022,23 @@ namespace MyGame {
 		LARGE_INTEGER time;
 		LARGE_INTEGER freq;
 		String fpsString;
+		String infoString;
 		XMMATRIX world = XMMatrixIdentity();
 		XMMATRIX view = XMMatrixIdentity();
 		XMMATRIX projection = XMMatrixIdentity();
+		XMMATRIX previousWorld = XMMatrixIdentity();
+		XMMATRIX previousView = XMMatrixIdentity();
+		XMMATRIX renderWorld = XMMatrixIdentity();
+		XMMATRIX renderView = XMMatrixIdentity();
 		Vector3 eye;
 		Vector3 focus_target;
 		Vector3 up;
 		float nearZ = 5.0f; 
 		float farZ = 10000.0f;
 		POINTS point;
+		InputRing Input;
+		QpcClock Clock;
+		FrameTimer Timer{ Clock, 1.0 / 60.0 };
+		bool FixedStep = false;
 	};
 }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+namespace MyGame {
+
+	struct DrawRange {
+		size_t Begin;
+		size_t End;
+
+		size_t Count() const {
+			return End - Begin;
+		}
+	};
+
+	// 把 draw list 依照估計成本切成連續的區間, 一個區間交給一個 DeferredContext 錄製
+	// 區間保持原本的順序, 依區間順序 ExecuteCommandList 就跟單執行緒畫出來的順序一樣
+	class DrawPartitioner {
+
+	public:
+		// 切換一次 buffer / texture 大約等於畫多少個 index
+		static const unsigned long long StateChangeCost = 256;
+
+		static unsigned long long EstimateCost(unsigned int indexCount, unsigned int stateChanges) {
+			return (unsigned long long)indexCount + stateChanges * StateChangeCost;
+		}
+
+		// 最多切成 parts 段, 空的區間不會被產生
+		void Partition(const vector<unsigned long long>& costs, int parts) {
+			ranges.clear();
+			size_t count = costs.size();
+			if (count == 0 || parts <= 0) return;
+			if ((size_t)parts > count) parts = (int)count;
+
+			unsigned long long remain = 0;
+			for (auto c : costs) remain += c;
+
+			size_t i = 0;
+			for (int p = 0; p < parts && i < count; p++) {
+				int partsLeft = parts - p;
+				size_t begin = i;
+
+				if (partsLeft == 1) {
+					i = count;
+				} else {
+					// 每一段的目標是剩下的成本平均分給剩下的段數
+					unsigned long long target = remain / partsLeft;
+					unsigned long long acc = 0;
+					// 至少留一個 draw 給後面每一段
+					size_t last = count - (partsLeft - 1);
+					while (i < last) {
+						unsigned long long c = costs[i];
+						// 超過目標一半以上就留給下一段
+						if (i > begin && acc + c / 2 > target) break;
+						acc += c;
+						i++;
+					}
+					remain -= acc;
+				}
+
+				ranges.push_back({ begin, i });
+			}
+		}
+
+		int Count() const {
+			return (int)ranges.size();
+		}
+
+		const DrawRange& operator[](int index) const {
+			return ranges[index];
+		}
+
+	private:
+		vector<DrawRange> ranges;
+	};
+}
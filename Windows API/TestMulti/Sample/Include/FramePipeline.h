@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "RenderDevice.h"
+#include "ConstantRing.h"
+#include "DrawPartition.h"
+#include "WorkerPool.h"
+#include "Profiler.h"
+
+namespace MyGame {
+
+	// 與 XMFLOAT4X4 相同的排列方式 (row-major, 列向量乘在左邊)
+	struct Float4x4 {
+		float m[4][4];
+
+		static Float4x4 Identity() {
+			Float4x4 r = {};
+			r.m[0][0] = r.m[1][1] = r.m[2][2] = r.m[3][3] = 1.0f;
+			return r;
+		}
+
+		static Float4x4 Translation(float x, float y, float z) {
+			Float4x4 r = Identity();
+			r.m[3][0] = x;
+			r.m[3][1] = y;
+			r.m[3][2] = z;
+			return r;
+		}
+	};
+
+	inline Float4x4 Multiply(const Float4x4& a, const Float4x4& b) {
+		Float4x4 r;
+		for (int i = 0; i < 4; i++) {
+			for (int j = 0; j < 4; j++) {
+				r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + a.m[i][3] * b.m[3][j];
+			}
+		}
+		return r;
+	}
+
+	struct DrawItem {
+		Float4x4 Transform;
+		uint32_t IndexCount;
+		uint32_t StartIndex;
+		int32_t BaseVertex;
+	};
+
+	// 每一幀的 update / record / submit, 只透過 RenderDevice 跟裝置溝通
+	// 錄製依照 DrawPartitioner 切好的區間分給 WorkerPool, 送出時依照區間順序執行
+	class FramePipeline {
+
+	public:
+		FramePipeline(RenderDevice& device)
+			: device(device) {
+		}
+
+		~FramePipeline() {
+			Shutdown();
+		}
+
+		void Initialize(int contextCount, bool parallel) {
+			if (contextCount <= 0) contextCount = 1;
+			this->parallel = parallel;
+			contexts.clear();
+			commandLists.clear();
+			for (int i = 0; i < contextCount; i++) {
+				contexts.push_back(device.CreateDeferredContext());
+			}
+			commandLists.resize(contextCount);
+			Partition();
+			// 呼叫 Render 的執行緒也會分擔一個區間
+			if (parallel) workers.Start(contextCount - 1);
+		}
+
+		void Shutdown() {
+			workers.Stop();
+		}
+
+		// DrawList 改變之後要重新切
+		void Partition() {
+			vector<unsigned long long> costs;
+			costs.reserve(DrawList.size());
+			for (size_t i = 0; i < DrawList.size(); i++) {
+				// 所有 draw 共用同一組 buffer, 只有常量緩衝區每次都要更新
+				costs.push_back(DrawPartitioner::EstimateCost(DrawList[i].IndexCount, 1));
+			}
+			partitioner.Partition(costs, (int)contexts.size());
+			constants.resize(DrawList.size());
+			constantOffsets.assign(DrawList.size(), size_t(ConstantRing::Invalid));
+
+			// 支援 constant buffer offset 時, 每個區間的矩陣寫進自己的 buffer, 不再每個 draw 都 UpdateBuffer
+			// DYNAMIC buffer 要在使用它的 deferred context 上以 WRITE_DISCARD 對應, 所以不能整幀共用一個
+			ringBuffers.clear();
+			if (device.SupportsConstantOffsets()) {
+				for (int i = 0; i < partitioner.Count(); i++) {
+					const DrawRange& range = partitioner[i];
+					ringBuffers.push_back(device.CreateBuffer(BufferType::DynamicConstant, RingCapacity(range), nullptr));
+				}
+			}
+		}
+
+		void Render(const Float4x4& world, const Float4x4& viewProjection, const float clearColor[4]) {
+			PROFILE_SCOPE("FramePipeline::Render");
+			frameWorld = world;
+			frameViewProjection = viewProjection;
+
+			RenderContext* immediate = device.Immediate();
+			immediate->Clear(clearColor);
+
+			if (parallel) {
+				// 喚醒常駐的 worker 分頭錄製, 全部 FinishCommandList 之後才返回
+				workers.Dispatch(partitioner.Count(), recordJob);
+			} else {
+				for (int i = 0; i < partitioner.Count(); i++) {
+					Record(i);
+				}
+			}
+
+			// 依照區間順序送出, 結果跟單執行緒錄製的順序相同
+			for (int i = 0; i < partitioner.Count(); i++) {
+				if (commandLists[i]) {
+					immediate->ExecuteCommandList(commandLists[i].get());
+					commandLists[i].reset();
+				}
+			}
+		}
+
+		RenderContext* Context(int index) {
+			return contexts[index].get();
+		}
+
+	private:
+		static size_t RingCapacity(const DrawRange& range) {
+			return ConstantRing::Align(sizeof(Float4x4)) * (range.End - range.Begin);
+		}
+
+		// mapped 不是 nullptr 時, 矩陣同時依序寫進這個區間的 buffer, offset 記在 constantOffsets
+		void Update(int index, uint8_t* mapped) {
+			PROFILE_SCOPE("UpdateDeferred");
+			const DrawRange& range = partitioner[index];
+			ConstantRing ring;
+			ring.Reset(mapped ? RingCapacity(range) : 0);
+			for (size_t i = range.Begin; i < range.End; i++) {
+				constants[i] = Multiply(Multiply(frameWorld, DrawList[i].Transform), frameViewProjection);
+				constantOffsets[i] = ring.Allocate(sizeof(Float4x4));
+				if (constantOffsets[i] != ConstantRing::Invalid) {
+					memcpy(mapped + constantOffsets[i], &constants[i], sizeof(Float4x4));
+				}
+			}
+		}
+
+		void Record(int index) {
+			RenderContext* context = contexts[index].get();
+			// 在錄製這個區間的 deferred context 上 Map, 寫入的內容跟著指令清單一起送出
+			// Map 失敗 (或不支援 offset) 時整個區間改回每個 draw 一次 UpdateBuffer
+			RenderBuffer* ringBuffer = ringBuffers.empty() ? nullptr : ringBuffers[index].get();
+			uint8_t* mapped = ringBuffer ? (uint8_t*)context->Map(ringBuffer) : nullptr;
+			Update(index, mapped);
+			if (mapped) context->Unmap(ringBuffer);
+
+			PROFILE_SCOPE("RenderDeferred");
+			context->SetShader(Shader.get());
+			context->SetVertexBuffer(VertexBuffer.get(), VertexStride);
+			context->SetIndexBuffer(IndexBuffer.get());
+			if (!mapped) context->SetConstantBuffer(0, ConstantBuffer.get());
+			if (Texture) context->SetTexture(0, Texture);
+
+			const DrawRange& range = partitioner[index];
+			for (size_t i = range.Begin; i < range.End; i++) {
+				const DrawItem& item = DrawList[i];
+				if (mapped) {
+					context->SetConstantBufferRange(0, ringBuffer, constantOffsets[i], sizeof(Float4x4));
+				} else {
+					context->UpdateBuffer(ConstantBuffer.get(), &constants[i], sizeof(Float4x4));
+				}
+				context->DrawIndexed(item.IndexCount, item.StartIndex, item.BaseVertex);
+			}
+
+			commandLists[index] = context->FinishCommandList();
+		}
+
+	public:
+		unique_ptr<RenderShader> Shader;
+		unique_ptr<RenderBuffer> VertexBuffer;
+		unique_ptr<RenderBuffer> IndexBuffer;
+		unique_ptr<RenderBuffer> ConstantBuffer;
+		uint32_t VertexStride = 0;
+		RenderTexture* Texture = nullptr;
+		vector<DrawItem> DrawList;
+
+	private:
+		RenderDevice& device;
+		vector<unique_ptr<RenderContext>> contexts;
+		vector<unique_ptr<RenderCommandList>> commandLists;
+		vector<Float4x4> constants;
+		vector<size_t> constantOffsets;				// 在所屬區間的 buffer 裡的 offset
+		vector<unique_ptr<RenderBuffer>> ringBuffers;	// 每個區間一個, 由錄製它的 deferred context 對應
+		DrawPartitioner partitioner;
+		WorkerPool workers;
+		bool parallel = false;
+		Float4x4 frameWorld;
+		Float4x4 frameViewProjection;
+		const function<void(int)> recordJob = [this](int index) { Record(index); };
+	};
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+namespace MyGame {
+
+	// 計時來源, 遊戲裡用 QueryPerformanceCounter, 測試時可以換成假的時鐘
+	class FrameClock {
+	public:
+		virtual ~FrameClock() = default;
+		virtual int64_t Now() = 0;
+		virtual int64_t Frequency() = 0;
+	};
+
+	// 每一幀花費的時間 (毫秒), 以 0.05ms 為一格統計, 超過 BucketCount 格的放在最後一格
+	// 平均 FPS 看不出偶爾卡一下, 所以另外提供 p50 / p95 / p99 / max
+	class FrameHistogram {
+
+	public:
+		static const int BucketCount = 2000;
+		static constexpr double BucketWidth = 0.05;
+
+		FrameHistogram() {
+			Reset();
+		}
+
+		void Reset() {
+			for (int i = 0; i < BucketCount; i++) buckets[i] = 0;
+			count = 0;
+			total = 0.0;
+			maximum = 0.0;
+		}
+
+		void Record(double milliseconds) {
+			if (milliseconds < 0.0) milliseconds = 0.0;
+			int index = (int)(milliseconds / BucketWidth);
+			if (index >= BucketCount) index = BucketCount - 1;
+			buckets[index]++;
+			count++;
+			total += milliseconds;
+			if (milliseconds > maximum) maximum = milliseconds;
+		}
+
+		uint64_t Count() const {
+			return count;
+		}
+
+		double Mean() const {
+			return count ? total / count : 0.0;
+		}
+
+		double Max() const {
+			return maximum;
+		}
+
+		// p = 0 ~ 100, 回傳該格的上界, 不會超過實際的最大值
+		double Percentile(double p) const {
+			if (count == 0) return 0.0;
+			uint64_t rank = (uint64_t)(p / 100.0 * count + 0.5);
+			if (rank < 1) rank = 1;
+			if (rank > count) rank = count;
+			uint64_t seen = 0;
+			for (int i = 0; i < BucketCount; i++) {
+				seen += buckets[i];
+				if (seen >= rank) {
+					double upper = (i + 1) * BucketWidth;
+					return upper < maximum ? upper : maximum;
+				}
+			}
+			return maximum;
+		}
+
+		void WriteCsv(FILE* stream) const {
+			fprintf(stream, "bucket_ms,count\n");
+			for (int i = 0; i < BucketCount; i++) {
+				if (buckets[i]) fprintf(stream, "%.2f,%llu\n", i * BucketWidth, (unsigned long long)buckets[i]);
+			}
+		}
+
+		void WriteJson(FILE* stream) const {
+			fprintf(stream, "{\n");
+			fprintf(stream, "  \"frames\": %llu,\n", (unsigned long long)count);
+			fprintf(stream, "  \"mean_ms\": %.4f,\n", Mean());
+			fprintf(stream, "  \"p50_ms\": %.4f,\n", Percentile(50.0));
+			fprintf(stream, "  \"p95_ms\": %.4f,\n", Percentile(95.0));
+			fprintf(stream, "  \"p99_ms\": %.4f,\n", Percentile(99.0));
+			fprintf(stream, "  \"max_ms\": %.4f\n", Max());
+			fprintf(stream, "}\n");
+		}
+
+	private:
+		uint64_t buckets[BucketCount];
+		uint64_t count;
+		double total;
+		double maximum;
+	};
+
+	// 固定時間步長: 模擬以固定的 Step 前進, 畫面則用 Alpha 在前後兩個狀態之間內插
+	class FrameTimer {
+
+	public:
+		// 一幀最多補幾步模擬, 避免卡頓之後越追越慢
+		static const int MaxStepsPerFrame = 8;
+
+		FrameTimer(FrameClock& clock, double step)
+			: clock(clock), step(step) {
+			Reset();
+		}
+
+		void Reset() {
+			last = clock.Now();
+			accumulator = 0.0;
+			steps = 0;
+			histogram.Reset();
+		}
+
+		// 每一幀呼叫一次, 記錄這一幀的時間並回傳這一幀要跑幾步模擬
+		int Tick() {
+			int64_t now = clock.Now();
+			double elapsed = (double)(now - last) / (double)clock.Frequency();
+			last = now;
+			histogram.Record(elapsed * 1000.0);
+
+			accumulator += elapsed;
+			steps = 0;
+			while (accumulator >= step && steps < MaxStepsPerFrame) {
+				accumulator -= step;
+				steps++;
+			}
+			if (steps == MaxStepsPerFrame && accumulator > step) {
+				accumulator = 0.0;
+			}
+			return steps;
+		}
+
+		// 這一幀第 index 步模擬 (0 ~ Tick 的回傳值 - 1) 結束的時間, 單位跟 FrameClock::Now 相同
+		// 發生在這個時間之前的輸入屬於這一步; 追不上而丟掉的時間全部算進最後一步
+		int64_t StepEnd(int index) const {
+			double behind = accumulator + (steps - 1 - index) * step;
+			return last - (int64_t)(behind * (double)clock.Frequency());
+		}
+
+		// 0 ~ 1, 目前時間落在上一個與這一個模擬狀態之間的位置
+		double Alpha() const {
+			return accumulator / step;
+		}
+
+		double Step() const {
+			return step;
+		}
+
+		const FrameHistogram& Histogram() const {
+			return histogram;
+		}
+
+	private:
+		FrameClock& clock;
+		double step;
+		int64_t last;
+		double accumulator;
+		int steps;
+		FrameHistogram histogram;
+	};
+}
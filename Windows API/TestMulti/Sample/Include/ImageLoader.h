@@ -0,0 +1,416 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <objbase.h>
+#endif
+
+#include "RenderDevice.h"
+#include "Profiler.h"
+
+namespace MyGame {
+
+#ifdef _WIN32
+	typedef wstring ImagePath;
+#else
+	typedef string ImagePath;
+#endif
+
+	// 解碼後的圖片, 一律是 RGBA8, 由上往下排列
+	struct DecodedImage {
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		vector<uint8_t> Pixels;
+	};
+
+	// 在解碼執行緒上呼叫, 必須是 thread-safe 的
+	typedef function<bool(const uint8_t* data, size_t size, DecodedImage& image)> ImageDecoder;
+
+	enum class ImageLoadStatus {
+		Completed,
+		Failed,
+		Cancelled,
+	};
+
+	struct ImageLoadResult {
+		uint64_t Id;
+		ImageLoadStatus Status;
+		unique_ptr<RenderTexture> Texture;
+		uint32_t Width;
+		uint32_t Height;
+	};
+
+	typedef function<void(ImageLoadResult& result)> ImageLoadCallback;
+
+	// BI_BITFIELDS 的一個通道: 遮罩必須是連續的位元, 取出來之後放大到 0 ~ 255
+	struct BitmapChannel {
+		uint32_t Mask = 0;
+		uint32_t Shift = 0;
+		uint32_t Max = 0;
+
+		bool Set(uint32_t mask) {
+			Mask = mask;
+			Shift = 0;
+			Max = 0;
+			if (mask == 0) return true;
+			while ((mask & 1) == 0) {
+				mask >>= 1;
+				Shift++;
+			}
+			if ((mask & (mask + 1)) != 0) return false;
+			Max = mask;
+			return true;
+		}
+
+		uint8_t Extract(uint32_t pixel, uint8_t missing) const {
+			if (Max == 0) return missing;
+			return (uint8_t)(((uint64_t)((pixel & Mask) >> Shift) * 255 + Max / 2) / Max);
+		}
+	};
+
+	// 未壓縮的 24/32 位元 BMP 與 32 位元 BI_BITFIELDS, 不需要 WIC, 在任何平台都能用
+	inline bool DecodeBitmap(const uint8_t* data, size_t size, DecodedImage& image) {
+		auto u16 = [&](size_t o) { return (uint32_t)data[o] | ((uint32_t)data[o + 1] << 8); };
+		auto u32 = [&](size_t o) { return u16(o) | (u16(o + 2) << 16); };
+
+		const uint32_t BI_RGB = 0, BI_BITFIELDS = 3;
+		if (size < 54 || data[0] != 'B' || data[1] != 'M') return false;
+		uint32_t offset = u32(10);
+		uint32_t headerSize = u32(14);
+		int32_t width = (int32_t)u32(18);
+		int32_t height = (int32_t)u32(22);
+		uint32_t bpp = u16(28);
+		uint32_t compression = u32(30);
+		// INT32_MIN 取負號會溢位
+		if (width <= 0 || height == 0 || height == INT32_MIN || (bpp != 24 && bpp != 32)) return false;
+		if (compression != BI_RGB && (compression != BI_BITFIELDS || bpp != 32)) return false;
+
+		// 遮罩緊接在 40 bytes 的 BITMAPINFOHEADER 後面, V4 / V5 的 header 則是包含在 header 裡, 位置相同
+		// 只有 V4 以上的 header 有 alpha 遮罩
+		BitmapChannel red, green, blue, alpha;
+		if (compression == BI_BITFIELDS) {
+			if (headerSize < 40 || size < 66) return false;
+			if (!red.Set(u32(54)) || !green.Set(u32(58)) || !blue.Set(u32(62))) return false;
+			if (headerSize >= 56 && (size < 70 || !alpha.Set(u32(66)))) return false;
+		}
+
+		// 高度是正的代表由下往上存
+		bool bottomUp = height > 0;
+		uint32_t h = bottomUp ? (uint32_t)height : (uint32_t)-height;
+		uint32_t w = (uint32_t)width;
+		size_t pitch = ((size_t)w * bpp / 8 + 3) & ~(size_t)3;
+		if (offset > size || h > (size - offset) / pitch) return false;
+
+		image.Width = w;
+		image.Height = h;
+		image.Pixels.resize((size_t)w * h * 4);
+		for (uint32_t y = 0; y < h; y++) {
+			const uint8_t* src = data + offset + pitch * (bottomUp ? h - 1 - y : y);
+			uint8_t* dst = image.Pixels.data() + (size_t)y * w * 4;
+			if (compression == BI_BITFIELDS) {
+				for (uint32_t x = 0; x < w; x++) {
+					uint32_t pixel = (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+					dst[0] = red.Extract(pixel, 0);
+					dst[1] = green.Extract(pixel, 0);
+					dst[2] = blue.Extract(pixel, 0);
+					dst[3] = alpha.Extract(pixel, 255);
+					src += 4;
+					dst += 4;
+				}
+				continue;
+			}
+			for (uint32_t x = 0; x < w; x++) {
+				dst[0] = src[2];
+				dst[1] = src[1];
+				dst[2] = src[0];
+				dst[3] = bpp == 32 ? src[3] : 255;
+				src += bpp / 8;
+				dst += 4;
+			}
+		}
+		return true;
+	}
+
+	// 三個階段: 讀檔 (1 條執行緒) -> 解碼 (多條執行緒) -> 上傳 (呼叫 Upload 的執行緒, 通常是 render thread)
+	// 讀檔跟解碼不碰繪圖裝置, 所以在 Linux 上也能跑
+	// 完成、失敗或取消都會在 Upload 裡呼叫 callback, 所以 callback 不需要考慮同步
+	class ImageLoader {
+
+	public:
+		ImageLoader(RenderDevice& device, ImageDecoder decoder)
+			: device(device), decoder(decoder) {
+		}
+
+		~ImageLoader() {
+			Stop();
+		}
+
+		void Start(int decodeThreads) {
+			if (running) return;
+			if (decodeThreads <= 0) decodeThreads = 1;
+			running = true;
+			ioThread = thread(&ImageLoader::ReadMain, this);
+			for (int i = 0; i < decodeThreads; i++) {
+				decodeThread.emplace_back(&ImageLoader::DecodeMain, this);
+			}
+		}
+
+		// 還在排隊的工作都當作取消, 下一次 Upload 會收到 callback
+		void Stop() {
+			{
+				lock_guard<mutex> lock(mtx);
+				if (!running) return;
+				running = false;
+			}
+			ioReady.notify_all();
+			decodeReady.notify_all();
+			if (ioThread.joinable()) ioThread.join();
+			for (auto& t : decodeThread) t.join();
+			decodeThread.clear();
+
+			lock_guard<mutex> lock(mtx);
+			for (auto& job : ioQueue) Finish(job, ImageLoadStatus::Cancelled);
+			for (auto& job : decodeQueue) Finish(job, ImageLoadStatus::Cancelled);
+			ioQueue.clear();
+			decodeQueue.clear();
+		}
+
+		uint64_t Load(const ImagePath& path, ImageLoadCallback callback) {
+			shared_ptr<Job> job = NewJob(move(callback));
+			job->Path = path;
+			{
+				lock_guard<mutex> lock(mtx);
+				ioQueue.push_back(job);
+			}
+			ioReady.notify_one();
+			return job->Id;
+		}
+
+		// 已經解碼好的圖片, 直接排進上傳
+		uint64_t Load(DecodedImage image, ImageLoadCallback callback) {
+			shared_ptr<Job> job = NewJob(move(callback));
+			job->Image = move(image);
+			lock_guard<mutex> lock(mtx);
+			Finish(job, ImageLoadStatus::Completed);
+			return job->Id;
+		}
+
+		void Cancel(uint64_t id) {
+			lock_guard<mutex> lock(mtx);
+			for (auto& job : active) {
+				if (job->Id == id) job->Cancelled = true;
+			}
+		}
+
+		void CancelAll() {
+			lock_guard<mutex> lock(mtx);
+			for (auto& job : active) job->Cancelled = true;
+		}
+
+		// 每一幀最多上傳 budget 張, 避免一次卡住太久
+		// 回傳處理了幾個工作 (包含失敗與取消)
+		int Upload(int budget) {
+			int handled = 0;
+			while (true) {
+				shared_ptr<Job> job;
+				{
+					lock_guard<mutex> lock(mtx);
+					if (readyQueue.empty()) break;
+					job = readyQueue.front();
+					if (job->Status == ImageLoadStatus::Completed && !job->Cancelled) {
+						if (budget <= 0) break;
+						budget--;
+					}
+					readyQueue.pop_front();
+				}
+
+				ImageLoadResult result = { job->Id, job->Status, nullptr, job->Image.Width, job->Image.Height };
+				if (job->Cancelled) {
+					result.Status = ImageLoadStatus::Cancelled;
+				} else if (result.Status == ImageLoadStatus::Completed) {
+					PROFILE_SCOPE("ImageUpload");
+					result.Texture = device.CreateTexture(job->Image.Width, job->Image.Height, job->Image.Pixels.data());
+					if (!result.Texture) result.Status = ImageLoadStatus::Failed;
+				}
+				if (job->Callback) job->Callback(result);
+
+				{
+					lock_guard<mutex> lock(mtx);
+					for (size_t i = 0; i < active.size(); i++) {
+						if (active[i] == job) {
+							active[i] = active.back();
+							active.pop_back();
+							break;
+						}
+					}
+				}
+				handled++;
+			}
+			return handled;
+		}
+
+		// 還沒呼叫 callback 的工作數量
+		size_t Pending() {
+			lock_guard<mutex> lock(mtx);
+			return active.size();
+		}
+
+	private:
+		struct Job {
+			uint64_t Id;
+			ImagePath Path;
+			ImageLoadCallback Callback;
+			vector<uint8_t> File;
+			DecodedImage Image;
+			ImageLoadStatus Status = ImageLoadStatus::Completed;
+			atomic<bool> Cancelled{ false };
+		};
+
+		shared_ptr<Job> NewJob(ImageLoadCallback callback) {
+			shared_ptr<Job> job = make_shared<Job>();
+			job->Callback = move(callback);
+			lock_guard<mutex> lock(mtx);
+			job->Id = ++lastId;
+			active.push_back(job);
+			return job;
+		}
+
+		// 必須持有 mtx
+		void Finish(const shared_ptr<Job>& job, ImageLoadStatus status) {
+			job->Status = status;
+			job->File.clear();
+			job->File.shrink_to_fit();
+			readyQueue.push_back(job);
+		}
+
+		static bool ReadWholeFile(const ImagePath& path, vector<uint8_t>& data) {
+			FILE* stream = nullptr;
+#ifdef _WIN32
+			if (_wfopen_s(&stream, path.c_str(), L"rb") != 0) return false;
+#else
+			stream = fopen(path.c_str(), "rb");
+#endif
+			if (stream == nullptr) return false;
+			bool ok = fseek(stream, 0, SEEK_END) == 0;
+			long length = ok ? ftell(stream) : -1;
+			ok = length >= 0 && fseek(stream, 0, SEEK_SET) == 0;
+			if (ok) {
+				data.resize((size_t)length);
+				ok = fread(data.data(), 1, data.size(), stream) == data.size();
+			}
+			fclose(stream);
+			return ok;
+		}
+
+		void ReadMain() {
+			PROFILE_THREAD("ImageRead");
+			while (true) {
+				shared_ptr<Job> job;
+				{
+					unique_lock<mutex> lock(mtx);
+					ioReady.wait(lock, [this] { return !running || !ioQueue.empty(); });
+					if (!running) return;
+					job = ioQueue.front();
+					ioQueue.pop_front();
+					if (job->Cancelled) {
+						Finish(job, ImageLoadStatus::Cancelled);
+						continue;
+					}
+				}
+
+				bool ok;
+				{
+					PROFILE_SCOPE("ImageRead");
+					ok = ReadWholeFile(job->Path, job->File);
+				}
+
+				{
+					lock_guard<mutex> lock(mtx);
+					if (!ok || job->Cancelled) {
+						Finish(job, ok ? ImageLoadStatus::Cancelled : ImageLoadStatus::Failed);
+						continue;
+					}
+					decodeQueue.push_back(job);
+				}
+				decodeReady.notify_one();
+			}
+		}
+
+		// 解碼器 (例如 WIC) 需要 COM, 每條解碼執行緒自己初始化, 離開時釋放
+		class ComScope {
+		public:
+			ComScope() {
+#ifdef _WIN32
+				initialized = SUCCEEDED(CoInitializeEx(nullptr, COINITBASE_MULTITHREADED));
+#endif
+			}
+
+			~ComScope() {
+#ifdef _WIN32
+				if (initialized) CoUninitialize();
+#endif
+			}
+
+			ComScope(const ComScope&) = delete;
+			ComScope& operator=(const ComScope&) = delete;
+
+		private:
+			bool initialized = false;
+		};
+
+		void DecodeMain() {
+			PROFILE_THREAD("ImageDecode");
+			ComScope com;
+			while (true) {
+				shared_ptr<Job> job;
+				{
+					unique_lock<mutex> lock(mtx);
+					decodeReady.wait(lock, [this] { return !running || !decodeQueue.empty(); });
+					if (!running) return;
+					job = decodeQueue.front();
+					decodeQueue.pop_front();
+					if (job->Cancelled) {
+						Finish(job, ImageLoadStatus::Cancelled);
+						continue;
+					}
+				}
+
+				bool ok;
+				{
+					PROFILE_SCOPE("ImageDecode");
+					ok = decoder(job->File.data(), job->File.size(), job->Image);
+				}
+
+				lock_guard<mutex> lock(mtx);
+				Finish(job, ok ? ImageLoadStatus::Completed : ImageLoadStatus::Failed);
+			}
+		}
+
+	private:
+		RenderDevice& device;
+		ImageDecoder decoder;
+		mutex mtx;
+		condition_variable ioReady;
+		condition_variable decodeReady;
+		deque<shared_ptr<Job>> ioQueue;
+		deque<shared_ptr<Job>> decodeQueue;
+		deque<shared_ptr<Job>> readyQueue;
+		vector<shared_ptr<Job>> active;
+		uint64_t lastId = 0;
+		bool running = false;
+		thread ioThread;
+		vector<thread> decodeThread;
+	};
+}
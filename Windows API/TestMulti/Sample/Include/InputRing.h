@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace MyGame {
+
+	struct InputEvent {
+		uint32_t Message;
+		uint64_t wParam;
+		int64_t lParam;
+		int64_t Timestamp;
+	};
+
+	// 單一生產者 (WndProc) / 單一消費者 (render thread) 的環狀佇列, 不用鎖
+	// Capacity 必須是 2 的次方
+	template<typename T, size_t Capacity>
+	class SpscRing {
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+	public:
+		bool Push(const T& item) {
+			size_t tail = tailIndex.load(memory_order_relaxed);
+			if (tail - cachedHead >= Capacity) {
+				cachedHead = headIndex.load(memory_order_acquire);
+				if (tail - cachedHead >= Capacity) return false;
+			}
+			items[tail & (Capacity - 1)] = item;
+			tailIndex.store(tail + 1, memory_order_release);
+			return true;
+		}
+
+		bool Pop(T& item) {
+			size_t head = headIndex.load(memory_order_relaxed);
+			if (head == tailIndex.load(memory_order_acquire)) return false;
+			item = items[head & (Capacity - 1)];
+			headIndex.store(head + 1, memory_order_release);
+			return true;
+		}
+
+		// 一次取出目前所有的項目, 只更新一次 head
+		template<typename Function>
+		size_t Drain(Function&& func) {
+			size_t head = headIndex.load(memory_order_relaxed);
+			size_t tail = tailIndex.load(memory_order_acquire);
+			for (size_t i = head; i != tail; i++) {
+				func(items[i & (Capacity - 1)]);
+			}
+			headIndex.store(tail, memory_order_release);
+			return tail - head;
+		}
+
+		// 從頭開始取出 pred 成立的項目, 遇到第一個不成立的就停下, 剩下的留到下一次
+		template<typename Predicate, typename Function>
+		size_t DrainWhile(Predicate&& pred, Function&& func) {
+			size_t head = headIndex.load(memory_order_relaxed);
+			size_t tail = tailIndex.load(memory_order_acquire);
+			size_t i = head;
+			for (; i != tail; i++) {
+				const T& item = items[i & (Capacity - 1)];
+				if (!pred(item)) break;
+				func(item);
+			}
+			headIndex.store(i, memory_order_release);
+			return i - head;
+		}
+
+		bool Empty() const {
+			return headIndex.load(memory_order_acquire) == tailIndex.load(memory_order_acquire);
+		}
+
+	private:
+		alignas(64) atomic<size_t> headIndex{ 0 };
+		alignas(64) atomic<size_t> tailIndex{ 0 };
+		// 只有生產者會用到, 減少讀取 headIndex 的次數
+		size_t cachedHead = 0;
+		alignas(64) T items[Capacity];
+	};
+
+	// WM_MOUSEMOVE 帶的是絕對座標, 連續的移動只要保留最後一筆就不會遺失位移量
+	class InputRing {
+
+	public:
+		static const uint32_t MouseMove = 0x0200; // WM_MOUSEMOVE
+
+		// 由 WndProc 呼叫
+		bool Post(uint32_t message, uint64_t wParam, int64_t lParam, int64_t timestamp) {
+			InputEvent e = { message, wParam, lParam, timestamp };
+			if (message == MouseMove) {
+				// 佇列滿了就先暫存, 之後的移動直接覆蓋, 等有空位再送出
+				if (hasPendingMove || !ring.Push(e)) {
+					pendingMove = e;
+					hasPendingMove = true;
+					FlushPendingMove();
+				}
+				return true;
+			}
+			// 維持事件順序, 暫存的移動要先送
+			if (!FlushPendingMove()) return false;
+			return ring.Push(e);
+		}
+
+		// 由 render thread 呼叫, 一次處理這一幀收到的所有事件
+		// 相鄰且按鍵狀態相同的滑鼠移動合併成一筆
+		template<typename Function>
+		size_t Drain(Function&& func) {
+			return DrainUntil(INT64_MAX, func);
+		}
+
+		// 固定時間步長用: 只處理 Timestamp <= time 的事件, 之後的事件留給下一步
+		template<typename Function>
+		size_t DrainUntil(int64_t time, Function&& func) {
+			bool hasMove = false;
+			InputEvent move;
+			size_t n = ring.DrainWhile([time](const InputEvent& e) { return e.Timestamp <= time; }, [&](const InputEvent& e) {
+				if (e.Message == MouseMove) {
+					if (hasMove && move.wParam != e.wParam) func(move);
+					move = e;
+					hasMove = true;
+				} else {
+					if (hasMove) {
+						func(move);
+						hasMove = false;
+					}
+					func(e);
+				}
+			});
+			if (hasMove) func(move);
+			return n;
+		}
+
+	private:
+		bool FlushPendingMove() {
+			if (!hasPendingMove) return true;
+			if (!ring.Push(pendingMove)) return false;
+			hasPendingMove = false;
+			return true;
+		}
+
+	private:
+		SpscRing<InputEvent, 1024> ring;
+		InputEvent pendingMove;
+		bool hasPendingMove = false;
+	};
+}
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "RenderDevice.h"
+
+namespace MyGame {
+
+	// 不畫任何東西, 只記錄 CPU 端送了哪些指令
+	// 用來在沒有 GPU 的環境 (例如 Linux CI) 跑完整的 update / record / submit 流程並計時
+	struct NullDeviceStats {
+		uint64_t Draws = 0;
+		uint64_t Indices = 0;
+		uint64_t BufferUpdates = 0;
+		uint64_t BytesUploaded = 0;
+		uint64_t StateChanges = 0;
+		uint64_t CommandLists = 0;
+		uint64_t Presents = 0;
+		// 依照執行順序累積的指令雜湊, 多執行緒錄製的結果應該要跟單執行緒相同
+		uint64_t StreamHash = 14695981039346656037ull;
+	};
+
+	class NullBuffer : public RenderBuffer {
+	public:
+		NullBuffer(BufferType type, size_t size, const void* initData)
+			: Type(type), Data(size) {
+			if (initData && size) memcpy(Data.data(), initData, size);
+		}
+
+		BufferType Type;
+		vector<uint8_t> Data;
+	};
+
+	class NullTexture : public RenderTexture {
+	public:
+		NullTexture(uint32_t width, uint32_t height)
+			: Width(width), Height(height) {
+		}
+
+		uint32_t Width;
+		uint32_t Height;
+	};
+
+	class NullShader : public RenderShader {
+	};
+
+	struct NullCommand {
+		enum Kind : uint32_t {
+			Shader,
+			VertexBuffer,
+			IndexBuffer,
+			ConstantBuffer,
+			ConstantRange,
+			Texture,
+			Update,
+			Unmap,
+			Draw,
+			Clear,
+		};
+
+		Kind Type;
+		void* Object;
+		uint32_t A;
+		uint32_t B;
+		int32_t C;
+		size_t DataOffset;
+		size_t DataSize;
+	};
+
+	class NullCommandList : public RenderCommandList {
+	public:
+		vector<NullCommand> Commands;
+		vector<uint8_t> Data;
+	};
+
+	class NullRenderDevice;
+
+	class NullContext : public RenderContext {
+
+	public:
+		NullContext(NullRenderDevice* device, bool deferred)
+			: device(device), deferred(deferred), list(new NullCommandList()) {
+		}
+
+		void SetShader(RenderShader* shader) override {
+			Record({ NullCommand::Shader, shader, 0, 0, 0, 0, 0 });
+		}
+
+		void SetVertexBuffer(RenderBuffer* buffer, uint32_t stride) override {
+			Record({ NullCommand::VertexBuffer, buffer, stride, 0, 0, 0, 0 });
+		}
+
+		void SetIndexBuffer(RenderBuffer* buffer) override {
+			Record({ NullCommand::IndexBuffer, buffer, 0, 0, 0, 0, 0 });
+		}
+
+		void SetConstantBuffer(uint32_t slot, RenderBuffer* buffer) override {
+			Record({ NullCommand::ConstantBuffer, buffer, slot, 0, 0, 0, 0 });
+		}
+
+		void SetConstantBufferRange(uint32_t slot, RenderBuffer* buffer, size_t offset, size_t size) override {
+			Record({ NullCommand::ConstantRange, buffer, (uint32_t)offset, (uint32_t)size, (int32_t)slot, 0, 0 });
+		}
+
+		void SetTexture(uint32_t slot, RenderTexture* texture) override {
+			Record({ NullCommand::Texture, texture, slot, 0, 0, 0, 0 });
+		}
+
+		void UpdateBuffer(RenderBuffer* buffer, const void* data, size_t size) override {
+			// 錄製時先複製一份, 執行時才真的寫進 buffer, 跟 D3D11 的 deferred context 一樣
+			size_t offset = list->Data.size();
+			list->Data.resize(offset + size);
+			memcpy(list->Data.data() + offset, data, size);
+			Record({ NullCommand::Update, buffer, 0, 0, 0, offset, size });
+		}
+
+		void DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) override {
+			Record({ NullCommand::Draw, nullptr, indexCount, startIndex, baseVertex, 0, 0 });
+		}
+
+		void Clear(const float /*color*/[4]) override {
+			Record({ NullCommand::Clear, nullptr, 0, 0, 0, 0, 0 });
+		}
+
+		unique_ptr<RenderCommandList> FinishCommandList() override {
+			if (!deferred) return nullptr;
+			unique_ptr<RenderCommandList> result(list.release());
+			list.reset(new NullCommandList());
+			return result;
+		}
+
+		void ExecuteCommandList(RenderCommandList* commandList) override;
+
+		// deferred context 跟 D3D11 的 WRITE_DISCARD 一樣拿到一塊新的記憶體
+		// Unmap 時複製進指令清單, 執行到這個指令才寫進 buffer
+		void* Map(RenderBuffer* buffer) override {
+			NullBuffer* b = static_cast<NullBuffer*>(buffer);
+			if (!deferred) return b->Data.data();
+			staging.resize(b->Data.size());
+			return staging.data();
+		}
+
+		void Unmap(RenderBuffer* buffer) override {
+			if (!deferred) {
+				Record({ NullCommand::Unmap, buffer, 0, 0, 0, 0, 0 });
+				return;
+			}
+			size_t offset = list->Data.size();
+			list->Data.insert(list->Data.end(), staging.begin(), staging.end());
+			Record({ NullCommand::Unmap, buffer, 0, 0, 0, offset, staging.size() });
+		}
+
+	private:
+		void Record(const NullCommand& command);
+
+	private:
+		NullRenderDevice* device;
+		bool deferred;
+		unique_ptr<NullCommandList> list;
+		vector<uint8_t> staging;	// deferred context Map 出去的記憶體
+	};
+
+	class NullRenderDevice : public RenderDevice {
+
+	public:
+		NullRenderDevice()
+			: immediate(this, false) {
+		}
+
+		unique_ptr<RenderBuffer> CreateBuffer(BufferType type, size_t size, const void* initData) override {
+			return unique_ptr<RenderBuffer>(new NullBuffer(type, size, initData));
+		}
+
+		unique_ptr<RenderTexture> CreateTexture(uint32_t width, uint32_t height, const void* /*rgba*/) override {
+			return unique_ptr<RenderTexture>(new NullTexture(width, height));
+		}
+
+		unique_ptr<RenderShader> CreateShader(
+			const void* /*vertexCode*/, size_t /*vertexLength*/,
+			const void* /*pixelCode*/, size_t /*pixelLength*/,
+			const VertexElement* /*elements*/, size_t /*elementCount*/) override {
+			return unique_ptr<RenderShader>(new NullShader());
+		}
+
+		RenderContext* Immediate() override {
+			return &immediate;
+		}
+
+		unique_ptr<RenderContext> CreateDeferredContext() override {
+			return unique_ptr<RenderContext>(new NullContext(this, true));
+		}
+
+		bool SupportsConstantOffsets() const override {
+			return ConstantOffsets;
+		}
+
+		void Present(bool /*allowTearing*/) override {
+			Stats.Presents++;
+		}
+
+		// 只有 immediate context 會呼叫, 也就是只在送出的那條執行緒上執行
+		void Execute(const NullCommand& command, const uint8_t* data) {
+			switch (command.Type) {
+			case NullCommand::Shader:
+			case NullCommand::VertexBuffer:
+			case NullCommand::IndexBuffer:
+			case NullCommand::ConstantBuffer:
+			case NullCommand::ConstantRange:
+			case NullCommand::Texture:
+				Stats.StateChanges++;
+				break;
+			case NullCommand::Update:
+			{
+				NullBuffer* buffer = static_cast<NullBuffer*>(command.Object);
+				size_t size = command.DataSize < buffer->Data.size() ? command.DataSize : buffer->Data.size();
+				memcpy(buffer->Data.data(), data + command.DataOffset, size);
+				Stats.BufferUpdates++;
+				Stats.BytesUploaded += command.DataSize;
+				Hash(data + command.DataOffset, command.DataSize);
+			}
+			break;
+			case NullCommand::Unmap:
+			{
+				// 整個 buffer 在 Unmap 時才算上傳, deferred context 寫的內容在這裡才放進 buffer
+				NullBuffer* buffer = static_cast<NullBuffer*>(command.Object);
+				if (command.DataSize) memcpy(buffer->Data.data(), data + command.DataOffset, command.DataSize < buffer->Data.size() ? command.DataSize : buffer->Data.size());
+				Stats.BufferUpdates++;
+				Stats.BytesUploaded += buffer->Data.size();
+				Hash(buffer->Data.data(), buffer->Data.size());
+			}
+			break;
+			case NullCommand::Draw:
+				Stats.Draws++;
+				Stats.Indices += command.A;
+				break;
+			case NullCommand::Clear:
+				break;
+			}
+			Hash(&command.Type, sizeof(command.Type));
+			Hash(&command.A, sizeof(command.A));
+			Hash(&command.B, sizeof(command.B));
+			Hash(&command.C, sizeof(command.C));
+		}
+
+		NullDeviceStats Stats;
+		// 關掉時 FramePipeline 會改回每個 draw 一次 UpdateBuffer
+		bool ConstantOffsets = true;
+
+	private:
+		void Hash(const void* data, size_t size) {
+			const uint8_t* p = (const uint8_t*)data;
+			for (size_t i = 0; i < size; i++) {
+				Stats.StreamHash ^= p[i];
+				Stats.StreamHash *= 1099511628211ull;
+			}
+		}
+
+	private:
+		NullContext immediate;
+	};
+
+	inline void NullContext::Record(const NullCommand& command) {
+		if (deferred) {
+			list->Commands.push_back(command);
+		} else {
+			device->Execute(command, list->Data.data());
+			list->Data.clear();
+		}
+	}
+
+	inline void NullContext::ExecuteCommandList(RenderCommandList* commandList) {
+		if (deferred || commandList == nullptr) return;
+		NullCommandList* l = static_cast<NullCommandList*>(commandList);
+		for (const auto& c : l->Commands) {
+			device->Execute(c, l->Data.data());
+		}
+		device->Stats.CommandLists++;
+	}
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// 用法:
+//   PROFILE_SCOPE("Render");    記錄這個區塊花的時間
+//   PROFILE_FRAME();            在時間軸上標記一幀的開始
+// 結束時用 Profiler::Instance().WriteChromeTrace() 輸出, 可以直接拖進 chrome://tracing 或 Perfetto
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) MyGame::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_FRAME() MyGame::Profiler::Instance().Mark("Frame")
+#define PROFILE_THREAD(name) MyGame::Profiler::Instance().SetThreadName(name)
+
+namespace MyGame {
+
+	struct ProfileEvent {
+		const char* Name;	// 必須是字串常數, 不會複製
+		int64_t Begin;		// Profiler::Now 的原始 tick
+		int64_t End;		// 小於 0 表示是一個標記
+	};
+
+	// 每條執行緒自己一塊環狀緩衝區, 只有擁有者會寫入, 不需要鎖
+	// 寫滿之後覆蓋最舊的事件
+	class ProfileThreadBuffer {
+
+	public:
+		static const size_t Capacity = 1 << 16;
+
+		ProfileThreadBuffer(int id)
+			: Id(id), events(new ProfileEvent[Capacity]) {
+		}
+
+		void Push(const char* name, int64_t begin, int64_t end) {
+			uint64_t n = written.load(memory_order_relaxed);
+			ProfileEvent& e = events[n & (Capacity - 1)];
+			e.Name = name;
+			e.Begin = begin;
+			e.End = end;
+			written.store(n + 1, memory_order_release);
+		}
+
+		template<typename Function>
+		void ForEach(Function&& func) const {
+			uint64_t n = written.load(memory_order_acquire);
+			uint64_t first = n > Capacity ? n - Capacity : 0;
+			for (uint64_t i = first; i < n; i++) {
+				func(events[i & (Capacity - 1)]);
+			}
+		}
+
+		const int Id;
+		const char* Name = nullptr;
+
+	private:
+		unique_ptr<ProfileEvent[]> events;
+		atomic<uint64_t> written{ 0 };
+	};
+
+	class Profiler {
+
+	public:
+		static Profiler& Instance() {
+			static Profiler profiler;
+			return profiler;
+		}
+
+		// 熱路徑只讀 CPU 的 time stamp counter, 比 steady_clock (QPC / clock_gettime) 便宜得多
+		// 換算成微秒留到輸出時, 用建構到輸出之間 steady_clock 經過的時間校正; 需要 invariant TSC (2008 年之後的 x86 都有)
+		// 不是 x86 的平台讀 steady_clock 的原始 tick
+		static int64_t Now() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			return (int64_t)__rdtsc();
+#else
+			return chrono::steady_clock::now().time_since_epoch().count();
+#endif
+		}
+
+		// 第一次呼叫時才向 Profiler 登記, 之後都只是讀 thread_local
+		ProfileThreadBuffer& ThreadBuffer() {
+			static thread_local ProfileThreadBuffer* buffer = nullptr;
+			if (buffer == nullptr) {
+				lock_guard<mutex> lock(mtx);
+				buffers.emplace_back(new ProfileThreadBuffer((int)buffers.size() + 1));
+				buffer = buffers.back().get();
+			}
+			return *buffer;
+		}
+
+		void SetThreadName(const char* name) {
+			ThreadBuffer().Name = name;
+		}
+
+		void Mark(const char* name) {
+			int64_t now = Now();
+			ThreadBuffer().Push(name, now, -1);
+		}
+
+		// 輸出 Trace Event Format, 應該在其他執行緒都停下來之後呼叫
+		void WriteChromeTrace(FILE* stream) {
+			lock_guard<mutex> lock(mtx);
+			const double toMicroseconds = MicrosecondsPerTick();
+			bool first = true;
+			fprintf(stream, "{\"traceEvents\":[\n");
+			for (auto& b : buffers) {
+				if (b->Name) {
+					fprintf(stream, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+						first ? "" : ",\n", b->Id, b->Name);
+					first = false;
+				}
+				b->ForEach([&](const ProfileEvent& e) {
+					if (e.End < 0) {
+						fprintf(stream, "%s{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+							first ? "" : ",\n", e.Name, (e.Begin - start) * toMicroseconds, b->Id);
+					} else {
+						fprintf(stream, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+							first ? "" : ",\n", e.Name, (e.Begin - start) * toMicroseconds, (e.End - e.Begin) * toMicroseconds, b->Id);
+					}
+					first = false;
+				});
+			}
+			fprintf(stream, "\n],\"displayTimeUnit\":\"ms\"}\n");
+		}
+
+		// 原始 tick 換算成微秒的比例
+		double MicrosecondsPerTick() const {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			int64_t ticks = Now() - start;
+			double microseconds = chrono::duration<double, micro>(chrono::steady_clock::now() - startTime).count();
+			return ticks > 0 ? microseconds / ticks : 0.0;
+#else
+			return 1000000.0 * chrono::steady_clock::period::num / chrono::steady_clock::period::den;
+#endif
+		}
+
+	private:
+		Profiler() : start(Now()), startTime(chrono::steady_clock::now()) {}
+
+		int64_t start;
+		chrono::steady_clock::time_point startTime;
+		mutex mtx;
+		vector<unique_ptr<ProfileThreadBuffer>> buffers;
+	};
+
+	class ProfileZone {
+
+	public:
+		explicit ProfileZone(const char* name)
+			: buffer(Profiler::Instance().ThreadBuffer()), name(name), begin(Profiler::Now()) {
+		}
+
+		~ProfileZone() {
+			buffer.Push(name, begin, Profiler::Now());
+		}
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		ProfileThreadBuffer& buffer;
+		const char* name;
+		int64_t begin;
+	};
+}
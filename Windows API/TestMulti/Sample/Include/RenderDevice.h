@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace MyGame {
+
+	// DirectXPanel 的每一幀只透過這一層跟繪圖裝置溝通
+	// D3D11RenderDevice 是實際的 Direct3D 11, NullRenderDevice 只記錄呼叫, 不需要 GPU 也能在 Linux 上跑
+
+	enum class BufferType {
+		Vertex,
+		Index,
+		Constant,
+		DynamicConstant,	// 每幀由 CPU Map 寫入, 以 SetConstantBufferRange 分段綁定; 在哪個 context 用就在哪個 context Map
+	};
+
+	enum class VertexFormat {
+		Float2,
+		Float3,
+		Float4,
+	};
+
+	struct VertexElement {
+		const char* Semantic;
+		VertexFormat Format;
+		uint32_t Offset;
+	};
+
+	class RenderBuffer {
+	public:
+		virtual ~RenderBuffer() = default;
+	};
+
+	class RenderTexture {
+	public:
+		virtual ~RenderTexture() = default;
+	};
+
+	// 頂點著色器 + 像素著色器 + 輸入配置
+	class RenderShader {
+	public:
+		virtual ~RenderShader() = default;
+	};
+
+	class RenderCommandList {
+	public:
+		virtual ~RenderCommandList() = default;
+	};
+
+	// Immediate 或 Deferred context, 一個 context 同時只能給一條執行緒用
+	class RenderContext {
+	public:
+		virtual ~RenderContext() = default;
+
+		virtual void SetShader(RenderShader* shader) = 0;
+		virtual void SetVertexBuffer(RenderBuffer* buffer, uint32_t stride) = 0;
+		virtual void SetIndexBuffer(RenderBuffer* buffer) = 0;
+		virtual void SetConstantBuffer(uint32_t slot, RenderBuffer* buffer) = 0;
+		// 只綁定 buffer 的一段, offset 必須是 256 的倍數 (D3D11.1 以上, 見 RenderDevice::SupportsConstantOffsets)
+		virtual void SetConstantBufferRange(uint32_t slot, RenderBuffer* buffer, size_t offset, size_t size) = 0;
+		virtual void SetTexture(uint32_t slot, RenderTexture* texture) = 0;
+		virtual void UpdateBuffer(RenderBuffer* buffer, const void* data, size_t size) = 0;
+		virtual void DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) = 0;
+
+		// 清除目前的 render target 與 depth buffer
+		virtual void Clear(const float color[4]) = 0;
+
+		// 只有 deferred context 可以用
+		virtual unique_ptr<RenderCommandList> FinishCommandList() = 0;
+		// 只有 immediate context 可以用
+		virtual void ExecuteCommandList(RenderCommandList* commandList) = 0;
+		// DynamicConstant 整個 buffer 以 discard 方式對應, 失敗回傳 nullptr
+		// deferred context 也可以用 (D3D11 規定 DYNAMIC buffer 在 deferred context 裡使用前要先在同一個 context WRITE_DISCARD)
+		// 寫入的內容在執行指令清單的 Unmap 時才生效, 每個指令清單都要重新 Map 一次
+		virtual void* Map(RenderBuffer* buffer) = 0;
+		virtual void Unmap(RenderBuffer* buffer) = 0;
+	};
+
+	class RenderDevice {
+	public:
+		virtual ~RenderDevice() = default;
+
+		virtual unique_ptr<RenderBuffer> CreateBuffer(BufferType type, size_t size, const void* initData) = 0;
+		virtual unique_ptr<RenderTexture> CreateTexture(uint32_t width, uint32_t height, const void* rgba) = 0;
+		virtual unique_ptr<RenderShader> CreateShader(
+			const void* vertexCode, size_t vertexLength,
+			const void* pixelCode, size_t pixelLength,
+			const VertexElement* elements, size_t elementCount) = 0;
+
+		virtual RenderContext* Immediate() = 0;
+		virtual unique_ptr<RenderContext> CreateDeferredContext() = 0;
+
+		// 是否可以用 SetConstantBufferRange
+		virtual bool SupportsConstantOffsets() const = 0;
+
+		virtual void Present(bool allowTearing) = 0;
+	};
+}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace MyGame {
+
+	// Shaders.pak 的格式 (little-endian):
+	//   ShaderArchiveHeader
+	//   ShaderArchiveEntry[TableSize]   以名稱雜湊做開放定址, NameHash == 0 代表空格
+	//   資料區, 每個 blob 對齊 Alignment, 內容相同的 blob 只存一份; 名稱也存在這裡 (不含結尾的 0)
+	// 雜湊相同但名稱不同的項目會放在同一條探測序列上, Find 會比對名稱
+	struct ShaderArchiveHeader {
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t EntryCount;
+		uint32_t TableSize;		// 2 的次方
+	};
+
+	struct ShaderArchiveEntry {
+		uint64_t NameHash;
+		uint64_t ContentHash;
+		uint32_t Offset;		// 從檔案開頭算起
+		uint32_t Size;
+		uint32_t NameOffset;	// 從檔案開頭算起
+		uint32_t NameLength;
+	};
+
+	static_assert(sizeof(ShaderArchiveHeader) == 16, "ShaderArchiveHeader layout");
+	static_assert(sizeof(ShaderArchiveEntry) == 32, "ShaderArchiveEntry layout");
+
+	struct ShaderBlob {
+		const uint8_t* Code = nullptr;
+		size_t Length = 0;
+	};
+
+	class ShaderArchiveFormat {
+	public:
+		static const uint32_t Magic = 0x4B415053;	// "SPAK"
+		static const uint32_t Version = 2;
+		static const uint32_t Alignment = 16;
+
+		// FNV-1a, 0 保留給空格
+		static uint64_t Hash(const void* data, size_t size) {
+			const uint8_t* p = (const uint8_t*)data;
+			uint64_t h = 14695981039346656037ull;
+			for (size_t i = 0; i < size; i++) {
+				h ^= p[i];
+				h *= 1099511628211ull;
+			}
+			return h ? h : 1;
+		}
+
+		static uint64_t HashName(const char* name) {
+			return Hash(name, strlen(name));
+		}
+	};
+
+	// 執行時讀取, 整個檔案只對應一次, Find 回傳的指標指向對應的記憶體
+	class ShaderArchive {
+
+	public:
+		template<typename Char>
+		bool Open(const Char* path) {
+			header = nullptr;
+			table = nullptr;
+			if (!file.Open(path)) return false;
+			if (!Validate()) {
+				file.Close();
+				return false;
+			}
+			return true;
+		}
+
+		bool IsOpen() const {
+			return header != nullptr;
+		}
+
+		uint32_t Count() const {
+			return header ? header->EntryCount : 0;
+		}
+
+		bool Find(const char* name, ShaderBlob& blob) const {
+			const ShaderArchiveEntry* entry = FindEntry(name);
+			if (entry == nullptr) return false;
+			blob.Code = file.Data() + entry->Offset;
+			blob.Length = entry->Size;
+			return true;
+		}
+
+		// 檢查每個 blob 的內容雜湊, 只在除錯時需要
+		bool Verify() const {
+			if (!header) return false;
+			for (uint32_t i = 0; i < header->TableSize; i++) {
+				const ShaderArchiveEntry& e = table[i];
+				if (e.NameHash == 0) continue;
+				if (ShaderArchiveFormat::Hash(file.Data() + e.Offset, e.Size) != e.ContentHash) return false;
+			}
+			return true;
+		}
+
+	private:
+		bool Validate() {
+			size_t size = file.Size();
+			if (size < sizeof(ShaderArchiveHeader)) return false;
+			const ShaderArchiveHeader* h = (const ShaderArchiveHeader*)file.Data();
+			if (h->Magic != ShaderArchiveFormat::Magic || h->Version != ShaderArchiveFormat::Version) return false;
+			if (h->TableSize == 0 || (h->TableSize & (h->TableSize - 1)) != 0 || h->EntryCount >= h->TableSize) return false;
+			if ((size - sizeof(ShaderArchiveHeader)) / sizeof(ShaderArchiveEntry) < h->TableSize) return false;
+
+			// 實際佔用的格數必須跟 EntryCount 相同, 才保證表格裡有空格
+			const ShaderArchiveEntry* t = (const ShaderArchiveEntry*)(file.Data() + sizeof(ShaderArchiveHeader));
+			uint32_t used = 0;
+			for (uint32_t i = 0; i < h->TableSize; i++) {
+				if (t[i].NameHash == 0) continue;
+				if (t[i].Offset > size || t[i].Size > size - t[i].Offset) return false;
+				if (t[i].NameOffset > size || t[i].NameLength > size - t[i].NameOffset) return false;
+				used++;
+			}
+			if (used != h->EntryCount) return false;
+			header = h;
+			table = t;
+			return true;
+		}
+
+		const ShaderArchiveEntry* FindEntry(const char* name) const {
+			if (!header) return nullptr;
+			uint64_t nameHash = ShaderArchiveFormat::HashName(name);
+			size_t length = strlen(name);
+			uint32_t mask = header->TableSize - 1;
+			uint32_t i = (uint32_t)nameHash & mask;
+			// Validate 已經確認有空格, 這裡仍然最多只看 TableSize 格
+			for (uint32_t probe = 0; probe < header->TableSize; probe++, i = (i + 1) & mask) {
+				const ShaderArchiveEntry& e = table[i];
+				if (e.NameHash == 0) return nullptr;
+				if (e.NameHash == nameHash && e.NameLength == length && memcmp(file.Data() + e.NameOffset, name, length) == 0) return &e;
+			}
+			return nullptr;
+		}
+
+	private:
+		DirectX::MappedFile file;
+		const ShaderArchiveHeader* header = nullptr;
+		const ShaderArchiveEntry* table = nullptr;
+	};
+
+	// 建置時打包用, 見 ShaderPack/ShaderPack.cpp
+	class ShaderArchiveWriter {
+
+	public:
+		// 名稱重複時回傳 false; 雜湊相撞但名稱不同沒有關係
+		bool Add(const string& name, const void* data, size_t size) {
+			uint64_t nameHash = ShaderArchiveFormat::HashName(name.c_str());
+			for (const auto& e : entries) {
+				if (e.NameHash == nameHash && e.Name == name) return false;
+			}
+			Pending e;
+			e.Name = name;
+			e.NameHash = nameHash;
+			e.Data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+			e.ContentHash = ShaderArchiveFormat::Hash(e.Data.data(), e.Data.size());
+			entries.push_back(move(e));
+			return true;
+		}
+
+		// 實際存了幾個不同的 blob
+		size_t UniqueBlobs() const {
+			return uniqueBlobs;
+		}
+
+		vector<uint8_t> Build() {
+			uint32_t tableSize = 1;
+			while (tableSize < entries.size() * 2 + 1) tableSize <<= 1;
+
+			vector<ShaderArchiveEntry> table(tableSize);
+			memset(table.data(), 0, table.size() * sizeof(ShaderArchiveEntry));
+
+			vector<uint8_t> out(sizeof(ShaderArchiveHeader) + tableSize * sizeof(ShaderArchiveEntry));
+			vector<size_t> offsets(entries.size());
+			uniqueBlobs = 0;
+			for (size_t i = 0; i < entries.size(); i++) {
+				// 不同名稱但內容相同 (例如同一份 shader 的不同 permutation 編出一樣的結果) 就共用
+				size_t same = i;
+				for (size_t j = 0; j < i; j++) {
+					if (entries[j].ContentHash == entries[i].ContentHash && entries[j].Data == entries[i].Data) {
+						same = j;
+						break;
+					}
+				}
+				if (same != i) {
+					offsets[i] = offsets[same];
+					continue;
+				}
+				size_t offset = (out.size() + ShaderArchiveFormat::Alignment - 1) & ~(size_t)(ShaderArchiveFormat::Alignment - 1);
+				out.resize(offset + entries[i].Data.size());
+				memcpy(out.data() + offset, entries[i].Data.data(), entries[i].Data.size());
+				offsets[i] = offset;
+				uniqueBlobs++;
+			}
+
+			vector<size_t> nameOffsets(entries.size());
+			for (size_t i = 0; i < entries.size(); i++) {
+				nameOffsets[i] = out.size();
+				out.insert(out.end(), entries[i].Name.begin(), entries[i].Name.end());
+			}
+
+			for (size_t i = 0; i < entries.size(); i++) {
+				uint32_t mask = tableSize - 1;
+				uint32_t slot = (uint32_t)entries[i].NameHash & mask;
+				while (table[slot].NameHash != 0) slot = (slot + 1) & mask;
+				table[slot].NameHash = entries[i].NameHash;
+				table[slot].ContentHash = entries[i].ContentHash;
+				table[slot].Offset = (uint32_t)offsets[i];
+				table[slot].Size = (uint32_t)entries[i].Data.size();
+				table[slot].NameOffset = (uint32_t)nameOffsets[i];
+				table[slot].NameLength = (uint32_t)entries[i].Name.size();
+			}
+
+			ShaderArchiveHeader header = { ShaderArchiveFormat::Magic, ShaderArchiveFormat::Version, (uint32_t)entries.size(), tableSize };
+			memcpy(out.data(), &header, sizeof(header));
+			memcpy(out.data() + sizeof(header), table.data(), table.size() * sizeof(ShaderArchiveEntry));
+			return out;
+		}
+
+	private:
+		struct Pending {
+			string Name;
+			uint64_t NameHash;
+			uint64_t ContentHash;
+			vector<uint8_t> Data;
+		};
+
+		vector<Pending> entries;
+		size_t uniqueBlobs = 0;
+	};
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Profiler.h"
+
+namespace MyGame {
+
+	// 常駐的工作執行緒, 整個遊戲迴圈只建立一次, 每一幀用 Dispatch 喚醒
+	// 呼叫 Dispatch 的執行緒也會一起領工作, 所以 N 個工作只需要 N - 1 條 worker
+	class WorkerPool {
+
+	public:
+		WorkerPool() = default;
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		~WorkerPool() {
+			Stop();
+		}
+
+		void Start(size_t threadCount) {
+			Stop();
+			stopping = false;
+			threads.reserve(threadCount);
+			for (size_t i = 0; i < threadCount; i++) {
+				threads.emplace_back(&WorkerPool::WorkerMain, this);
+			}
+		}
+
+		void Stop() {
+			{
+				lock_guard<mutex> lock(mtx);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& t : threads) {
+				if (t.joinable()) t.join();
+			}
+			threads.clear();
+		}
+
+		size_t Count() const {
+			return threads.size();
+		}
+
+		// 執行 job(0) ~ job(jobCount - 1), 全部做完才返回
+		// 同一個 index 只會被一條執行緒拿到, 所以每個 index 可以安全地對應一個 DeferredContext
+		void Dispatch(int jobCount, const function<void(int)>& job) {
+			if (jobCount <= 0) return;
+
+			{
+				lock_guard<mutex> lock(mtx);
+				currentJob = &job;
+				totalJobs = jobCount;
+				pendingJobs = jobCount;
+				generation++;
+				cursor.store((unsigned long long)(unsigned int)generation << 32, memory_order_release);
+			}
+			wake.notify_all();
+
+			RunJobs(job, jobCount, (unsigned int)generation);
+
+			unique_lock<mutex> lock(mtx);
+			done.wait(lock, [this] { return pendingJobs == 0; });
+			currentJob = nullptr;
+		}
+
+	private:
+		void WorkerMain() {
+			PROFILE_THREAD("Worker");
+			unsigned long long seen = 0;
+			for (;;) {
+				const function<void(int)>* job;
+				int count;
+				unsigned int gen;
+				{
+					unique_lock<mutex> lock(mtx);
+					wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+					if (stopping) return;
+					seen = generation;
+					job = currentJob;
+					count = totalJobs;
+					gen = (unsigned int)generation;
+				}
+				if (job) RunJobs(*job, count, gen);
+			}
+		}
+
+		// cursor 高 32 位元是 generation, 低 32 位元是下一個工作的 index
+		// 醒得太晚的 worker 看到 generation 不同就直接離開, 不會拿到下一幀的工作
+		void RunJobs(const function<void(int)>& job, int count, unsigned int gen) {
+			int finished = 0;
+			unsigned long long value = cursor.load(memory_order_acquire);
+			for (;;) {
+				if ((unsigned int)(value >> 32) != gen) break;
+				int index = (int)(unsigned int)value;
+				if (index >= count) break;
+				if (!cursor.compare_exchange_weak(value, value + 1, memory_order_acq_rel)) continue;
+				job(index);
+				finished++;
+				value = cursor.load(memory_order_acquire);
+			}
+
+			if (finished) {
+				bool last;
+				{
+					lock_guard<mutex> lock(mtx);
+					pendingJobs -= finished;
+					last = pendingJobs == 0;
+				}
+				if (last) done.notify_one();
+			}
+		}
+
+	private:
+		vector<thread> threads;
+		mutex mtx;
+		condition_variable wake;
+		condition_variable done;
+		const function<void(int)>* currentJob = nullptr;
+		int totalJobs = 0;
+		int pendingJobs = 0;
+		atomic<unsigned long long> cursor{ 0 };
+		unsigned long long generation = 0;
+		bool stopping = false;
+	};
+}
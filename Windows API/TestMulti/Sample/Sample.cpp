@@ -15,8 +15,6 @@ HWND hWnd;
 HANDLE RenderThread;
 BOOL Exit;
 BOOL IsFocus;
-LARGE_INTEGER time;
-LARGE_INTEGER frequency;
 DirectXPanel helloworld;
 
 // 這個程式碼模組中所包含之函式的向前宣告: 
@@ -132,8 +130,6 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     switch (message)
     {
 	case WM_CREATE:
-		QueryPerformanceCounter(&time);
-		QueryPerformanceFrequency(&frequency);
 		break;
 	case WM_SIZE:
 		return FALSE;
@@ -154,6 +150,13 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 			case IDM_TEST:
 				helloworld.Test();
 				break;
+			case IDM_FIXEDSTEP:
+				if (helloworld.ToggleFixedStep()) {
+					CheckMenuItem(GetMenu(hWnd), IDM_FIXEDSTEP, MF_CHECKED);
+				} else {
+					CheckMenuItem(GetMenu(hWnd), IDM_FIXEDSTEP, MF_UNCHECKED);
+				}
+				break;
 			case IDM_TEARING:
 				if (helloworld.ToggleTearing()) {
 					CheckMenuItem(GetMenu(hWnd), IDM_TEARING, MF_UNCHECKED);
@@ -177,7 +180,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 				DestroyWindow(hWnd);
 				break;
 			default:
-				if (!PostThreadMessage(GetThreadId(RenderThread), message, wParam, lParam))
+				if (!helloworld.PostInput(message, wParam, lParam))
 				{
 					OutputDebugString(TEXT("Post Message Failed\n"));
 				}
@@ -185,19 +188,19 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 		}
 		break;
 	case WM_CHAR:
-		if (!PostThreadMessage(GetThreadId(RenderThread), message, wParam, lParam))
+		if (!helloworld.PostInput(message, wParam, lParam))
 		{
 			OutputDebugString(TEXT("Post Message Failed\n"));
 		}
 		break;
 	case WM_MOUSEWHEEL:
-		if (!PostThreadMessage(GetThreadId(RenderThread), message, wParam, lParam)) {
+		if (!helloworld.PostInput(message, wParam, lParam)) {
 			OutputDebugString(TEXT("Post Message Failed\n"));
 		}
 		break;
 	case WM_LBUTTONDOWN:
 	case WM_RBUTTONDOWN:
-		if (!PostThreadMessage(GetThreadId(RenderThread), message, wParam, lParam)) {
+		if (!helloworld.PostInput(message, wParam, lParam)) {
 			OutputDebugString(TEXT("Post Message Failed\n"));
 		} else {
 			OutputDebugString(TEXT("Button up down\n"));
@@ -206,16 +209,8 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 	case WM_MOUSEMOVE:
 		if ((wParam & MK_LBUTTON) && IsFocus)
 		{
-			LARGE_INTEGER now;
-			QueryPerformanceCounter(&now);
-			__int64 ElapsedCount = (now.QuadPart - time.QuadPart);
-			double Elapsed = ElapsedCount * 1000.0 / frequency.QuadPart;
-			if (Elapsed > 16.0f) { // 如果輸入頻率超過60FPS就忽略
-				if (!PostThreadMessage(GetThreadId(RenderThread), message, wParam, lParam)) {
-					OutputDebugString(TEXT("Post Message Failed\n"));
-				}
-				time = now;
-			}
+			// 連續的移動會在 render thread 合併, 不需要在這裡丟掉
+			helloworld.PostInput(message, wParam, lParam);
 		}
 		break;
 	case WM_KILLFOCUS:
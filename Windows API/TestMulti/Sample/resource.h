@@ -17,6 +17,7 @@
 #define IDM_SAVEIMAGE                   32774
 #define IDM_TEARING                     32776
 #define IDM_TEST                        32779
+#define IDM_FIXEDSTEP                   32780
 #define IDC_STATIC                      -1
 
 // Next default values for new objects
@@ -25,7 +26,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NO_MFC                     1
 #define _APS_NEXT_RESOURCE_VALUE        134
-#define _APS_NEXT_COMMAND_VALUE         32780
+#define _APS_NEXT_COMMAND_VALUE         32781
 #define _APS_NEXT_CONTROL_VALUE         1000
 #define _APS_NEXT_SYMED_VALUE           111
 #endif
@@ -0,0 +1,74 @@
+// 把編譯好的 .cso 打包成一個 Shaders.pak, 執行時由 ShaderArchive 對應整個檔案讀取
+//
+//   g++ -std=c++14 -O2 -I../Sample/Include -I../../DirectXTK/Inc ShaderPack.cpp -o shaderpack
+//   cl /EHsc /O2 /I..\Sample\Include /I..\..\DirectXTK\Inc ShaderPack.cpp
+//
+//   shaderpack Shaders.pak VertexShader.cso PixelShader.cso ...
+//
+// 每個 blob 以檔名 (不含路徑) 為鍵, 例如 "VertexShader.cso"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "ShaderArchive.h"
+
+using namespace MyGame;
+
+static bool ReadWholeFile(const char* path, vector<uint8_t>& data) {
+	FILE* stream = fopen(path, "rb");
+	if (stream == nullptr) return false;
+	bool ok = fseek(stream, 0, SEEK_END) == 0;
+	long length = ok ? ftell(stream) : -1;
+	ok = length >= 0 && fseek(stream, 0, SEEK_SET) == 0;
+	if (ok) {
+		data.resize((size_t)length);
+		ok = fread(data.data(), 1, data.size(), stream) == data.size();
+	}
+	fclose(stream);
+	return ok;
+}
+
+static string BaseName(const string& path) {
+	size_t slash = path.find_last_of("/\\");
+	return slash == string::npos ? path : path.substr(slash + 1);
+}
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s output.pak input.cso...\n", argv[0]);
+		return 2;
+	}
+
+	ShaderArchiveWriter writer;
+	for (int i = 2; i < argc; i++) {
+		vector<uint8_t> data;
+		if (!ReadWholeFile(argv[i], data)) {
+			fprintf(stderr, "cannot read %s\n", argv[i]);
+			return 1;
+		}
+		string name = BaseName(argv[i]);
+		if (!writer.Add(name, data.data(), data.size())) {
+			fprintf(stderr, "duplicate name %s\n", name.c_str());
+			return 1;
+		}
+	}
+
+	vector<uint8_t> archive = writer.Build();
+	FILE* out = fopen(argv[1], "wb");
+	if (out == nullptr || fwrite(archive.data(), 1, archive.size(), out) != archive.size()) {
+		fprintf(stderr, "cannot write %s\n", argv[1]);
+		if (out) fclose(out);
+		return 1;
+	}
+	fclose(out);
+
+	printf("%s: %d shaders, %zu unique blobs, %zu bytes\n", argv[1], argc - 2, writer.UniqueBlobs(), archive.size());
+	return 0;
+}